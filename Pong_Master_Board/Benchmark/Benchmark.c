@@ -0,0 +1,359 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  On-Board Benchmarks for PONG.
+ *  ----------------------------------------
+ *  File Name     : Benchmark.c
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Benchmarks that replay the drawing and game workload on the board and
+ *  	print the results to the debugger console.
+ *  	The cache refill counts are only meaningful once the MMU and the L1
+ *  	data cache have been enabled, otherwise they read zero.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Benchmark.h"														// Invoking the main header file.
+#include "../Game_Engine/Game_Engine.h"										// Importing the game's ball and paddle drawing functions.
+#include "../Graphics_Engine/Graphics_Engine.h"								// Importing the graphics engine library.
+#include "../Graphics_Pipeline/Graphics_Pipeline.h"							// Importing the frame buffer pipeline.
+#include "../HPS_Timer/HPS_Timer.h"											// Importing the time stamp counter.
+#include "../HPS_Watchdog/HPS_Watchdog.h"									// Importing the watchdog timer library.
+#include "../DE1SoC_Link/DE1SoC_Link.h"										// Importing the link from the slave board.
+#include <stdio.h>															// Importing printf() for the debugger console.
+
+/* Cortex-A9 performance monitor registers. */
+register unsigned int PMU_PMCR       __asm("cp15:0:c9:c12:0");				// Control.
+register unsigned int PMU_PMCNTENSET __asm("cp15:0:c9:c12:1");				// Counter enable.
+register unsigned int PMU_PMSELR     __asm("cp15:0:c9:c12:5");				// Event counter select.
+register unsigned int PMU_PMXEVTYPER __asm("cp15:0:c9:c13:1");				// Event type of the selected counter.
+register unsigned int PMU_PMXEVCNTR  __asm("cp15:0:c9:c13:2");				// Value of the selected counter.
+
+/* Event number of L1 data cache refills. */
+#define PMU_EVENT_DCACHE_REFILL 0x03
+
+/* Start values of the current measurement. */
+unsigned int benchmark_start_ticks = 0;
+unsigned int benchmark_start_refills = 0;
+bool benchmark_pmu_ready = false;
+
+/* Internal function to read the L1 data cache refill counter. */
+unsigned int Benchmark_readRefills ( void )
+{
+	if ( !benchmark_pmu_ready )
+	{
+		HPS_Timer_startTimestamp();
+		PMU_PMCR = PMU_PMCR | 0x3;											// Enable the counters and reset the event counters.
+		PMU_PMSELR = 0;
+		PMU_PMXEVTYPER = PMU_EVENT_DCACHE_REFILL;							// Event counter 0 counts data cache refills.
+		PMU_PMCNTENSET = 0x1;
+		benchmark_pmu_ready = true;
+	}
+
+	PMU_PMSELR = 0;
+	return PMU_PMXEVCNTR;
+}
+
+/* Function to start measuring a section of code. */
+void Benchmark_start ( void )
+{
+	benchmark_start_refills = Benchmark_readRefills();
+	benchmark_start_ticks = HPS_Timer_timestamp();
+}
+
+/* Function to stop measuring. Returns the time and refills since Benchmark_start(). */
+void Benchmark_stop ( Benchmark_Result *result )
+{
+	unsigned int ticks = HPS_Timer_timestamp();
+	unsigned int refills = Benchmark_readRefills();
+
+	result->ticks = ticks - benchmark_start_ticks;
+	result->cache_refills = refills - benchmark_start_refills;
+}
+
+/* Internal function to draw the frames of a rally: the ball moves diagonally and bounces off the walls,
+   and both paddles follow it, erased and redrawn the way Game_Render and Paddle_Draw do it. */
+void Benchmark_drawRally ( unsigned int frames, Benchmark_Result *render, Benchmark_Result *flush )
+{
+	Benchmark_Result result;
+	unsigned int frame;
+	unsigned int ball_x = 120;
+	unsigned int ball_y = 160;
+	unsigned int last_ball_x = 120;
+	unsigned int last_ball_y = 160;
+	signed int step_x = 1;
+	signed int step_y = 2;
+	unsigned int paddle_x;
+	unsigned int last_paddle_x = PADDLE_1_START_X_1;
+
+	render->ticks = 0; render->cache_refills = 0;
+	flush->ticks = 0; flush->cache_refills = 0;
+
+	for ( frame = 0; frame < frames; frame++ )
+	{
+		if ( ball_x + step_x < 12 || ball_x + step_x > 225 ) step_x = -step_x;
+		if ( ball_y + step_y < 12 || ball_y + step_y > 305 ) step_y = -step_y;
+		ball_x = ball_x + step_x;
+		ball_y = ball_y + step_y;
+		paddle_x = MIN ( MAX ( ball_x, MINIMUM_PADDLE_X + ( PADDLE_LENGTH / 2 ) ), MAXIMUM_PADDLE_X - ( PADDLE_LENGTH / 2 ) ) - ( PADDLE_LENGTH / 2 );
+
+		Benchmark_start();
+
+		Graphics_Erase ( last_ball_x, last_ball_y, last_ball_x+3, last_ball_y+3, GAME_BACKGROUND_GREY );
+		Graphics_drawDash ( 11, 160, 229, 160, LT24_WHITE );
+		Graphics_drawBall ( ball_x, ball_y, ball_x+3, ball_y+3, LT24_RED );
+
+		Graphics_drawBox ( last_paddle_x, PADDLE_1_START_Y_1, last_paddle_x + PADDLE_LENGTH, PADDLE_1_START_Y_2, LT24_BLACK, false, LT24_BLACK );
+		Graphics_drawBox ( paddle_x, PADDLE_1_START_Y_1, paddle_x + PADDLE_LENGTH, PADDLE_1_START_Y_2, LT24_WHITE, false, LT24_WHITE );
+		Graphics_drawBox ( last_paddle_x, PADDLE_2_START_Y_1, last_paddle_x + PADDLE_LENGTH, PADDLE_2_START_Y_2, LT24_BLACK, false, LT24_BLACK );
+		Graphics_drawBox ( paddle_x, PADDLE_2_START_Y_1, paddle_x + PADDLE_LENGTH, PADDLE_2_START_Y_2, LT24_WHITE, false, LT24_WHITE );
+
+		Benchmark_stop ( &result );
+		render->ticks += result.ticks;
+		render->cache_refills += result.cache_refills;
+
+		/* The swap copies the dirty tiles into the new back buffer, then the flush streams them to the LT24. */
+		Benchmark_start();
+		Graphics_present();
+		Graphics_Pipeline_finish();
+		Benchmark_stop ( &result );
+		flush->ticks += result.ticks;
+		flush->cache_refills += result.cache_refills;
+
+		last_ball_x = ball_x;
+		last_ball_y = ball_y;
+		last_paddle_x = paddle_x;
+		HPS_ResetWatchdog();
+	}
+}
+
+/* Internal function to print the cost of one object draw in nanoseconds (the time stamp runs at 200MHz). */
+void Benchmark_printPerObject ( const char *name, Benchmark_Result *result, unsigned int iterations )
+{
+	printf ( "  %-22s %5u ns %4u refills per object\n", name,
+			 ( result->ticks * ( 1000 / HPS_TIMER_TICKS_PER_US ) ) / iterations, result->cache_refills / iterations );
+}
+
+/* Function to compare the unrolled ball and paddle fills with the generic fill paths. The pipeline must be enabled. */
+signed int Benchmark_blitters ( unsigned int iterations )
+{
+	Benchmark_Result result;
+	unsigned int previous_layout = Graphics_Pipeline_getLayout();
+	unsigned int count;
+	unsigned int x;
+	signed int status;
+
+	if ( iterations == 0 ) return BENCHMARK_SUCCESS;
+
+	status = Graphics_Pipeline_setLayout ( GP_LAYOUT_LINEAR, GAME_BACKGROUND_GREY );	// The unrolled fills need the linear layout.
+	if ( status != GP_SUCCESS ) return status;
+
+	printf ( "Ball and paddle fills, %u objects each:\n", iterations );
+
+	/* The objects walk across the court so that they do not stay in the same cache lines. */
+	Benchmark_start();
+	for ( count = 0; count < iterations; count++ ) { x = 11 + ( count % 200 ); Graphics_fillBox ( x, 100, x + BALL_SIZE - 1, 100 + BALL_SIZE - 1, LT24_WHITE ); }
+	Benchmark_stop ( &result );
+	Benchmark_printPerObject ( "ball, generic fill", &result, iterations );
+
+	Benchmark_start();
+	for ( count = 0; count < iterations; count++ ) { x = 11 + ( count % 200 ); Ball_Fill ( x, 100, LT24_WHITE ); }
+	Benchmark_stop ( &result );
+	Benchmark_printPerObject ( "ball, unrolled fill", &result, iterations );
+	HPS_ResetWatchdog();
+
+	Benchmark_start();
+	for ( count = 0; count < iterations; count++ ) { x = 11 + ( count % 178 ); Graphics_drawBox ( x, PADDLE_2_START_Y_1, x + PADDLE_LENGTH, PADDLE_2_START_Y_2, LT24_WHITE, false, LT24_WHITE ); }
+	Benchmark_stop ( &result );
+	Benchmark_printPerObject ( "paddle, generic box", &result, iterations );
+
+	Benchmark_start();
+	for ( count = 0; count < iterations; count++ ) { x = 11 + ( count % 178 ); Paddle_Fill ( x, PADDLE_2_START_Y_1, LT24_WHITE ); }
+	Benchmark_stop ( &result );
+	Benchmark_printPerObject ( "paddle, unrolled fill", &result, iterations );
+	HPS_ResetWatchdog();
+
+	/* A paddle that moved one pixel: erase and redraw it whole, or only the column it left and the column it moved onto. */
+	Benchmark_start();
+	for ( count = 0; count < iterations; count++ ) { x = 11 + ( count % 178 ); Paddle_Fill ( x, PADDLE_2_START_Y_1, LT24_BLACK ); Paddle_Fill ( x + 1, PADDLE_2_START_Y_1, LT24_WHITE ); }
+	Benchmark_stop ( &result );
+	Benchmark_printPerObject ( "paddle 1 pixel move, redrawn", &result, iterations );
+
+	Benchmark_start();
+	for ( count = 0; count < iterations; count++ ) { x = 11 + ( count % 178 ); Paddle_Strip ( x, PADDLE_2_START_Y_1, 1, LT24_BLACK ); Paddle_Strip ( x + PADDLE_DRAWN_LENGTH, PADDLE_2_START_Y_1, 1, LT24_WHITE ); }
+	Benchmark_stop ( &result );
+	Benchmark_printPerObject ( "paddle 1 pixel move, strips", &result, iterations );
+	HPS_ResetWatchdog();
+
+	return Graphics_Pipeline_setLayout ( previous_layout, LT24_BLACK );
+}
+
+/* Function to compare the linear and tiled frame buffer layouts on the game's drawing workload. The pipeline must be enabled. */
+signed int Benchmark_framebufferLayouts ( unsigned int frames )
+{
+	static const char *layout_names[2] = { "linear", "tiled " };
+	Benchmark_Result render;
+	Benchmark_Result flush;
+	unsigned int previous_layout = Graphics_Pipeline_getLayout();
+	unsigned int layout;
+	signed int status;
+
+	if ( frames == 0 ) return BENCHMARK_SUCCESS;
+
+	printf ( "Frame buffer layouts, %u frames of a rally:\n", frames );
+
+	for ( layout = GP_LAYOUT_LINEAR; layout <= GP_LAYOUT_TILED; layout++ )
+	{
+		status = Graphics_Pipeline_setLayout ( layout, GAME_BACKGROUND_GREY );
+		if ( status != GP_SUCCESS ) return status;
+		Graphics_present();
+		Graphics_Pipeline_finish();											// Start from a clean screen with nothing left to flush.
+
+		Benchmark_drawRally ( frames, &render, &flush );
+
+		printf ( "  %s: render %u us %u refills, swap+flush %u us %u refills per frame\n", layout_names[layout],
+				 render.ticks / frames / HPS_TIMER_TICKS_PER_US, render.cache_refills / frames,
+				 flush.ticks / frames / HPS_TIMER_TICKS_PER_US, flush.cache_refills / frames );
+	}
+
+	return Graphics_Pipeline_setLayout ( previous_layout, LT24_BLACK );
+}
+
+/* Function to measure a frame of the game with more and more balls in play: the ticks of one frame, Game_Render()
+   and the swap and flush. The game must be initialised and the pipeline enabled, the game is restarted afterwards. */
+signed int Benchmark_multiBall ( unsigned int frames )
+{
+	static const unsigned int ball_counts[4] = { 1, 8, 16, 32 };
+	Benchmark_Result tick;
+	Benchmark_Result render;
+	Benchmark_Result flush;
+	Benchmark_Result result;
+	unsigned int previous_count = Game_getBallCount();
+	unsigned int frame_ticks;
+	unsigned int count;
+	unsigned int frame;
+	unsigned int step;
+	signed int status;
+
+	if ( frames == 0 ) return BENCHMARK_SUCCESS;
+
+	printf ( "Multi-ball frames, %u frames of %u ticks:\n", frames, BENCHMARK_TICKS_PER_FRAME );
+
+	for ( count = 0; count < 4; count++ )
+	{
+		status = Game_setBallCount ( ball_counts[count] );
+		if ( status != GAME_SUCCESS ) return status;
+		Game_Restart();
+
+		tick.ticks = tick.cache_refills = 0;
+		render.ticks = render.cache_refills = 0;
+		flush.ticks = flush.cache_refills = 0;
+
+		for ( frame = 0; frame < frames; frame++ )
+		{
+			Benchmark_start();
+			for ( step = 0; step < BENCHMARK_TICKS_PER_FRAME; step++ ) Game_Tick();
+			Benchmark_stop ( &result );
+			tick.ticks += result.ticks; tick.cache_refills += result.cache_refills;
+
+			Benchmark_start();
+			Game_Render ( GAME_ALPHA_ONE );
+			Benchmark_stop ( &result );
+			render.ticks += result.ticks; render.cache_refills += result.cache_refills;
+
+			Benchmark_start();
+			Graphics_present();
+			Graphics_Pipeline_finish();
+			Benchmark_stop ( &result );
+			flush.ticks += result.ticks; flush.cache_refills += result.cache_refills;
+
+			if ( Game_isOver() ) Game_Restart();						// Keep the balls moving for every frame.
+			HPS_ResetWatchdog();
+		}
+
+		frame_ticks = ( tick.ticks + render.ticks + flush.ticks ) / frames;
+		printf ( "  %2u balls: tick %u us %u refills, render %u us %u refills, swap+flush %u us, %u fps\n", ball_counts[count],
+				 tick.ticks / frames / HPS_TIMER_TICKS_PER_US, tick.cache_refills / frames,
+				 render.ticks / frames / HPS_TIMER_TICKS_PER_US, render.cache_refills / frames,
+				 flush.ticks / frames / HPS_TIMER_TICKS_PER_US,
+				 frame_ticks ? ( 1000000 * HPS_TIMER_TICKS_PER_US ) / frame_ticks : 0 );
+	}
+
+	Game_setBallCount ( previous_count );
+	return Game_Restart();
+}
+
+/* Function to measure the bulk mode of the link: the words per second received from the slave board, the share of
+   blocks dropped for a bad CRC or missed, and the words that got through wrong. */
+signed int Benchmark_link ( unsigned int blocks )
+{
+	static Link link;
+	static unsigned int words [LINK_TEST_WORDS];
+	Benchmark_Result result;
+	Link_Stats stats;
+	unsigned int received = 0;
+	unsigned int wrong = 0;
+	unsigned int first_block = 0;
+	unsigned int last_block = 0;
+	unsigned int count;
+	unsigned int index;
+	unsigned int waited;
+	unsigned long long words_per_second;
+	
+	if ( blocks == 0 ) return BENCHMARK_SUCCESS;
+	
+	HPS_Timer_startTimestamp();												// The time-out needs the time stamp counter running.
+	Link_initialise ( &link, LINK_PORT_BASE, &link_control, LINK_RECEIVER );
+	Link_setBulkBuffer ( &link, words, LINK_TEST_WORDS );
+	
+	waited = HPS_Timer_timestamp();
+	while ( received < blocks )
+	{
+		Link_poll ( &link, 64 );
+		count = Link_receiveBulk ( &link );
+		HPS_ResetWatchdog();
+		
+		if ( count == 0 )
+		{
+			if ( HPS_Timer_timestamp() - waited > BENCHMARK_LINK_TIMEOUT_US * HPS_TIMER_TICKS_PER_US )
+			{
+				printf ( "Link bulk mode: no test blocks from the slave board.\n" );
+				return BENCHMARK_SUCCESS;
+			}
+			continue;
+		}
+		waited = HPS_Timer_timestamp();
+		
+		/* Time from the end of the first block, so a block already under way does not count. */
+		if ( received == 0 )
+		{
+			Benchmark_start();
+			Link_getStats ( &link, &stats );
+			first_block = words[0];
+		}
+		else
+		{
+			for ( index = 0; index < count; index++ )
+			{
+				if ( words[index] != Link_testWord ( words[0], index ) ) wrong++;
+			}
+			if ( count != LINK_TEST_WORDS ) wrong++;
+		}
+		last_block = words[0];
+		received++;
+	}
+	Benchmark_stop ( &result );
+	
+	count = stats.bulk_errors;
+	Link_getStats ( &link, &stats );
+	words_per_second = (unsigned long long)( received - 1 ) * LINK_TEST_WORDS * 1000000 * HPS_TIMER_TICKS_PER_US / ( result.ticks ? result.ticks : 1 );
+	printf ( "Link bulk mode, %u blocks of %u words: %llu words/s, %u dropped for CRC and %u missed of %u sent, %u words wrong\n",
+			 received - 1, LINK_TEST_WORDS, words_per_second, stats.bulk_errors - count,
+			 ( last_block - first_block ) - ( received - 1 ), last_block - first_block, wrong );
+	
+	return BENCHMARK_SUCCESS;
+}
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  On-Board Benchmarks for PONG.
+ *  ----------------------------------------
+ *  File Name     : Benchmark.h
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Benchmarks that replay the drawing and game workload on the board and
+ *  	print the results to the debugger console. They are run from main()
+ *  	when RUN_BENCHMARKS is defined. Time is measured with the A9 global
+ *  	timer and L1 data cache refills with the Cortex-A9 performance
+ *  	monitor unit.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+
+/* Error Codes*/
+#define BENCHMARK_SUCCESS       0
+
+/* Time the link benchmark waits for a block before giving up on the slave board, in microseconds. */
+#define BENCHMARK_LINK_TIMEOUT_US 1000000
+
+/* Game ticks run for each frame of the multi-ball benchmark, about one 60Hz frame. */
+#define BENCHMARK_TICKS_PER_FRAME 4
+
+/* Results of one benchmark run. */
+typedef struct {
+	unsigned int ticks;														// HPS_Timer_timestamp() ticks.
+	unsigned int cache_refills;												// L1 data cache refills.
+} Benchmark_Result;
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Functions to measure a section of code. Benchmark_stop() returns the time and refills since Benchmark_start(). */
+void Benchmark_start ( void );
+void Benchmark_stop ( Benchmark_Result *result );
+
+/* Function to compare the linear and tiled frame buffer layouts on the game's drawing workload. The pipeline must be enabled. */
+signed int Benchmark_framebufferLayouts ( unsigned int frames );
+
+/* Function to compare the unrolled ball and paddle fills with the generic fill paths. The pipeline must be enabled. */
+signed int Benchmark_blitters ( unsigned int iterations );
+
+/* Function to measure the game frame with 1, 8, 16 and 32 balls in play. The game must be initialised and the pipeline enabled. */
+signed int Benchmark_multiBall ( unsigned int frames );
+
+/* Function to measure the bulk mode of the link from the slave board, which must be sending test blocks. Takes the
+   parallel port until it returns: open the game's end of the link afterwards. */
+signed int Benchmark_link ( unsigned int blocks );
+
+#endif /* BENCHMARK_H_ */
@@ -448,7 +448,7 @@ signed int LT24_copyFrameBuffer(const unsigned short* framebuffer, unsigned int
     if (status != LT24_SUCCESS) return status;
     //And Copy
     cnt = (height * width); //How many pixels.
-    while (--cnt) {
+    while (cnt--) {
         LT24_write(true, *framebuffer++);
     }
     //Done
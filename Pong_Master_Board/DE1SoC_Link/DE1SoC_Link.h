@@ -0,0 +1,249 @@
+/*
+ * DE1-SoC Board-to-Board Link Driver
+ * ------------------------------
+ * Description:
+ * Packet protocol between the slave and the master board over the
+ * JP2 parallel port (GPIO 1), which is wired pin for pin between
+ * the two boards.
+ *
+ * On the control channel the slave sends and the master receives.
+ * A byte is put on the eight
+ * data lines, then the strobe line is toggled. The master reads the
+ * port twice, takes the byte only if both reads agree and the strobe
+ * differs from its acknowledge line, then toggles the acknowledge
+ * line to match. The slave only changes the data once the
+ * acknowledge matches its strobe, so a byte can never be read half
+ * updated.
+ *
+ * Bytes are grouped into packets:
+ *   0x7E, type, sequence, length, payload[length], CRC high, CRC low
+ * The CRC-16 (CCITT, initial value 0xFFFF) covers the type to the
+ * end of the payload. A packet with a bad CRC is dropped and the
+ * receiver waits for the next 0x7E. The sequence number counts
+ * packets, so the receiver can count the ones that were lost.
+ *
+ * Blocks of words, such as game state snapshots, go in bulk mode.
+ * A LINK_MSG_BULK packet gives the number of words, then the block
+ * follows three bytes per beat on all 24 lines D8-D31, with the
+ * strobe toggled in the same store as the data. The last beat holds
+ * the CRC-16 of the block. A receiver that missed the BULK packet
+ * takes the beats as bytes and throws them away while it hunts for
+ * the next packet, so the two ends never lose step.
+ *
+ * The same protocol runs the other way, from the master to the
+ * slave, on the mirror channel: its strobe, acknowledge and three
+ * data lines sit in the spare lines D3-D7, so a byte goes as three
+ * symbols of three bits, lowest first. Both channels share the port,
+ * each end only ever changes its own lines. A receiver that was
+ * started in the middle of a byte hunts in the wrong place; after
+ * LINK_SLIP_BYTES bytes without a good packet it drops a symbol and
+ * tries the next alignment.
+ *
+ * Link_poll() moves the handshake on and must be called often by
+ * both boards. An end on the port can also raise the interrupt of
+ * the port when the other end changes its line, and be polled from
+ * the handler instead of busy-polling.
+ *
+ * Company: University of Leeds
+ * Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *
+ */
+
+#ifndef DE1SoC_LINK_H_
+#define DE1SoC_LINK_H_
+
+#include <stdbool.h>
+
+//Error Codes
+#define LINK_SUCCESS         0
+#define LINK_BUSY           -1
+#define LINK_INVALIDLENGTH  -4
+#define LINK_NOBULK         -5
+#define LINK_NOPORT         -6
+
+//Address of the JP2 parallel port. The direction, interrupt mask and edge capture registers are the next words.
+#define LINK_PORT_BASE 0xFF200070
+
+//Barrier between filling a queue entry and moving its index on, as the other side may be an interrupt handler
+#ifdef __ARMCC_VERSION
+#define LINK_BARRIER() __dmb(0xF)
+#else
+#define LINK_BARRIER() __sync_synchronize()
+#endif
+
+//Lines of the port. Bit 0 is left alone: it carries the camera PWM on the slave board.
+//Control channel, slave to master
+#define LINK_ACK        (1u << 1)     //Master to slave
+#define LINK_STROBE     (1u << 2)     //Slave to master
+#define LINK_DATA_SHIFT 8
+#define LINK_DATA       (0xFFu << LINK_DATA_SHIFT)
+#define LINK_BULK_DATA  (0xFFFFFFu << LINK_DATA_SHIFT)   //Whole bytes per beat, D3-D7 are the mirror channel
+//Mirror channel, master to slave
+#define LINK_MIRROR_STROBE     (1u << 3)                 //Master to slave
+#define LINK_MIRROR_ACK        (1u << 4)                 //Slave to master
+#define LINK_MIRROR_DATA_SHIFT 5
+#define LINK_MIRROR_DATA_BITS  3
+
+//Ends of a channel
+#define LINK_SENDER   true            //Drives the strobe and the data lines
+#define LINK_RECEIVER false           //Drives the acknowledge line
+
+//Types of packet
+#define LINK_MSG_PADDLE 1             //Camera position of paddle 1, one byte. The slave is playing.
+#define LINK_MSG_MODE   2             //One byte: 0 the slave is stopped, 1 it is playing.
+#define LINK_MSG_TOUCH  3             //The touch screen was tapped, no payload.
+#define LINK_MSG_BULK   4             //Two bytes, low first: words in the bulk block that follows.
+#define LINK_MSG_MIRROR 5             //Master to slave: state of the game, see Game_Mirror.h.
+
+//Framing
+#define LINK_SYNC        0x7E
+#define LINK_MAX_PAYLOAD 32
+#define LINK_OVERHEAD    6            //Sync, type, sequence, length and the two CRC bytes
+#define LINK_MAX_BULK    65535        //Words in a bulk block
+#define LINK_SLIP_BYTES  (2 * (LINK_MAX_PAYLOAD + LINK_OVERHEAD))   //Bytes without a good packet before a symbol is dropped
+
+//Queues: bytes waiting to be sent (a power of two) and packets waiting to be read
+#define LINK_TX_BYTES   128
+#define LINK_RX_PACKETS 8
+
+//Lines of a channel
+typedef struct {
+    unsigned int strobe;              //Sender to receiver
+    unsigned int ack;                 //Receiver to sender
+    unsigned int data_shift;          //Lowest data line
+    unsigned int data_bits;           //Data lines, 1 to 8. A byte takes as many symbols as it needs.
+    unsigned int bulk;                //Lines of a bulk beat from data_shift up, 0 if the channel has no bulk mode
+} Link_Channel;
+
+//The two channels of the port
+extern const Link_Channel link_control;   //Slave to master: D1, D2 and D8-D31
+extern const Link_Channel link_mirror;    //Master to slave: D3-D7
+
+//A packet
+typedef struct {
+    unsigned char type;
+    unsigned char sequence;
+    unsigned char length;
+    unsigned char payload[LINK_MAX_PAYLOAD];
+} Link_Packet;
+
+//Counts kept by the receiver (bytes also by the sender)
+typedef struct {
+    unsigned int bytes;               //Bytes moved over the link
+    unsigned int packets;             //Packets received with a good CRC
+    unsigned int crc_errors;          //Packets dropped for a bad CRC or length
+    unsigned int lost;                //Packets missing from the sequence numbers
+    unsigned int overruns;            //Good packets and blocks dropped because nobody read them or they did not fit
+    unsigned int bulk_blocks;         //Bulk blocks received with a good CRC
+    unsigned int bulk_errors;         //Bulk blocks dropped for a bad CRC
+} Link_Stats;
+
+//One end of the link
+typedef struct {
+    volatile unsigned int* in;        //Register the lines of the other end are read from
+    volatile unsigned int* out;       //Register this end drives its lines through
+    volatile unsigned int* port;      //Parallel port, 0 for a loopback
+    const Link_Channel* channel;
+    bool sender;
+    unsigned int outputs;             //Lines driven by this end, the others on out are left as they are
+    unsigned int lines;               //Last value written to the outputs
+    unsigned int symbols;             //Symbols a byte takes
+    //Sender
+    unsigned char tx[LINK_TX_BYTES];
+    volatile unsigned int tx_head;    //Moved on by Link_send(), which may run outside the interrupt handler
+    volatile unsigned int tx_tail;
+    unsigned int tx_phase;
+    unsigned char tx_sequence;
+    unsigned int tx_symbol;           //Symbols of the byte being sent already taken
+    const unsigned int* tx_bulk;      //Block being sent, tx_bulk_beats data beats then the CRC beat
+    unsigned int tx_bulk_bytes;
+    unsigned int tx_bulk_beats;
+    unsigned int tx_bulk_beat;
+    unsigned int tx_bulk_start;       //The block starts once the queue has been sent up to here
+    bool tx_bulk_pending;
+    bool tx_bulk_active;
+    unsigned short tx_bulk_crc;
+    //Receiver
+    unsigned int rx_state;
+    unsigned int rx_byte;             //Symbols of the byte being received so far
+    unsigned int rx_symbol;
+    unsigned int rx_unsynced;         //Bytes since the last good packet
+    unsigned int rx_index;
+    unsigned short rx_crc;
+    unsigned short rx_crc_received;
+    Link_Packet rx_packet;
+    Link_Packet rx_queue[LINK_RX_PACKETS];
+    unsigned int rx_head;
+    unsigned int rx_tail;
+    bool rx_synced;                   //A packet has been received, rx_sequence is the next one expected
+    unsigned char rx_sequence;
+    unsigned int* rx_bulk;            //Buffer of bulk blocks
+    unsigned int rx_bulk_capacity;
+    unsigned int rx_bulk_bytes;       //Bytes of the block being received
+    unsigned int rx_bulk_index;
+    unsigned int rx_bulk_ready;       //Words of the last good block, 0 when it has been read
+    bool rx_bulk_active;
+    unsigned short rx_bulk_crc;
+    Link_Stats stats;
+} Link;
+
+//Initialise one end of a channel of the link on the parallel port at port_address
+// - Sets the direction of the lines of the channel only, the other lines are left as they are
+// - Returns LINK_SUCCESS if successful
+signed int Link_initialise(Link* link, unsigned int port_address, const Link_Channel* channel, bool sender);
+
+//Initialise one end of a channel on two plain words, for a loopback on a PC.
+// - in is the out word of the other end. Both channels can share the same two words.
+void Link_initialiseLoopback(Link* link, volatile unsigned int* in, volatile unsigned int* out, const Link_Channel* channel, bool sender);
+
+//Raise the interrupt of the port when the line driven by the other end changes: the strobe at a receiver, the
+//acknowledge at a sender. The port edge captures the line.
+// - The handler must call Link_acknowledgeInterrupt() then Link_poll()
+// - From then on only the handler may call the other functions, apart from Link_send() and Link_isIdle()
+// - Returns LINK_NOPORT for a loopback
+signed int Link_setInterrupt(Link* link, bool enable);
+
+//Clear the edges captured on the port, before polling from the interrupt handler
+void Link_acknowledgeInterrupt(Link* link);
+
+//Queue a packet to be sent. Sender only.
+// - Returns LINK_BUSY if there is no room for the whole packet, nothing is queued then
+// - Returns LINK_INVALIDLENGTH if the payload is longer than LINK_MAX_PAYLOAD
+signed int Link_send(Link* link, unsigned char type, const unsigned char* payload, unsigned int length);
+
+//Queue a bulk block of count words to be sent after the packets already queued. Sender only.
+// - The words are read while they are sent: leave them alone until Link_isIdle()
+// - Returns LINK_BUSY if a block is already being sent or its BULK packet does not fit
+// - Returns LINK_INVALIDLENGTH for 0 or more than LINK_MAX_BULK words
+// - Returns LINK_NOBULK on a channel without the bulk mode
+signed int Link_sendBulk(Link* link, const unsigned int* words, unsigned int count);
+
+//Check if everything queued has been sent. Sender only.
+bool Link_isIdle(Link* link);
+
+//Move the handshake on by up to polls steps. Returns the number of bytes moved.
+unsigned int Link_poll(Link* link, unsigned int polls);
+
+//Take the oldest packet received. Returns false if there is none. Receiver only.
+bool Link_receive(Link* link, Link_Packet* packet);
+
+//Give the receiver a buffer for bulk blocks of up to capacity words. Blocks are dropped without one.
+void Link_setBulkBuffer(Link* link, unsigned int* words, unsigned int capacity);
+
+//Check for a bulk block. Returns its number of words, in the buffer from the start, or 0 if none has arrived
+// since the last call. Read the block before polling again, the next one is received into the same buffer.
+unsigned int Link_receiveBulk(Link* link);
+
+//Test blocks for measuring the bulk mode: LINK_TEST_WORDS words, the first being the block number
+#define LINK_TEST_WORDS 256
+
+//Word index of test block number block, for checking the link from both ends
+unsigned int Link_testWord(unsigned int block, unsigned int index);
+
+//Read the counts of the link
+void Link_getStats(Link* link, Link_Stats* stats);
+
+//CRC-16 (CCITT) of a block of bytes, continuing from crc (0xFFFF to start)
+unsigned short Link_crc(unsigned short crc, const unsigned char* bytes, unsigned int length);
+
+#endif /* DE1SoC_LINK_H_ */
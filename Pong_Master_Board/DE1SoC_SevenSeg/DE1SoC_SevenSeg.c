@@ -0,0 +1,130 @@
+/*
+ * DE1-SoC Seven Segment Display Driver
+ * ------------------------------
+ * Description:
+ * Driver for the six seven segment displays HEX5-0 of the DE1-SoC.
+ *
+ * Company: University of Leeds
+ * Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *
+ */
+
+#include "DE1SoC_SevenSeg.h"
+
+//Registers: HEX3-0 and HEX5-4
+volatile unsigned int* const sevenseg_base_ptr [SEVENSEG_WORDS] = {
+    (unsigned int *)0xFF200020, (unsigned int *)0xFF200030
+};
+
+//Last values stored in the registers
+SevenSeg_Frame sevenseg_shadow = { { 0, 0 } };
+
+//Segments of the digits 0-9 and the letters A-Z (the lower case form where the upper case one cannot be shown)
+const unsigned char sevenseg_digits [10] = {
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x67
+};
+const unsigned char sevenseg_letters [26] = {
+    0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71, 0x6F, 0x76, 0x30, 0x1E, 0x75, 0x38, 0x37, //A b C d E F g H I J K L M
+    0x54, 0x5C, 0x73, 0x67, 0x50, 0x6D, 0x78, 0x3E, 0x1C, 0x2A, 0x76, 0x6E, 0x5B  //n o P q r S t U v W X y Z
+};
+
+//Put the segments of one display into a frame
+static void SevenSeg_set(SevenSeg_Frame *frame, unsigned int display, unsigned char segments) {
+    unsigned int shift = (display & 3) * 8;
+    frame->words[display >> 2] = (frame->words[display >> 2] & ~(0xFFu << shift)) | ((unsigned int)segments << shift);
+}
+
+//Blank all the displays and bring the shadow copy in line with them
+void SevenSeg_initialise(void) {
+    unsigned int word;
+    for (word = 0; word < SEVENSEG_WORDS; word++) {
+        *sevenseg_base_ptr[word] = 0;
+        sevenseg_shadow.words[word] = 0;
+    }
+}
+
+//Start a frame with every display blank
+void SevenSeg_frameClear(SevenSeg_Frame *frame) {
+    unsigned int word;
+    for (word = 0; word < SEVENSEG_WORDS; word++) frame->words[word] = 0;
+}
+
+//Put a pattern of segments on one display of a frame
+signed int SevenSeg_frameWrite(SevenSeg_Frame *frame, unsigned int display, unsigned char segments) {
+    if (display >= SEVENSEG_DISPLAYS) return SEVENSEG_INVALIDDISPLAY;
+    SevenSeg_set(frame, display, segments);
+    return SEVENSEG_SUCCESS;
+}
+
+//Put a decimal number right-aligned on digits displays of a frame, the lowest being display
+signed int SevenSeg_frameNumber(SevenSeg_Frame *frame, unsigned int display, unsigned int digits, unsigned int value) {
+    unsigned int limit = 1;
+    unsigned int digit;
+    if ((digits == 0) || (display + digits > SEVENSEG_DISPLAYS)) return SEVENSEG_INVALIDDISPLAY;
+    for (digit = 0; digit < digits; digit++) limit = limit * 10;
+    if (value >= limit) {
+        for (digit = 0; digit < digits; digit++) SevenSeg_set(frame, display + digit, SEVENSEG_DASH);
+        return SEVENSEG_OVERFLOW;
+    }
+    //Lowest digit first, always shown so that zero is "0"
+    for (digit = 0; digit < digits; digit++) {
+        SevenSeg_set(frame, display + digit, ((value != 0) || (digit == 0)) ? sevenseg_digits[value % 10] : SEVENSEG_BLANK);
+        value = value / 10;
+    }
+    return SEVENSEG_SUCCESS;
+}
+
+//Put text on a frame starting on display and going right, towards HEX0
+signed int SevenSeg_frameText(SevenSeg_Frame *frame, unsigned int display, const char *text) {
+    if (display >= SEVENSEG_DISPLAYS) return SEVENSEG_INVALIDDISPLAY;
+    while (*text != '\0') {
+        SevenSeg_set(frame, display, SevenSeg_glyph(*text++));
+        if (display == 0) break;
+        display--;
+    }
+    return (*text == '\0') ? SEVENSEG_SUCCESS : SEVENSEG_INVALIDDISPLAY;
+}
+
+//Show a frame, storing the registers that differ from the shadow copy, one 32bit store each
+void SevenSeg_show(const SevenSeg_Frame *frame) {
+    unsigned int word;
+    for (word = 0; word < SEVENSEG_WORDS; word++) {
+        if (frame->words[word] != sevenseg_shadow.words[word]) {
+            *sevenseg_base_ptr[word] = frame->words[word];
+            sevenseg_shadow.words[word] = frame->words[word];
+        }
+    }
+}
+
+//Light a pattern of segments on one display
+signed int SevenSeg_write(unsigned int display, unsigned char segments) {
+    SevenSeg_Frame frame = sevenseg_shadow;
+    signed int status = SevenSeg_frameWrite(&frame, display, segments);
+    SevenSeg_show(&frame);
+    return status;
+}
+
+//Show a decimal number right-aligned on digits displays, the lowest being display
+signed int SevenSeg_writeNumber(unsigned int display, unsigned int digits, unsigned int value) {
+    SevenSeg_Frame frame = sevenseg_shadow;
+    signed int status = SevenSeg_frameNumber(&frame, display, digits, value);
+    SevenSeg_show(&frame);
+    return status;
+}
+
+//Show text starting on display and going right, towards HEX0
+signed int SevenSeg_writeText(unsigned int display, const char *text) {
+    SevenSeg_Frame frame = sevenseg_shadow;
+    signed int status = SevenSeg_frameText(&frame, display, text);
+    SevenSeg_show(&frame);
+    return status;
+}
+
+//Segments that show a character
+unsigned char SevenSeg_glyph(char character) {
+    if ((character >= '0') && (character <= '9')) return sevenseg_digits[character - '0'];
+    if ((character >= 'A') && (character <= 'Z')) return sevenseg_letters[character - 'A'];
+    if ((character >= 'a') && (character <= 'z')) return sevenseg_letters[character - 'a'];
+    if (character == '-') return SEVENSEG_DASH;
+    return SEVENSEG_BLANK;
+}
@@ -0,0 +1,75 @@
+/*
+ * DE1-SoC Seven Segment Display Driver
+ * ------------------------------
+ * Description:
+ * Driver for the six seven segment displays HEX5-0 of the DE1-SoC.
+ *
+ * HEX3-0 are the four bytes of one 32bit register and HEX5-4 the
+ * low two bytes of another. The driver keeps a shadow copy of both
+ * words and stores a whole word, once, only when one of its digits
+ * has changed. Displays are numbered 0 (HEX0, on the right) to 5.
+ *
+ * Several numbers and texts can be laid out in a frame in memory and
+ * shown together with SevenSeg_show(), so that each word is built
+ * once and stored at most once for all of them.
+ *
+ * Company: University of Leeds
+ * Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *
+ */
+
+#ifndef DE1SoC_SEVENSEG_H_
+#define DE1SoC_SEVENSEG_H_
+
+//Error Codes
+#define SEVENSEG_SUCCESS         0
+#define SEVENSEG_INVALIDDISPLAY -2
+#define SEVENSEG_OVERFLOW       -4
+
+//Number of displays, and of register words they are in
+#define SEVENSEG_DISPLAYS 6
+#define SEVENSEG_WORDS    2
+
+//Segments of a display, bit 0 (a, top) to bit 6 (g, middle). A set bit lights the segment.
+#define SEVENSEG_BLANK 0x00
+#define SEVENSEG_DASH  0x40
+
+//The register words of all the displays, built in memory
+typedef struct {
+    unsigned int words [SEVENSEG_WORDS];
+} SevenSeg_Frame;
+
+//Blank all the displays and bring the shadow copy in line with them
+void SevenSeg_initialise(void);
+
+//Start a frame with every display blank
+void SevenSeg_frameClear(SevenSeg_Frame *frame);
+
+//Put a pattern of segments, a number or text into a frame, as SevenSeg_write(), SevenSeg_writeNumber() and
+//SevenSeg_writeText() do on the displays. Nothing is shown until SevenSeg_show().
+signed int SevenSeg_frameWrite(SevenSeg_Frame *frame, unsigned int display, unsigned char segments);
+signed int SevenSeg_frameNumber(SevenSeg_Frame *frame, unsigned int display, unsigned int digits, unsigned int value);
+signed int SevenSeg_frameText(SevenSeg_Frame *frame, unsigned int display, const char *text);
+
+//Show a frame on all the displays
+// - Only the register words that differ from the shadow copy are stored, one 32bit store each
+void SevenSeg_show(const SevenSeg_Frame *frame);
+
+//Light a pattern of segments on one display
+// - Returns SEVENSEG_SUCCESS if successful
+signed int SevenSeg_write(unsigned int display, unsigned char segments);
+
+//Show a decimal number right-aligned on digits displays, the lowest being display
+// - Unused leading digits are blank
+// - Returns SEVENSEG_OVERFLOW, and shows dashes, if the number does not fit
+signed int SevenSeg_writeNumber(unsigned int display, unsigned int digits, unsigned int value);
+
+//Show text starting on display and going right, towards HEX0
+// - Digits, letters, '-' and ' ' are shown, anything else is blank
+// - Returns SEVENSEG_INVALIDDISPLAY if the text does not fit
+signed int SevenSeg_writeText(unsigned int display, const char *text);
+
+//Segments that show a character
+unsigned char SevenSeg_glyph(char character);
+
+#endif /* DE1SoC_SEVENSEG_H_ */
@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Uniform Grid Broad Phase for PONG.
+ *  ----------------------------------------
+ *  File Name     : Collision_Grid.c
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	The grid is rebuilt every tick with a counting sort: the number of
+ *  	objects in each cell is counted, the counts are summed into the
+ *  	start of each cell's list, and the objects are written into one
+ *  	shared entry array. There is no allocation and no linked list, and
+ *  	the cost of a build grows with the number of objects only.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Collision_Grid.h"													// Invoking the main header file.
+
+/* The objects, one array per field. */
+signed short grid_x1 [GRID_MAX_OBJECTS];
+signed short grid_y1 [GRID_MAX_OBJECTS];
+signed short grid_x2 [GRID_MAX_OBJECTS];
+signed short grid_y2 [GRID_MAX_OBJECTS];
+unsigned char grid_type [GRID_MAX_OBJECTS];
+unsigned short grid_index [GRID_MAX_OBJECTS];
+unsigned int grid_query_mark [GRID_MAX_OBJECTS];							// Last query that found the object.
+unsigned int grid_objects = 0;
+unsigned int grid_entries = 0;
+
+/* The cell lists: the objects of cell c are grid_entry[grid_cell_start[c]] to grid_entry[grid_cell_start[c+1]-1]. */
+unsigned short grid_cell_start [GRID_CELLS + 1];
+unsigned short grid_entry [GRID_MAX_ENTRIES];
+
+/* Statistics and query marks. */
+unsigned int grid_tests = 0;
+unsigned int grid_query_count = 0;
+
+/* Internal functions to find the cell column and row of a pixel, clamped to the grid. */
+unsigned int Collision_Grid_column ( signed int x )
+{
+	x = ( x - GRID_ORIGIN_X ) >> GRID_CELL_SHIFT;
+	if ( x < 0 ) return 0;
+	if ( x >= GRID_CELLS_X ) return GRID_CELLS_X - 1;
+	return (unsigned int)x;
+}
+
+unsigned int Collision_Grid_row ( signed int y )
+{
+	y = ( y - GRID_ORIGIN_Y ) >> GRID_CELL_SHIFT;
+	if ( y < 0 ) return 0;
+	if ( y >= GRID_CELLS_Y ) return GRID_CELLS_Y - 1;
+	return (unsigned int)y;
+}
+
+/* Function to empty the grid before the objects of a tick are inserted. */
+void Collision_Grid_reset ( void )
+{
+	grid_objects = 0;
+	grid_entries = 0;
+}
+
+/* Function to add an object with the box (x1,y1)-(x2,y2), corners included. The index is the caller's number of the object. */
+signed int Collision_Grid_insert ( unsigned int type, unsigned int index, signed int x1, signed int y1, signed int x2, signed int y2 )
+{
+	unsigned int cells = ( Collision_Grid_column ( x2 ) - Collision_Grid_column ( x1 ) + 1 ) * ( Collision_Grid_row ( y2 ) - Collision_Grid_row ( y1 ) + 1 );
+
+	if ( grid_objects >= GRID_MAX_OBJECTS || grid_entries + cells > GRID_MAX_ENTRIES ) return GRID_FULL;
+
+	grid_x1[grid_objects] = (signed short)x1;
+	grid_y1[grid_objects] = (signed short)y1;
+	grid_x2[grid_objects] = (signed short)x2;
+	grid_y2[grid_objects] = (signed short)y2;
+	grid_type[grid_objects] = (unsigned char)type;
+	grid_index[grid_objects] = (unsigned short)index;
+	grid_query_mark[grid_objects] = 0;
+	grid_objects++;
+	grid_entries += cells;
+
+	return GRID_SUCCESS;
+}
+
+/* Function to sort the inserted objects into their cells. Must be called before the grid is searched. */
+void Collision_Grid_build ( void )
+{
+	unsigned int object;
+	unsigned int cell;
+	unsigned int column;
+	unsigned int row;
+	unsigned int first_column;
+	unsigned int last_column;
+	unsigned int last_row;
+	unsigned int start = 0;
+	unsigned int count;
+
+	for ( cell = 0; cell <= GRID_CELLS; cell++ ) grid_cell_start[cell] = 0;
+
+	/* Count the objects of every cell, one cell along. */
+	for ( object = 0; object < grid_objects; object++ )
+	{
+		first_column = Collision_Grid_column ( grid_x1[object] );
+		last_column = Collision_Grid_column ( grid_x2[object] );
+		last_row = Collision_Grid_row ( grid_y2[object] );
+		for ( row = Collision_Grid_row ( grid_y1[object] ); row <= last_row; row++ )
+		{
+			for ( column = first_column; column <= last_column; column++ ) grid_cell_start[row * GRID_CELLS_X + column + 1]++;
+		}
+	}
+
+	/* Turn the counts into the start of each list. */
+	for ( cell = 1; cell <= GRID_CELLS; cell++ )
+	{
+		count = grid_cell_start[cell];
+		grid_cell_start[cell] = start;
+		start += count;
+	}
+
+	/* Write the objects, moving each start along. At the end every start has moved into the next cell's place. */
+	for ( object = 0; object < grid_objects; object++ )
+	{
+		first_column = Collision_Grid_column ( grid_x1[object] );
+		last_column = Collision_Grid_column ( grid_x2[object] );
+		last_row = Collision_Grid_row ( grid_y2[object] );
+		for ( row = Collision_Grid_row ( grid_y1[object] ); row <= last_row; row++ )
+		{
+			for ( column = first_column; column <= last_column; column++ ) grid_entry[grid_cell_start[row * GRID_CELLS_X + column + 1]++] = object;
+		}
+	}
+}
+
+/* Internal function to check whether two objects overlap. */
+bool Collision_Grid_overlap ( unsigned int a, unsigned int b )
+{
+	return grid_x1[a] <= grid_x2[b] && grid_x1[b] <= grid_x2[a] && grid_y1[a] <= grid_y2[b] && grid_y1[b] <= grid_y2[a];
+}
+
+/* Function to find the pairs of overlapping objects, each pair once. Returns the number of pairs written, at most max_pairs. */
+unsigned int Collision_Grid_findPairs ( Collision_Grid_Pair *pairs, unsigned int max_pairs )
+{
+	unsigned int found = 0;
+	unsigned int cell;
+	unsigned int first;
+	unsigned int second;
+	unsigned int a;
+	unsigned int b;
+
+	grid_tests = 0;
+
+	for ( cell = 0; cell < GRID_CELLS; cell++ )
+	{
+		for ( first = grid_cell_start[cell]; first < grid_cell_start[cell + 1]; first++ )
+		{
+			a = grid_entry[first];
+			for ( second = first + 1; second < grid_cell_start[cell + 1]; second++ )
+			{
+				b = grid_entry[second];
+				if ( grid_type[a] != GRID_BALL && grid_type[b] != GRID_BALL ) continue;
+
+				grid_tests++;
+				if ( !Collision_Grid_overlap ( a, b ) ) continue;
+
+				/* Two objects can share several cells. The pair is only reported by the cell holding the top-left corner of their overlap. */
+				if ( Collision_Grid_row ( MAX ( grid_y1[a], grid_y1[b] ) ) * GRID_CELLS_X + Collision_Grid_column ( MAX ( grid_x1[a], grid_x1[b] ) ) != cell ) continue;
+
+				if ( found == max_pairs ) return found;
+				pairs[found].type_a = grid_type[a];
+				pairs[found].type_b = grid_type[b];
+				pairs[found].index_a = grid_index[a];
+				pairs[found].index_b = grid_index[b];
+				found++;
+			}
+		}
+	}
+
+	return found;
+}
+
+/* Function to find the objects of one type that overlap a box. Returns the number of indices written, at most max_results. */
+unsigned int Collision_Grid_query ( unsigned int type, signed int x1, signed int y1, signed int x2, signed int y2, unsigned short *results, unsigned int max_results )
+{
+	unsigned int found = 0;
+	unsigned int column;
+	unsigned int row;
+	unsigned int first_column = Collision_Grid_column ( x1 );
+	unsigned int last_column = Collision_Grid_column ( x2 );
+	unsigned int last_row = Collision_Grid_row ( y2 );
+	unsigned int entry;
+	unsigned int object;
+
+	grid_query_count++;														// Marks objects already found by this query.
+
+	for ( row = Collision_Grid_row ( y1 ); row <= last_row; row++ )
+	{
+		for ( column = first_column; column <= last_column; column++ )
+		{
+			for ( entry = grid_cell_start[row * GRID_CELLS_X + column]; entry < grid_cell_start[row * GRID_CELLS_X + column + 1]; entry++ )
+			{
+				object = grid_entry[entry];
+				if ( grid_type[object] != type || grid_query_mark[object] == grid_query_count ) continue;
+				grid_query_mark[object] = grid_query_count;
+
+				if ( grid_x1[object] > x2 || x1 > grid_x2[object] || grid_y1[object] > y2 || y1 > grid_y2[object] ) continue;
+
+				if ( found == max_results ) return found;
+				results[found++] = grid_index[object];
+			}
+		}
+	}
+
+	return found;
+}
+
+/* Function to read the number of box tests done by the last Collision_Grid_findPairs(). */
+unsigned int Collision_Grid_getTests ( void )
+{
+	return grid_tests;
+}
@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Uniform Grid Broad Phase for PONG.
+ *  ----------------------------------------
+ *  File Name     : Collision_Grid.h
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	The 220x300 playfield is split into square cells. Every tick the
+ *  	balls, paddles and obstacles are inserted as boxes, the grid is
+ *  	built as one list of objects per cell, and the exact box tests are
+ *  	only done for objects that share a cell. The grid does not touch
+ *  	any hardware, so it builds on a PC as well.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef COLLISION_GRID_H_
+#define COLLISION_GRID_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+#include "Min_Max.h"
+
+/* Error Codes*/
+#define GRID_SUCCESS       0
+#define GRID_FULL         -1
+
+/* The playfield covered by the grid, in pixels. Boxes outside it are clamped to the cells on its edge. */
+#define GRID_ORIGIN_X      10
+#define GRID_ORIGIN_Y      10
+#define GRID_WIDTH         220
+#define GRID_HEIGHT        300
+
+/* Cells of 16x16 pixels: 14 across and 19 down. */
+#define GRID_CELL_SHIFT    4
+#define GRID_CELL_SIZE     ( 1 << GRID_CELL_SHIFT )
+#define GRID_CELLS_X       ( ( GRID_WIDTH  + GRID_CELL_SIZE - 1 ) >> GRID_CELL_SHIFT )
+#define GRID_CELLS_Y       ( ( GRID_HEIGHT + GRID_CELL_SIZE - 1 ) >> GRID_CELL_SHIFT )
+#define GRID_CELLS         ( GRID_CELLS_X * GRID_CELLS_Y )
+
+/* Most objects in the grid, and most object-in-cell entries (an object covers every cell its box touches). */
+#define GRID_MAX_OBJECTS   1024
+#define GRID_MAX_ENTRIES   4096
+
+/* Kinds of object. Only pairs with at least one ball are reported, paddles and obstacles do not collide with each other. */
+#define GRID_BALL          0
+#define GRID_PADDLE        1
+#define GRID_OBSTACLE      2
+
+/* Two objects whose boxes overlap. The index is the one given to Collision_Grid_insert(). */
+typedef struct {
+	unsigned char type_a;
+	unsigned char type_b;
+	unsigned short index_a;
+	unsigned short index_b;
+} Collision_Grid_Pair;
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to empty the grid before the objects of a tick are inserted. */
+void Collision_Grid_reset ( void );
+
+/* Function to add an object with the box (x1,y1)-(x2,y2), corners included. The index is the caller's number of the object. */
+signed int Collision_Grid_insert ( unsigned int type, unsigned int index, signed int x1, signed int y1, signed int x2, signed int y2 );
+
+/* Function to sort the inserted objects into their cells. Must be called before the grid is searched. */
+void Collision_Grid_build ( void );
+
+/* Function to find the pairs of overlapping objects, each pair once. Returns the number of pairs written, at most max_pairs. */
+unsigned int Collision_Grid_findPairs ( Collision_Grid_Pair *pairs, unsigned int max_pairs );
+
+/* Function to find the objects of one type that overlap a box. Returns the number of indices written, at most max_results. */
+unsigned int Collision_Grid_query ( unsigned int type, signed int x1, signed int y1, signed int x2, signed int y2, unsigned short *results, unsigned int max_results );
+
+/* Function to read the number of box tests done by the last Collision_Grid_findPairs(). */
+unsigned int Collision_Grid_getTests ( void );
+
+#endif /* COLLISION_GRID_H_ */
@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Q16.16 Fixed-Point Arithmetic for PONG.
+ *  ----------------------------------------
+ *  File Name     : Fixed_Point.h
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Positions and velocities of the game are signed 32-bit numbers with
+ *  	16 integer bits and 16 fraction bits. Only integer instructions are
+ *  	used, so the game steps the same way on the board and on a PC.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef FIXED_POINT_H_
+#define FIXED_POINT_H_
+
+/* A Q16.16 number. */
+typedef signed int fixed;
+
+#define FIXED_SHIFT 16
+#define FIXED_ONE   ( 1 << FIXED_SHIFT )
+#define FIXED_HALF  ( 1 << ( FIXED_SHIFT - 1 ) )
+
+/* Conversions. FIXED_TO_INT rounds towards minus infinity. */
+#define INT_TO_FIXED(number)   ( (fixed)( number ) << FIXED_SHIFT )
+#define FIXED_TO_INT(number)   ( (signed int)( number ) >> FIXED_SHIFT )
+#define FIXED_ROUND(number)    ( ( (signed int)( number ) + FIXED_HALF ) >> FIXED_SHIFT )
+
+/* Product of two Q16.16 numbers, with a 64-bit intermediate. */
+#define FIXED_MUL(number_1, number_2) ( (fixed)( ( (signed long long)( number_1 ) * ( number_2 ) ) >> FIXED_SHIFT ) )
+
+/* Quotient of two Q16.16 numbers, with a 64-bit intermediate. */
+#define FIXED_DIV(number_1, number_2) ( (fixed)( ( (signed long long)( number_1 ) << FIXED_SHIFT ) / ( number_2 ) ) )
+
+#endif /* FIXED_POINT_H_ */
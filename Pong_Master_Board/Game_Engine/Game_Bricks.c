@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Brick Walls for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Bricks.c
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Layout of the bricks, the occupancy bitmap and the bounce of a ball
+ *  	off the bricks.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Game_Bricks.h"													// Invoking the main header file.
+
+/* Distance between the left edges of two columns and the top edges of two rows of bricks. */
+#define BRICK_PITCH_X           ( BRICK_LENGTH + BRICK_GAP )
+#define BRICK_PITCH_Y           ( BRICK_WIDTH + BRICK_GAP )
+
+/* The bitmap covers both walls and the gap between them, 256 pixels along x in 32-bit words. */
+#define BITMAP_TOP              BRICK_WALL_1_Y
+#define BITMAP_ROWS             ( BRICK_WALL_2_Y + BRICK_WALL_ROWS * BRICK_PITCH_Y - BITMAP_TOP )
+#define BITMAP_WORDS            8
+
+/* Mask of the BALL_SIZE pixels of a row of the ball's footprint. */
+#define BALL_ROW_MASK           ( ( 1u << BALL_SIZE ) - 1 )
+
+/* The occupancy bitmap, bit x & 31 of word x / 32 for pixel x of a row. */
+unsigned int brick_bitmap [BITMAP_ROWS][BITMAP_WORDS];
+
+/* Bricks painted into the bitmap. */
+unsigned int brick_bitmap_standing [BRICK_WORDS];
+
+/* Function to stand every brick of the brick mode, or none in the classic mode. */
+void Game_Bricks_build ( Game_State *state )
+{
+	unsigned int word;
+
+	for ( word = 0; word < BRICK_WORDS; word++ )
+	{
+		state->bricks[word] = 0;
+		if ( state->mode == GAME_MODE_BRICKS )
+		{
+			state->bricks[word] = ( word * 32 + 32 <= BRICK_COUNT ) ? 0xFFFFFFFFu : ( 1u << ( BRICK_COUNT % 32 ) ) - 1;
+		}
+	}
+}
+
+/* Function to return the top-left corner of a brick in pixels. */
+unsigned int Game_Bricks_x ( unsigned int brick )
+{
+	return BRICK_LEFT + ( brick % BRICK_COLUMNS ) * BRICK_PITCH_X;
+}
+
+unsigned int Game_Bricks_y ( unsigned int brick )
+{
+	unsigned int row = brick / BRICK_COLUMNS;
+
+	if ( row < BRICK_WALL_ROWS ) return BRICK_WALL_1_Y + row * BRICK_PITCH_Y;
+	return BRICK_WALL_2_Y + ( row - BRICK_WALL_ROWS ) * BRICK_PITCH_Y;
+}
+
+/* Function to return the brick under pixel (x,y), standing or not, or BRICK_NONE. */
+signed int Game_Bricks_at ( signed int x, signed int y )
+{
+	signed int column;
+	signed int row;
+
+	x = x - BRICK_LEFT;
+	if ( x < 0 || x >= BRICK_COLUMNS * BRICK_PITCH_X || x % BRICK_PITCH_X >= BRICK_LENGTH ) return BRICK_NONE;
+	column = x / BRICK_PITCH_X;
+
+	if ( y >= BRICK_WALL_2_Y ) { y = y - BRICK_WALL_2_Y; row = BRICK_WALL_ROWS; }
+	else { y = y - BRICK_WALL_1_Y; row = 0; }
+	if ( y < 0 || y >= BRICK_WALL_ROWS * BRICK_PITCH_Y || y % BRICK_PITCH_Y >= BRICK_WIDTH ) return BRICK_NONE;
+	row = row + y / BRICK_PITCH_Y;
+
+	return row * BRICK_COLUMNS + column;
+}
+
+/* Internal function to set or clear the pixels of a brick in the bitmap. A brick spans at most two words of a row. */
+void Bitmap_Paint ( unsigned int brick, bool standing )
+{
+	unsigned int x = Game_Bricks_x ( brick );
+	unsigned int top = Game_Bricks_y ( brick ) - BITMAP_TOP;
+	unsigned int word = x / 32;
+	unsigned int shift = x % 32;
+	unsigned int mask = ( ( 1u << BRICK_LENGTH ) - 1 ) << shift;
+	unsigned int spill = ( shift + BRICK_LENGTH > 32 ) ? ( ( 1u << BRICK_LENGTH ) - 1 ) >> ( 32 - shift ) : 0;	// Pixels in the next word.
+	unsigned int row;
+
+	for ( row = top; row < top + BRICK_WIDTH; row++ )
+	{
+		if ( standing ) { brick_bitmap[row][word] |= mask; if ( spill ) brick_bitmap[row][word + 1] |= spill; }
+		else { brick_bitmap[row][word] &= ~mask; if ( spill ) brick_bitmap[row][word + 1] &= ~spill; }
+	}
+
+	if ( standing ) brick_bitmap_standing[brick / 32] |= 1u << ( brick % 32 );
+	else brick_bitmap_standing[brick / 32] &= ~( 1u << ( brick % 32 ) );
+}
+
+/* Function to bring the bitmap up to date with the bricks standing in a state. */
+void Game_Bricks_sync ( const Game_State *state )
+{
+	unsigned int word;
+	unsigned int bit;
+	unsigned int changed;
+
+	for ( word = 0; word < BRICK_WORDS; word++ )
+	{
+		changed = state->bricks[word] ^ brick_bitmap_standing[word];
+		for ( bit = 0; changed != 0; bit++, changed >>= 1 )
+		{
+			if ( changed & 1 ) Bitmap_Paint ( word * 32 + bit, ( state->bricks[word] >> bit ) & 1 );
+		}
+	}
+}
+
+/* Function to check whether a ball with its top-left corner at pixel (x,y) overlaps a brick in the bitmap. */
+bool Game_Bricks_occupied ( signed int x, signed int y )
+{
+	unsigned int word = (unsigned int)x / 32;
+	unsigned int shift = (unsigned int)x % 32;
+	signed int row;
+	signed int last_row;
+	unsigned int bits;
+
+	row = MAX ( y - BITMAP_TOP, 0 );
+	last_row = MIN ( y - BITMAP_TOP + BALL_SIZE - 1, BITMAP_ROWS - 1 );
+	if ( row > last_row || x < 0 ) return false;							// Away from the walls.
+
+	for ( ; row <= last_row; row++ )
+	{
+		bits = brick_bitmap[row][word] >> shift;
+		if ( shift > 32 - BALL_SIZE ) bits |= brick_bitmap[row][word + 1] << ( 32 - shift );
+		if ( bits & BALL_ROW_MASK ) return true;
+	}
+
+	return false;
+}
+
+/* Internal function to break the standing bricks under the ball's footprint. */
+void Bricks_Break ( Game_State *state, signed int x, signed int y )
+{
+	signed int corners [4][2] = { { x, y }, { x + BALL_SIZE - 1, y }, { x, y + BALL_SIZE - 1 }, { x + BALL_SIZE - 1, y + BALL_SIZE - 1 } };
+	signed int brick;
+	unsigned int corner;
+
+	for ( corner = 0; corner < 4; corner++ )								// A brick is bigger than a ball, a corner of the ball is on every brick it touches.
+	{
+		brick = Game_Bricks_at ( corners[corner][0], corners[corner][1] );
+		if ( brick != BRICK_NONE && ( state->bricks[brick / 32] & ( 1u << ( brick % 32 ) ) ) )
+		{
+			state->bricks[brick / 32] &= ~( 1u << ( brick % 32 ) );
+			Bitmap_Paint ( brick, false );
+		}
+	}
+}
+
+/* Function to bounce a ball that moved from (previous_x,previous_y) to (*x,*y) off the bricks it ran into, and break them.
+   The ball is put back where it was along the axes it bounced on. Returns true if it hit a brick. */
+bool Game_Bricks_collide ( Game_State *state, unsigned int ball, fixed previous_x, fixed previous_y, fixed *x, fixed *y )
+{
+	signed int left = FIXED_ROUND ( *x );									// The pixels the ball is drawn on.
+	signed int top = FIXED_ROUND ( *y );
+	bool hit_x;
+	bool hit_y;
+
+	if ( !Game_Bricks_occupied ( left, top ) ) return false;
+
+	/* The axis the ball bounces on is the one it ran into a brick along. Into a corner it bounces on both. */
+	hit_x = Game_Bricks_occupied ( left, FIXED_ROUND ( previous_y ) );
+	hit_y = Game_Bricks_occupied ( FIXED_ROUND ( previous_x ), top );
+	if ( !hit_x && !hit_y ) { hit_x = true; hit_y = true; }
+
+	Bricks_Break ( state, left, top );
+
+	if ( hit_x ) { *x = previous_x; state->balls.direction_x[ball] = -state->balls.direction_x[ball]; }
+	if ( hit_y ) { *y = previous_y; state->balls.direction_y[ball] = -state->balls.direction_y[ball]; }
+
+	return true;
+}
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Brick Walls for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Bricks.h
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	The bricks of the brick mode. Which bricks stand is one bit per
+ *  	brick in the game state. To test a ball against all of them at once
+ *  	the standing bricks are also painted into a 1-bit-per-pixel bitmap
+ *  	of the two walls, and the ball's footprint is tested against it one
+ *  	32-pixel word per row: a ball away from the bricks costs a compare,
+ *  	a ball among them at most eight word loads, however many bricks
+ *  	there are. The bitmap belongs to no state and follows whichever
+ *  	state is stepped, only the bricks that differ are painted again, so
+ *  	snapshots and rollbacks only copy the bits. Like the collision grid
+ *  	it is scratch memory, only one step may run at a time.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAME_BRICKS_H_
+#define GAME_BRICKS_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+#include "Game_Simulation.h"
+
+/* Returned by Game_Bricks_at() for a pixel that is not on a brick. */
+#define BRICK_NONE              -1
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to stand every brick of the brick mode, or none in the classic mode. */
+void Game_Bricks_build ( Game_State *state );
+
+/* Function to return the top-left corner of a brick in pixels. */
+unsigned int Game_Bricks_x ( unsigned int brick );
+unsigned int Game_Bricks_y ( unsigned int brick );
+
+/* Function to return the brick under pixel (x,y), standing or not, or BRICK_NONE. */
+signed int Game_Bricks_at ( signed int x, signed int y );
+
+/* Function to bring the bitmap up to date with the bricks standing in a state. */
+void Game_Bricks_sync ( const Game_State *state );
+
+/* Function to check whether a ball with its top-left corner at pixel (x,y) overlaps a brick in the bitmap. */
+bool Game_Bricks_occupied ( signed int x, signed int y );
+
+/* Function to bounce a ball that moved from (previous_x,previous_y) to (*x,*y) off the bricks it ran into, and break them.
+   The ball is put back where it was along the axes it bounced on. Returns true if it hit a brick. */
+bool Game_Bricks_collide ( Game_State *state, unsigned int ball, fixed previous_x, fixed previous_y, fixed *x, fixed *y );
+
+#endif /* GAME_BRICKS_H_ */
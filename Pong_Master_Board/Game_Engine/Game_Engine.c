@@ -19,168 +19,121 @@
 
 #include "Game_Engine.h"													// Invoking the main header file.
 #include "../Graphics_Engine/Graphics_Engine.h"								// Importing the Graphics Engine driver library.
+#include "../Graphics_Engine/Graphics_Blit.h"								// Importing the fixed-size blitter generator.
 #include "../DE1Soc_LT24/DE1SoC_LT24.h"	 									// Importing the Leeds SoC LT24 driver controller.
 #include "../HPS_Watchdog/HPS_Watchdog.h"									// Importing the Watch dog timer driver controller.
-#include "../HPS_usleep/HPS_usleep.h"										// Importing the sleep function.
-#include "math.h"															// Importing the mathematical library of C.
-#include <time.h>															// Importing the time library so that its values can be used as seed value for generating random numbers.
-
-/* Global variables to hold the current position of paddle 1. */
-unsigned current_paddle_1_x_1;
-unsigned current_paddle_1_y_1;
-unsigned current_paddle_1_x_2;
-unsigned current_paddle_1_y_2;
-
-/* Global variables to hold the previous position of paddle 1. */
-unsigned previous_paddle_1_x_1;
-unsigned previous_paddle_1_y_1;
-unsigned previous_paddle_1_x_2;
-unsigned previous_paddle_1_y_2;
-
-/* Global variables to hold the current position of paddle 2. */
-unsigned current_paddle_2_x_1;
-unsigned current_paddle_2_y_1;
-unsigned current_paddle_2_x_2;
-unsigned current_paddle_2_y_2;
-
-/* Global variables to hold the previous position of paddle 2. */
-unsigned previous_paddle_2_x_1;
-unsigned previous_paddle_2_y_1;
-unsigned previous_paddle_2_x_2;
-unsigned previous_paddle_2_y_2;
-
-/* Global variables to move the paddles. */
-unsigned move_paddle_1_x = PADDLE_1_START_X_1;
-unsigned move_paddle_2_x = PADDLE_2_START_X_1;
-
-/* Move ball variables. */
-#define PI 3.14
-
-signed int quadrant = 1;
-signed int inherent_delay = 5000;
-
-unsigned int x1 = 120 ;
-unsigned int y1 = 160;
-
-unsigned int x2 = 120;
-unsigned int y2 = 160;
-
-unsigned int angle = 60;
+#include "../DE1SoC_SevenSeg/DE1SoC_SevenSeg.h"							// Importing the seven segment display driver for the scores.
+#include "../HPS_Timer/HPS_Timer.h"											// Importing the time stamp counter used to interpolate between ticks.
+#include "../DE1SoC_Link/DE1SoC_Link.h"										// Importing the packet link to and from the slave board.
+#include "Fixed_Point.h"													// Importing the Q16.16 arithmetic used by the ball physics.
+#include "Game_Simulation.h"												// Importing the rules of the game.
+#include "Game_Replay.h"													// Importing the input recorder and replay.
+#include "Game_Rollback.h"													// Importing the rollback of the late camera input.
+#include "Game_Opponent.h"													// Importing the computer opponent.
+#include "Game_Scoreboard.h"												// Importing the scores drawn on the LT24.
+#include "Game_Particles.h"													// Importing the sparks of hits and points.
+#include "Game_Bricks.h"													// Importing the layout of the bricks.
+#include "Game_Mirror.h"													// Importing the view of the match sent to the slave board.
+#include <stddef.h>															// Importing NULL.
+
+/* The game. The rules are in Game_Simulation.c, this file feeds it the inputs of the board and shows the results. */
+Game_State game;
+
+/* The replay log recorded or played back. Save or load it with the debugger, Game_Replay_size() bytes from its address. */
+Game_Replay game_replay;
+unsigned int game_input_mode = GAME_INPUT_LIVE;
+unsigned int game_replay_tick = 0;											// Next record to play back.
+
+/* Snapshots of the last ticks, to run them again when a late value of the camera arrives. */
+Game_Rollback game_rollback;
+
+/* The computer opponent. KEY3 switches it in and out once Game_setOpponent() has chosen its paddle. */
+Game_Opponent game_opponent;
+bool game_opponent_set = false;
+bool game_opponent_playing = false;
+bool game_opponent_key = false;												// KEY3 was down in the last tick.
+
+/* Colours of the balls. The first ball is white as it always was. */
+static const unsigned short ball_colours [8] = { LT24_WHITE, LT24_YELLOW, LT24_CYAN, LT24_MAGENTA, LT24_GREEN, LT24_RED, 0xFD20, 0x07FF };
 
 unsigned short colour;
 unsigned short fillColour;
 
 unsigned int GPIO_value;
 
-/* Base address of the seven segment displays. */
-volatile char *HEX_1  = (char *) 0xFF200020;
-volatile char *HEX_2  = (char *) 0xFF200021;
-volatile char *HEX_3  = (char *) 0xFF200022;
-volatile char *HEX_4  = (char *) 0xFF200023;
-volatile char *HEX_5  = (char *) 0xFF200030;
-volatile char *HEX_6  = (char *) 0xFF200031;
-
-/* Flags for the points. */
-bool ball_touch_paddle = true;
-
-/* Variables to store players' scores. */
-int player_1_score = 0;
-int player_2_score = 0;
-
-/* Function to initialize PADDLE 1 with two coordinates: top-left (x1,y1) and bottom_right (x2,y2) with a boundary colour. */
-signed int Paddle_1_Initialize ( void )
-{
-	/* Declaring the local variables required for drawing a line */
-	signed int Game_status = 0;												// Status variable to check for errors.
-	
-	current_paddle_1_x_1 = PADDLE_1_START_X_1;
-	current_paddle_1_y_1 = PADDLE_1_START_Y_1;
-	current_paddle_1_x_2 = PADDLE_1_START_X_2;
-	current_paddle_1_y_2 = PADDLE_1_START_Y_2;
-	
-	Game_status = Graphics_drawBox ( current_paddle_1_x_1, current_paddle_1_y_1, current_paddle_1_x_2, current_paddle_1_y_2, LT24_WHITE, false, LT24_WHITE ); // Draw the paddle.
-	if ( Game_status != GAME_SUCCESS) return Game_status;					// If there is an error, report it.
-	
-	/* The current value of the paddle becomes previous value in the next iteration. */
-	previous_paddle_1_x_1 = current_paddle_1_x_1;
-	previous_paddle_1_y_1 = current_paddle_1_y_1;
-	previous_paddle_1_x_2 = current_paddle_1_x_2;
-	previous_paddle_1_y_2 = current_paddle_1_y_2;
-	
-	return GAME_SUCCESS;													// Return the completion of the function.
-}
-
-/* Function to initialize PADDLE 2 with two coordinates: top-left (x1,y1) and bottom_right (x2,y2) with a boundary colour. */
-signed int Paddle_2_Initialize ( void )
-{
-	/* Declaring the local variables required for drawing a line */
-	signed int Game_status = 0;												// Status variable to check for errors.
-	
-	current_paddle_2_x_1 = PADDLE_2_START_X_1;
-	current_paddle_2_y_1 = PADDLE_2_START_Y_1;
-	current_paddle_2_x_2 = PADDLE_2_START_X_2;
-	current_paddle_2_y_2 = PADDLE_2_START_Y_2;
-	
-	Game_status = Graphics_drawBox ( current_paddle_2_x_1, current_paddle_2_y_1, current_paddle_2_x_2, current_paddle_2_y_2, LT24_WHITE, false, LT24_WHITE ); // Draw the paddle.
-	if ( Game_status != GAME_SUCCESS) return Game_status;					// If there is an error, report it.
-	
-	/* The current value of the paddle becomes previous value in the next iteration. */
-	previous_paddle_2_x_1 = current_paddle_2_x_1;
-	previous_paddle_2_y_1 = current_paddle_2_y_1;
-	previous_paddle_2_x_2 = current_paddle_2_x_2;
-	previous_paddle_2_y_2 = current_paddle_2_y_2;
-	
-	return GAME_SUCCESS;													// Return the completion of the function.
-}
-
-/* Function to draw PADDLE 1 with two coordinates: top-left (x,y) and fixed paddle dimensions with a boundary colour. */
-signed int Paddle_1_Draw ( unsigned int PADDLE_1_X, unsigned int PADDLE_1_Y )
-{
-	/* Declaring the local variables required for drawing a line */
-	signed int Game_status = 0;												// Status variable to check for errors.
-	
-	current_paddle_1_x_1 = PADDLE_1_X;
-	current_paddle_1_y_1 = PADDLE_1_Y;
-	current_paddle_1_x_2 = PADDLE_1_X + PADDLE_LENGTH;
-	current_paddle_1_y_2 = PADDLE_1_Y + PADDLE_WIDTH ;
-	
-	Game_status = Graphics_drawBox ( previous_paddle_1_x_1, previous_paddle_1_y_1, previous_paddle_1_x_2, previous_paddle_1_y_2,LT24_BLACK, false, LT24_BLACK); // Erase the paddle.
-	if ( Game_status != GAME_SUCCESS) return Game_status;					// If there is an error, report it.
-	
-	Game_status = Graphics_drawBox ( current_paddle_1_x_1, current_paddle_1_y_1, current_paddle_1_x_2, current_paddle_1_y_2, LT24_WHITE, false, LT24_WHITE ); // Draw the paddle.
-	if ( Game_status != GAME_SUCCESS) return Game_status;					// If there is an error, report it.
-	
-	/* The current value of the paddle becomes previous value in the next iteration. */
-	previous_paddle_1_x_1 = current_paddle_1_x_1;
-	previous_paddle_1_y_1 = current_paddle_1_y_1;
-	previous_paddle_1_x_2 = current_paddle_1_x_2;
-	previous_paddle_1_y_2 = current_paddle_1_y_2;
-	
-	return GAME_SUCCESS;													// Return the completion of the function.
-}
-
-/* Function to draw PADDLE 2 with two coordinates: top-left (x,y) and fixed paddle dimensions with a boundary colour. */
-signed int Paddle_2_Draw ( unsigned int PADDLE_2_X, unsigned int PADDLE_2_Y )
+/* The link from the slave board, and the mailbox the last values it sent are latched into. The mailbox is one word, written
+   whole by whoever polls the link and read whole by the game loop, so it needs no lock even when an interrupt handler
+   polls the link. */
+Link game_link;
+volatile unsigned int link_mailbox = 0;										// Camera position of paddle 1, and LINK_MAILBOX_PLAYING.
+bool link_interrupt = false;												// The link is polled by the interrupt of the port.
+
+/* The mirror channel to the slave board, the view of the match last sent on it, and the ticks since its last keyframe. */
+Link game_mirror_link;
+Game_MirrorView mirror_sent;
+unsigned int mirror_ticks = 0;
+bool mirror_open = false;
+
+/* State of the fixed timestep loop. */
+unsigned int bounce_sound_ticks = 0;
+volatile unsigned int game_pending_ticks = 0;								// Ticks raised by the timer interrupt and not run yet.
+volatile unsigned int game_tick_time = 0;									// Time stamp of the last tick interrupt.
+
+/* What Game_Render() has put on the screen. */
+unsigned int drawn_state = GAME_STATE_PLAYING;
+unsigned int drawn_ball_count = 0;
+unsigned int drawn_ball_x [GAME_MAX_BALLS];
+unsigned int drawn_ball_y [GAME_MAX_BALLS];
+unsigned int drawn_paddle_x [GAME_PADDLES];
+unsigned int drawn_paddle_y [GAME_PADDLES];
+bool paddles_drawn = false;													// False when the paddles must be drawn again wherever they are.
+unsigned int drawn_bricks [BRICK_WORDS];									// Bricks on the screen.
+
+//////////////////////////////////////// PADDLES ///////////////////////////////////////////////////////
+
+/* Function to draw a paddle that has moved since it was last drawn. A paddle that slid sideways by less than its length
+   only has the columns it left erased and the columns it moved onto painted. Otherwise it is erased where it was and drawn
+   where it is. At half resolution two pixels share a column, so the whole paddle is always redrawn. */
+signed int Paddle_Draw ( unsigned int paddle )
 {
 	/* Declaring the local variables required for drawing a line */
 	signed int Game_status = 0;												// Status variable to check for errors.
+	unsigned int x = game.paddles.x[paddle];
+	unsigned int y = game.paddles.y[paddle];
+	unsigned int drawn_x = drawn_paddle_x[paddle];
 	
-	current_paddle_2_x_1 = PADDLE_2_X;
-	current_paddle_2_y_1 = PADDLE_2_Y;
-	current_paddle_2_x_2 = PADDLE_2_X + PADDLE_LENGTH;
-	current_paddle_2_y_2 = PADDLE_2_Y + PADDLE_WIDTH ;
+	if ( paddles_drawn && x == drawn_x && y == drawn_paddle_y[paddle] ) return GAME_SUCCESS;	// Nothing has changed.
 	
-	Game_status = Graphics_drawBox ( previous_paddle_2_x_1, previous_paddle_2_y_1, previous_paddle_2_x_2, previous_paddle_2_y_2, LT24_BLACK, false, LT24_BLACK); // Erase the paddle.
-	if ( Game_status != GAME_SUCCESS) return Game_status;					// If there is an error, report it.
-	
-	Game_status = Graphics_drawBox ( current_paddle_2_x_1, current_paddle_2_y_1, current_paddle_2_x_2, current_paddle_2_y_2, LT24_WHITE, false, LT24_WHITE ); // Draw the paddle.
-	if ( Game_status != GAME_SUCCESS) return Game_status;					// If there is an error, report it.
+	if ( paddles_drawn && y == drawn_paddle_y[paddle] && Graphics_getRenderMode() == GRAPHICS_FULL_RESOLUTION &&
+		 x < drawn_x + PADDLE_DRAWN_LENGTH && drawn_x < x + PADDLE_DRAWN_LENGTH )
+	{
+		if ( x > drawn_x )
+		{
+			Game_status = Paddle_Strip ( drawn_x, y, x - drawn_x, LT24_BLACK );							// Columns left behind.
+			if ( Game_status == GAME_SUCCESS ) Game_status = Paddle_Strip ( drawn_x + PADDLE_DRAWN_LENGTH, y, x - drawn_x, LT24_WHITE );	// Columns moved onto.
+		}
+		else
+		{
+			Game_status = Paddle_Strip ( x + PADDLE_DRAWN_LENGTH, y, drawn_x - x, LT24_BLACK );
+			if ( Game_status == GAME_SUCCESS ) Game_status = Paddle_Strip ( x, y, drawn_x - x, LT24_WHITE );
+		}
+		if ( Game_status != GAME_SUCCESS) return Game_status;				// If there is an error, report it.
+	}
+	else
+	{
+		if ( paddles_drawn )
+		{
+			Game_status = Paddle_Fill ( drawn_x, drawn_paddle_y[paddle], LT24_BLACK ); // Erase the paddle.
+			if ( Game_status != GAME_SUCCESS) return Game_status;			// If there is an error, report it.
+		}
+		
+		Game_status = Paddle_Fill ( x, y, LT24_WHITE );						// Draw the paddle.
+		if ( Game_status != GAME_SUCCESS) return Game_status;				// If there is an error, report it.
+	}
 	
 	/* The current value of the paddle becomes previous value in the next iteration. */
-	previous_paddle_2_x_1 = current_paddle_2_x_1;
-	previous_paddle_2_y_1 = current_paddle_2_y_1;
-	previous_paddle_2_x_2 = current_paddle_2_x_2;
-	previous_paddle_2_y_2 = current_paddle_2_y_2;
+	drawn_paddle_x[paddle] = x;
+	drawn_paddle_y[paddle] = y;
 	
 	return GAME_SUCCESS;													// Return the completion of the function.
 }
@@ -203,569 +156,619 @@ signed int Graphics_drawDash(unsigned int x1, unsigned int y1, unsigned int x2,
 	return GAME_SUCCESS;
 }
 
-/* Function to move paddle based on the camera. */
-signed int Move_Paddle_1 ( void )
+/* Function to open the link on the parallel port at port_address: the control channel from the slave board, and the mirror
+   channel the view of the match is sent to it on. */
+signed int Game_openLink ( unsigned int port_address )
 {
-	/* Declaring the local variables required for drawing a line */
-	signed int Game_status = 0;												// Status variable to check for errors.
-	
-	/* GPIO Port Base Address. */
-	volatile unsigned char *GPIO_ptr  = (unsigned char *) 0xFF200070;
-	
-	/* LED Base Address. */
-	volatile unsigned int *LED_ptr  = (unsigned int *) 0xFF200000; 
-	
-	/* Variable to hold the value from the slave board */
-	unsigned slave_board_value;  
+	signed int status;
 	
-	/* Setting all pin as Input. */
-	*(GPIO_ptr+4)  = 0x00000001;
+	link_interrupt = false;
+	link_mailbox = 0;
+	mirror_sent.valid = false;												// The first view sent is a keyframe.
 	
-	slave_board_value = *GPIO_ptr & 0xFFF;
-	
-	move_paddle_1_x = ( slave_board_value * 5 ) / 4;
-	
-	if ( move_paddle_1_x <= MINIMUM_PADDLE_X )
-	{
-		move_paddle_1_x = MINIMUM_PADDLE_X;
-	}
-	else if ( move_paddle_1_x >= ( MAXIMUM_PADDLE_X - PADDLE_LENGTH ) )
-	{
-		move_paddle_1_x = MAXIMUM_PADDLE_X - PADDLE_LENGTH;
-	}
-   
-	//Paddle_1_Draw ( current_paddle_1_x, PADDLE_Y_1 ); HPS_ResetWatchdog();
-	Game_status = Paddle_1_Draw ( move_paddle_1_x, PADDLE_1_START_Y_1 ); HPS_ResetWatchdog();
-	if ( Game_status != GAME_SUCCESS) return Game_status;					// If there is an error, report it.
-	
-	return GAME_SUCCESS;
+	status = Link_initialise ( &game_link, port_address, &link_control, LINK_RECEIVER );
+	if ( status != LINK_SUCCESS ) return status;
+	status = Link_initialise ( &game_mirror_link, port_address, &link_mirror, LINK_SENDER );
+	mirror_open = ( status == LINK_SUCCESS );
+	return status;
 }
 
-/* Function to move paddle based on the buttons. */
-signed int Move_Paddle_2 ( void )
+/* Internal function to move both channels of the link on, and latch the values of the packets completed into the mailbox. */
+void Game_serviceLink ( unsigned int polls )
 {
-	/* Declaring the local variables required for drawing a line */
-	signed int Game_status = 0;												// Status variable to check for errors.
+	Link_Packet packet;
+	unsigned int mailbox = link_mailbox;
 	
-	volatile unsigned int *KEY_ptr     = (unsigned int *) 0xFF200050;
-	unsigned key_value;
-	
-	key_value = *KEY_ptr & 0x3;
-
-	if ( key_value == 1 )
+	Link_poll ( &game_link, polls );
+	if ( mirror_open ) Link_poll ( &game_mirror_link, polls );
+	while ( Link_receive ( &game_link, &packet ) )
 	{
-		
-		if ( move_paddle_2_x >= ( MAXIMUM_PADDLE_X - PADDLE_LENGTH ) )
+		if ( packet.type == LINK_MSG_PADDLE && packet.length == 1 )
 		{
-			move_paddle_2_x = MAXIMUM_PADDLE_X - PADDLE_LENGTH;
+			mailbox = packet.payload[0] | LINK_MAILBOX_PLAYING;				// Positions are only sent in the start mode.
 		}
-		
-		else if ( move_paddle_2_x < MAXIMUM_PADDLE_X )
+		else if ( packet.type == LINK_MSG_MODE && packet.length == 1 )
 		{
-			move_paddle_2_x = move_paddle_2_x + PADDLE_INCREMENT;
-
-			if ( move_paddle_2_x >= ( MAXIMUM_PADDLE_X - PADDLE_LENGTH ) )
-			{
-				move_paddle_2_x = MAXIMUM_PADDLE_X - PADDLE_LENGTH;
-			}
+			mailbox = ( mailbox & LINK_MAILBOX_PADDLE ) | ( ( packet.payload[0] != 0 ) ? LINK_MAILBOX_PLAYING : 0 );
 		}
-		
-		//Reset watchdog.
-		HPS_ResetWatchdog();
 	}
-	else if ( key_value == 2 )
+	link_mailbox = mailbox;
+}
+
+/* Function to take the bytes the slave board has sent since the last call, and the packets they completed. The mirror
+   channel is moved on too. Once the interrupt of the port polls the link, there is nothing to do. */
+void Game_pollLink ( void )
+{
+	if ( !link_interrupt ) Game_serviceLink ( GAME_LINK_POLLS );
+}
+
+/* Function to poll the link from the interrupt of the parallel port instead: the port raises it when the slave board moves
+   the strobe of the control channel or the acknowledge of the mirror channel. */
+signed int Game_enableLinkInterrupt ( void )
+{
+	signed int status;
+	
+	status = Link_setInterrupt ( &game_link, true );
+	if ( status == LINK_SUCCESS && mirror_open ) status = Link_setInterrupt ( &game_mirror_link, true );
+	if ( status == LINK_SUCCESS ) link_interrupt = true;
+	return status;
+}
+
+/* Function to be called from the interrupt handler of the parallel port. */
+void Game_linkInterrupt ( void )
+{
+	/* Each channel clears the edge of its own line, both before polling so that an edge while polling raises the interrupt again. */
+	Link_acknowledgeInterrupt ( &game_link );
+	if ( mirror_open ) Link_acknowledgeInterrupt ( &game_mirror_link );
+	Game_serviceLink ( GAME_LINK_IRQ_POLLS );
+}
+
+/* Function to check whether the slave board is in its start mode. */
+bool Game_isSlavePlaying ( void )
+{
+	return ( link_mailbox & LINK_MAILBOX_PLAYING ) != 0;
+}
+
+/* Function to read the inputs of a tick from the board: the camera position of paddle 1 from the slave board, the push
+   buttons and the slide switches. */
+void Game_readInputRecord ( Game_InputRecord *record )
+{
+	volatile unsigned int *KEY_ptr    = (unsigned int *) 0xFF200050;
+	volatile unsigned int *SW_ptr     = (unsigned int *) 0xFF200040;
+	
+	Game_pollLink();
+	
+	record->link = (unsigned char)( link_mailbox & LINK_MAILBOX_PADDLE );
+	record->keys = (unsigned char)( *KEY_ptr & 0xF );
+	record->switches = (unsigned short)( *SW_ptr & 0x3FF );
+}
+
+/* Internal function to send the view of the match to the slave board once the last one has gone, so the slave board
+   always gets the newest one. A tick that could not be sent is folded into the next, as the changes are taken from the
+   view last sent. */
+void Game_sendMirror ( void )
+{
+	Game_MirrorView now;
+	unsigned char payload [MIRROR_MAX_BYTES];
+	unsigned int length;
+	unsigned int ball;
+	
+	if ( mirror_ticks < MIRROR_KEY_TICKS ) mirror_ticks++;
+	if ( !mirror_open || !Link_isIdle ( &game_mirror_link ) ) return;
+	
+	now.valid = true;
+	now.paddle_x[0] = (unsigned char)game.paddles.x[PADDLE_1];
+	now.paddle_x[1] = (unsigned char)game.paddles.x[PADDLE_2];
+	now.score[0] = (unsigned char)game.player_1_score;
+	now.score[1] = (unsigned char)game.player_2_score;
+	now.state = (unsigned char)game.state;
+	now.last_point_player = (unsigned char)game.last_point_player;
+	now.ball_count = (unsigned char)MIN ( game.balls.count, MIRROR_BALLS );
+	for ( ball = 0; ball < now.ball_count; ball++ )
 	{
-		if ( move_paddle_2_x <= MINIMUM_PADDLE_X )
-		{
-			move_paddle_2_x = MINIMUM_PADDLE_X;
-		}
-		else if ( move_paddle_2_x > MINIMUM_PADDLE_X )
-		{
-			move_paddle_2_x = move_paddle_2_x - PADDLE_DECREMENT;
-			
-			if ( move_paddle_2_x <= MINIMUM_PADDLE_X )
-			{
-				move_paddle_2_x = MINIMUM_PADDLE_X;
-			}
-		}
-		
-		//Reset watchdog.
-		HPS_ResetWatchdog();
+		now.ball_x[ball] = (unsigned char)game.balls.current_x[ball];
+		now.ball_y[ball] = (unsigned short)game.balls.current_y[ball];
 	}
-   
-	//Paddle_1_Draw ( current_paddle_1_x, PADDLE_Y_1 ); HPS_ResetWatchdog();
-	Game_status = Paddle_2_Draw ( move_paddle_2_x, PADDLE_2_START_Y_1 ); HPS_ResetWatchdog();
-	if ( Game_status != GAME_SUCCESS) return Game_status;					// If there is an error, report it.
 	
-	return GAME_SUCCESS;
+	length = Game_Mirror_encode ( &now, &mirror_sent, mirror_ticks >= MIRROR_KEY_TICKS, payload );
+	if ( length == 0 || Link_send ( &game_mirror_link, LINK_MSG_MIRROR, payload, length ) != LINK_SUCCESS ) return;
+	
+	if ( payload[0] & MIRROR_KEY ) mirror_ticks = 0;
+	mirror_sent = now;
 }
 
+//////////////////////////////////////// BALLS /////////////////////////////////////////////////////////
+
+/* Unrolled fills for the two object sizes of the game. */
+GRAPHICS_DEFINE_FILL ( Ball_Fill, BALL_SIZE, BALL_SIZE )
+GRAPHICS_DEFINE_FILL ( Paddle_Fill, PADDLE_DRAWN_LENGTH, PADDLE_DRAWN_WIDTH )
+GRAPHICS_DEFINE_STRIP ( Paddle_Strip, PADDLE_DRAWN_WIDTH )
+GRAPHICS_DEFINE_FILL ( Brick_Fill, BRICK_LENGTH, BRICK_WIDTH )
+
 /* Function to draw ball on the screen. */
 signed int Graphics_drawBall(unsigned int x1, unsigned int y1, unsigned int x2,  unsigned int y2, unsigned short colour)
 {
-	signed int i;
-	signed int j;
-	for(i=y1;i<=y2;i++)
-			{
-				for(j=x1;j<=x2;j++)
-				{
-					LT24_drawPixel(colour,j,i);
-
-				}
-			}
-	return 0;
+	if ( x2 - x1 + 1 == BALL_SIZE && y2 - y1 + 1 == BALL_SIZE ) return Ball_Fill(x1,y1,colour);
+	return Graphics_fillBox(x1,y1,x2,y2,colour);							// The ball is sent as one window burst in either render mode.
 }
 
 /* Function to erase ball from the screen. */
 signed int Graphics_Erase(unsigned int x1, unsigned int y1, unsigned int x2,  unsigned int y2, unsigned short fillColour)
 {
-	signed int i;
-	signed int j;
-		for(i=y1;i<=y2;i++)
-				{
-					for(j=x1;j<=x2;j++)
-					{
-							LT24_drawPixel(fillColour,j,i);
-					}
-				}
-
-	return 0;
+	if ( x2 - x1 + 1 == BALL_SIZE && y2 - y1 + 1 == BALL_SIZE ) return Ball_Fill(x1,y1,fillColour);
+	return Graphics_fillBox(x1,y1,x2,y2,fillColour);						// The ball is sent as one window burst in either render mode.
 }
 
-/* Function to move the ball around the screen. */
-signed int Move_Ball ( void )
+/* Internal function to drive the bounce sound. A bounce holds the sound on for BOUNCE_SOUND_TICKS ticks. */
+void Ball_Sound ( bool bounce )
 {
 	volatile unsigned char *AUDIO_ptr = (unsigned char *)0xFF2000C0;
-	float hit_angle = angle*(PI/180);
-	
-	volatile unsigned int *SW_ptr = (unsigned int *)0xFF200040;
-	unsigned int delay = inherent_delay - ( ( *SW_ptr & 0x3FF ) * 3.5) ;
 	
 	*(AUDIO_ptr+4)  = 0xFF;
-	colour = LT24_WHITE;
-	fillColour = 0x39E7;
-	
-	ball_touch_paddle = true;
 	
-	if (quadrant ==1)
+	if ( bounce )
 	{
-		if  (x2>12 && y2>12)
-		{
+		*AUDIO_ptr = 0xF;
+		bounce_sound_ticks = BOUNCE_SOUND_TICKS;							// The sound is switched off by a step after this time, the game keeps running.
+	}
+	else if ( bounce_sound_ticks == 0 )
+	{
+		*AUDIO_ptr = 0x0;
+	}
+}
 
-			*AUDIO_ptr = 0x0;
-			x2 = x2-1;
-			y2 = y2 - abs(round_off(1/tan(hit_angle)));
-			Graphics_drawBall(x2,y2,x2+3,y2+3,colour);
-			usleep(delay);
-			Graphics_Erase(x2,y2,x2+3,y2+3,fillColour);
-			Graphics_drawDash(11,160,229,160,LT24_WHITE);
-		}
-		
-		if (x2 <= 12)
-		{
-			*AUDIO_ptr = 0xF;
-			usleep(10000);
-			quadrant = 2;
-		}
-		else if(y2 <= 12)
-		{
-			if ( x2 > current_paddle_1_x_1 && x2 < current_paddle_1_x_2 )
-			{
-				*AUDIO_ptr = 0xF;
-				usleep(10000);
-				quadrant = 4;
-			}
-			else 
-			{
-				Update_Score_2();
-				ball_touch_paddle = false;
-			}
-		}
+/* Observer of the game: the bounce sound, the scores on the seven segment displays and the sparks. */
+void Game_bounced ( void *context )
+{
+	Ball_Sound ( true );
+}
 
-	}
+void Game_scored ( void *context, const Game_State *state )
+{
+	Game_showScores();
+}
 
-	else if (quadrant ==2)
-	{
-		if (x2<225 && y2>12)
-		{
-			*AUDIO_ptr = 0x0;
-			x2 = x2+1;
-			y2 = y2 - abs(round_off(1/tan(hit_angle)));
-			Graphics_drawBall(x2,y2,x2+3,y2+3,colour);
-			usleep(delay);
-			Graphics_Erase(x2,y2,x2+3,y2+3,fillColour);
-			Graphics_drawDash(11,160,229,160,LT24_WHITE);
-		}
+/* Sparks fly into the court from where the ball met the paddle line: yellow off a paddle, red past it. */
+void Game_hit ( void *context, unsigned int paddle, unsigned int x, unsigned int y, bool scored )
+{
+	x = x + ( BALL_SIZE - PARTICLE_SIZE ) / 2;
+	if ( paddle == PADDLE_2 ) y = y + BALL_SIZE - PARTICLE_SIZE;
+	
+	Game_Particles_burst ( x, y, ( paddle == PADDLE_1 ) ? 1 : -1, scored ? PARTICLE_SCORE_COUNT : PARTICLE_HIT_COUNT, scored ? LT24_RED : LT24_YELLOW );
+}
 
-		if (x2 >= 225)
-		{
-			quadrant = 1;
-			*AUDIO_ptr = 0xF;
-			usleep(10000);
-		}
-		else if(y2 <= 12)
-		{
-			if ( x2 > current_paddle_1_x_1 && x2 < current_paddle_1_x_2 )
-			{
-				*AUDIO_ptr = 0xF;
-				usleep(10000);
-				quadrant = 3;
-			}
-			else 
-			{
-				Update_Score_2();
-				ball_touch_paddle = false;
-			}
-		}
+static const Game_Observer board_observer = { NULL, Game_bounced, Game_scored, Game_hit };
+
+/* Function to show the scores on the seven segment displays: player 2 on the left, Pong in the middle and player 1 on the right.
+   A score of 10 takes two displays, and Pong gives way to dashes between the scores. The displays are laid out in a frame
+   and only the register words that change are written. */
+void Game_showScores ( void )
+{
+	SevenSeg_Frame frame;
+	unsigned int player_1_digits = ( game.player_1_score > 9 ) ? 2 : 1;
+	unsigned int player_2_digits = ( game.player_2_score > 9 ) ? 2 : 1;
+	unsigned int display;
+
+	SevenSeg_frameClear ( &frame );
+	if ( player_1_digits + player_2_digits == 2 )
+	{
+		SevenSeg_frameText ( &frame, 4, "Pong" );
 	}
-		
-	//else if (angle>180 && angle<270)
-	else if (quadrant ==3)
+	else
 	{
-		if (x2<225 && y2<305)
-		{
-			*AUDIO_ptr = 0x0;
-			x2 = x2+1;
-			y2 = y2 + abs(round_off(1/tan(hit_angle)));
-			Graphics_drawBall(x2,y2,x2+3,y2+3,colour);
-			usleep(delay);
-			Graphics_Erase(x2,y2,x2+3,y2+3,fillColour);
-			Graphics_drawDash(11,160,229,160,LT24_WHITE);
-		}
+		for ( display = player_1_digits; display < SEVENSEG_DISPLAYS - player_2_digits; display++ ) SevenSeg_frameWrite ( &frame, display, SEVENSEG_DASH );
+	}
+	SevenSeg_frameNumber ( &frame, 0, player_1_digits, game.player_1_score );
+	SevenSeg_frameNumber ( &frame, SEVENSEG_DISPLAYS - player_2_digits, player_2_digits, game.player_2_score );
+	SevenSeg_show ( &frame );
+}
 
-		if (x2 >= 225)
-		{
+/* Function to start the game with a number of balls on a GAME_MODE_ court. The next Game_Render() draws the paddles, the bricks
+   and the balls. GAME_INPUT_RECORD also records the game into game_replay, GAME_INPUT_REPLAY plays game_replay back instead. */
+signed int Game_Initialize ( unsigned int ball_count, unsigned int mode, unsigned int input_mode )
+{
+	unsigned int seed = HPS_Timer_timestamp();								// The time the board took to start up.
+	signed int status;
+	
+	Game_Scoreboard_initialise ( LT24_WHITE, GAME_BACKGROUND_GREY );
+	Game_forceRedraw();
+	game_input_mode = input_mode;
+	game_replay_tick = 0;
+	Game_Rollback_reset ( &game_rollback );
+	
+	if ( input_mode == GAME_INPUT_REPLAY ) return Game_Replay_begin ( &game_replay, &game );
+	
+	status = Game_Simulation_initialise ( &game, ball_count, seed );
+	if ( status != GAME_SUCCESS ) return status;
+	status = Game_Simulation_setMode ( &game, mode );
+	if ( status != GAME_SUCCESS ) return status;
+	
+	if ( input_mode == GAME_INPUT_RECORD ) Game_Replay_startRecording ( &game_replay, seed, ball_count, &game );
+	
+	return GAME_SUCCESS;
+}
 
-			quadrant = 4;
-			*AUDIO_ptr = 0xF;
-			usleep(10000);
-		}
-		else if(y2 >= 305)
-		{
-			if ( x2 > current_paddle_2_x_1 && x2 < current_paddle_2_x_2 )
-			{
-				*AUDIO_ptr = 0xF;
-				usleep(10000);
-				quadrant = 2;
-			}
-			else 
-			{
-				Update_Score_1();
-				ball_touch_paddle = false;
-			};
-		}
+/* Function to set how many ticks late the camera position of paddle 1 arrives from the slave board, 0 to GAME_ROLLBACK_MAX_DELAY.
+   The game runs ahead with the last position and is rolled back by this many ticks when a new one arrives. 0 never rolls back. */
+signed int Game_setLinkDelay ( unsigned int ticks )
+{
+	return Game_Rollback_initialise ( &game_rollback, ticks );
+}
+
+/* Function to choose the paddle and the level of the computer opponent. It starts playing at the next press of KEY3. */
+signed int Game_setOpponent ( unsigned int paddle, unsigned int level )
+{
+	signed int status = Game_Opponent_initialise ( &game_opponent, paddle, level, HPS_Timer_timestamp() );
+	
+	game_opponent_set = ( status == GAME_OPPONENT_SUCCESS );
+	game_opponent_playing = false;
+	return status;
+}
+
+/* Internal function to follow KEY3, which switches the computer opponent in and out, and let it play. */
+void Game_playOpponent ( Game_InputRecord *record )
+{
+	bool key = ( record->keys & GAME_KEY_OPPONENT ) != 0;
+	
+	if ( key && !game_opponent_key && game_opponent_set ) game_opponent_playing = !game_opponent_playing;
+	game_opponent_key = key;
+	
+	if ( game_opponent_playing ) Game_Opponent_play ( &game_opponent, &game, record );
+}
+
+/* Function to check whether a replay has played its last tick. */
+bool Game_isReplayDone ( void )
+{
+	return game_input_mode == GAME_INPUT_REPLAY && game_replay_tick >= game_replay.header.ticks;
+}
+
+/* Function to check that the replay ended in the same state as the recorded game. */
+bool Game_verifyReplay ( void )
+{
+	return Game_Replay_verify ( &game_replay, &game );
+}
+
+/* Function to set the number of balls in play, 1 to GAME_MAX_BALLS. More than one ball is the multi-ball mode:
+   there is no pause after a point and the ball that scored is served again straight away. */
+signed int Game_setBallCount ( unsigned int count )
+{
+	Game_Rollback_reset ( &game_rollback );									// The snapshots have the old number of balls.
+	return Game_Simulation_setBallCount ( &game, count );
+}
+
+/* Function to read the number of balls in play. */
+unsigned int Game_getBallCount ( void )
+{
+	return game.balls.count;
+}
+
+/* Function to start a new game with the same number of balls. */
+signed int Game_Restart ( void )
+{
+	Game_Simulation_restart ( &game );
+	Game_Rollback_reset ( &game_rollback );
+	return GAME_SUCCESS;
+}
+
+/* Function to check whether a player has won. */
+bool Game_isOver ( void )
+{
+	return game.state == GAME_STATE_OVER;
+}
+
+//////////////////////////////////////// FIXED TIMESTEP LOOP ///////////////////////////////////////
+
+/* Function to advance the game by one fixed tick of GAME_TICK_US microseconds. Returns GAME_REPLAY_END when a replay is over. */
+signed int Game_Tick ( void )
+{
+	Game_InputRecord record;
+	Game_Input input;
+	unsigned int player_1_score = game.player_1_score;
+	unsigned int player_2_score = game.player_2_score;
+	unsigned int rolled_back;
+	unsigned int tick;
+	
+	if ( bounce_sound_ticks > 0 ) bounce_sound_ticks--;
+	
+	if ( game_input_mode == GAME_INPUT_REPLAY )
+	{
+		/* The log holds the inputs the ticks were finally run with, so a replay never rolls back. */
+		if ( game_replay_tick >= game_replay.header.ticks ) return GAME_REPLAY_END;
+		record = game_replay.records[game_replay_tick++];
+		
+		Game_Simulation_decodeInput ( &record, &input );
+		Game_Simulation_step ( &game, &input, &board_observer );
 	}
-		//else 	if (angle>270 && angle<360)
-	else if (quadrant == 4)
+	else
 	{
-		if (x2>12 && y2<305)
+		Game_readInputRecord ( &record );
+		Game_playOpponent ( &record );										// The opponent's moves are recorded like a player's.
+		
+		/* When the log is full the game goes on without recording, the log is still a complete replay. */
+		if ( game_input_mode == GAME_INPUT_RECORD && Game_Replay_record ( &game_replay, &record ) != GAME_REPLAY_SUCCESS ) game_input_mode = GAME_INPUT_LIVE;
+		
+		if ( game_opponent_playing && game_opponent.paddle == PADDLE_1 )
 		{
-			*AUDIO_ptr = 0x0;
-			x2 = x2-1;
-			y2 = y2 + abs(round_off(1/tan(hit_angle)));
-			Graphics_drawBall(x2,y2,x2+3,y2+3,colour);
-			usleep(delay);
-			Graphics_Erase(x2,y2,x2+3,y2+3,fillColour);
-			Graphics_drawDash(11,160,229,160,LT24_WHITE);
+			/* Paddle 1 is played here and not late, there is nothing to roll back. */
+			Game_Rollback_reset ( &game_rollback );
+			Game_Simulation_decodeInput ( &record, &input );
+			Game_Simulation_step ( &game, &input, &board_observer );
+			rolled_back = 0;
 		}
-
-		if (x2 <= 12)
+		else
 		{
-			quadrant = 3;
-			*AUDIO_ptr = 0xF;
-			usleep(10000);
+			rolled_back = Game_Rollback_step ( &game_rollback, &game, &record, &board_observer );
 		}
-		else if(y2 >= 305)
+		
+		if ( rolled_back > 0 )
 		{
-			if ( x2 > current_paddle_2_x_1 && x2 < current_paddle_2_x_2 )
+			/* Points won or lost in the ticks run again were not reported, show the scores as they are now. */
+			if ( game.player_1_score != player_1_score || game.player_2_score != player_2_score ) Game_scored ( NULL, &game );
+			
+			if ( game_input_mode == GAME_INPUT_RECORD )
 			{
-				*AUDIO_ptr = 0xF;
-				usleep(10000);
-				quadrant = 1;
+				for ( tick = 1; tick <= rolled_back; tick++ ) Game_Replay_correct ( &game_replay, tick, Game_Rollback_input ( &game_rollback, tick ) );
 			}
-			else 
-			{
-				Update_Score_1();
-				ball_touch_paddle = false;
-			};
 		}
 	}
-
-	HPS_ResetWatchdog();
 	
-	if ( ball_touch_paddle == true )
-	{
-		x1=x2;
-		y1=y2;
-	}
+	Ball_Sound ( false );													// Switch the sound off once it has played long enough.
+	Game_Particles_update();
+	Game_sendMirror();														// Only the state crosses to the slave board, a few bytes a tick.
+	
+	if ( game_input_mode == GAME_INPUT_RECORD ) Game_Replay_recordResult ( &game_replay, &game );
+	
+	return GAME_SUCCESS;
 }
 
-void Update_Score_1 ( void )
+/* Function to run a number of ticks straight away, without waiting for the timer. Used to play a replay unthrottled. */
+unsigned int Game_runTicks ( unsigned int ticks )
 {
-	Graphics_drawBox ( 115, 75, 125, 85, LT24_GREEN, false, LT24_GREEN ); // Draw the box.
-	Graphics_drawBox ( 115, 235, 125, 245, LT24_RED, false, LT24_RED ); // Draw the box.
-	
-	player_1_score = player_1_score + 1;
-	
-	Display_Seven_Segment(1,player_1_score);
-	Display_Seven_Segment(2,16);
-	Display_Seven_Segment(3,16);
-	Display_Seven_Segment(4,16);
-	Display_Seven_Segment(5,16);
-	Display_Seven_Segment(6,player_2_score);
+	unsigned int count;
 	
-	if ( player_1_score >= 10  )
+	for ( count = 0; count < ticks; count++ )
 	{
-		Graphics_drawBox ( previous_paddle_1_x_1, previous_paddle_1_y_1, previous_paddle_1_x_2, previous_paddle_1_y_2, LT24_BLACK, false, LT24_BLACK); // Erase paddle 1.
-		Graphics_drawBox ( previous_paddle_2_x_1, previous_paddle_2_y_1, previous_paddle_2_x_2, previous_paddle_2_y_2, LT24_BLACK, false, LT24_BLACK); // Erase paddle 2.
-		
-		while (1)
-		{
-			Graphics_drawBox(10,10,230,310,LT24_BLACK,false,LT24_YELLOW); ResetWDT();
-			Graphics_drawLetter(85,215,115,235,7,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,190,115,210,8,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,165,115,185,9,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,140,115,160,9,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,115,115,135,10,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,90,115,110,4,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(125,165,155,185,6,LT24_BLACK); ResetWDT();
-			
-			//P1
-			Graphics_drawLetter(125,140,155,160,11,LT24_BLACK); ResetWDT();
-		}
+		if ( Game_Tick() != GAME_SUCCESS ) break;
 	}
+	game_tick_time = HPS_Timer_timestamp();									// Draw the ticks as they are.
 	
-	usleep(3000000);
+	return count;
+}
+
+/* Function called by the periodic timer interrupt. It only counts the tick, the game loop does the work. */
+void Game_timerTick ( void )
+{
+	game_tick_time = HPS_Timer_timestamp();
+	game_pending_ticks++;
+	if ( link_interrupt ) Game_serviceLink ( GAME_LINK_IRQ_POLLS );		// In case an edge of the port was missed. Interrupts do not nest.
+}
+
+/* Function to run the ticks raised since the last call. At most GAME_MAX_CATCH_UP_TICKS are run,
+   the rest are dropped so a slow frame cannot make the game fall further and further behind. */
+unsigned int Game_runPendingTicks ( void )
+{
+	unsigned int ticks;
+	unsigned int count;
+	bool was_masked;
 	
-	Graphics_drawBox ( 115, 75, 125, 85, GAME_BACKGROUND_GREY , false, GAME_BACKGROUND_GREY  ); // Erase the box.
-	Graphics_drawBox ( 115, 235, 125, 245, GAME_BACKGROUND_GREY , false, GAME_BACKGROUND_GREY  ); // Draw the box.
+	was_masked = __disable_irq();
+	ticks = game_pending_ticks;
+	game_pending_ticks = 0;
+	if ( !was_masked ) __enable_irq();
 	
-	x1 = 120;
-	y1 = 160;
-	x2 = 120;
-	y2 = 160;
+	if ( ticks > GAME_MAX_CATCH_UP_TICKS ) ticks = GAME_MAX_CATCH_UP_TICKS;
 	
-	srand(time(0));
+	for ( count = 0; count < ticks; count++ ) Game_Tick();
 	
-	quadrant = ((abs( rand())) % 4 ) + 1;
-	angle = ((abs( rand())) % 40 )+ 20;
+	return ticks;
 }
 
-void Update_Score_2 ( void )
+/* Function to drop the ticks raised while the game is paused. */
+void Game_discardPendingTicks ( void )
 {
-	Graphics_drawBox ( 115, 75, 125, 85, LT24_RED, false, LT24_RED ); // Draw the box.
-	Graphics_drawBox ( 115, 235, 125, 245, LT24_GREEN, false, LT24_GREEN ); // Draw the box.
-	
-	player_2_score = player_2_score + 1;
+	game_pending_ticks = 0;
+	Game_Rollback_reset ( &game_rollback );									// A value read after the pause does not belong to the ticks before it.
+}
+
+/* Function to return how far the game is into the current tick, from 0 to GAME_ALPHA_ONE. */
+unsigned int Game_tickFraction ( void )
+{
+	unsigned int elapsed = HPS_Timer_timestamp() - game_tick_time;
 	
-	Display_Seven_Segment(1,player_1_score);
-	Display_Seven_Segment(2,16);
-	Display_Seven_Segment(3,16);
-	Display_Seven_Segment(4,16);
-	Display_Seven_Segment(5,16);
-	Display_Seven_Segment(6,player_2_score);
+	if ( elapsed >= GAME_TICK_US * HPS_TIMER_TICKS_PER_US ) return GAME_ALPHA_ONE;
+	return ( elapsed * GAME_ALPHA_ONE ) / ( GAME_TICK_US * HPS_TIMER_TICKS_PER_US );
+}
+
+/* Internal function to interpolate between the ball position of the last tick and the current one. */
+unsigned int Interpolate ( unsigned int from, unsigned int to, unsigned int alpha )
+{
+	return (unsigned int)( (signed int)from + ( ( (signed int)to - (signed int)from ) * (signed int)alpha ) / GAME_ALPHA_ONE );
+}
+
+/* Internal function to draw the winner screen. */
+void Draw_Winner ( unsigned int player )
+{
+	Paddle_Fill ( drawn_paddle_x[PADDLE_1], drawn_paddle_y[PADDLE_1], LT24_BLACK ); // Erase paddle 1.
+	Paddle_Fill ( drawn_paddle_x[PADDLE_2], drawn_paddle_y[PADDLE_2], LT24_BLACK ); // Erase paddle 2.
+	
+	Graphics_drawBox(10,10,230,310,LT24_BLACK,false,LT24_YELLOW); ResetWDT();
+	Graphics_drawLetter(85,215,115,235,7,LT24_BLACK); ResetWDT();
+	Graphics_drawLetter(85,190,115,210,8,LT24_BLACK); ResetWDT();
+	Graphics_drawLetter(85,165,115,185,9,LT24_BLACK); ResetWDT();
+	Graphics_drawLetter(85,140,115,160,9,LT24_BLACK); ResetWDT();
+	Graphics_drawLetter(85,115,115,135,10,LT24_BLACK); ResetWDT();
+	Graphics_drawLetter(85,90,115,110,4,LT24_BLACK); ResetWDT();
+	Graphics_drawLetter(125,165,155,185,6,LT24_BLACK); ResetWDT();
+	
+	//P1 or P2
+	Graphics_drawLetter(125,140,155,160,( player == 1 ) ? 11 : 12,LT24_BLACK); ResetWDT();
+}
+
+/* Function to make the next Game_Render() redraw the scores, the score boxes or the winner screen, after the screen was cleared. */
+void Game_forceRedraw ( void )
+{
+	unsigned int word;
+	
+	drawn_state = GAME_STATE_NONE;
+	drawn_ball_count = 0;													// No ball is on the screen any more.
+	paddles_drawn = false;
+	Game_Scoreboard_invalidate();
+	Game_Particles_clear();													// The sparks went with the screen.
+	for ( word = 0; word < BRICK_WORDS; word++ ) drawn_bricks[word] = 0;
+}
+
+/* Colour of each row of a wall of bricks, from the top of the screen. */
+static const unsigned short brick_colours [BRICK_WALL_ROWS] = { LT24_RED, 0xFD20, LT24_YELLOW, LT24_GREEN, LT24_CYAN };
+
+/* Internal function to draw the bricks that stood up and erase the ones that broke since the last frame. */
+void Render_Bricks ( void )
+{
+	unsigned int word;
+	unsigned int bit;
+	unsigned int brick;
+	unsigned int changed;
 	
-	if ( player_2_score >= 10 )
+	for ( word = 0; word < BRICK_WORDS; word++ )
 	{
-		Graphics_drawBox ( previous_paddle_1_x_1, previous_paddle_1_y_1, previous_paddle_1_x_2, previous_paddle_1_y_2, LT24_BLACK, false, LT24_BLACK); // Erase paddle 1.
-		Graphics_drawBox ( previous_paddle_2_x_1, previous_paddle_2_y_1, previous_paddle_2_x_2, previous_paddle_2_y_2, LT24_BLACK, false, LT24_BLACK); // Erase paddle 2.
-
-		while (1)
+		changed = game.bricks[word] ^ drawn_bricks[word];
+		for ( bit = 0; changed != 0; bit++, changed >>= 1 )
 		{
-			Graphics_drawBox(10,10,230,310,LT24_BLACK,false,LT24_YELLOW); ResetWDT();
-			Graphics_drawLetter(85,215,115,235,7,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,190,115,210,8,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,165,115,185,9,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,140,115,160,9,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,115,115,135,10,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(85,90,115,110,4,LT24_BLACK); ResetWDT();
-			Graphics_drawLetter(125,165,155,185,6,LT24_BLACK); ResetWDT();
-
-			//P2
-			Graphics_drawLetter(125,140,155,160,12,LT24_BLACK); ResetWDT();
+			if ( ( changed & 1 ) == 0 ) continue;
+			brick = word * 32 + bit;
+			Brick_Fill ( Game_Bricks_x ( brick ), Game_Bricks_y ( brick ),
+						 ( ( game.bricks[word] >> bit ) & 1 ) ? brick_colours[( brick / BRICK_COLUMNS ) % BRICK_WALL_ROWS] : GAME_BACKGROUND_GREY );
 		}
+		drawn_bricks[word] = game.bricks[word];
 	}
-	
-	usleep(3000000);
-	
-	Graphics_drawBox ( 115, 75, 125, 85, GAME_BACKGROUND_GREY , false, GAME_BACKGROUND_GREY  ); // Erase the box.
-	Graphics_drawBox ( 115, 235, 125, 245, GAME_BACKGROUND_GREY , false, GAME_BACKGROUND_GREY  ); // Draw the box.
-	
-	x1 = 120;
-	y1 = 160;
-	x2 = 120;
-	y2 = 160;
-	
-	srand(time(0));
-	
-	quadrant = ((abs( rand())) % 4 ) + 1;
-	angle = ((abs( rand())) % 40 )+ 20;
-	
 }
 
-/* Round off function that converts float value to integer. */
-unsigned int round_off(float num)
+/* Internal function to draw again the bricks under a box that was erased. */
+void Touch_Bricks ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2 )
 {
-	int n = (int)num;
+	signed int corners [4][2] = { { x1, y1 }, { x2, y1 }, { x1, y2 }, { x2, y2 } };	// The box is smaller than a brick.
+	signed int brick;
+	unsigned int corner;
 	
-	if((num-n)>0.5)
+	for ( corner = 0; corner < 4; corner++ )
 	{
-		return n+1;
-	}
-	else {
-		return n;
+		brick = Game_Bricks_at ( corners[corner][0], corners[corner][1] );
+		if ( brick != BRICK_NONE ) drawn_bricks[brick / 32] &= ~( 1u << ( brick % 32 ) );
 	}
 }
 
-/* Seven Segment displays. */
-void Display_Seven_Segment(int DISPLAY_NUMBER, int HEX_NUMBER)
+/* Internal render pass over the balls: erase every ball that moved, then draw all of them, so that a ball erased
+   next to another one cannot leave a hole in it. The net, the bricks and the digits of the scores are only redrawn
+   when an erased ball was on them, under the balls. */
+void Render_Balls ( unsigned int alpha )
 {
-	if ( DISPLAY_NUMBER == 1 )
+	const Game_Balls *balls = &game.balls;
+	unsigned int ball;
+	unsigned int ball_x;
+	unsigned int ball_y;
+	bool net_touched = false;
+	
+	/* Erase pass. Balls that are no longer in play are erased too. */
+	for ( ball = 0; ball < drawn_ball_count; ball++ )
 	{
-		switch (HEX_NUMBER)
+		ball_x = Interpolate ( balls->previous_x[ball], balls->current_x[ball], alpha );
+		ball_y = Interpolate ( balls->previous_y[ball], balls->current_y[ball], alpha );
+		
+		if ( ( ball >= balls->count ) || ( ball_x != drawn_ball_x[ball] ) || ( ball_y != drawn_ball_y[ball] ) )
 		{
-			case 0: *HEX_1 = 63;break;
-			case 1: *HEX_1 = 6;break;
-			case 2: *HEX_1 = 91;break;
-			case 3: *HEX_1 = 79;break;
-			case 4: *HEX_1 = 102;break;
-			case 5: *HEX_1 = 109;break;
-			case 6: *HEX_1 = 125;break;
-			case 7: *HEX_1 = 07;break;
-			case 8: *HEX_1 = 127;break;
-			case 9: *HEX_1 = 103;break;
-			case 10: *HEX_1 = 119;break;
-			case 11: *HEX_1 = 124;break;
-			case 12: *HEX_1 = 57;break;
-			case 13: *HEX_1 = 94;break;
-			case 14: *HEX_1 = 121;break;
-			case 15: *HEX_1 = 113;break;
-
+			Graphics_Erase(drawn_ball_x[ball],drawn_ball_y[ball],drawn_ball_x[ball]+3,drawn_ball_y[ball]+3,fillColour);	// Erase the ball where it was drawn last time.
+			if ( drawn_ball_y[ball] + BALL_SIZE > 160 && drawn_ball_y[ball] <= 160 ) net_touched = true;
+			Game_Scoreboard_touch ( drawn_ball_x[ball], drawn_ball_y[ball], drawn_ball_x[ball]+3, drawn_ball_y[ball]+3 );
+			if ( game.mode == GAME_MODE_BRICKS ) Touch_Bricks ( drawn_ball_x[ball], drawn_ball_y[ball], drawn_ball_x[ball]+3, drawn_ball_y[ball]+3 );
 		}
+		
+		drawn_ball_x[ball] = ball_x;
+		drawn_ball_y[ball] = ball_y;
 	}
-
-	else if ( DISPLAY_NUMBER == 2 )
+	
+	if ( net_touched ) Graphics_drawDash(11,160,229,160,LT24_WHITE);
+	Render_Bricks();
+	Game_Scoreboard_draw ( game.player_1_score, game.player_2_score );
+	
+	/* Draw pass. */
+	for ( ball = 0; ball < balls->count; ball++ )
 	{
-
-		switch (HEX_NUMBER)
+		if ( ball >= drawn_ball_count )										// Not on the screen yet.
 		{
-			case 0: *HEX_2 = 63;break;
-			case 1: *HEX_2 = 6;break;
-			case 2: *HEX_2 = 91;break;
-			case 3: *HEX_2 = 79;break;
-			case 4: *HEX_2 = 102;break;
-			case 5: *HEX_2 = 109;break;
-			case 6: *HEX_2 = 125;break;
-			case 7: *HEX_2 = 07;break;
-			case 8: *HEX_2 = 127;break;
-			case 9: *HEX_2 = 103;break;
-			case 10: *HEX_2 = 119;break;
-			case 11: *HEX_2 = 124;break;
-			case 12: *HEX_2 = 57;break;
-			case 13: *HEX_2 = 94;break;
-			case 14: *HEX_2 = 121;break;
-			case 15: *HEX_2 = 113;break;
-			case 16: *HEX_2 = 0x6F; break;
+			drawn_ball_x[ball] = Interpolate ( balls->previous_x[ball], balls->current_x[ball], alpha );
+			drawn_ball_y[ball] = Interpolate ( balls->previous_y[ball], balls->current_y[ball], alpha );
 		}
+		Graphics_drawBall(drawn_ball_x[ball],drawn_ball_y[ball],drawn_ball_x[ball]+3,drawn_ball_y[ball]+3,ball_colours[ball % 8]);	// The ball stays on the screen until the next frame.
 	}
+	
+	drawn_ball_count = balls->count;
+}
 
-	else if ( DISPLAY_NUMBER == 3 )
+/* Internal function to erase every ball on the screen. */
+void Erase_Balls ( void )
+{
+	unsigned int ball;
+	
+	for ( ball = 0; ball < drawn_ball_count; ball++ )
 	{
-
-		switch (HEX_NUMBER)
-		{
-			case 0: *HEX_3 = 63;break;
-			case 1: *HEX_3 = 6;break;
-			case 2: *HEX_3 = 91;break;
-			case 3: *HEX_3 = 79;break;
-			case 4: *HEX_3 = 102;break;
-			case 5: *HEX_3 = 109;break;
-			case 6: *HEX_3 = 125;break;
-			case 7: *HEX_3 = 07;break;
-			case 8: *HEX_3 = 127;break;
-			case 9: *HEX_3 = 103;break;
-			case 10: *HEX_3 = 119;break;
-			case 11: *HEX_3 = 124;break;
-			case 12: *HEX_3 = 57;break;
-			case 13: *HEX_3 = 94;break;
-			case 14: *HEX_3 = 121;break;
-			case 15: *HEX_3 = 113;break;
-			case 16: *HEX_3 = 0x54; break;
-		}
+		Graphics_Erase ( drawn_ball_x[ball], drawn_ball_y[ball], drawn_ball_x[ball]+3, drawn_ball_y[ball]+3, fillColour );
+		Game_Scoreboard_touch ( drawn_ball_x[ball], drawn_ball_y[ball], drawn_ball_x[ball]+3, drawn_ball_y[ball]+3 );
+		if ( game.mode == GAME_MODE_BRICKS ) Touch_Bricks ( drawn_ball_x[ball], drawn_ball_y[ball], drawn_ball_x[ball]+3, drawn_ball_y[ball]+3 );
 	}
+	drawn_ball_count = 0;
+}
 
-	else if ( DISPLAY_NUMBER == 4 )
+/* Function to draw the game as it is at a fraction alpha (0 to GAME_ALPHA_ONE) of the way through the current tick. */
+signed int Game_Render ( unsigned int alpha )
+{
+	unsigned int paddle;
+	
+	colour = LT24_WHITE;
+	fillColour = GAME_BACKGROUND_GREY;
+	
+	if ( game.state == GAME_STATE_OVER )
 	{
-
-		switch (HEX_NUMBER)
+		if ( drawn_state != GAME_STATE_OVER )
 		{
-			case 0: *HEX_4 = 63;break;
-			case 1: *HEX_4 = 6;break;
-			case 2: *HEX_4 = 91;break;
-			case 3: *HEX_4 = 79;break;
-			case 4: *HEX_4 = 102;break;
-			case 5: *HEX_4 = 109;break;
-			case 6: *HEX_4 = 125;break;
-			case 7: *HEX_4 = 07;break;
-			case 8: *HEX_4 = 127;break;
-			case 9: *HEX_4 = 103;break;
-			case 10: *HEX_4 = 119;break;
-			case 11: *HEX_4 = 124;break;
-			case 12: *HEX_4 = 57;break;
-			case 13: *HEX_4 = 94;break;
-			case 14: *HEX_4 = 121;break;
-			case 15: *HEX_4 = 113;break;
-			case 16: *HEX_4 =0x5C; break;
+			Game_Particles_clear();											// Drawn over by the winner screen.
+			Draw_Winner ( game.last_point_player );
 		}
+		drawn_state = GAME_STATE_OVER;
+		return GAME_SUCCESS;
 	}
-
-	else if ( DISPLAY_NUMBER == 5 )
+	
+	if ( game.state != drawn_state )
 	{
-
-		switch (HEX_NUMBER)
+		if ( game.state == GAME_STATE_SCORED )
 		{
-			case 0: *HEX_5 = 63;break;
-			case 1: *HEX_5 = 6;break;
-			case 2: *HEX_5 = 91;break;
-			case 3: *HEX_5 = 79;break;
-			case 4: *HEX_5 = 102;break;
-			case 5: *HEX_5 = 109;break;
-			case 6: *HEX_5 = 125;break;
-			case 7: *HEX_5 = 07;break;
-			case 8: *HEX_5 = 127;break;
-			case 9: *HEX_5 = 103;break;
-			case 10: *HEX_5 = 119;break;
-			case 11: *HEX_5 = 124;break;
-			case 12: *HEX_5 = 57;break;
-			case 13: *HEX_5 = 94;break;
-			case 14: *HEX_5 = 121;break;
-			case 15: *HEX_5 = 113;break;
-			case 16: *HEX_5 = 0x73; break;
-
+			Erase_Balls();													// Remove the ball that went past the paddle.
+			Graphics_drawDash(11,160,229,160,LT24_WHITE);
+			Graphics_drawBox ( 115, 75, 125, 85, ( game.last_point_player == 1 ) ? LT24_GREEN : LT24_RED, false, ( game.last_point_player == 1 ) ? LT24_GREEN : LT24_RED ); // Draw the box.
+			Graphics_drawBox ( 115, 235, 125, 245, ( game.last_point_player == 1 ) ? LT24_RED : LT24_GREEN, false, ( game.last_point_player == 1 ) ? LT24_RED : LT24_GREEN ); // Draw the box.
 		}
-	}
-
-	else if ( DISPLAY_NUMBER == 6 )
-	{
-
-		switch (HEX_NUMBER)
+		else
 		{
-			case 0: *HEX_6 = 63;break;
-			case 1: *HEX_6 = 6;break;
-			case 2: *HEX_6 = 91;break;
-			case 3: *HEX_6 = 79;break;
-			case 4: *HEX_6 = 102;break;
-			case 5: *HEX_6 = 109;break;
-			case 6: *HEX_6 = 125;break;
-			case 7: *HEX_6 = 07;break;
-			case 8: *HEX_6 = 127;break;
-			case 9: *HEX_6 = 103;break;
-			case 10: *HEX_6 = 119;break;
-			case 11: *HEX_6 = 124;break;
-			case 12: *HEX_6 = 57;break;
-			case 13: *HEX_6 = 94;break;
-			case 14: *HEX_6 = 121;break;
-			case 15: *HEX_6 = 113;break;
+			Graphics_drawBox ( 115, 75, 125, 85, GAME_BACKGROUND_GREY , false, GAME_BACKGROUND_GREY  ); // Erase the box.
+			Graphics_drawBox ( 115, 235, 125, 245, GAME_BACKGROUND_GREY , false, GAME_BACKGROUND_GREY  ); // Erase the box.
 		}
+		drawn_state = game.state;
 	}
-}
\ No newline at end of file
+	
+	/* The sparks are erased before the balls and drawn after them, so a spark erased over a ball cannot leave a hole in it. */
+	Game_Particles_erase ( fillColour );
+	if ( game.state == GAME_STATE_PLAYING )
+	{
+		Render_Balls ( alpha );
+	}
+	else
+	{
+		Render_Bricks();
+		Game_Scoreboard_draw ( game.player_1_score, game.player_2_score );
+	}
+	Game_Particles_draw();
+	
+	for ( paddle = 0; paddle < GAME_PADDLES; paddle++ ) Paddle_Draw ( paddle );
+	paddles_drawn = true;
+	HPS_ResetWatchdog();
+	
+	return GAME_SUCCESS;
+}
@@ -25,72 +25,91 @@
 /* Importing the required libraries. */
 /* Boolean variable type "bool" and "true"/"false" constants. */
 #include <stdbool.h> 														
+#include "Fixed_Point.h"
+#include "Game_Simulation.h"												// The rules, constants and state of the game.
+#include "Game_Opponent.h"													// The levels of the computer opponent.
 
-/* Error Codes*/
-#define GAME_SUCCESS       0
-
-/* Creating a function that returns maximum and minimum of two numbers. */
-#define MAX(number_1, number_2) (((number_1) > (number_2)) ? (number_1) : (number_2))
-#define MIN(number_1, number_2) (((number_1) < (number_2)) ? (number_1) : (number_2))
+/* The colour of the background. */
+#define GAME_BACKGROUND_GREY (0x39E7) 
 
-//////////////////////////////////////// INITIAL CONSTANT POSITIONS //////////////////////////////////////
+/* Size of a paddle on the screen. The paddle box includes both corners, one pixel more than its size. */
+#define PADDLE_DRAWN_LENGTH     ( PADDLE_LENGTH + 1 )
+#define PADDLE_DRAWN_WIDTH      ( PADDLE_WIDTH + 1 )
 
-/* A paddle is a rectangle with length 20 pixels and width 5 width. Therefore, it has a right top coordinate and left-bottom coordinate. */
+//////////////////////////////////////// FIXED TIMESTEP LOOP ///////////////////////////////////////////
 
-/* Constant paddle dimensions. */
-#define PADDLE_LENGTH 40
-#define PADDLE_WIDTH  2
+/* The game advances in fixed ticks of GAME_TICK_US raised by a periodic timer interrupt. */
+#define GAME_MAX_CATCH_UP_TICKS 8											// Ticks run at most per frame, the rest are dropped.
 
-#define PADDLE_1_CENTER_X	119
-#define PADDLE_2_CENTER_X	119
+/* Interpolation fraction used by Game_Render(). */
+#define GAME_ALPHA_ONE          256
 
-#define MINIMUM_PADDLE_X 11
-#define MAXIMUM_PADDLE_X 229
+/* The bounce sound is held for 10ms. */
+#define BOUNCE_SOUND_TICKS      ( 10000 / GAME_TICK_US )
 
-#define PADDLE_INCREMENT 1
-#define PADDLE_DECREMENT 1
+/* Sources of the inputs of the game. */
+#define GAME_INPUT_LIVE         0											// Read from the board.
+#define GAME_INPUT_RECORD       1											// Read from the board and recorded into game_replay.
+#define GAME_INPUT_REPLAY       2											// Played back from game_replay.
 
-/* Paddle 1 (x1,y1) point. */
-#define PADDLE_1_START_X_1	PADDLE_1_CENTER_X - ( PADDLE_LENGTH / 2 )
-#define PADDLE_1_START_Y_1	7
+/* Polls of the link from the slave board each time it is read. A byte takes a few polls when the slave is keeping up. */
+#define GAME_LINK_POLLS         256
 
-/* Paddle 1 (x2,y2) point. */
-#define PADDLE_1_START_X_2	PADDLE_1_CENTER_X + ( PADDLE_LENGTH / 2 )
-#define PADDLE_1_START_Y_2	9
+/* Polls of the link in its interrupt: enough for the symbol that raised it, and the next if the other end is quick. */
+#define GAME_LINK_IRQ_POLLS     8
 
-/* Paddle 2 (x1,y1) point. */
-#define PADDLE_2_START_X_1	PADDLE_2_CENTER_X - ( PADDLE_LENGTH / 2 )
-#define PADDLE_2_START_Y_1	311
+/* The mailbox of the values last sent by the slave board. */
+#define LINK_MAILBOX_PADDLE     0xFF										// Camera position of paddle 1.
+#define LINK_MAILBOX_PLAYING    0x100										// The slave board is in its start mode.
 
-/* Paddle 2 (x2,y2) point. */
-#define PADDLE_2_START_X_2	PADDLE_2_CENTER_X + ( PADDLE_LENGTH / 2 )
-#define PADDLE_2_START_Y_2	313
+/* Push button that switches the computer opponent in and out. */
+#define GAME_KEY_OPPONENT       0x8
 
-/* The colour of the background. */
-#define GAME_BACKGROUND_GREY (0x39E7) 
+/* The game played on the board. */
+extern Game_State game;
 
 //////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
 
-/* Function to initialize PADDLE 1 with two coordinates: top-left (x1,y1) and bottom_right (x2,y2) with a boundary colour. */
-signed int Paddle_1_Initialize ( void );
+/* Function to start the game with a number of balls, one of the GAME_MODE_ courts and one of the GAME_INPUT_ sources.
+   The next Game_Render() draws the paddles, the bricks and the balls. A replay brings its own number of balls and mode. */
+signed int Game_Initialize ( unsigned int ball_count, unsigned int mode, unsigned int input_mode );
 
-/* Function to initialize PADDLE 2 with two coordinates: top-left (x1,y1) and bottom_right (x2,y2) with a boundary colour. */
-signed int Paddle_2_Initialize ( void );
+/* Function to open the packet link on the parallel port at port_address: the control channel from the slave board and the
+   mirror channel, which sends it the view of the match every tick. Returns LINK_SUCCESS. */
+signed int Game_openLink ( unsigned int port_address );
 
-/* Function to draw PADDLE 1 with two coordinates: top-left (x,y) and fixed paddle dimensions with a boundary colour. */
-signed int Paddle_1_Draw ( unsigned int PADDLE_1_X, unsigned int PADDLE_1_Y );
+/* Function to take the bytes the slave board has sent since the last call, and the packets they completed, and to move
+   the mirror channel on. */
+void Game_pollLink ( void );
 
-/* Function to draw PADDLE 2 with two coordinates: top-left (x,y) and fixed paddle dimensions with a boundary colour. */
-signed int Paddle_2_Draw ( unsigned int PADDLE_2_X, unsigned int PADDLE_2_Y );
+/* Function to poll the link from the interrupt of the parallel port, IRQ_LSC_GPIO_JP2 for JP2, and from the tick interrupt,
+   instead of from the game loop. Game_pollLink() then does nothing. The handler must call Game_linkInterrupt(). */
+signed int Game_enableLinkInterrupt ( void );
+void Game_linkInterrupt ( void );
 
-/* Function to draw the dashed line with points: (x1,y1) and (x2,y2) with a boundary colour. */
-signed int Graphics_drawDash(unsigned int x1, unsigned int y1, unsigned int x2,  unsigned int y2, unsigned short colour);
+/* Function to check whether the slave board is in its start mode. The game is paused otherwise. */
+bool Game_isSlavePlaying ( void );
+
+/* Function to read the inputs of a tick from the camera, the push buttons and the slide switches. */
+void Game_readInputRecord ( Game_InputRecord *record );
+
+/* Function to set how many ticks late the camera position of paddle 1 arrives from the slave board. The game is rolled back
+   by this many ticks when a new position arrives, 0 to GAME_ROLLBACK_MAX_DELAY. 0 never rolls back. */
+signed int Game_setLinkDelay ( unsigned int ticks );
 
-/* Function to move paddle 1 based on the buttons. */
-signed int Move_Paddle_1 ( void );
+/* Function to choose the paddle, PADDLE_1 or PADDLE_2, and the GAME_OPPONENT_ level of the computer opponent.
+   KEY3 switches it in and out: it plays instead of the camera or the push buttons of its paddle. */
+signed int Game_setOpponent ( unsigned int paddle, unsigned int level );
 
-/* Function to move paddle 2 based on the buttons. */
-signed int Move_Paddle_2 ( void );
+/* Functions to follow a replay: whether its last tick has been played, and whether it ended in the recorded state. */
+bool Game_isReplayDone ( void );
+bool Game_verifyReplay ( void );
+
+/* Function to draw a paddle that has moved since it was last drawn. */
+signed int Paddle_Draw ( unsigned int paddle );
+
+/* Function to draw the dashed line with points: (x1,y1) and (x2,y2) with a boundary colour. */
+signed int Graphics_drawDash(unsigned int x1, unsigned int y1, unsigned int x2,  unsigned int y2, unsigned short colour);
 
 /* Function to draw ball on the screen. */
 signed int Graphics_drawBall(unsigned int x1, unsigned int y1, unsigned int x2,  unsigned int y2, unsigned short colour);
@@ -98,17 +117,48 @@ signed int Graphics_drawBall(unsigned int x1, unsigned int y1, unsigned int x2,
 /* Function to erase ball from the screen. */
 signed int Graphics_Erase(unsigned int x1, unsigned int y1, unsigned int x2,  unsigned int y2, unsigned short fillColour);
 
-/* Function to move the ball around the screen. */
-signed int Move_Ball ( void );
+/* Fixed-size fills generated by GRAPHICS_DEFINE_FILL for the ball and the paddles, and the strips of a paddle sliding sideways. */
+signed int Ball_Fill ( unsigned int x, unsigned int y, unsigned short colour );
+signed int Paddle_Fill ( unsigned int x, unsigned int y, unsigned short colour );
+signed int Paddle_Strip ( unsigned int x, unsigned int y, unsigned int width, unsigned short colour );
+
+/* Function to set the number of balls in play, 1 to GAME_MAX_BALLS. More than one ball is the multi-ball mode. */
+signed int Game_setBallCount ( unsigned int count );
+
+/* Function to read the number of balls in play. */
+unsigned int Game_getBallCount ( void );
+
+/* Function to show the scores on the seven segment displays. */
+void Game_showScores ( void );
+
+/* Function to start a new game with the same number of balls. */
+signed int Game_Restart ( void );
+
+/* Function to check whether a player has won. */
+bool Game_isOver ( void );
+
+/* Function to advance the game by one fixed tick of GAME_TICK_US microseconds. Paddle inputs are read here. */
+signed int Game_Tick ( void );
+
+/* Function to be called from the periodic timer interrupt. It counts the tick, and polls the link if its interrupt is enabled. */
+void Game_timerTick ( void );
+
+/* Function to run a number of ticks straight away, without waiting for the timer. Returns how many were run. */
+unsigned int Game_runTicks ( unsigned int ticks );
+
+/* Function to run the ticks counted since the last call, returns how many were run. */
+unsigned int Game_runPendingTicks ( void );
+
+/* Function to drop the ticks counted while the game is paused. */
+void Game_discardPendingTicks ( void );
 
-/* Round off function. */
-unsigned int round_off(float num);
+/* Function to return how far the game is into the current tick, from 0 to GAME_ALPHA_ONE. */
+unsigned int Game_tickFraction ( void );
 
-/* Seven Segment displays. */
-void Display_Seven_Segment(int DISPLAY_NUMBER, int HEX_NUMBER);
+/* Function to make the next Game_Render() redraw the scores, the score boxes or the winner screen, after the screen was cleared. */
+void Game_forceRedraw ( void );
 
-/* Function to update scores of players. */
-void Update_Score_1 ( void );
-void Update_Score_2 ( void );
+/* Function to draw the game, interpolated a fraction alpha of the way through the current tick. */
+signed int Game_Render ( unsigned int alpha );
 
 #endif /* GAME_ENGINE_H_ */
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Spectator Mirror of PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Mirror.c
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Encoding of the view of the match into mirror packets, and decoding
+ *  	of the packets back into a view.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Game_Mirror.h"													// Invoking the main header file.
+
+/* Every field of a keyframe. */
+#define MIRROR_ALL_FIELDS       ( MIRROR_PADDLES | MIRROR_SCORES | MIRROR_STATE | MIRROR_BALLS_MOVED )
+
+/* Function to encode the view now as changes from the view sent last time, or as a keyframe. Returns the length of the packet. */
+unsigned int Game_Mirror_encode ( const Game_MirrorView *now, const Game_MirrorView *sent, bool key, unsigned char *payload )
+{
+	unsigned int flags = 0;
+	unsigned int length = 1;
+	unsigned int ball;
+	signed int move_x;
+	signed int move_y;
+
+	if ( !sent->valid || now->ball_count != sent->ball_count ) key = true;	// New balls have nothing to move from.
+
+	/* A ball that jumped further than a signed byte, such as a serve, needs a keyframe. */
+	for ( ball = 0; ball < now->ball_count && !key; ball++ )
+	{
+		move_x = (signed int)now->ball_x[ball] - (signed int)sent->ball_x[ball];
+		move_y = (signed int)now->ball_y[ball] - (signed int)sent->ball_y[ball];
+		if ( move_x < -128 || move_x > 127 || move_y < -128 || move_y > 127 ) key = true;
+		if ( move_x != 0 || move_y != 0 ) flags |= MIRROR_BALLS_MOVED;
+	}
+
+	if ( key )
+	{
+		flags = MIRROR_KEY | MIRROR_ALL_FIELDS;
+	}
+	else
+	{
+		if ( now->paddle_x[0] != sent->paddle_x[0] || now->paddle_x[1] != sent->paddle_x[1] ) flags |= MIRROR_PADDLES;
+		if ( now->score[0] != sent->score[0] || now->score[1] != sent->score[1] ) flags |= MIRROR_SCORES;
+		if ( now->state != sent->state || now->last_point_player != sent->last_point_player ) flags |= MIRROR_STATE;
+		if ( flags == 0 ) return 0;											// Nothing changed.
+	}
+
+	payload[0] = (unsigned char)flags;
+	if ( flags & MIRROR_PADDLES )
+	{
+		payload[length++] = now->paddle_x[0];
+		payload[length++] = now->paddle_x[1];
+	}
+	if ( flags & MIRROR_SCORES )
+	{
+		payload[length++] = now->score[0];
+		payload[length++] = now->score[1];
+	}
+	if ( flags & MIRROR_STATE )
+	{
+		payload[length++] = now->state;
+		payload[length++] = now->last_point_player;
+	}
+	if ( flags & MIRROR_BALLS_MOVED )
+	{
+		payload[length++] = now->ball_count;
+		for ( ball = 0; ball < now->ball_count; ball++ )
+		{
+			if ( key )
+			{
+				payload[length++] = now->ball_x[ball];
+				payload[length++] = (unsigned char)now->ball_y[ball];
+				payload[length++] = (unsigned char)( now->ball_y[ball] >> 8 );
+			}
+			else
+			{
+				payload[length++] = (unsigned char)( now->ball_x[ball] - sent->ball_x[ball] );
+				payload[length++] = (unsigned char)( now->ball_y[ball] - sent->ball_y[ball] );
+			}
+		}
+	}
+
+	return length;
+}
+
+/* Function to apply a packet to a view. Returns false, with the view unchanged, if it cannot be applied. */
+bool Game_Mirror_decode ( Game_MirrorView *view, const unsigned char *payload, unsigned int length )
+{
+	Game_MirrorView next = *view;
+	unsigned int flags;
+	unsigned int index = 1;
+	unsigned int ball;
+	bool key;
+
+	if ( length < 1 ) return false;
+	flags = payload[0];
+	key = ( flags & MIRROR_KEY ) != 0;
+	if ( key && ( flags & MIRROR_ALL_FIELDS ) != MIRROR_ALL_FIELDS ) return false;
+	if ( !key && !view->valid ) return false;								// Changes from a view that was missed.
+
+	if ( flags & MIRROR_PADDLES )
+	{
+		if ( index + 2 > length ) return false;
+		next.paddle_x[0] = payload[index++];
+		next.paddle_x[1] = payload[index++];
+	}
+	if ( flags & MIRROR_SCORES )
+	{
+		if ( index + 2 > length ) return false;
+		next.score[0] = payload[index++];
+		next.score[1] = payload[index++];
+	}
+	if ( flags & MIRROR_STATE )
+	{
+		if ( index + 2 > length ) return false;
+		next.state = payload[index++];
+		next.last_point_player = payload[index++];
+	}
+	if ( flags & MIRROR_BALLS_MOVED )
+	{
+		if ( index + 1 > length ) return false;
+		next.ball_count = payload[index++];
+		if ( next.ball_count > MIRROR_BALLS ) return false;
+		if ( !key && next.ball_count != view->ball_count ) return false;
+		if ( index + next.ball_count * ( key ? 3 : 2 ) > length ) return false;
+		for ( ball = 0; ball < next.ball_count; ball++ )
+		{
+			if ( key )
+			{
+				next.ball_x[ball] = payload[index];
+				next.ball_y[ball] = (unsigned short)( payload[index + 1] | ( payload[index + 2] << 8 ) );
+				index += 3;
+			}
+			else
+			{
+				next.ball_x[ball] = (unsigned char)( next.ball_x[ball] + (signed char)payload[index] );
+				next.ball_y[ball] = (unsigned short)( next.ball_y[ball] + (signed char)payload[index + 1] );
+				index += 2;
+			}
+		}
+	}
+	if ( index != length ) return false;
+
+	next.valid = true;
+	*view = next;
+	return true;
+}
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Spectator Mirror of PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Mirror.h
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	What a spectator needs to draw the match: the balls, the paddles,
+ *  	the scores and the state of the game, in pixels. The master board
+ *  	sends it to the slave board in LINK_MSG_MIRROR packets over the
+ *  	mirror channel of the link, only the state and never the pixels.
+ *
+ *  	A packet starts with a byte of flags saying which fields follow.
+ *  	A keyframe has every field, absolute. Any other packet only has
+ *  	the fields that changed since the last packet sent, with the balls
+ *  	as moves of a signed byte in x and y, a few bytes a tick. The
+ *  	sender falls back on a keyframe when a move does not fit or the
+ *  	number of balls changed, and sends one every MIRROR_KEY_TICKS
+ *  	ticks anyway. A receiver that missed a packet ignores the changes
+ *  	until the next keyframe.
+ *
+ *  	The same file is built on both boards and on a PC.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAME_MIRROR_H_
+#define GAME_MIRROR_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+
+/* The first MIRROR_BALLS balls in play are mirrored. */
+#define MIRROR_BALLS            8
+
+/* A keyframe is sent at least this often, so that a spectator that missed a packet is not out for long. */
+#define MIRROR_KEY_TICKS        64
+
+/* Flags, the first byte of a packet. The fields follow in this order. */
+#define MIRROR_KEY              0x01										// Every field, absolute.
+#define MIRROR_PADDLES          0x02										// x of paddle 1 and paddle 2.
+#define MIRROR_SCORES           0x04										// Score of player 1 and player 2.
+#define MIRROR_STATE            0x08										// Game state, then the player who won the last point.
+#define MIRROR_BALLS_MOVED      0x10										// Number of balls, then x and y of each: moves in signed bytes,
+																			// or in a keyframe x and y low and high.
+
+/* States of the game, the GAME_STATE_ values of Game_Simulation.h. */
+#define MIRROR_STATE_PLAYING    0
+#define MIRROR_STATE_SCORED     1											// Pause after a point.
+#define MIRROR_STATE_OVER       2											// A player won.
+
+/* Longest packet: a keyframe with every ball. */
+#define MIRROR_MAX_BYTES        ( 8 + 3 * MIRROR_BALLS )
+
+/* The match as a spectator sees it. */
+typedef struct {
+	bool valid;																// False until the first keyframe.
+	unsigned char paddle_x [2];												// Top-left corner of paddle 1 and paddle 2.
+	unsigned char score [2];												// Player 1 and player 2.
+	unsigned char state;													// One of the MIRROR_STATE_ values.
+	unsigned char last_point_player;										// 1 or 2, 0 before the first point.
+	unsigned char ball_count;												// Balls mirrored, up to MIRROR_BALLS.
+	unsigned char ball_x [MIRROR_BALLS];									// Top-left corner of each ball.
+	unsigned short ball_y [MIRROR_BALLS];
+} Game_MirrorView;
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to encode the view now into a packet of at most MIRROR_MAX_BYTES, as changes from the view sent last time,
+   or a keyframe if key is true or sent is not valid. Returns the length of the packet, 0 if nothing changed. */
+unsigned int Game_Mirror_encode ( const Game_MirrorView *now, const Game_MirrorView *sent, bool key, unsigned char *payload );
+
+/* Function to apply a packet to a view. Returns false, with the view unchanged, for a packet that is not a keyframe
+   while the view is not valid, or a packet that does not hold what its flags say. */
+bool Game_Mirror_decode ( Game_MirrorView *view, const unsigned char *payload, unsigned int length );
+
+#endif /* GAME_MIRROR_H_ */
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Computer Opponent for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Opponent.c
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Analytic intercept of the balls and the paddle inputs of the
+ *  	computer opponent.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Game_Opponent.h"													// Invoking the main header file.
+#include <stdlib.h>															// Importing abs().
+
+/* Reaction time, aiming error and paddle 1 speed of each level. */
+static const unsigned int opponent_levels [GAME_OPPONENT_LEVELS][3] = {
+	{ 60, 40, 2 },															// Easy: looks every 240ms and aims up to 40 pixels off.
+	{ 25, 26, 3 },															// Normal: every 100ms, 26 pixels.
+	{  5, 12, 4 }															// Hard: every 20ms, 12 pixels: inside the paddle.
+};
+
+/* Paddle 2 does not move when it is this close to its target, so that it does not shake. */
+#define OPPONENT_DEAD_BAND 1
+
+/* Function to set up an opponent playing a paddle at one of the GAME_OPPONENT_ levels. The seed selects its aiming errors. */
+signed int Game_Opponent_initialise ( Game_Opponent *opponent, unsigned int paddle, unsigned int level, unsigned int seed )
+{
+	if ( paddle >= GAME_PADDLES || level >= GAME_OPPONENT_LEVELS ) return GAME_OPPONENT_INVALID;
+
+	opponent->paddle = paddle;
+	opponent->reaction_ticks = opponent_levels[level][0];
+	opponent->error = opponent_levels[level][1];
+	opponent->speed = opponent_levels[level][2];
+	opponent->wait = 0;
+	opponent->target_x = ( paddle == PADDLE_1 ) ? PADDLE_1_START_X_1 : PADDLE_2_START_X_1;
+	opponent->commanded_x = opponent->target_x;
+	opponent->random = ( seed != 0 ) ? seed : 0x9E3779B9;
+
+	return GAME_OPPONENT_SUCCESS;
+}
+
+/* Function to find where a ball crosses the line of a paddle, bounces off the side walls included.
+   The side walls are mirrors: the ball goes on in a straight line through copies of the court, and the crossing
+   in the copy is folded back into the court. */
+bool Game_Opponent_intercept ( const Game_State *state, unsigned int ball, unsigned int paddle, signed int *x, fixed *distance )
+{
+	fixed direction_x = state->balls.direction_x[ball];
+	fixed direction_y = state->balls.direction_y[ball];
+	fixed travel_y;
+	signed long long width = INT_TO_FIXED(BALL_MAXIMUM_X - BALL_MINIMUM_X);
+	signed long long unfolded;
+
+	if ( paddle == PADDLE_1 )
+	{
+		if ( direction_y >= 0 ) return false;
+		travel_y = INT_TO_FIXED(BALL_MINIMUM_Y) - state->balls.y[ball];
+	}
+	else
+	{
+		if ( direction_y <= 0 ) return false;
+		travel_y = INT_TO_FIXED(BALL_MAXIMUM_Y) - state->balls.y[ball];
+	}
+
+	/* Straight-line crossing, from the left wall, then folded into 0 to width. */
+	unfolded = state->balls.x[ball] - INT_TO_FIXED(BALL_MINIMUM_X) + ( (signed long long)travel_y * direction_x ) / direction_y;
+	unfolded %= 2 * width;
+	if ( unfolded < 0 ) unfolded += 2 * width;
+	if ( unfolded > width ) unfolded = 2 * width - unfolded;
+
+	*x = BALL_MINIMUM_X + FIXED_ROUND(unfolded);
+	*distance = FIXED_DIV ( abs ( travel_y ), abs ( direction_y ) );			// |direction_y| is at least one half.
+
+	return true;
+}
+
+/* Internal function to pick a random aiming error from -error to +error pixels. */
+signed int Opponent_Error ( Game_Opponent *opponent )
+{
+	opponent->random ^= opponent->random << 13;								// Xorshift32.
+	opponent->random ^= opponent->random >> 17;
+	opponent->random ^= opponent->random << 5;
+
+	return (signed int)( ( opponent->random >> 8 ) % ( 2 * opponent->error + 1 ) ) - (signed int)opponent->error;
+}
+
+/* Internal function to look at the court and aim at the ball that reaches the paddle first, or at the centre when none is coming. */
+void Opponent_Look ( Game_Opponent *opponent, const Game_State *state )
+{
+	unsigned int length = state->paddles.length[opponent->paddle];
+	signed int target = (signed int)( ( opponent->paddle == PADDLE_1 ) ? PADDLE_1_CENTER_X : PADDLE_2_CENTER_X ) - (signed int)( length / 2 );
+	fixed nearest = 0;
+	fixed distance;
+	signed int x;
+	unsigned int ball;
+	bool found = false;
+
+	if ( state->state == GAME_STATE_PLAYING )
+	{
+		for ( ball = 0; ball < state->balls.count; ball++ )
+		{
+			if ( Game_Opponent_intercept ( state, ball, opponent->paddle, &x, &distance ) && ( !found || distance < nearest ) )
+			{
+				target = x + ( BALL_SIZE / 2 ) - (signed int)( length / 2 ) + Opponent_Error ( opponent );
+				nearest = distance;
+				found = true;
+			}
+		}
+	}
+
+	target = MAX ( target, MINIMUM_PADDLE_X );
+	target = MIN ( target, (signed int)( MAXIMUM_PADDLE_X - length ) );
+	opponent->target_x = (unsigned int)target;
+}
+
+/* Function to play a tick: replaces the inputs of the opponent's paddle in the record read from the board. */
+void Game_Opponent_play ( Game_Opponent *opponent, const Game_State *state, Game_InputRecord *record )
+{
+	unsigned int paddle_x = state->paddles.x[opponent->paddle];
+	unsigned int target_x;
+
+	if ( opponent->wait == 0 )
+	{
+		Opponent_Look ( opponent, state );
+		opponent->wait = opponent->reaction_ticks;
+	}
+	opponent->wait--;
+	target_x = opponent->target_x;
+
+	if ( opponent->paddle == PADDLE_1 )
+	{
+		/* Paddle 1 is placed by the camera position, 4/5 of the paddle position. Rounded so that small steps still move it.
+		   The steps are taken from the position sent last, as the tracked paddle runs ahead of it while it moves. */
+		paddle_x = opponent->commanded_x;
+		if ( target_x > paddle_x + opponent->speed ) paddle_x += opponent->speed;
+		else if ( target_x + opponent->speed < paddle_x ) paddle_x -= opponent->speed;
+		else paddle_x = target_x;
+		opponent->commanded_x = paddle_x;
+		record->link = (unsigned char)MIN ( ( paddle_x * 4 + 2 ) / 5, 255 );
+	}
+	else
+	{
+		record->keys &= ~0x3;
+		if ( target_x > paddle_x + OPPONENT_DEAD_BAND ) record->keys |= 0x1;
+		else if ( target_x + OPPONENT_DEAD_BAND < paddle_x ) record->keys |= 0x2;
+	}
+}
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Computer Opponent for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Opponent.h
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Plays one of the paddles for a single player. The opponent works
+ *  	out where a ball will cross its paddle line in one go: the path is
+ *  	unfolded across the side walls, so the bounces are a reflection of
+ *  	the straight-line crossing and cost nothing however fast the ball
+ *  	is. It only looks at the court every few ticks and aims with a
+ *  	random error, which sets how hard it is to beat.
+ *  	The opponent writes the inputs of its paddle into the record read
+ *  	from the board, so the game and the replays see it as a player.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAME_OPPONENT_H_
+#define GAME_OPPONENT_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+#include "Game_Simulation.h"
+
+/* Error Codes*/
+#define GAME_OPPONENT_SUCCESS       0
+#define GAME_OPPONENT_INVALID      -1
+
+/* Levels of the opponent. */
+#define GAME_OPPONENT_EASY          0
+#define GAME_OPPONENT_NORMAL        1
+#define GAME_OPPONENT_HARD          2
+#define GAME_OPPONENT_LEVELS        3
+
+/* The opponent and its current plan. */
+typedef struct {
+	unsigned int paddle;													// PADDLE_1 or PADDLE_2.
+	unsigned int reaction_ticks;											// Ticks between two looks at the court.
+	unsigned int error;														// Largest aiming error in pixels.
+	unsigned int speed;														// Pixels paddle 1 moves per tick. Paddle 2 moves as fast as the push buttons.
+	unsigned int wait;														// Ticks until the next look.
+	unsigned int target_x;													// Paddle position aimed at.
+	unsigned int commanded_x;												// Paddle 1 position last sent as the camera position.
+	unsigned int random;													// State of the opponent's own random number generator.
+} Game_Opponent;
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to set up an opponent playing a paddle at one of the GAME_OPPONENT_ levels. The seed selects its aiming errors. */
+signed int Game_Opponent_initialise ( Game_Opponent *opponent, unsigned int paddle, unsigned int level, unsigned int seed );
+
+/* Function to find where a ball crosses the line of a paddle, bounces off the side walls included.
+   Returns false when the ball moves away from the paddle. Otherwise x is the left edge of the ball there, in pixels,
+   and distance is the length of its path to get there, in Q16.16 pixels. */
+bool Game_Opponent_intercept ( const Game_State *state, unsigned int ball, unsigned int paddle, signed int *x, fixed *distance );
+
+/* Function to play a tick: replaces the inputs of the opponent's paddle in the record read from the board. */
+void Game_Opponent_play ( Game_Opponent *opponent, const Game_State *state, Game_InputRecord *record );
+
+#endif /* GAME_OPPONENT_H_ */
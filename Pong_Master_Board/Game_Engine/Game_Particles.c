@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Spark Effects for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Particles.c
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	The spark pool, its integration and its sorted erase and draw
+ *  	passes.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Game_Particles.h"													// Invoking the main header file.
+#include "../DE1Soc_LT24/DE1SoC_LT24.h"	 									// Importing the LT24 size used by the blitter.
+#include "../Graphics_Engine/Graphics_Blit.h"								// Importing the fixed-size blitter generator.
+
+/* Sparks stay inside the court and die at the net, so erasing them never cuts the border, the paddles or the net. */
+#define PARTICLE_MINIMUM_X        11
+#define PARTICLE_MAXIMUM_X        ( 229 - PARTICLE_SIZE + 1 )
+#define PARTICLE_MINIMUM_Y        11
+#define PARTICLE_MAXIMUM_Y        ( 309 - PARTICLE_SIZE + 1 )
+#define PARTICLE_NET_Y            160
+
+/* The live sparks, the first particle_count entries of each array. */
+fixed particle_x [GAME_PARTICLES_MAX];										// Top-left corner in Q16.16 pixels.
+fixed particle_y [GAME_PARTICLES_MAX];
+fixed particle_velocity_x [GAME_PARTICLES_MAX];								// Q16.16 pixels per tick.
+fixed particle_velocity_y [GAME_PARTICLES_MAX];
+unsigned short particle_colour [GAME_PARTICLES_MAX];
+unsigned char particle_life [GAME_PARTICLES_MAX];							// Ticks left.
+unsigned int particle_count = 0;
+
+/* The sparks on the screen, in the order they were drawn. */
+unsigned int particle_drawn [GAME_PARTICLES_MAX];							// Offset of the top-left pixel in the LT24, y * LT24_WIDTH + x.
+unsigned int particle_drawn_count = 0;
+
+/* The live sparks by their offset in the LT24. Kept from frame to frame, so it is nearly sorted already. */
+unsigned char particle_order [GAME_PARTICLES_MAX];
+unsigned int particle_key [GAME_PARTICLES_MAX];
+
+/* Random numbers for the sparks only, so that the game's own generator is not touched. */
+unsigned int particle_random = 0x2545F491;
+
+/* Unrolled fill for a spark. */
+GRAPHICS_DEFINE_FILL ( Particle_Fill, PARTICLE_SIZE, PARTICLE_SIZE )
+
+/* Internal function to return the next random number of the sparks (xorshift32). */
+unsigned int Particle_Random ( void )
+{
+	particle_random ^= particle_random << 13;
+	particle_random ^= particle_random >> 17;
+	particle_random ^= particle_random << 5;
+	return particle_random;
+}
+
+/* Internal function to remove a spark by moving the last one into its place. */
+void Particle_Remove ( unsigned int particle )
+{
+	unsigned int last = --particle_count;
+	unsigned int position;
+	unsigned int kept = 0;
+
+	/* Take the spark out of the draw order and give the last one its number. */
+	for ( position = 0; position <= last; position++ )
+	{
+		if ( particle_order[position] == particle ) continue;
+		particle_order[kept++] = ( particle_order[position] == last ) ? particle : particle_order[position];
+	}
+
+	particle_x[particle] = particle_x[last];
+	particle_y[particle] = particle_y[last];
+	particle_velocity_x[particle] = particle_velocity_x[last];
+	particle_velocity_y[particle] = particle_velocity_y[last];
+	particle_colour[particle] = particle_colour[last];
+	particle_life[particle] = particle_life[last];
+}
+
+/* Function to remove every spark without erasing it, after the screen was cleared. */
+void Game_Particles_clear ( void )
+{
+	particle_count = 0;
+	particle_drawn_count = 0;
+}
+
+/* Function to start a burst of sparks at LT24 pixel (x,y), flying away from a paddle: along +y when direction_y is
+   positive, along -y otherwise. Sparks that do not fit in the pool are dropped. */
+void Game_Particles_burst ( unsigned int x, unsigned int y, signed int direction_y, unsigned int count, unsigned short colour )
+{
+	unsigned int particle;
+	fixed speed_y;
+
+	x = MIN ( MAX ( x, PARTICLE_MINIMUM_X ), PARTICLE_MAXIMUM_X );
+	y = MIN ( MAX ( y, PARTICLE_MINIMUM_Y ), PARTICLE_MAXIMUM_Y );
+
+	while ( count-- > 0 && particle_count < GAME_PARTICLES_MAX )
+	{
+		particle = particle_count++;
+		speed_y = PARTICLE_SPEED / 8 + (fixed)( Particle_Random() % ( PARTICLE_SPEED * 7 / 8 ) );	// Always some speed away from the paddle.
+
+		particle_x[particle] = INT_TO_FIXED(x);
+		particle_y[particle] = INT_TO_FIXED(y);
+		particle_velocity_x[particle] = (fixed)( Particle_Random() % ( 2 * PARTICLE_SPEED ) ) - PARTICLE_SPEED;
+		particle_velocity_y[particle] = ( direction_y > 0 ) ? speed_y : -speed_y;
+		particle_colour[particle] = colour;
+		particle_life[particle] = PARTICLE_LIFE_TICKS + ( Particle_Random() & 15 );
+		particle_order[particle] = particle;								// Sorted into place by the next draw.
+	}
+}
+
+/* Function to move the sparks by one tick of the game and remove the ones that burnt out or left the court. */
+void Game_Particles_update ( void )
+{
+	unsigned int particle = 0;
+	signed int x;
+	signed int y;
+
+	while ( particle < particle_count )
+	{
+		particle_x[particle] += particle_velocity_x[particle];
+		particle_y[particle] += particle_velocity_y[particle];
+		particle_velocity_x[particle] = FIXED_MUL ( particle_velocity_x[particle], PARTICLE_DRAG );
+		particle_velocity_y[particle] = FIXED_MUL ( particle_velocity_y[particle], PARTICLE_DRAG );
+
+		x = FIXED_ROUND ( particle_x[particle] );
+		y = FIXED_ROUND ( particle_y[particle] );
+
+		if ( --particle_life[particle] == 0 || x < PARTICLE_MINIMUM_X || x > PARTICLE_MAXIMUM_X || y < PARTICLE_MINIMUM_Y || y > PARTICLE_MAXIMUM_Y
+			 || ( y <= PARTICLE_NET_Y && y + PARTICLE_SIZE > PARTICLE_NET_Y ) )
+		{
+			Particle_Remove ( particle );									// The last spark moves here, look at this entry again.
+		}
+		else
+		{
+			particle++;
+		}
+	}
+}
+
+/* Function to erase the sparks drawn in the last frame. */
+void Game_Particles_erase ( unsigned short background )
+{
+	unsigned int drawn;
+
+	for ( drawn = 0; drawn < particle_drawn_count; drawn++ )
+	{
+		Particle_Fill ( particle_drawn[drawn] % LT24_WIDTH, particle_drawn[drawn] / LT24_WIDTH, background );
+	}
+	particle_drawn_count = 0;
+}
+
+/* Function to draw the live sparks. They are sorted by their offset in the LT24 with an insertion sort on the order
+   of the last frame, and that order is kept for the next erase. */
+void Game_Particles_draw ( void )
+{
+	unsigned int particle;
+	unsigned int position;
+	unsigned int moving;
+	unsigned int key;
+
+	for ( particle = 0; particle < particle_count; particle++ )
+	{
+		particle_key[particle] = (unsigned int)FIXED_ROUND ( particle_y[particle] ) * LT24_WIDTH + (unsigned int)FIXED_ROUND ( particle_x[particle] );
+	}
+
+	for ( position = 1; position < particle_count; position++ )
+	{
+		moving = particle_order[position];
+		key = particle_key[moving];
+		for ( particle = position; particle > 0 && particle_key[particle_order[particle - 1]] > key; particle-- )
+		{
+			particle_order[particle] = particle_order[particle - 1];
+		}
+		particle_order[particle] = moving;
+	}
+
+	for ( position = 0; position < particle_count; position++ )
+	{
+		particle = particle_order[position];
+		Particle_Fill ( particle_key[particle] % LT24_WIDTH, particle_key[particle] / LT24_WIDTH, particle_colour[particle] );
+		particle_drawn[position] = particle_key[particle];
+	}
+	particle_drawn_count = particle_count;
+}
@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Spark Effects for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Particles.h
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Bursts of sparks where a ball hits a paddle or goes past it. The
+ *  	sparks live in a fixed pool, one array per field, and move in
+ *  	Q16.16 pixels once per tick of the game. Nothing is allocated: when
+ *  	the pool is full new sparks are dropped, so the pool size is also
+ *  	the most sparks erased and drawn in a frame. Every frame all the
+ *  	sparks on the screen are erased and the live ones drawn again, both
+ *  	in the order of their rows on the LT24, the order of the frame
+ *  	buffer in memory.
+ *  	The sparks are only decoration and are not part of the game state,
+ *  	they do not change a replay or a rollback.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAME_PARTICLES_H_
+#define GAME_PARTICLES_H_
+
+/* Importing the required libraries. */
+#include "Fixed_Point.h"
+
+/* Size of the pool, and most sparks erased and drawn in a frame. */
+#define GAME_PARTICLES_MAX        48
+
+/* A spark is a PARTICLE_SIZE x PARTICLE_SIZE square. */
+#define PARTICLE_SIZE             2
+
+/* Sparks of a paddle hit and of a point. */
+#define PARTICLE_HIT_COUNT        8
+#define PARTICLE_SCORE_COUNT      16
+
+/* A spark lives PARTICLE_LIFE_TICKS plus up to 15 ticks, starts at up to PARTICLE_SPEED pixels per tick and slows down
+   by PARTICLE_DRAG every tick. It gets at most 24 pixels from where it started, away from the net and the scores. */
+#define PARTICLE_LIFE_TICKS       40
+#define PARTICLE_SPEED            ( FIXED_ONE * 3 / 4 )
+#define PARTICLE_DRAG             ( FIXED_ONE * 31 / 32 )
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to remove every spark without erasing it, after the screen was cleared. */
+void Game_Particles_clear ( void );
+
+/* Function to start a burst of sparks at LT24 pixel (x,y), flying away from a paddle: along +y when direction_y is
+   positive, along -y otherwise. Sparks that do not fit in the pool are dropped. */
+void Game_Particles_burst ( unsigned int x, unsigned int y, signed int direction_y, unsigned int count, unsigned short colour );
+
+/* Function to move the sparks by one tick of the game and remove the ones that burnt out or left the court. */
+void Game_Particles_update ( void );
+
+/* Function to erase the sparks drawn in the last frame. */
+void Game_Particles_erase ( unsigned short background );
+
+/* Function to draw the live sparks. */
+void Game_Particles_draw ( void );
+
+#endif /* GAME_PARTICLES_H_ */
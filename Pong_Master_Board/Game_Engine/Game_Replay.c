@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Input Recording and Replay for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Replay.c
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Records the inputs of a game into a replay log, and plays a log
+ *  	back through Game_Simulation_step().
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Game_Replay.h"													// Invoking the main header file.
+#include <stddef.h>															// Importing offsetof().
+
+/* Function to start recording a game. The state must have been initialised with the same seed and number of balls,
+   and its mode selected. */
+void Game_Replay_startRecording ( Game_Replay *replay, unsigned int seed, unsigned int ball_count, const Game_State *state )
+{
+	replay->header.magic = GAME_REPLAY_MAGIC;
+	replay->header.version = GAME_REPLAY_VERSION;
+	replay->header.seed = seed;
+	replay->header.ball_count = ball_count;
+	replay->header.mode = state->mode;
+	replay->header.ticks = 0;
+	replay->header.checksum = Game_Simulation_checksum ( state );
+}
+
+/* Function to add the inputs of a tick before it is run. */
+signed int Game_Replay_record ( Game_Replay *replay, const Game_InputRecord *record )
+{
+	if ( replay->header.ticks >= GAME_REPLAY_MAX_TICKS ) return GAME_REPLAY_FULL;
+
+	replay->records[replay->header.ticks++] = *record;
+	return GAME_REPLAY_SUCCESS;
+}
+
+/* Function to change the inputs of a recorded tick, 0 being the last one, after the game was rolled back and run again with them. */
+void Game_Replay_correct ( Game_Replay *replay, unsigned int ticks_ago, const Game_InputRecord *record )
+{
+	if ( ticks_ago < replay->header.ticks ) replay->records[replay->header.ticks - 1 - ticks_ago] = *record;
+}
+
+/* Function to record the state the last recorded tick ended in. */
+void Game_Replay_recordResult ( Game_Replay *replay, const Game_State *state )
+{
+	replay->header.checksum = Game_Simulation_checksum ( state );
+}
+
+/* Function to check a replay log and initialise a game to play it back from the start. */
+signed int Game_Replay_begin ( const Game_Replay *replay, Game_State *state )
+{
+	if ( replay->header.magic != GAME_REPLAY_MAGIC || replay->header.version != GAME_REPLAY_VERSION ) return GAME_REPLAY_INVALID;
+	if ( replay->header.ticks > GAME_REPLAY_MAX_TICKS ) return GAME_REPLAY_INVALID;
+	if ( Game_Simulation_initialise ( state, replay->header.ball_count, replay->header.seed ) != GAME_SUCCESS ) return GAME_REPLAY_INVALID;
+	if ( Game_Simulation_setMode ( state, replay->header.mode ) != GAME_SUCCESS ) return GAME_REPLAY_INVALID;
+
+	return GAME_REPLAY_SUCCESS;
+}
+
+/* Function to run one tick of a replay. Returns GAME_REPLAY_END after the last tick. The observer may be NULL. */
+signed int Game_Replay_step ( const Game_Replay *replay, unsigned int tick, Game_State *state, const Game_Observer *observer )
+{
+	Game_Input input;
+
+	if ( tick >= replay->header.ticks ) return GAME_REPLAY_END;
+
+	Game_Simulation_decodeInput ( &replay->records[tick], &input );
+	Game_Simulation_step ( state, &input, observer );
+
+	return GAME_REPLAY_SUCCESS;
+}
+
+/* Function to check that a game played back to the end finished in the recorded state. */
+bool Game_Replay_verify ( const Game_Replay *replay, const Game_State *state )
+{
+	return Game_Simulation_checksum ( state ) == replay->header.checksum;
+}
+
+/* Function to return the size in bytes of a replay log with its records, for saving it. */
+unsigned int Game_Replay_size ( const Game_Replay *replay )
+{
+	return offsetof ( Game_Replay, records ) + replay->header.ticks * sizeof ( Game_InputRecord );
+}
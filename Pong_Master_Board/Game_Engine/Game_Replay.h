@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Input Recording and Replay for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Replay.h
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	A replay is the seed, the number of balls and the mode of a game, then
+ *  	the inputs of every tick, as they were read from the board. Fed
+ *  	back into the step function it plays the game again bit for bit,
+ *  	on the board or on a PC. The checksum of the state after the last
+ *  	tick is kept up to date while recording, so a replay can check
+ *  	that it ended in exactly the same state.
+ *
+ *  	The log is a plain block of memory: the header followed by one
+ *  	4-byte record per tick, little-endian. On the board it can be saved
+ *  	and loaded with the debugger (the game_replay variable), and the
+ *  	PC tools read and write the same bytes.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAME_REPLAY_H_
+#define GAME_REPLAY_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+#include "Game_Simulation.h"
+
+/* Error Codes*/
+#define GAME_REPLAY_SUCCESS       0
+#define GAME_REPLAY_FULL         -1
+#define GAME_REPLAY_INVALID      -2
+#define GAME_REPLAY_END          -3
+
+/* Identification of a replay log. */
+#define GAME_REPLAY_MAGIC         0x504E4F50								// "PONP" in memory.
+#define GAME_REPLAY_VERSION       3											// 2: paddle 1 is tracked, 3: game mode.
+
+/* Longest replay: 4 minutes at 250 ticks per second, 240KB of records. */
+#define GAME_REPLAY_MAX_TICKS     60000
+
+/* Start of a replay log. */
+typedef struct {
+	unsigned int magic;
+	unsigned int version;
+	unsigned int seed;														// Seed of the game's random number generator.
+	unsigned int ball_count;												// Balls in play at the start.
+	unsigned int mode;														// One of the GAME_MODE_ values.
+	unsigned int ticks;														// Number of records.
+	unsigned int checksum;													// Game_Simulation_checksum() after the last record.
+} Game_ReplayHeader;
+
+/* A replay log. Only the first header.ticks records are used. */
+typedef struct {
+	Game_ReplayHeader header;
+	Game_InputRecord records [GAME_REPLAY_MAX_TICKS];
+} Game_Replay;
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to start recording a game. The state must have been initialised with the same seed and number of balls,
+   and its mode selected. */
+void Game_Replay_startRecording ( Game_Replay *replay, unsigned int seed, unsigned int ball_count, const Game_State *state );
+
+/* Function to add the inputs of a tick before it is run, then to record the state it ended in. */
+signed int Game_Replay_record ( Game_Replay *replay, const Game_InputRecord *record );
+void Game_Replay_recordResult ( Game_Replay *replay, const Game_State *state );
+
+/* Function to change the inputs of a recorded tick, 0 being the last one, after the game was rolled back and run again with them. */
+void Game_Replay_correct ( Game_Replay *replay, unsigned int ticks_ago, const Game_InputRecord *record );
+
+/* Function to check a replay log and initialise a game to play it back from the start. */
+signed int Game_Replay_begin ( const Game_Replay *replay, Game_State *state );
+
+/* Function to run one tick of a replay. Returns GAME_REPLAY_END after the last tick. The observer may be NULL. */
+signed int Game_Replay_step ( const Game_Replay *replay, unsigned int tick, Game_State *state, const Game_Observer *observer );
+
+/* Function to check that a game played back to the end finished in the recorded state. */
+bool Game_Replay_verify ( const Game_Replay *replay, const Game_State *state );
+
+/* Function to return the size in bytes of a replay log with its records, for saving it. */
+unsigned int Game_Replay_size ( const Game_Replay *replay );
+
+#endif /* GAME_REPLAY_H_ */
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Rollback of the Remote Paddle for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Rollback.c
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Predicts the camera position of paddle 1 by holding the last value
+ *  	from the link, and rolls the game back when a new value arrives.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Game_Rollback.h"													// Invoking the main header file.
+#include <stddef.h>															// Importing NULL.
+
+/* Slot of a tick in the ring. */
+#define ROLLBACK_SLOT(tick) ( (tick) & ( GAME_ROLLBACK_TICKS - 1 ) )
+
+/* Function to start rolling back by a link delay of 0 to GAME_ROLLBACK_MAX_DELAY ticks. 0 switches the rollback off. */
+signed int Game_Rollback_initialise ( Game_Rollback *rollback, unsigned int delay_ticks )
+{
+	if ( delay_ticks > GAME_ROLLBACK_MAX_DELAY ) return GAME_ROLLBACK_INVALIDDELAY;
+
+	rollback->delay = delay_ticks;
+	rollback->rollbacks = 0;
+	rollback->resimulated = 0;
+	Game_Rollback_reset ( rollback );
+
+	return GAME_ROLLBACK_SUCCESS;
+}
+
+/* Function to forget the ring, after the state was changed outside of a tick. */
+void Game_Rollback_reset ( Game_Rollback *rollback )
+{
+	rollback->tick = 0;
+	rollback->kept = 0;
+	rollback->link = 0;
+}
+
+/* Internal function to run a tick and keep the state before it and its inputs in the ring. */
+void Rollback_Run ( Game_Rollback *rollback, Game_State *state, const Game_InputRecord *record, const Game_Observer *observer )
+{
+	unsigned int slot = ROLLBACK_SLOT ( rollback->tick );
+	Game_Input input;
+
+	Game_Simulation_copy ( &rollback->snapshots[slot], state );
+	rollback->inputs[slot] = *record;
+	rollback->tick++;
+	if ( rollback->kept < GAME_ROLLBACK_TICKS ) rollback->kept++;
+
+	Game_Simulation_decodeInput ( record, &input );
+	Game_Simulation_step ( state, &input, observer );
+}
+
+/* Function to run one tick with the inputs read from the board. A new link value first rolls the game back and runs
+   the ticks it belongs to again. Returns the number of ticks run again. The observer may be NULL. */
+unsigned int Game_Rollback_step ( Game_Rollback *rollback, Game_State *state, const Game_InputRecord *record, const Game_Observer *observer )
+{
+	Game_InputRecord corrected;
+	unsigned int depth = 0;
+	unsigned int count;
+
+	/* The new value is where the paddle was delay ticks ago. The ticks since were run with the old value. */
+	if ( record->link != rollback->link )
+	{
+		depth = MIN ( rollback->delay, rollback->kept );
+		rollback->link = record->link;
+	}
+
+	if ( depth > 0 )
+	{
+		rollback->tick -= depth;
+		rollback->kept -= depth;
+		Game_Simulation_copy ( state, &rollback->snapshots[ROLLBACK_SLOT(rollback->tick)] );
+
+		for ( count = 0; count < depth; count++ )
+		{
+			corrected = rollback->inputs[ROLLBACK_SLOT(rollback->tick)];
+			corrected.link = record->link;
+			Rollback_Run ( rollback, state, &corrected, NULL );				// The events were reported the first time.
+		}
+
+		rollback->rollbacks++;
+		rollback->resimulated += depth;
+	}
+
+	Rollback_Run ( rollback, state, record, observer );
+
+	return depth;
+}
+
+/* Function to read the inputs a recent tick was finally run with, 0 being the last tick. */
+const Game_InputRecord* Game_Rollback_input ( const Game_Rollback *rollback, unsigned int ticks_ago )
+{
+	return &rollback->inputs[ROLLBACK_SLOT ( rollback->tick - 1 - ticks_ago )];
+}
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Rollback of the Remote Paddle for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Rollback.h
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	The camera position of paddle 1 reaches the master through the
+ *  	slave board, which only updates its byte once per PWM pulse, so
+ *  	each new value says where the paddle was a few ticks ago. Instead
+ *  	of running the game that far behind, the ticks are run straight
+ *  	away with the last value held as the prediction, and a snapshot of
+ *  	the state before every tick is kept in a ring. When a new value
+ *  	arrives, the game is rolled back to the tick it belongs to and the
+ *  	ticks since are run again with it, before the frame is drawn.
+ *  	Events of the ticks that are run again are not reported twice.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAME_ROLLBACK_H_
+#define GAME_ROLLBACK_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+#include "Game_Simulation.h"
+
+/* Error Codes*/
+#define GAME_ROLLBACK_SUCCESS       0
+#define GAME_ROLLBACK_INVALIDDELAY -1
+
+/* Ticks kept in the ring, a power of two. The link delay must be shorter. */
+#define GAME_ROLLBACK_TICKS        16
+#define GAME_ROLLBACK_MAX_DELAY    ( GAME_ROLLBACK_TICKS - 1 )
+
+/* The snapshots and inputs of the last GAME_ROLLBACK_TICKS ticks, indexed by the tick modulo the ring size. */
+typedef struct {
+	Game_State snapshots [GAME_ROLLBACK_TICKS];								// State before the tick.
+	Game_InputRecord inputs [GAME_ROLLBACK_TICKS];							// Inputs the tick was run with.
+	unsigned int tick;														// Ticks run since the last reset.
+	unsigned int kept;														// Ticks in the ring, up to GAME_ROLLBACK_TICKS.
+	unsigned int delay;														// Ticks a value from the link is late by.
+	unsigned char link;														// Last value from the link.
+	unsigned int rollbacks;													// Number of rollbacks, for the benchmarks.
+	unsigned int resimulated;												// Ticks run again.
+} Game_Rollback;
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to start rolling back by a link delay of 0 to GAME_ROLLBACK_MAX_DELAY ticks. 0 switches the rollback off. */
+signed int Game_Rollback_initialise ( Game_Rollback *rollback, unsigned int delay_ticks );
+
+/* Function to forget the ring, after the state was changed outside of a tick. */
+void Game_Rollback_reset ( Game_Rollback *rollback );
+
+/* Function to run one tick with the inputs read from the board. A new link value first rolls the game back and runs
+   the ticks it belongs to again. Returns the number of ticks run again. The observer may be NULL. */
+unsigned int Game_Rollback_step ( Game_Rollback *rollback, Game_State *state, const Game_InputRecord *record, const Game_Observer *observer );
+
+/* Function to read the inputs a recent tick was finally run with, 0 being the last tick. */
+const Game_InputRecord* Game_Rollback_input ( const Game_Rollback *rollback, unsigned int ticks_ago );
+
+#endif /* GAME_ROLLBACK_H_ */
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  On-Screen Scoreboard for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Scoreboard.c
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Expansion of the digit glyphs and the incremental redraw of the
+ *  	scores.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Game_Scoreboard.h"												// Invoking the main header file.
+#include "../Graphics_Engine/Graphics_Engine.h"								// Importing the Graphics Engine driver library.
+
+/* Glyph drawn for the tens of a score below 10. */
+#define SCOREBOARD_BLANK         10
+
+/* No digit is on the screen in this slot. */
+#define SCOREBOARD_NOT_DRAWN     0xFF
+
+/* The digits in a 5x7 font, one byte per row from the top, the leftmost column in bit 4. */
+static const unsigned char scoreboard_font [10][7] = {
+	{ 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E },							// 0
+	{ 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E },							// 1
+	{ 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F },							// 2
+	{ 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E },							// 3
+	{ 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 },							// 4
+	{ 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E },							// 5
+	{ 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E },							// 6
+	{ 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },							// 7
+	{ 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E },							// 8
+	{ 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C }							// 9
+};
+
+/* The expanded glyphs, row by row in LT24 coordinates: SCOREBOARD_GLYPH_Y rows of SCOREBOARD_GLYPH_X pixels. */
+unsigned short scoreboard_glyphs [SCOREBOARD_BLANK + 1][SCOREBOARD_GLYPH_Y][SCOREBOARD_GLYPH_X];
+
+/* Smallest y of each digit: player 1 tens and units, then player 2 tens and units. The screen is held with
+   its y axis pointing left, so the tens are at the larger y. */
+static const unsigned int scoreboard_y [SCOREBOARD_DIGITS] = {
+	SCOREBOARD_PLAYER_1_Y + 2, SCOREBOARD_PLAYER_1_Y - 16,
+	SCOREBOARD_PLAYER_2_Y + 2, SCOREBOARD_PLAYER_2_Y - 16
+};
+
+/* Glyph on the screen in each slot. */
+unsigned char scoreboard_drawn [SCOREBOARD_DIGITS] = { SCOREBOARD_NOT_DRAWN, SCOREBOARD_NOT_DRAWN, SCOREBOARD_NOT_DRAWN, SCOREBOARD_NOT_DRAWN };
+
+/* Function to expand the digits in a colour on a background. Everything is drawn by the next Game_Scoreboard_draw(). */
+void Game_Scoreboard_initialise ( unsigned short colour, unsigned short background )
+{
+	unsigned int glyph;
+	unsigned int row;
+	unsigned int column;
+	unsigned char bits;
+
+	for ( glyph = 0; glyph <= SCOREBOARD_BLANK; glyph++ )
+	{
+		for ( row = 0; row < SCOREBOARD_GLYPH_Y; row++ )					// The glyph's row 0 is its rightmost column as the screen is held.
+		{
+			for ( column = 0; column < SCOREBOARD_GLYPH_X; column++ )		// Its column 0 is the top row of the font.
+			{
+				bits = ( glyph == SCOREBOARD_BLANK ) ? 0 : scoreboard_font[glyph][column / SCOREBOARD_SCALE];
+				scoreboard_glyphs[glyph][row][column] = ( bits & ( 1 << ( row / SCOREBOARD_SCALE ) ) ) ? colour : background;
+			}
+		}
+	}
+
+	Game_Scoreboard_invalidate();
+}
+
+/* Function to make the next Game_Scoreboard_draw() draw every digit, after the screen was cleared. */
+void Game_Scoreboard_invalidate ( void )
+{
+	unsigned int slot;
+
+	for ( slot = 0; slot < SCOREBOARD_DIGITS; slot++ ) scoreboard_drawn[slot] = SCOREBOARD_NOT_DRAWN;
+}
+
+/* Function to tell the scoreboard that the box (x1,y1) to (x2,y2), in LT24 coordinates, was drawn over. */
+void Game_Scoreboard_touch ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2 )
+{
+	unsigned int slot;
+
+	if ( x2 < SCOREBOARD_X || x1 >= SCOREBOARD_X + SCOREBOARD_GLYPH_X ) return;	// Most boxes are nowhere near the top of the court.
+
+	for ( slot = 0; slot < SCOREBOARD_DIGITS; slot++ )
+	{
+		if ( y2 >= scoreboard_y[slot] && y1 < scoreboard_y[slot] + SCOREBOARD_GLYPH_Y ) scoreboard_drawn[slot] = SCOREBOARD_NOT_DRAWN;
+	}
+}
+
+/* Function to draw the digits of two scores, 0 to 99, that changed or were drawn over since they were last drawn. */
+signed int Game_Scoreboard_draw ( unsigned int player_1_score, unsigned int player_2_score )
+{
+	unsigned char glyphs [SCOREBOARD_DIGITS];
+	unsigned int slot;
+	signed int status;
+
+	glyphs[0] = ( player_1_score > 9 ) ? ( player_1_score / 10 ) % 10 : SCOREBOARD_BLANK;
+	glyphs[1] = player_1_score % 10;
+	glyphs[2] = ( player_2_score > 9 ) ? ( player_2_score / 10 ) % 10 : SCOREBOARD_BLANK;
+	glyphs[3] = player_2_score % 10;
+
+	for ( slot = 0; slot < SCOREBOARD_DIGITS; slot++ )
+	{
+		if ( glyphs[slot] == scoreboard_drawn[slot] ) continue;
+
+		status = Graphics_drawImage ( SCOREBOARD_X, scoreboard_y[slot], SCOREBOARD_GLYPH_X, SCOREBOARD_GLYPH_Y, &scoreboard_glyphs[glyphs[slot]][0][0] );
+		if ( status != SCOREBOARD_SUCCESS ) return status;
+		scoreboard_drawn[slot] = glyphs[slot];
+	}
+
+	return SCOREBOARD_SUCCESS;
+}
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  On-Screen Scoreboard for PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Scoreboard.h
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	The scores of both players drawn at the top of the court. The ten
+ *  	digits are expanded once into ready-to-send pixels, already turned
+ *  	to the way the screen is held and in the colours of the court. A
+ *  	digit is only drawn again when its value changes, when a ball was
+ *  	erased over it or after the screen was cleared, and then as a single
+ *  	window burst, so a frame where nothing happened costs four compares.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAME_SCOREBOARD_H_
+#define GAME_SCOREBOARD_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+
+/* Error Codes*/
+#define SCOREBOARD_SUCCESS       0
+
+/* A digit is a 5x7 font scaled 3 times, 15 pixels wide and 21 high as the screen is held.
+   On the LT24 it is 21 pixels along x and 15 along y. */
+#define SCOREBOARD_SCALE         3
+#define SCOREBOARD_GLYPH_X       ( 7 * SCOREBOARD_SCALE )
+#define SCOREBOARD_GLYPH_Y       ( 5 * SCOREBOARD_SCALE )
+
+/* Two digits per player: the tens, blank below 10, and the units. */
+#define SCOREBOARD_DIGITS        4
+
+/* Top edge of the digits, inside the court, and the middle of the score of each player along y. */
+#define SCOREBOARD_X             16
+#define SCOREBOARD_PLAYER_1_Y    85
+#define SCOREBOARD_PLAYER_2_Y    235
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to expand the digits in a colour on a background. Everything is drawn by the next Game_Scoreboard_draw(). */
+void Game_Scoreboard_initialise ( unsigned short colour, unsigned short background );
+
+/* Function to make the next Game_Scoreboard_draw() draw every digit, after the screen was cleared. */
+void Game_Scoreboard_invalidate ( void );
+
+/* Function to tell the scoreboard that the box (x1,y1) to (x2,y2), in LT24 coordinates, was drawn over. */
+void Game_Scoreboard_touch ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2 );
+
+/* Function to draw the digits of two scores, 0 to 99, that changed or were drawn over since they were last drawn. */
+signed int Game_Scoreboard_draw ( unsigned int player_1_score, unsigned int player_2_score );
+
+#endif /* GAME_SCOREBOARD_H_ */
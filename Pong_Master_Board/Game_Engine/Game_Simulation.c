@@ -0,0 +1,625 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Game Rules of PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Simulation.c
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	A tick moves the paddles from the inputs, bounces touching balls
+ *  	off each other, then sweeps every ball against the walls and the
+ *  	paddle lines. Only integer arithmetic is used.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Game_Simulation.h"												// Invoking the main header file.
+#include "Collision_Grid.h"													// Importing the broad phase that pairs up objects sharing a grid cell.
+#include "Game_Bricks.h"													// Importing the bricks of the brick mode.
+#include <stddef.h>															// Importing NULL.
+#include <stdlib.h>															// Importing abs().
+
+/* Unit vectors (sin, cos) for -60 to +60 degrees from straight down the court in 15 degree steps. A paddle hit picks
+   the entry from where the ball meets the paddle, so the edges send the ball off at a sharper angle than the centre. */
+static const fixed ball_angle_table [BALL_ANGLES][2] = {
+	{ -56756, 32768 },														// -60
+	{ -46341, 46341 },														// -45
+	{ -32768, 56756 },														// -30
+	{ -16962, 63303 },														// -15
+	{      0, 65536 },														//   0
+	{  16962, 63303 },														//  15
+	{  32768, 56756 },														//  30
+	{  46341, 46341 },														//  45
+	{  56756, 32768 }														//  60
+};
+
+/* Pairs of touching balls found by the broad phase in a tick, and whether the collision grid was built for it. */
+Collision_Grid_Pair ball_pairs [GAME_MAX_BALLS * 2];
+bool grid_in_use = false;
+
+/* Internal functions to tell the observer about a bounce, a point or a ball at a paddle. */
+void Notify_Bounce ( const Game_Observer *observer )
+{
+	if ( observer != NULL && observer->bounce != NULL ) observer->bounce ( observer->context );
+}
+
+void Notify_Score ( const Game_Observer *observer, const Game_State *state )
+{
+	if ( observer != NULL && observer->score != NULL ) observer->score ( observer->context, state );
+}
+
+void Notify_Hit ( const Game_Observer *observer, unsigned int paddle, fixed x, fixed y, bool scored )
+{
+	if ( observer != NULL && observer->hit != NULL ) observer->hit ( observer->context, paddle, FIXED_ROUND ( x ), FIXED_ROUND ( y ), scored );
+}
+
+//////////////////////////////////////// PADDLES ///////////////////////////////////////////////////////
+
+/* Internal function to filter a camera sample of paddle 1 and return where to put the paddle, now at paddle_x.
+   The tracker predicts a tick on, ignores samples too far from the prediction and corrects itself with the others.
+   The paddle is put ahead of the estimate by the latency of the camera, and left still while it is within the
+   hysteresis, so the jitter of the camera neither shakes it nor redraws it. */
+unsigned int Track_Paddle ( Game_Tracker *tracker, unsigned int sample_x, unsigned int paddle_x )
+{
+	fixed sample = INT_TO_FIXED(sample_x);
+	fixed residual;
+	fixed target;
+
+	if ( !tracker->locked || tracker->outliers >= TRACKER_REACQUIRE_TICKS )
+	{
+		tracker->position = sample;											// Start again from the sample.
+		tracker->velocity = 0;
+		tracker->outliers = 0;
+		tracker->locked = true;
+	}
+	else
+	{
+		tracker->position += tracker->velocity;
+		residual = sample - tracker->position;
+
+		if ( residual > TRACKER_OUTLIER || residual < -TRACKER_OUTLIER )
+		{
+			tracker->outliers++;											// Keep moving on the prediction.
+		}
+		else
+		{
+			tracker->outliers = 0;
+			tracker->position += FIXED_MUL ( TRACKER_ALPHA, residual );
+			tracker->velocity += FIXED_MUL ( TRACKER_BETA, residual );
+		}
+	}
+
+	target = tracker->position + tracker->velocity * TRACKER_LEAD_TICKS;
+	if ( target < 0 ) target = 0;
+
+	if ( target - INT_TO_FIXED(paddle_x) < TRACKER_HYSTERESIS && INT_TO_FIXED(paddle_x) - target < TRACKER_HYSTERESIS ) return paddle_x;
+	return FIXED_ROUND(target);
+}
+
+/* Internal function to move a paddle from its input: paddle 1 follows the camera, paddle 2 the buttons. */
+void Move_Paddle ( Game_State *state, unsigned int paddle, const Game_Input *input )
+{
+	Game_Paddles *paddles = &state->paddles;
+	unsigned int paddle_x = paddles->x[paddle];
+
+	if ( paddle == PADDLE_1 )
+	{
+		paddle_x = Track_Paddle ( &state->tracker, input->paddle_1_x, paddle_x );
+	}
+	else if ( input->paddle_2_move > 0 )
+	{
+		paddle_x = paddle_x + PADDLE_INCREMENT;
+	}
+	else if ( input->paddle_2_move < 0 && paddle_x > MINIMUM_PADDLE_X )
+	{
+		paddle_x = paddle_x - PADDLE_DECREMENT;
+	}
+
+	/* Keep the paddle inside the court. */
+	if ( paddle_x <= MINIMUM_PADDLE_X )
+	{
+		paddle_x = MINIMUM_PADDLE_X;
+	}
+	else if ( paddle_x >= ( MAXIMUM_PADDLE_X - paddles->length[paddle] ) )
+	{
+		paddle_x = MAXIMUM_PADDLE_X - paddles->length[paddle];
+	}
+
+	paddles->x[paddle] = paddle_x;
+}
+
+//////////////////////////////////////// BALLS /////////////////////////////////////////////////////////
+
+/* Internal function to serve a ball from the centre line in a random direction. The first ball starts in the centre,
+   the others along the centre line so that they do not all sit on top of each other. */
+void Ball_Initialize ( Game_State *state, unsigned int ball )
+{
+	Game_Balls *balls = &state->balls;
+	unsigned int angle;
+	unsigned int start_x = 120;
+
+	if ( ball > 0 ) start_x = 120 + ( Game_Simulation_random ( state ) % 100 ) - 50;
+
+	balls->x[ball] = INT_TO_FIXED(start_x);
+	balls->y[ball] = INT_TO_FIXED(160);
+	balls->previous_x[ball] = start_x;
+	balls->previous_y[ball] = 160;
+	balls->current_x[ball] = start_x;
+	balls->current_y[ball] = 160;
+
+	/* Any angle but the two steepest, towards either player. */
+	angle = ( Game_Simulation_random ( state ) % ( BALL_ANGLES - 2 ) ) + 1;
+	balls->direction_x[ball] = ball_angle_table[angle][0];
+	balls->direction_y[ball] = ( Game_Simulation_random ( state ) & 1 ) ? ball_angle_table[angle][1] : -ball_angle_table[angle][1];
+}
+
+/* Internal function to send a ball away from a paddle. The angle depends on where the ball hit the paddle. */
+void Ball_Deflect ( Game_State *state, unsigned int ball, unsigned int paddle, fixed direction_y_sign )
+{
+	Game_Balls *balls = &state->balls;
+	signed int half_length = state->paddles.length[paddle] / 2;
+	signed int offset = FIXED_TO_INT(balls->x[ball]) + ( BALL_SIZE / 2 ) - (signed int)( state->paddles.x[paddle] + half_length );
+	signed int angle = ( ( offset + half_length ) * ( BALL_ANGLES - 1 ) + half_length ) / (signed int)state->paddles.length[paddle];
+
+	angle = MIN ( MAX ( angle, 0 ), BALL_ANGLES - 1 );
+	balls->direction_x[ball] = ball_angle_table[angle][0];
+	balls->direction_y[ball] = direction_y_sign * ball_angle_table[angle][1];
+}
+
+/* Internal function to check whether a ball, with its left edge at x, overlaps a paddle along the paddle line.
+   With the collision grid in use, only the paddles in the grid cells of the ball are tested. */
+bool Ball_OverPaddle ( const Game_State *state, fixed x, unsigned int paddle )
+{
+	signed int left = FIXED_TO_INT(x);
+	signed int paddle_x = (signed int)state->paddles.x[paddle];
+	unsigned short found;
+
+	if ( !grid_in_use ) return left <= paddle_x + (signed int)state->paddles.length[paddle] && paddle_x <= left + BALL_SIZE - 1;
+	return Collision_Grid_query ( GRID_PADDLE, left, state->paddles.y[paddle], left + BALL_SIZE - 1, state->paddles.y[paddle], &found, 1 ) != 0;
+}
+
+/* Internal function to find when a moving coordinate reaches a limit, as a Q16.16 fraction of the tick.
+   Returns a value above FIXED_ONE when it does not get there in this tick. */
+fixed Ball_TimeOfImpact ( fixed position, fixed displacement, signed int minimum, signed int maximum )
+{
+	fixed distance;
+
+	if ( displacement < 0 ) distance = INT_TO_FIXED(minimum) - position;
+	else if ( displacement > 0 ) distance = INT_TO_FIXED(maximum) - position;
+	else return FIXED_ONE + 1;												// Not moving along this axis.
+
+	/* A limit further away than the displacement is not reached, and the division could overflow for a tiny displacement. */
+	if ( abs ( distance ) > abs ( displacement ) ) return FIXED_ONE + 1;
+	return FIXED_DIV ( distance, displacement );
+}
+
+/* Internal function to record a point. In the multi-ball mode the ball is served again, otherwise the game
+   pauses for SCORE_PAUSE_TICKS ticks. */
+void Update_Score ( Game_State *state, unsigned int ball, unsigned int player, const Game_Observer *observer )
+{
+	if ( player == 1 ) state->player_1_score++; else state->player_2_score++;
+	state->last_point_player = player;
+
+	if ( state->player_1_score >= WINNING_SCORE || state->player_2_score >= WINNING_SCORE )
+	{
+		state->state = GAME_STATE_OVER;										// Stays on the winner screen.
+	}
+	else if ( state->balls.count > 1 )
+	{
+		Ball_Initialize ( state, ball );
+	}
+	else
+	{
+		state->state = GAME_STATE_SCORED;
+		state->state_ticks = SCORE_PAUSE_TICKS;								// The step serves again when the pause is over.
+	}
+
+	Notify_Score ( observer, state );
+}
+
+/* Internal function to move a ball by one tick. The path of the ball's box is swept against the walls and the paddle lines:
+   the ball is moved to the exact time of the first impact, reflected there, and moves on for the rest of the tick.
+   However far the ball moves in a tick it cannot pass through a wall or a paddle. Returns true if it bounced. */
+bool Move_Ball ( Game_State *state, unsigned int ball, fixed speed, const Game_Observer *observer )
+{
+	Game_Balls *balls = &state->balls;
+	bool bounce = false;
+	fixed x = balls->x[ball];
+	fixed y = balls->y[ball];
+	fixed remaining = FIXED_ONE;											// Part of the tick still to be moved.
+	fixed displacement_x;
+	fixed displacement_y;
+	fixed time_x;
+	fixed time_y;
+	fixed time;
+	unsigned int collisions;
+	unsigned int paddle;
+
+	for ( collisions = 0; collisions < BALL_MAXIMUM_COLLISIONS && remaining > 0; collisions++ )
+	{
+		/* Displacement over the rest of the tick. */
+		displacement_x = FIXED_MUL ( FIXED_MUL ( balls->direction_x[ball], speed ), remaining );
+		displacement_y = FIXED_MUL ( FIXED_MUL ( balls->direction_y[ball], speed ), remaining );
+
+		/* Time of impact with the side walls and the paddle lines, as a fraction of the rest of the tick. */
+		time_x = Ball_TimeOfImpact ( x, displacement_x, BALL_MINIMUM_X, BALL_MAXIMUM_X );
+		time_y = Ball_TimeOfImpact ( y, displacement_y, BALL_MINIMUM_Y, BALL_MAXIMUM_Y );
+		time = MIN ( time_x, time_y );
+
+		if ( time > FIXED_ONE )												// Nothing is hit before the end of the tick.
+		{
+			x = x + displacement_x;
+			y = y + displacement_y;
+			break;
+		}
+
+		/* Move to the point of impact. */
+		x = x + FIXED_MUL ( displacement_x, time );
+		y = y + FIXED_MUL ( displacement_y, time );
+		remaining = remaining - FIXED_MUL ( remaining, time );
+
+		if ( time_x <= time_y )
+		{
+			/* Side wall: reverse the x direction. */
+			x = ( displacement_x < 0 ) ? INT_TO_FIXED(BALL_MINIMUM_X) : INT_TO_FIXED(BALL_MAXIMUM_X);
+			balls->direction_x[ball] = -balls->direction_x[ball];
+			bounce = true;
+		}
+
+		if ( time_y <= time_x )
+		{
+			/* Paddle line: a paddle under the ball sends it back, otherwise the other player scores. */
+			paddle = ( displacement_y < 0 ) ? PADDLE_1 : PADDLE_2;
+			y = ( displacement_y < 0 ) ? INT_TO_FIXED(BALL_MINIMUM_Y) : INT_TO_FIXED(BALL_MAXIMUM_Y);
+
+			if ( !Ball_OverPaddle ( state, x, paddle ) )
+			{
+				balls->x[ball] = x;
+				balls->y[ball] = y;
+				Notify_Hit ( observer, paddle, x, y, true );
+				Update_Score ( state, ball, ( paddle == PADDLE_1 ) ? 2 : 1, observer );
+				return bounce;
+			}
+
+			balls->x[ball] = x;
+			Notify_Hit ( observer, paddle, x, y, false );
+			Ball_Deflect ( state, ball, paddle, ( paddle == PADDLE_1 ) ? 1 : -1 );
+			bounce = true;
+		}
+	}
+
+	/* Bricks are tested where the ball ended up: it moves less than a brick is wide in a tick, so it cannot pass through one. */
+	if ( state->mode == GAME_MODE_BRICKS && Game_Bricks_collide ( state, ball, balls->x[ball], balls->y[ball], &x, &y ) ) bounce = true;
+
+	balls->x[ball] = x;
+	balls->y[ball] = y;
+	balls->current_x[ball] = FIXED_ROUND ( x );
+	balls->current_y[ball] = FIXED_ROUND ( y );
+
+	return bounce;
+}
+
+/* Internal function to put the paddles and the balls of this tick into the collision grid. */
+void Build_Grid ( const Game_State *state )
+{
+	unsigned int paddle;
+	unsigned int ball;
+	signed int left;
+	signed int top;
+
+	Collision_Grid_reset();
+
+	for ( paddle = 0; paddle < GAME_PADDLES; paddle++ )
+	{
+		Collision_Grid_insert ( GRID_PADDLE, paddle, state->paddles.x[paddle], state->paddles.y[paddle],
+								state->paddles.x[paddle] + state->paddles.length[paddle], state->paddles.y[paddle] + state->paddles.width[paddle] );
+	}
+
+	for ( ball = 0; ball < state->balls.count; ball++ )
+	{
+		left = FIXED_TO_INT ( state->balls.x[ball] );
+		top = FIXED_TO_INT ( state->balls.y[ball] );
+		Collision_Grid_insert ( GRID_BALL, ball, left, top, left + BALL_SIZE - 1, top + BALL_SIZE - 1 );
+	}
+
+	Collision_Grid_build();
+}
+
+/* Internal function to find the pairs of touching balls by testing every pair, for when there are too few balls for the grid
+   to pay off. Returns the number of pairs written, at most max_pairs. */
+unsigned int Find_Ball_Pairs ( const Game_State *state, Collision_Grid_Pair *pairs, unsigned int max_pairs )
+{
+	const Game_Balls *balls = &state->balls;
+	unsigned int found = 0;
+	unsigned int a;
+	unsigned int b;
+	signed int ax;
+	signed int ay;
+
+	for ( a = 0; a < balls->count; a++ )
+	{
+		ax = FIXED_TO_INT ( balls->x[a] );
+		ay = FIXED_TO_INT ( balls->y[a] );
+		for ( b = a + 1; b < balls->count; b++ )
+		{
+			if ( abs ( FIXED_TO_INT ( balls->x[b] ) - ax ) >= BALL_SIZE || abs ( FIXED_TO_INT ( balls->y[b] ) - ay ) >= BALL_SIZE ) continue;
+
+			if ( found == max_pairs ) return found;
+			pairs[found].type_a = GRID_BALL;
+			pairs[found].type_b = GRID_BALL;
+			pairs[found].index_a = (unsigned short)a;
+			pairs[found].index_b = (unsigned short)b;
+			found++;
+		}
+	}
+
+	return found;
+}
+
+/* Internal function to bounce two touching balls off each other. Each ball that is moving towards the other one along the
+   axis where they overlap least turns back along that axis, like it would off a wall. Returns true if one of them turned. */
+bool Ball_Collide ( Game_Balls *balls, unsigned int a, unsigned int b )
+{
+	bool bounce = false;
+	fixed overlap_x = BALL_SIZE * FIXED_ONE - abs ( balls->x[a] - balls->x[b] );
+	fixed overlap_y = BALL_SIZE * FIXED_ONE - abs ( balls->y[a] - balls->y[b] );
+	fixed sign;
+
+	if ( overlap_x < overlap_y )
+	{
+		sign = ( balls->x[a] <= balls->x[b] ) ? 1 : -1;						// Direction from a to b.
+		if ( sign * balls->direction_x[a] > 0 ) { balls->direction_x[a] = -balls->direction_x[a]; bounce = true; }
+		if ( sign * balls->direction_x[b] < 0 ) { balls->direction_x[b] = -balls->direction_x[b]; bounce = true; }
+	}
+	else
+	{
+		sign = ( balls->y[a] <= balls->y[b] ) ? 1 : -1;
+		if ( sign * balls->direction_y[a] > 0 ) { balls->direction_y[a] = -balls->direction_y[a]; bounce = true; }
+		if ( sign * balls->direction_y[b] < 0 ) { balls->direction_y[b] = -balls->direction_y[b]; bounce = true; }
+	}
+
+	return bounce;
+}
+
+/* Internal function to move all balls by one tick, at a speed in Q16.16 pixels per tick. */
+void Move_Balls ( Game_State *state, fixed speed, const Game_Observer *observer )
+{
+	Game_Balls *balls = &state->balls;
+	bool bounce = false;
+	unsigned int ball;
+	unsigned int pairs;
+	unsigned int pair;
+
+	/* Broad phase: with enough balls, only the balls that share a grid cell are tested against each other. */
+	grid_in_use = balls->count + GAME_PADDLES >= GAME_GRID_MIN_OBJECTS;
+	if ( grid_in_use ) Build_Grid ( state );
+	if ( state->mode == GAME_MODE_BRICKS ) Game_Bricks_sync ( state );		// The bitmap may hold the bricks of another state.
+	if ( grid_in_use ) pairs = Collision_Grid_findPairs ( ball_pairs, GAME_MAX_BALLS * 2 );
+	else pairs = Find_Ball_Pairs ( state, ball_pairs, GAME_MAX_BALLS * 2 );
+	for ( pair = 0; pair < pairs; pair++ )
+	{
+		if ( ball_pairs[pair].type_a == GRID_BALL && ball_pairs[pair].type_b == GRID_BALL )
+		{
+			if ( Ball_Collide ( balls, ball_pairs[pair].index_a, ball_pairs[pair].index_b ) ) bounce = true;
+		}
+	}
+
+	/* The balls are interpolated from where they were at the start of the tick. */
+	for ( ball = 0; ball < balls->count; ball++ )
+	{
+		balls->previous_x[ball] = balls->current_x[ball];
+		balls->previous_y[ball] = balls->current_y[ball];
+	}
+
+	for ( ball = 0; ball < balls->count && state->state == GAME_STATE_PLAYING; ball++ )
+	{
+		if ( Move_Ball ( state, ball, speed, observer ) ) bounce = true;
+	}
+
+	if ( bounce ) Notify_Bounce ( observer );
+}
+
+//////////////////////////////////////// GAME ///////////////////////////////////////////////////////////
+
+/* Function to return the next number of the game's random number generator (xorshift32). */
+unsigned int Game_Simulation_random ( Game_State *state )
+{
+	unsigned int random = state->random;
+
+	random ^= random << 13;
+	random ^= random >> 17;
+	random ^= random << 5;
+	state->random = random;
+
+	return random >> 1;														// 31 bits, so the result can be used as a signed number too.
+}
+
+/* Function to turn the inputs read from the board into the inputs of a tick. */
+void Game_Simulation_decodeInput ( const Game_InputRecord *record, Game_Input *input )
+{
+	unsigned int buttons = record->keys & 0x3;
+
+	input->paddle_1_x = ( record->link * 5 ) / 4;							// The camera position is scaled to the court.
+	input->paddle_2_move = ( buttons == 1 ) ? 1 : ( buttons == 2 ) ? -1 : 0;
+	input->speed = record->switches & 0x1FF;								// SW9 is reserved for the render mode.
+	input->multi_ball = ( record->keys & GAME_KEY_MULTI_BALL ) != 0;
+}
+
+/* Internal function to add a word to an FNV-1a checksum. */
+unsigned int Checksum_Add ( unsigned int checksum, unsigned int value )
+{
+	return ( checksum ^ value ) * 16777619u;
+}
+
+/* Function to compute a checksum of everything in the state (FNV-1a over its words), to compare two runs of the same game. */
+unsigned int Game_Simulation_checksum ( const Game_State *state )
+{
+	unsigned int checksum = 2166136261u;
+	unsigned int ball;
+	unsigned int paddle;
+	unsigned int word;
+
+	for ( ball = 0; ball < state->balls.count; ball++ )
+	{
+		checksum = Checksum_Add ( checksum, state->balls.x[ball] );
+		checksum = Checksum_Add ( checksum, state->balls.y[ball] );
+		checksum = Checksum_Add ( checksum, state->balls.direction_x[ball] );
+		checksum = Checksum_Add ( checksum, state->balls.direction_y[ball] );
+	}
+	for ( paddle = 0; paddle < GAME_PADDLES; paddle++ ) checksum = Checksum_Add ( checksum, state->paddles.x[paddle] );
+	checksum = Checksum_Add ( checksum, state->tracker.position );
+	checksum = Checksum_Add ( checksum, state->tracker.velocity );
+	checksum = Checksum_Add ( checksum, state->tracker.outliers );
+	checksum = Checksum_Add ( checksum, state->mode );
+	for ( word = 0; word < BRICK_WORDS; word++ ) checksum = Checksum_Add ( checksum, state->bricks[word] );
+	checksum = Checksum_Add ( checksum, state->balls.count );
+	checksum = Checksum_Add ( checksum, state->state );
+	checksum = Checksum_Add ( checksum, state->state_ticks );
+	checksum = Checksum_Add ( checksum, state->player_1_score );
+	checksum = Checksum_Add ( checksum, state->player_2_score );
+	checksum = Checksum_Add ( checksum, state->ticks );
+	checksum = Checksum_Add ( checksum, state->random );
+
+	return checksum;
+}
+
+/* Function to copy a state. Only the balls in play are copied, so a snapshot of a one-ball game costs a few words. */
+void Game_Simulation_copy ( Game_State *destination, const Game_State *source )
+{
+	unsigned int count = source->balls.count;
+	unsigned int ball;
+	unsigned int word;
+
+	for ( ball = 0; ball < count; ball++ )
+	{
+		destination->balls.x[ball] = source->balls.x[ball];
+		destination->balls.y[ball] = source->balls.y[ball];
+		destination->balls.direction_x[ball] = source->balls.direction_x[ball];
+		destination->balls.direction_y[ball] = source->balls.direction_y[ball];
+		destination->balls.previous_x[ball] = source->balls.previous_x[ball];
+		destination->balls.previous_y[ball] = source->balls.previous_y[ball];
+		destination->balls.current_x[ball] = source->balls.current_x[ball];
+		destination->balls.current_y[ball] = source->balls.current_y[ball];
+	}
+	destination->balls.count = count;
+	destination->paddles = source->paddles;
+	destination->tracker = source->tracker;
+	destination->mode = source->mode;
+	for ( word = 0; word < BRICK_WORDS; word++ ) destination->bricks[word] = source->bricks[word];
+	destination->state = source->state;
+	destination->state_ticks = source->state_ticks;
+	destination->last_point_player = source->last_point_player;
+	destination->player_1_score = source->player_1_score;
+	destination->player_2_score = source->player_2_score;
+	destination->ticks = source->ticks;
+	destination->random = source->random;
+	destination->multi_ball_key = source->multi_ball_key;
+}
+
+/* Function to start a game with a number of balls, 1 to GAME_MAX_BALLS, and the paddles in their starting positions.
+   The seed selects the serves of the whole game. */
+signed int Game_Simulation_initialise ( Game_State *state, unsigned int ball_count, unsigned int seed )
+{
+	unsigned int paddle;
+
+	if ( ball_count < 1 || ball_count > GAME_MAX_BALLS ) return GAME_INVALIDCOUNT;
+
+	state->paddles.x[PADDLE_1] = PADDLE_1_START_X_1;
+	state->paddles.y[PADDLE_1] = PADDLE_1_START_Y_1;
+	state->paddles.x[PADDLE_2] = PADDLE_2_START_X_1;
+	state->paddles.y[PADDLE_2] = PADDLE_2_START_Y_1;
+	for ( paddle = 0; paddle < GAME_PADDLES; paddle++ )
+	{
+		state->paddles.length[paddle] = PADDLE_LENGTH;
+		state->paddles.width[paddle] = PADDLE_WIDTH;
+	}
+	state->tracker.position = 0;
+	state->tracker.velocity = 0;
+	state->tracker.outliers = 0;
+	state->tracker.locked = false;											// Paddle 1 jumps to the first camera sample.
+	state->mode = GAME_MODE_CLASSIC;
+
+	state->balls.count = ball_count;
+	state->ticks = 0;
+	state->random = ( seed != 0 ) ? seed : 0x12345678;						// Xorshift never leaves zero.
+	state->multi_ball_key = false;
+	Game_Simulation_restart ( state );
+
+	return GAME_SUCCESS;
+}
+
+/* Function to select one of the GAME_MODE_ values, with every brick standing. Bricks stand again at every restart. */
+signed int Game_Simulation_setMode ( Game_State *state, unsigned int mode )
+{
+	if ( mode != GAME_MODE_CLASSIC && mode != GAME_MODE_BRICKS ) return GAME_INVALIDMODE;
+
+	state->mode = mode;
+	Game_Bricks_build ( state );
+
+	return GAME_SUCCESS;
+}
+
+/* Function to change the number of balls in play. New balls are served, the ones in play keep moving. */
+signed int Game_Simulation_setBallCount ( Game_State *state, unsigned int ball_count )
+{
+	unsigned int ball;
+
+	if ( ball_count < 1 || ball_count > GAME_MAX_BALLS ) return GAME_INVALIDCOUNT;
+
+	for ( ball = state->balls.count; ball < ball_count; ball++ ) Ball_Initialize ( state, ball );
+	state->balls.count = ball_count;
+
+	return GAME_SUCCESS;
+}
+
+/* Function to start a new game with the same number of balls. */
+void Game_Simulation_restart ( Game_State *state )
+{
+	unsigned int ball;
+
+	state->player_1_score = 0;
+	state->player_2_score = 0;
+	state->last_point_player = 0;
+	state->state = GAME_STATE_PLAYING;
+	state->state_ticks = 0;
+	Game_Bricks_build ( state );
+	for ( ball = 0; ball < state->balls.count; ball++ ) Ball_Initialize ( state, ball );
+}
+
+/* Function to advance the game by one tick of GAME_TICK_US microseconds. The observer may be NULL. */
+void Game_Simulation_step ( Game_State *state, const Game_Input *input, const Game_Observer *observer )
+{
+	unsigned int step_us;
+	unsigned int paddle;
+
+	/* Each press of the multi-ball key switches between one ball and MULTI_BALL_COUNT balls. */
+	if ( input->multi_ball && !state->multi_ball_key )
+	{
+		Game_Simulation_setBallCount ( state, ( state->balls.count > 1 ) ? 1 : MULTI_BALL_COUNT );
+	}
+	state->multi_ball_key = input->multi_ball;
+
+	if ( state->state == GAME_STATE_OVER ) return;
+
+	state->ticks++;
+
+	for ( paddle = 0; paddle < GAME_PADDLES; paddle++ ) Move_Paddle ( state, paddle, input );	// Paddle inputs are read every tick.
+
+	if ( state->state == GAME_STATE_SCORED )
+	{
+		if ( --state->state_ticks == 0 )
+		{
+			Ball_Initialize ( state, 0 );									// Serve from the centre again.
+			state->state = GAME_STATE_PLAYING;
+		}
+		return;
+	}
+
+	/* The speed switches shorten the time the ball takes to travel BALL_STEP_PIXELS. */
+	step_us = BALL_STEP_US - ( ( ( input->speed & 0x1FF ) * 7 ) / 2 );
+
+	Move_Balls ( state, ( INT_TO_FIXED(BALL_STEP_PIXELS) * GAME_TICK_US ) / (signed int)step_us, observer );	// Speed in pixels per tick.
+}
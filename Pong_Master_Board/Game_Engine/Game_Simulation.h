@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Game Rules of PONG.
+ *  ----------------------------------------
+ *  File Name     : Game_Simulation.h
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	The rules of the game as one step function: a tick takes the state
+ *  	of the game and the players' inputs and gives the next state. The
+ *  	step does not read or write any hardware and draws nothing. Sound,
+ *  	scores and drawing are done by whoever calls it, through the
+ *  	optional observer and by reading the state afterwards, so the same
+ *  	rules run on the board and in a library on a PC.
+ *  	The step uses the collision grid as scratch memory, so only one
+ *  	step may run at a time. Random numbers come from a generator in the
+ *  	state, so a game started with the same seed and fed the same inputs
+ *  	plays out bit for bit the same on the board and on a PC.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAME_SIMULATION_H_
+#define GAME_SIMULATION_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+#include "Fixed_Point.h"
+#include "Min_Max.h"
+
+/* Error Codes*/
+#define GAME_SUCCESS       0
+#define GAME_INVALIDCOUNT -1
+#define GAME_INVALIDMODE  -2
+
+//////////////////////////////////////// INITIAL CONSTANT POSITIONS //////////////////////////////////////
+
+/* A paddle is a rectangle with length 20 pixels and width 5 width. Therefore, it has a right top coordinate and left-bottom coordinate. */
+
+/* Constant paddle dimensions. */
+#define PADDLE_LENGTH 40
+#define PADDLE_WIDTH  2
+
+/* Constant ball size. The ball is a BALL_SIZE x BALL_SIZE square. */
+#define BALL_SIZE 4
+
+/* Limits of the top-left corner of the ball. Past BALL_MINIMUM_Y or BALL_MAXIMUM_Y the ball meets a paddle or scores. */
+#define BALL_MINIMUM_X 12
+#define BALL_MAXIMUM_X 225
+#define BALL_MINIMUM_Y 12
+#define BALL_MAXIMUM_Y 305
+
+/* Ball speed: BALL_STEP_PIXELS every BALL_STEP_US microseconds, less with the speed switches. */
+#define BALL_STEP_PIXELS 2
+#define BALL_STEP_US     5000
+
+/* Most walls and paddles the ball can meet in one tick. */
+#define BALL_MAXIMUM_COLLISIONS 4
+
+/* Number of entries in the paddle deflection angle table. */
+#define BALL_ANGLES 9
+
+#define PADDLE_1_CENTER_X	119
+#define PADDLE_2_CENTER_X	119
+
+#define MINIMUM_PADDLE_X 11
+#define MAXIMUM_PADDLE_X 229
+
+#define PADDLE_INCREMENT 1
+#define PADDLE_DECREMENT 1
+
+/* Camera tracker of paddle 1: an alpha-beta filter on the camera position, in Q16.16 pixels and pixels per tick.
+   The gains are critically damped, beta = alpha^2 / ( 2 - alpha ). */
+#define TRACKER_ALPHA           ( FIXED_ONE / 16 )							// Share of the error that corrects the position.
+#define TRACKER_BETA            ( FIXED_ONE / 512 )							// Share of the error that corrects the velocity.
+#define TRACKER_LEAD_TICKS      8											// The camera is about 32ms late, the paddle is put where the racquet is now.
+#define TRACKER_OUTLIER         INT_TO_FIXED(48)							// Samples further than this from the prediction are ignored,
+#define TRACKER_REACQUIRE_TICKS 12											// unless they stay there this long: the racquet really jumped.
+#define TRACKER_HYSTERESIS      ( FIXED_ONE * 2 )							// The paddle only moves when the estimate is this far from it.
+
+/* Paddle 1 (x1,y1) point. */
+#define PADDLE_1_START_X_1	PADDLE_1_CENTER_X - ( PADDLE_LENGTH / 2 )
+#define PADDLE_1_START_Y_1	7
+
+/* Paddle 1 (x2,y2) point. */
+#define PADDLE_1_START_X_2	PADDLE_1_CENTER_X + ( PADDLE_LENGTH / 2 )
+#define PADDLE_1_START_Y_2	9
+
+/* Paddle 2 (x1,y1) point. */
+#define PADDLE_2_START_X_1	PADDLE_2_CENTER_X - ( PADDLE_LENGTH / 2 )
+#define PADDLE_2_START_Y_1	311
+
+/* Paddle 2 (x2,y2) point. */
+#define PADDLE_2_START_X_2	PADDLE_2_CENTER_X + ( PADDLE_LENGTH / 2 )
+#define PADDLE_2_START_Y_2	313
+
+//////////////////////////////////////// RULES ///////////////////////////////////////////////////////
+
+/* Length of a tick of the game. */
+#define GAME_TICK_US            4000										// 250 ticks per second.
+
+/* The result of a point is shown for 3s, and the first player to 10 points wins. */
+#define SCORE_PAUSE_TICKS       ( 3000000 / GAME_TICK_US )
+#define WINNING_SCORE           10
+
+/* Push button that switches between one ball and MULTI_BALL_COUNT balls. */
+#define GAME_KEY_MULTI_BALL     0x4
+
+/* Game states. */
+#define GAME_STATE_PLAYING      0
+#define GAME_STATE_SCORED       1											// Pause after a point.
+#define GAME_STATE_OVER         2											// A player reached WINNING_SCORE points.
+#define GAME_STATE_NONE         0xFF										// Nothing drawn yet.
+
+//////////////////////////////////////// BRICKS //////////////////////////////////////////////////////
+
+/* Game modes. In the brick mode two walls of bricks stand between the paddles, and a ball breaks the brick it bounces off. */
+#define GAME_MODE_CLASSIC       0
+#define GAME_MODE_BRICKS        1
+
+/* A brick is BRICK_LENGTH pixels along x and BRICK_WIDTH along y, like a paddle, with BRICK_GAP pixels between bricks.
+   Each wall is BRICK_WALL_ROWS rows of BRICK_COLUMNS bricks, clear of the net, the scores and the score boxes. */
+#define BRICK_LENGTH            12
+#define BRICK_WIDTH             6
+#define BRICK_GAP               2
+#define BRICK_COLUMNS           11
+#define BRICK_WALL_ROWS         5
+#define BRICK_ROWS              ( 2 * BRICK_WALL_ROWS )
+#define BRICK_COUNT             ( BRICK_COLUMNS * BRICK_ROWS )				// Brick number row * BRICK_COLUMNS + column.
+#define BRICK_WORDS             ( ( BRICK_COUNT + 31 ) / 32 )
+#define BRICK_LEFT              44											// Left edge of the first column.
+#define BRICK_WALL_1_Y          100											// Top edge of the first row of each wall.
+#define BRICK_WALL_2_Y          181
+
+//////////////////////////////////////// ENTITY STORE ////////////////////////////////////////////////
+
+/* Most balls in play at once, and the number of balls in the multi-ball mode. */
+#define GAME_MAX_BALLS          32
+#define MULTI_BALL_COUNT        24
+
+/* Below this number of balls and paddles, testing every pair of balls is faster than building the collision grid
+   (Host/Grid_Benchmark.c puts the crossover near 40 objects). */
+#define GAME_GRID_MIN_OBJECTS   40
+
+/* The paddles: paddle 1 at the top follows the camera, paddle 2 at the bottom follows the push buttons. */
+#define GAME_PADDLES            2
+#define PADDLE_1                0
+#define PADDLE_2                1
+
+/* The balls, stored as one array per field so that each pass over the balls only touches the fields it uses. */
+typedef struct {
+	unsigned int count;														// Balls in play.
+	fixed x [GAME_MAX_BALLS];												// Top-left corner in Q16.16 pixels.
+	fixed y [GAME_MAX_BALLS];
+	fixed direction_x [GAME_MAX_BALLS];										// Unit vector of the direction of travel.
+	fixed direction_y [GAME_MAX_BALLS];
+	unsigned int previous_x [GAME_MAX_BALLS];								// Pixel position at the start of the tick.
+	unsigned int previous_y [GAME_MAX_BALLS];
+	unsigned int current_x [GAME_MAX_BALLS];								// Pixel position at the end of the tick.
+	unsigned int current_y [GAME_MAX_BALLS];
+} Game_Balls;
+
+/* The paddles, stored the same way. */
+typedef struct {
+	unsigned int x [GAME_PADDLES];											// Top-left corner in pixels.
+	unsigned int y [GAME_PADDLES];
+	unsigned int length [GAME_PADDLES];
+	unsigned int width [GAME_PADDLES];
+} Game_Paddles;
+
+/* Estimate of where the racquet in front of the camera is and how fast it moves. */
+typedef struct {
+	fixed position;															// Q16.16 pixels.
+	fixed velocity;															// Q16.16 pixels per tick.
+	unsigned int outliers;													// Samples ignored in a row.
+	bool locked;															// False until the first sample.
+} Game_Tracker;
+
+/* Everything the next tick depends on. */
+typedef struct {
+	Game_Balls balls;
+	Game_Paddles paddles;
+	Game_Tracker tracker;													// Camera tracker of paddle 1.
+	unsigned int mode;														// One of the GAME_MODE_ values.
+	unsigned int bricks [BRICK_WORDS];										// One bit per brick still standing.
+	unsigned int state;														// One of the GAME_STATE_ values.
+	unsigned int state_ticks;												// Ticks left in the score pause.
+	unsigned int last_point_player;											// 1 or 2, 0 before the first point.
+	unsigned int player_1_score;
+	unsigned int player_2_score;
+	unsigned int ticks;														// Ticks run since the game was initialised.
+	unsigned int random;													// State of the random number generator.
+	bool multi_ball_key;													// The multi-ball key was down in the last tick.
+} Game_State;
+
+/* The players' inputs for one tick. */
+typedef struct {
+	unsigned int paddle_1_x;												// Raw position of paddle 1 from the camera, in pixels.
+	signed int paddle_2_move;												// Push buttons of paddle 2: -1 left, 0 still, 1 right.
+	unsigned int speed;														// Slide switches 0-8: 0 to 511, higher is faster.
+	bool multi_ball;														// The multi-ball key is down.
+} Game_Input;
+
+/* The inputs of one tick as they were read from the board, the way they are recorded for a replay. */
+typedef struct {
+	unsigned char link;														// Camera position of paddle 1, from the last packet of the slave board.
+	unsigned char keys;														// KEY3-0.
+	unsigned short switches;												// SW9-0.
+} Game_InputRecord;
+
+/* Functions called by the step when something happens. Any of them may be NULL. */
+typedef struct {
+	void *context;															// Passed back to every function.
+	void (*bounce) ( void *context );										// A ball bounced off a wall, a paddle or another ball.
+	void (*score) ( void *context, const Game_State *state );				// A player scored, last_point_player says who.
+	void (*hit) ( void *context, unsigned int paddle, unsigned int x, unsigned int y, bool scored );	// A ball at pixel (x,y) bounced off a paddle or went past it.
+} Game_Observer;
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to start a game with a number of balls, 1 to GAME_MAX_BALLS, and the paddles in their starting positions.
+   The seed selects the serves of the whole game. */
+signed int Game_Simulation_initialise ( Game_State *state, unsigned int ball_count, unsigned int seed );
+
+/* Function to select one of the GAME_MODE_ values, with every brick standing. Bricks stand again at every restart. */
+signed int Game_Simulation_setMode ( Game_State *state, unsigned int mode );
+
+/* Function to change the number of balls in play. New balls are served, the ones in play keep moving. */
+signed int Game_Simulation_setBallCount ( Game_State *state, unsigned int ball_count );
+
+/* Function to start a new game with the same number of balls. */
+void Game_Simulation_restart ( Game_State *state );
+
+/* Function to turn the inputs read from the board into the inputs of a tick. */
+void Game_Simulation_decodeInput ( const Game_InputRecord *record, Game_Input *input );
+
+/* Function to return the next number of the game's random number generator. */
+unsigned int Game_Simulation_random ( Game_State *state );
+
+/* Function to compute a checksum of everything in the state, to compare two runs of the same game. */
+unsigned int Game_Simulation_checksum ( const Game_State *state );
+
+/* Function to copy a state. Only the balls in play are copied. */
+void Game_Simulation_copy ( Game_State *destination, const Game_State *source );
+
+/* Function to advance the game by one tick of GAME_TICK_US microseconds. The observer may be NULL. */
+void Game_Simulation_step ( Game_State *state, const Game_Input *input, const Game_Observer *observer );
+
+#endif /* GAME_SIMULATION_H_ */
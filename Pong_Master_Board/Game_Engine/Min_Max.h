@@ -0,0 +1,25 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Maximum and Minimum for PONG.
+ *  ----------------------------------------
+ *  File Name     : Min_Max.h
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	MAX and MIN of two numbers, shared by the graphics and the game
+ *  	modules. Each argument may be evaluated twice.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef MIN_MAX_H_
+#define MIN_MAX_H_
+
+/* Creating a function that returns maximum and minimum of two numbers. */
+#define MAX(number_1, number_2) (((number_1) > (number_2)) ? (number_1) : (number_2))
+#define MIN(number_1, number_2) (((number_1) < (number_2)) ? (number_1) : (number_2))
+
+#endif /* MIN_MAX_H_ */
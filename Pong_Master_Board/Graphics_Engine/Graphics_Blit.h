@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Fixed-Size Blitters for the Graphics Engine.
+ *  ----------------------------------------
+ *  File Name     : Graphics_Blit.h
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	GRAPHICS_DEFINE_FILL(name, WIDTH, HEIGHT) generates a function
+ *
+ *  		signed int name ( unsigned int x, unsigned int y, unsigned short colour );
+ *
+ *  	that fills a WIDTH x HEIGHT rectangle with its top-left corner at
+ *  	panel coordinate (x,y). WIDTH and HEIGHT must be constants below 128.
+ *  	When the pipeline is drawing at full resolution with the linear
+ *  	layout, every pixel store is written out by the preprocessor and
+ *  	there are no loops. Otherwise the function falls back to the generic
+ *  	Graphics_fillBox(). Erasing is filling with the background colour.
+ *
+ *  	GRAPHICS_DEFINE_STRIP(name, HEIGHT) generates a function
+ *
+ *  		signed int name ( unsigned int x, unsigned int y, unsigned int width, unsigned short colour );
+ *
+ *  	that fills columns of a constant HEIGHT, for the few columns an
+ *  	object moving sideways uncovers and covers. Only the rows are
+ *  	unrolled.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAPHICS_BLIT_H_
+#define GRAPHICS_BLIT_H_
+
+#include "Graphics_Engine.h"
+#include "../Graphics_Pipeline/Graphics_Pipeline.h"
+#include <stddef.h>
+
+/* Repeat a statement a constant number of times, 0 to 127. The count is split into powers of two and the
+   branches for the unused ones are removed by the compiler. */
+#define GRAPHICS_REPEAT_1(statement)  statement
+#define GRAPHICS_REPEAT_2(statement)  GRAPHICS_REPEAT_1(statement)  GRAPHICS_REPEAT_1(statement)
+#define GRAPHICS_REPEAT_4(statement)  GRAPHICS_REPEAT_2(statement)  GRAPHICS_REPEAT_2(statement)
+#define GRAPHICS_REPEAT_8(statement)  GRAPHICS_REPEAT_4(statement)  GRAPHICS_REPEAT_4(statement)
+#define GRAPHICS_REPEAT_16(statement) GRAPHICS_REPEAT_8(statement)  GRAPHICS_REPEAT_8(statement)
+#define GRAPHICS_REPEAT_32(statement) GRAPHICS_REPEAT_16(statement) GRAPHICS_REPEAT_16(statement)
+#define GRAPHICS_REPEAT_64(statement) GRAPHICS_REPEAT_32(statement) GRAPHICS_REPEAT_32(statement)
+
+#define GRAPHICS_REPEAT(count, statement) {                     \
+	if ( (count) & 1 )  { GRAPHICS_REPEAT_1(statement) }        \
+	if ( (count) & 2 )  { GRAPHICS_REPEAT_2(statement) }        \
+	if ( (count) & 4 )  { GRAPHICS_REPEAT_4(statement) }        \
+	if ( (count) & 8 )  { GRAPHICS_REPEAT_8(statement) }        \
+	if ( (count) & 16 ) { GRAPHICS_REPEAT_16(statement) }       \
+	if ( (count) & 32 ) { GRAPHICS_REPEAT_32(statement) }       \
+	if ( (count) & 64 ) { GRAPHICS_REPEAT_64(statement) }       \
+}
+
+/* Generate a fill function for a WIDTH x HEIGHT rectangle. */
+#define GRAPHICS_DEFINE_FILL(name, WIDTH, HEIGHT)                                                          \
+typedef char name##_size_check [ ( (WIDTH) > 0 && (WIDTH) < 128 && (HEIGHT) > 0 && (HEIGHT) < 128 ) ? 1 : -1 ]; \
+signed int name ( unsigned int x, unsigned int y, unsigned short colour )                                  \
+{                                                                                                          \
+	unsigned int stride;                                                                                   \
+	unsigned short *pixel = Graphics_Pipeline_directTarget ( &stride );                                     \
+	                                                                                                       \
+	if ( pixel == NULL || x + (WIDTH) > LT24_WIDTH || y + (HEIGHT) > LT24_HEIGHT )                         \
+	{                                                                                                      \
+		return Graphics_fillBox ( x, y, x + (WIDTH) - 1, y + (HEIGHT) - 1, colour );	/* Generic path. */  \
+	}                                                                                                      \
+	                                                                                                       \
+	pixel = pixel + y * stride + x;                                                                        \
+	GRAPHICS_REPEAT ( HEIGHT, { GRAPHICS_REPEAT ( WIDTH, *pixel++ = colour; ) pixel += stride - (WIDTH); } ) \
+	                                                                                                       \
+	Graphics_Pipeline_markDirty ( x, y, x + (WIDTH) - 1, y + (HEIGHT) - 1 );                               \
+	return GE_SUCCESS;                                                                                     \
+}
+
+/* Generate a fill function for a strip of any width and HEIGHT rows, filled column by column. */
+#define GRAPHICS_DEFINE_STRIP(name, HEIGHT)                                                                \
+typedef char name##_size_check [ ( (HEIGHT) > 0 && (HEIGHT) < 128 ) ? 1 : -1 ];                           \
+signed int name ( unsigned int x, unsigned int y, unsigned int width, unsigned short colour )              \
+{                                                                                                          \
+	unsigned int stride;                                                                                   \
+	unsigned int column;                                                                                   \
+	unsigned short *pixel = Graphics_Pipeline_directTarget ( &stride );                                     \
+	                                                                                                       \
+	if ( width == 0 ) return GE_SUCCESS;                                                                   \
+	if ( pixel == NULL || x + width > LT24_WIDTH || y + (HEIGHT) > LT24_HEIGHT )                           \
+	{                                                                                                      \
+		return Graphics_fillBox ( x, y, x + width - 1, y + (HEIGHT) - 1, colour );	/* Generic path. */     \
+	}                                                                                                      \
+	                                                                                                       \
+	pixel = pixel + y * stride + x;                                                                        \
+	for ( column = 0; column < width; column++ )                                                           \
+	{                                                                                                      \
+		GRAPHICS_REPEAT ( HEIGHT, { *pixel = colour; pixel += stride; } )                                  \
+		pixel = pixel + 1 - (HEIGHT) * stride;                                                             \
+	}                                                                                                      \
+	                                                                                                       \
+	Graphics_Pipeline_markDirty ( x, y, x + width - 1, y + (HEIGHT) - 1 );                                 \
+	return GE_SUCCESS;                                                                                     \
+}
+
+#endif /* GRAPHICS_BLIT_H_ */
@@ -20,8 +20,14 @@
 
 #include "Graphics_Engine.h"												// Invoking the main header file.
 #include "../DE1Soc_LT24/DE1SoC_LT24.h"										// Importing the Leeds SoC LT24 driver controller.
+#include "../Graphics_Pipeline/Graphics_Pipeline.h"							// Importing the double-buffered render/flush pipeline.
 #include "math.h"															// Importing the mathematical library of C.
 
+/* Render mode. Every primitive is rasterised on a logical grid of (LT24_WIDTH >> scale_shift) x (LT24_HEIGHT >> scale_shift)
+   pixels, and every logical pixel is written to the LT24 as a (1 << scale_shift) square block in a single window burst. */
+unsigned int graphics_render_mode = GRAPHICS_FULL_RESOLUTION;
+unsigned int graphics_scale_shift = 0;
+
 /* Graphics initialisation.  */
 void Graphics_initialise( unsigned int lcd_pio_base, unsigned int lcd_hw_base )
 {
@@ -31,8 +37,152 @@ void Graphics_initialise( unsigned int lcd_pio_base, unsigned int lcd_hw_base )
 	}
 }
 
+/* Function to select full resolution or half resolution (2x2 pixel-doubled) rendering. */
+signed int Graphics_setRenderMode ( unsigned int mode )
+{
+	if ( mode == GRAPHICS_FULL_RESOLUTION )
+	{
+		graphics_scale_shift = 0;											// One logical pixel is one LT24 pixel.
+	}
+	else if ( mode == GRAPHICS_HALF_RESOLUTION )
+	{
+		graphics_scale_shift = 1;											// One logical pixel is a 2x2 block of LT24 pixels.
+	}
+	else
+	{
+		return GE_INVALIDMODE;												// Unknown mode, keep the current one.
+	}
+	
+	graphics_render_mode = mode;
+	
+	if ( Graphics_Pipeline_isEnabled() )
+	{
+		Graphics_Pipeline_reset ( LT24_BLACK, graphics_scale_shift );		// The frame buffers change size with the logical grid.
+	}
+	
+	return GE_SUCCESS;
+}
+
+/* Function to read back the current render mode. */
+unsigned int Graphics_getRenderMode ( void )
+{
+	return graphics_render_mode;
+}
+
+/* Internal function to write one logical pixel as a single window burst. */
+signed int Graphics_plot ( unsigned short colour, unsigned int x, unsigned int y )
+{
+	signed int GE_status = 0;												// Status variable to check for errors.
+	unsigned int size = 1 << graphics_scale_shift;							// Side of the block in LT24 pixels.
+	unsigned int count = size * size;										// Number of LT24 pixels in the block.
+	
+	if ( Graphics_Pipeline_isEnabled() )
+	{
+		Graphics_Pipeline_plot ( colour, x, y );							// Draw into the back buffer, the pipeline sends it later.
+		return GE_SUCCESS;
+	}
+	
+	GE_status = LT24_setWindow ( x << graphics_scale_shift, y << graphics_scale_shift, size, size );	// One window for the whole block.
+	if ( GE_status != GE_SUCCESS) return GE_status;							// If there is an error, report it.
+	
+	while ( count-- ) LT24_write ( true, colour );							// The window auto-increments, so just stream the colour.
+	
+	return GE_SUCCESS;
+}
+
+/* Internal function to fill the logical rectangle (x1,y1) to (x2,y2), both corners inclusive, as a single window burst. */
+signed int Graphics_fill ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour )
+{
+	signed int GE_status = 0;												// Status variable to check for errors.
+	unsigned int width = ( x2 - x1 + 1 ) << graphics_scale_shift;			// Width of the window in LT24 pixels.
+	unsigned int height = ( y2 - y1 + 1 ) << graphics_scale_shift;			// Height of the window in LT24 pixels.
+	unsigned int count = width * height;									// Number of LT24 pixels in the window.
+	
+	if ( x1 > x2 || y1 > y2 ) return GE_SUCCESS;							// Nothing to fill.
+	
+	if ( Graphics_Pipeline_isEnabled() )
+	{
+		Graphics_Pipeline_fill ( x1, y1, x2, y2, colour );					// Draw into the back buffer, the pipeline sends it later.
+		return GE_SUCCESS;
+	}
+	
+	GE_status = LT24_setWindow ( x1 << graphics_scale_shift, y1 << graphics_scale_shift, width, height );
+	if ( GE_status != GE_SUCCESS) return GE_status;							// If there is an error, report it.
+	
+	while ( count-- ) LT24_write ( true, colour );							// Stream the colour into the window.
+	
+	return GE_SUCCESS;
+}
+
+/* Function to draw a single pixel at LT24 coordinate (x,y). In half resolution the pixel is snapped to its 2x2 block. */
+signed int Graphics_drawPixel ( unsigned short colour, unsigned int x, unsigned int y )
+{
+	return Graphics_plot ( colour, x >> graphics_scale_shift, y >> graphics_scale_shift );
+}
+
+/* Function to fill a box with corners (x1,y1) and (x2,y2) in LT24 coordinates, using a single window burst. */
+signed int Graphics_fillBox ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour )
+{
+	return Graphics_fill ( x1 >> graphics_scale_shift, y1 >> graphics_scale_shift, x2 >> graphics_scale_shift, y2 >> graphics_scale_shift, colour );
+}
+
+/* Function to draw an image of width x height pixels, stored row by row, with its top-left corner at LT24 coordinate (x,y).
+   At full resolution the image is sent as a single window burst. In half resolution every other pixel is drawn. */
+signed int Graphics_drawImage ( unsigned int x, unsigned int y, unsigned int width, unsigned int height, const unsigned short *pixels )
+{
+	signed int GE_status = 0;												// Status variable to check for errors.
+	unsigned int current_x;
+	unsigned int current_y;
+	
+	if ( graphics_scale_shift != 0 )
+	{
+		for ( current_y = 0; current_y < height; current_y += 2 )			// One pixel of each 2x2 block, snapped like Graphics_drawPixel().
+		{
+			for ( current_x = 0; current_x < width; current_x += 2 )
+			{
+				GE_status = Graphics_drawPixel ( pixels[current_y * width + current_x], x + current_x, y + current_y );
+				if ( GE_status != GE_SUCCESS) return GE_status;				// If there is an error, report it.
+			}
+		}
+		return GE_SUCCESS;
+	}
+	
+	if ( Graphics_Pipeline_isEnabled() )
+	{
+		Graphics_Pipeline_blit ( x, y, width, height, pixels );				// Copy into the back buffer, the pipeline sends it later.
+		return GE_SUCCESS;
+	}
+	
+	return LT24_copyFrameBuffer ( pixels, x, y, width, height );			// One window, then stream the pixels.
+}
+
+/* Function to clear the whole screen to a colour. */
+signed int Graphics_clearScreen ( unsigned short colour )
+{
+	return Graphics_fill ( 0, 0, ( LT24_WIDTH >> graphics_scale_shift ) - 1, ( LT24_HEIGHT >> graphics_scale_shift ) - 1, colour );
+}
+
+/* Function to end a frame. With the pipeline enabled the finished frame is handed over to be sent to the LT24,
+   otherwise everything has already been drawn and there is nothing to do. */
+signed int Graphics_present ( void )
+{
+	if ( Graphics_Pipeline_isEnabled() )
+	{
+		return Graphics_Pipeline_swap();
+	}
+	
+	return GE_SUCCESS;
+}
+
 /* Graphic function to draw a straight line. Returns 0 if successful .*/
 signed int Graphics_drawLine ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour )
+{
+	/* Rasterise on the logical grid of the current render mode. */
+	return Graphics_drawLogicalLine ( x1 >> graphics_scale_shift, y1 >> graphics_scale_shift, x2 >> graphics_scale_shift, y2 >> graphics_scale_shift, colour );
+}
+
+/* Internal function to draw a straight line between two logical coordinates. Returns 0 if successful .*/
+signed int Graphics_drawLogicalLine ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour )
 {
 	/* Declaring the local variables required for drawing a line */
 	signed int GE_status = 0;												// Status variable to check for errors.
@@ -53,7 +203,7 @@ signed int Graphics_drawLine ( unsigned int x1, unsigned int y1, unsigned int x2
 		{
 			for ( current_x = x1; current_x >= x2; current_x -- )			// Draw a line from (x2,y2) to (x1,y1)
 			{
-				GE_status = LT24_drawPixel ( colour, current_x, current_y);	// Draw single pixel.
+				GE_status = Graphics_plot ( colour, current_x, current_y);	// Draw single pixel.
 				if ( GE_status != GE_SUCCESS) return GE_status;				// If there is an error, report it.
 			}
 		}
@@ -61,7 +211,7 @@ signed int Graphics_drawLine ( unsigned int x1, unsigned int y1, unsigned int x2
 		{
 			for ( current_x = x2; current_x >= x1; current_x -- )			// Draw a line from (x1,y1) to (x2,y2)
 			{
-				GE_status = LT24_drawPixel ( colour, current_x, current_y);	// Draw single pixel.
+				GE_status = Graphics_plot ( colour, current_x, current_y);	// Draw single pixel.
 				if ( GE_status != GE_SUCCESS) return GE_status;				// If there is an error, report it.
 			}
 		}
@@ -74,7 +224,7 @@ signed int Graphics_drawLine ( unsigned int x1, unsigned int y1, unsigned int x2
 		{
 			for ( current_y = y1; current_y >= y2; current_y -- )			// Draw a line from (x2,y2) to (x1,y1)
 			{
-				GE_status = LT24_drawPixel ( colour, current_x, current_y);	// Draw single pixel.
+				GE_status = Graphics_plot ( colour, current_x, current_y);	// Draw single pixel.
 				if ( GE_status != GE_SUCCESS) return GE_status;				// If there is an error, report it.
 			}
 		}
@@ -82,7 +232,7 @@ signed int Graphics_drawLine ( unsigned int x1, unsigned int y1, unsigned int x2
 		{
 			for ( current_y = y2; current_y >= y1; current_y -- )			// Draw a line from (x1,y1) to (x2,y2)
 			{
-				GE_status = LT24_drawPixel ( colour, current_x, current_y);	// Draw single pixel.
+				GE_status = Graphics_plot ( colour, current_x, current_y);	// Draw single pixel.
 				if ( GE_status != GE_SUCCESS) return GE_status;				// If there is an error, report it.
 			}
 		}
@@ -133,13 +283,13 @@ signed int Graphics_drawLine ( unsigned int x1, unsigned int y1, unsigned int x2
 		{
 			if ( is_line_steep ) 
 			{
-				GE_status = LT24_drawPixel ( colour, current_y,current_x );	// Draw single pixel.
+				GE_status = Graphics_plot ( colour, current_y,current_x );	// Draw single pixel.
 				if ( GE_status != GE_SUCCESS) return GE_status;				// If there is an error, report it.
 			}
 			
 			else
 			{
-				GE_status = LT24_drawPixel ( colour, current_x, current_y);	// Draw single pixel.
+				GE_status = Graphics_plot ( colour, current_x, current_y);	// Draw single pixel.
 				if ( GE_status != GE_SUCCESS) return GE_status;				// If there is an error, report it.
 			}
 			
@@ -163,31 +313,29 @@ signed int Graphics_drawBox ( unsigned int x1, unsigned int y1, unsigned int x2,
 	/* Declaring the local variables required for drawing a line */
 	signed int GE_status = 0;												// Status variable to check for errors.
 	
-	unsigned int current_x;													// The x - point from where the pixel has to be drawn.
-	unsigned int current_y;													// The y - point from where the pixel has to be drawn.	
+	/* Rasterise on the logical grid of the current render mode. */
+	x1 = x1 >> graphics_scale_shift;
+	y1 = y1 >> graphics_scale_shift;
+	x2 = x2 >> graphics_scale_shift;
+	y2 = y2 >> graphics_scale_shift;
 	
-	GE_status = Graphics_drawLine(x1,y1,x2,y1,colour);						// Draw a line from (x1,y1) to (x2,y1)
+	/* Each edge is a one pixel thick rectangle, so it is sent as one burst instead of pixel by pixel. */
+	GE_status = Graphics_fill(x1,y1,x2,y1,colour);							// Draw a line from (x1,y1) to (x2,y1)
 	if ( GE_status != GE_SUCCESS) return GE_status;							// If there is an error, report it.
 	
-	GE_status = Graphics_drawLine(x1,y1,x1,y2,colour);						// Draw a line from (x1,y1) to (x1,y2)
+	GE_status = Graphics_fill(x1,y1,x1,y2,colour);							// Draw a line from (x1,y1) to (x1,y2)
 	if ( GE_status != GE_SUCCESS) return GE_status;							// If there is an error, report it.
 	
-	GE_status = Graphics_drawLine(x2,y1,x2,y2,colour);						// Draw a line from (x2,y1) to (x2,y2)
+	GE_status = Graphics_fill(x2,y1,x2,y2,colour);							// Draw a line from (x2,y1) to (x2,y2)
 	if ( GE_status != GE_SUCCESS) return GE_status;							// If there is an error, report it.
 	
-	GE_status = Graphics_drawLine(x1,y2,x2,y2,colour);						// Draw a line from (x1,y2) to (x2,y2)
+	GE_status = Graphics_fill(x1,y2,x2,y2,colour);							// Draw a line from (x1,y2) to (x2,y2)
 	if ( GE_status != GE_SUCCESS) return GE_status;							// If there is an error, report it.
 	
-	if ( noFill == false ) 
+	if ( noFill == false && x2 > x1 + 1 && y2 > y1 + 1 ) 
 	{
-		for ( current_x = x2-1; current_x >= x1+1; current_x -- )			// Iterate through each row.
-		{
-			for ( current_y = y2-1; current_y >= y1+1; current_y -- )		// Fill each column of the every row.
-			{
-				GE_status = LT24_drawPixel(fillColour,current_x,current_y); // Draw single pixel.
-				if ( GE_status != GE_SUCCESS) return GE_status;				// If there is an error, report it.
-			}
-		}
+		GE_status = Graphics_fill(x1+1,y1+1,x2-1,y2-1,fillColour);			// Fill the inside of the box in one burst.
+		if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 	}
 	
 	return GE_SUCCESS;
@@ -207,6 +355,13 @@ signed int Graphics_drawCircle ( unsigned int x, unsigned int y, unsigned int r,
     int increment_error = delta_x - (r << 1);								// To hold the error.
 	int fill_radius;														// Radius of concentric circles.
 	
+	/* Rasterise on the logical grid of the current render mode. */
+	x = x >> graphics_scale_shift;
+	y = y >> graphics_scale_shift;
+	r = r >> graphics_scale_shift;
+	current_x = r-1;
+	increment_error = delta_x - (r << 1);
+	
 	if ( noFill == false )
 	{		
 		/*
@@ -223,59 +378,59 @@ signed int Graphics_drawCircle ( unsigned int x, unsigned int y, unsigned int r,
 		while (current_x >= current_y)
 		{
 			/* Octant #1 */
-			GE_status = Graphics_drawLine( x, y+current_y, x+current_x, y+current_y, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
+			GE_status = Graphics_drawLogicalLine( x, y+current_y, x+current_x, y+current_y, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
-			GE_status = LT24_drawPixel( colour, x + current_x, y + current_y); 						// Draw single pixel.
+			GE_status = Graphics_plot( colour, x + current_x, y + current_y); 						// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
 			/* Octant #2 */
-			GE_status = Graphics_drawLine( x, y + current_x, x+current_y, y+current_x, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
+			GE_status = Graphics_drawLogicalLine( x, y + current_x, x+current_y, y+current_x, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 
-			GE_status = LT24_drawPixel( colour, x + current_y, y + current_x);						// Draw single pixel.
+			GE_status = Graphics_plot( colour, x + current_y, y + current_x);						// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
 			/* Octant #3 */
-			GE_status = Graphics_drawLine( x, y + current_x, x-current_y, y+current_x, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
+			GE_status = Graphics_drawLogicalLine( x, y + current_x, x-current_y, y+current_x, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
-			GE_status = LT24_drawPixel( colour, x - current_y, y + current_x);						// Draw single pixel.
+			GE_status = Graphics_plot( colour, x - current_y, y + current_x);						// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
 			/* Octant #4 */
-			GE_status = Graphics_drawLine( x, y+current_y, x-current_x, y+current_y, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
+			GE_status = Graphics_drawLogicalLine( x, y+current_y, x-current_x, y+current_y, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
-			GE_status = LT24_drawPixel( colour, x - current_x, y + current_y);						// Draw single pixel.
+			GE_status = Graphics_plot( colour, x - current_x, y + current_y);						// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
 			/* Octant #5 */
-			GE_status = Graphics_drawLine( x, y-current_y, x-current_x, y-current_y, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
+			GE_status = Graphics_drawLogicalLine( x, y-current_y, x-current_x, y-current_y, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
-			GE_status = LT24_drawPixel( colour, x - current_x, y - current_y);						// Draw single pixel.
+			GE_status = Graphics_plot( colour, x - current_x, y - current_y);						// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
 			/* Octant #6 */
-			GE_status = Graphics_drawLine( x, y-current_x, x-current_y, y-current_x, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
+			GE_status = Graphics_drawLogicalLine( x, y-current_x, x-current_y, y-current_x, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
-			GE_status = LT24_drawPixel( colour, x - current_y, y - current_x);						// Draw single pixel.
+			GE_status = Graphics_plot( colour, x - current_y, y - current_x);						// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
 			/* Octant #7 */
-			GE_status = Graphics_drawLine( x, y-current_x, x+current_y, y-current_x, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
+			GE_status = Graphics_drawLogicalLine( x, y-current_x, x+current_y, y-current_x, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
-			GE_status = LT24_drawPixel( colour, x + current_y, y - current_x);						// Draw single pixel.
+			GE_status = Graphics_plot( colour, x + current_y, y - current_x);						// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
 			/* Octant #8 */
-			GE_status = Graphics_drawLine( x, y-current_y, x+current_x, y-current_y, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
+			GE_status = Graphics_drawLogicalLine( x, y-current_y, x+current_x, y-current_y, fillColour);	// Draw a line from (x,y) to the circumference of the circle.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 			
-			GE_status = LT24_drawPixel( colour, x + current_x, y - current_y);						// Draw single pixel.
+			GE_status = Graphics_plot( colour, x + current_x, y - current_y);						// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 
 			if (increment_error <= 0)																// Check whether the error is less than 0.
@@ -299,35 +454,35 @@ signed int Graphics_drawCircle ( unsigned int x, unsigned int y, unsigned int r,
 		while (current_x >= current_y)
 		{	
 			/* Octant #1 */
-			GE_status = LT24_drawPixel(colour, x + current_x, y + current_y); 	// Draw single pixel.
+			GE_status = Graphics_plot(colour, x + current_x, y + current_y); 	// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 			
 			/* Octant #2 */
-			GE_status = LT24_drawPixel(colour, x + current_y, y + current_x);	// Draw single pixel.
+			GE_status = Graphics_plot(colour, x + current_y, y + current_x);	// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 			
 			/* Octant #3 */
-			GE_status = LT24_drawPixel(colour, x - current_y, y + current_x);	// Draw single pixel.
+			GE_status = Graphics_plot(colour, x - current_y, y + current_x);	// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 			
 			/* Octant #4 */
-			GE_status = LT24_drawPixel(colour, x - current_x, y + current_y);	// Draw single pixel.
+			GE_status = Graphics_plot(colour, x - current_x, y + current_y);	// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 			
 			/* Octant #5 */
-			GE_status = LT24_drawPixel(colour, x - current_x, y - current_y);	// Draw single pixel.
+			GE_status = Graphics_plot(colour, x - current_x, y - current_y);	// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 			
 			/* Octant #6 */
-			GE_status = LT24_drawPixel(colour, x - current_y, y - current_x);	// Draw single pixel.
+			GE_status = Graphics_plot(colour, x - current_y, y - current_x);	// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 			
 			/* Octant #7 */
-			GE_status = LT24_drawPixel(colour, x + current_y, y - current_x);	// Draw single pixel.
+			GE_status = Graphics_plot(colour, x + current_y, y - current_x);	// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 			
 			/* Octant #8 */
-			GE_status = LT24_drawPixel(colour, x + current_x, y - current_y);	// Draw single pixel.
+			GE_status = Graphics_plot(colour, x + current_x, y - current_y);	// Draw single pixel.
 			if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 
 			if (increment_error <= 0)											// Check whether the error is less than 0.
@@ -363,6 +518,13 @@ signed int Graphics_drawTriangle( unsigned int x1, unsigned int y1, unsigned int
 	unsigned int boundary_min_y;											// The minimum y value of the triangle.
 	unsigned int boundary_max_y;											// The maximum y value of the triangle.
 	
+	/* Rasterise on the logical grid of the current render mode. */
+	x1 = x1 >> graphics_scale_shift;
+	y1 = y1 >> graphics_scale_shift;
+	x2 = x2 >> graphics_scale_shift;
+	y2 = y2 >> graphics_scale_shift;
+	x3 = x3 >> graphics_scale_shift;
+	y3 = y3 >> graphics_scale_shift;
 	
 	if ( noFill == false )													// Check whether the triangle should be filled or not.
 	{		
@@ -378,31 +540,31 @@ signed int Graphics_drawTriangle( unsigned int x1, unsigned int y1, unsigned int
 			{
 				if ( Graphics_Engine_Point_Test( current_x, current_y, x1, y1, x2, y2, x3, y3 )  == true )	// Check if the pixel lies within the triangle
 				{	
-					GE_status = LT24_drawPixel( fillColour, current_x, current_y);							// Draw single pixel.
+					GE_status = Graphics_plot( fillColour, current_x, current_y);							// Draw single pixel.
 					if ( GE_status != GE_SUCCESS) return GE_status;											// If there is an error, report it.
 				}
 			}
 		}
 		
-		GE_status = Graphics_drawLine(x1,y1,x2,y2,colour);					// Draw a line from (x1,y1) to (x2,y2)
+		GE_status = Graphics_drawLogicalLine(x1,y1,x2,y2,colour);					// Draw a line from (x1,y1) to (x2,y2)
 		if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 		
-		GE_status = Graphics_drawLine(x1,y1,x3,y3,colour);					// Draw a line from (x1,y1) to (x3,y3)
+		GE_status = Graphics_drawLogicalLine(x1,y1,x3,y3,colour);					// Draw a line from (x1,y1) to (x3,y3)
 		if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 		
-		GE_status = Graphics_drawLine(x2,y2,x3,y3,colour);					// Draw a line from (x2,y2) to (x3,y3)
+		GE_status = Graphics_drawLogicalLine(x2,y2,x3,y3,colour);					// Draw a line from (x2,y2) to (x3,y3)
 		if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 	}
 	
 	else 
 	{	
-		GE_status = Graphics_drawLine(x1,y1,x2,y2,colour);					// Draw a line from (x1,y1) to (x2,y2)
+		GE_status = Graphics_drawLogicalLine(x1,y1,x2,y2,colour);					// Draw a line from (x1,y1) to (x2,y2)
 		if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 		
-		GE_status = Graphics_drawLine(x1,y1,x3,y3,colour);					// Draw a line from (x1,y1) to (x3,y3)
+		GE_status = Graphics_drawLogicalLine(x1,y1,x3,y3,colour);					// Draw a line from (x1,y1) to (x3,y3)
 		if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 		
-		GE_status = Graphics_drawLine(x2,y2,x3,y3,colour);					// Draw a line from (x2,y2) to (x3,y3)
+		GE_status = Graphics_drawLogicalLine(x2,y2,x3,y3,colour);					// Draw a line from (x2,y2) to (x3,y3)
 		if ( GE_status != GE_SUCCESS) return GE_status;						// If there is an error, report it.
 	}
 	
@@ -23,16 +23,46 @@
 /* Importing the required libraries. */
 /* Boolean variable type "bool" and "true"/"false" constants. */
 #include <stdbool.h> 														
+#include "../Game_Engine/Min_Max.h"
 
 /* Error Codes*/
 #define GE_SUCCESS       0
+#define GE_INVALIDMODE  -8
 
-/* Creating a function that returns maximum and minimum of two numbers. */
-#define MAX(number_1, number_2) (((number_1) > (number_2)) ? (number_1) : (number_2))
-#define MIN(number_1, number_2) (((number_1) < (number_2)) ? (number_1) : (number_2))
+/* Render modes. In half resolution the logical playfield is 120x160 and every logical pixel is written as a 2x2 block. */
+#define GRAPHICS_FULL_RESOLUTION 0
+#define GRAPHICS_HALF_RESOLUTION 1
 
 //////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
 
+/* Function to select full resolution or half resolution (2x2 pixel-doubled) rendering.
+   All drawing functions keep taking LT24 coordinates, they are snapped to the logical grid of the current mode. */
+signed int Graphics_setRenderMode ( unsigned int mode );
+
+/* Function to read back the current render mode. */
+unsigned int Graphics_getRenderMode ( void );
+
+/* Function to draw a single pixel at LT24 coordinate (x,y). In half resolution the pixel is snapped to its 2x2 block. */
+signed int Graphics_drawPixel ( unsigned short colour, unsigned int x, unsigned int y );
+
+/* Function to fill a box with corners (x1,y1) and (x2,y2) in LT24 coordinates, using a single window burst. */
+signed int Graphics_fillBox ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour );
+
+/* Function to draw an image of width x height pixels, stored row by row, with its top-left corner at LT24 coordinate (x,y).
+   At full resolution the image is sent as a single window burst. In half resolution every other pixel is drawn. */
+signed int Graphics_drawImage ( unsigned int x, unsigned int y, unsigned int width, unsigned int height, const unsigned short *pixels );
+
+/* Function to clear the whole screen to a colour. */
+signed int Graphics_clearScreen ( unsigned short colour );
+
+/* Function to end a frame. With the render/flush pipeline enabled this hands the finished frame over to be sent to the LT24. */
+signed int Graphics_present ( void );
+
+/* Internal functions working on logical coordinates of the current render mode. */
+signed int Graphics_plot ( unsigned short colour, unsigned int x, unsigned int y );
+signed int Graphics_fill ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour );
+signed int Graphics_drawLogicalLine ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour );
+
 /* Function to draw a box with two coordinates: top-left (x1,y1) and bottom_right (x2,y2) with a boundary colour. 
    The function has a boolean argument that decides whether the box should be filled or not with the colour as that of the boundary.*/
 signed int Graphics_drawBox ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour, bool noFill, unsigned short fillColour );
@@ -0,0 +1,561 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Double-Buffered Render/Flush Pipeline for the LT24 Display
+ *  ----------------------------------------
+ *  File Name     : Graphics_Pipeline.c
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Two frame buffers with a dirty tile bitmap each. The game draws into
+ *  	the back buffer while the dirty tiles of the front buffer are
+ *  	streamed to the LT24, one window burst per run of dirty tiles.
+ *  	After a swap the tiles drawn in the finished frame are copied into
+ *  	the new back buffer, so both buffers always hold the whole scene and
+ *  	the game can keep drawing incrementally.
+ *
+ *  	In worker mode the runs of dirty tiles of each finished frame are
+ *  	queued on a ring, and a worker on the other core (or thread) takes
+ *  	them off and does all the LT24 traffic. The core that runs the game
+ *  	then never touches the display and takes no flush interrupts.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Graphics_Pipeline.h"												// Invoking the main header file.
+#include "Graphics_Ring.h"													// Importing the ring that feeds the render worker.
+#include "../HPS_Timer/HPS_Timer.h"											// Importing the time stamp counter for the frame statistics.
+#include <stddef.h>															// Importing NULL.
+
+/* The two frame buffers, sized for full resolution. Half resolution only uses the first quarter of each. */
+unsigned short gp_buffer [2][LT24_WIDTH * LT24_HEIGHT];
+
+/* One word per row of tiles, one bit per tile in the row. */
+unsigned int gp_dirty [2][GP_TILES_Y];
+
+/* Pipeline state. */
+bool gp_enabled = false;
+volatile unsigned int gp_back = 0;										// Index of the buffer being drawn into.
+volatile bool gp_flushing = false;											// True while the front buffer is being streamed to the LT24.
+unsigned int gp_flush_tile = 0;												// Next tile of the front buffer to look at.
+bool gp_worker = false;														// True when the render worker sends the frames instead of flushStep().
+
+/* Runs of dirty tiles queued for the render worker, one word each, and the word that ends a frame. */
+Graphics_Ring gp_ring;
+#define GP_REGION(tile_y,first_x,last_x) ( ( (tile_y) << 16 ) | ( (first_x) << 8 ) | (last_x) )
+#define GP_REGION_END 0xFFFFFFFF
+
+/* Logical screen of the current render mode. */
+unsigned int gp_shift = 0;
+unsigned int gp_width = LT24_WIDTH;
+unsigned int gp_height = LT24_HEIGHT;
+unsigned int gp_tiles_x = GP_TILES_X;
+unsigned int gp_tiles_y = GP_TILES_Y;
+unsigned int gp_layout = GP_LAYOUT_LINEAR;
+
+/* Timing. */
+Graphics_PipelineStats gp_stats;
+unsigned int gp_frame_start = 0;											// Time stamp of the end of the last swap.
+unsigned int gp_flush_start = 0;											// Time stamp of the start of the current flush.
+unsigned int gp_flush_count = 0;											// Tiles sent in the current flush.
+
+/* Index of a logical pixel in a frame buffer, for each layout. A row of 8x4 blocks is 4 rows of the linear layout long. */
+#define GP_LINEAR_INDEX(x,y) ( (y) * gp_width + (x) )
+#define GP_TILED_INDEX(x,y)  ( ( (y) & ~( GP_BLOCK_H - 1 ) ) * gp_width + ( ( (x) & ~( GP_BLOCK_W - 1 ) ) << GP_BLOCK_H_SHIFT ) \
+                             + ( ( (y) & ( GP_BLOCK_H - 1 ) ) << GP_BLOCK_W_SHIFT ) + ( (x) & ( GP_BLOCK_W - 1 ) ) )
+#define GP_INDEX(x,y) ( ( gp_layout == GP_LAYOUT_TILED ) ? GP_TILED_INDEX(x,y) : GP_LINEAR_INDEX(x,y) )
+
+/* Function to check whether drawing is going through the pipeline. */
+bool Graphics_Pipeline_isEnabled ( void )
+{
+	return gp_enabled;
+}
+
+/* Function to enable the pipeline. Both buffers are cleared to a colour, and the whole screen is marked dirty. */
+signed int Graphics_Pipeline_initialise ( unsigned short colour, unsigned int scale_shift )
+{
+	HPS_Timer_startTimestamp();												// The statistics need the time stamp counter running.
+
+	gp_enabled = true;
+	Graphics_Pipeline_reset ( colour, scale_shift );
+
+	gp_stats.frames = 0;
+	gp_stats.max_frame_ticks = 0;
+	gp_frame_start = HPS_Timer_timestamp();
+
+	return GP_SUCCESS;
+}
+
+/* Function to change the logical resolution. Waits for the current flush, then clears both buffers to a colour. */
+signed int Graphics_Pipeline_reset ( unsigned short colour, unsigned int scale_shift )
+{
+	unsigned int index;
+	unsigned int row;
+
+	if ( !gp_enabled ) return GP_NOTENABLED;
+
+	Graphics_Pipeline_finish();												// Never change the layout under a running flush.
+
+	gp_shift = scale_shift;
+	gp_width = LT24_WIDTH >> scale_shift;
+	gp_height = LT24_HEIGHT >> scale_shift;
+	gp_tiles_x = ( gp_width + GP_TILE_SIZE - 1 ) >> GP_TILE_SHIFT;
+	gp_tiles_y = ( gp_height + GP_TILE_SIZE - 1 ) >> GP_TILE_SHIFT;
+
+	for ( index = 0; index < gp_width * gp_height; index++ )
+	{
+		gp_buffer[0][index] = colour;
+		gp_buffer[1][index] = colour;
+	}
+
+	for ( row = 0; row < GP_TILES_Y; row++ )
+	{
+		gp_dirty[gp_back][row] = ( row < gp_tiles_y ) ? ( 1u << gp_tiles_x ) - 1 : 0;	// The next swap sends the whole screen.
+		gp_dirty[gp_back ^ 1][row] = 0;
+	}
+
+	return GP_SUCCESS;
+}
+
+/* Function to select the memory layout of the frame buffers. Both buffers are cleared to a colour like a reset. */
+signed int Graphics_Pipeline_setLayout ( unsigned int layout, unsigned short colour )
+{
+	if ( layout != GP_LAYOUT_LINEAR && layout != GP_LAYOUT_TILED ) return GP_INVALIDLAYOUT;
+	if ( !gp_enabled ) return GP_NOTENABLED;
+
+	Graphics_Pipeline_finish();												// The flush reads the buffers with the current layout.
+	gp_layout = layout;
+
+	return Graphics_Pipeline_reset ( colour, gp_shift );
+}
+
+/* Function to read the memory layout of the frame buffers. */
+unsigned int Graphics_Pipeline_getLayout ( void )
+{
+	return gp_layout;
+}
+
+/* Function to draw a logical pixel into the back buffer. */
+void Graphics_Pipeline_plot ( unsigned short colour, unsigned int x, unsigned int y )
+{
+	if ( x >= gp_width || y >= gp_height ) return;							// Clip to the logical screen.
+
+	gp_buffer[gp_back][GP_INDEX(x,y)] = colour;
+	gp_dirty[gp_back][y >> GP_TILE_SHIFT] |= 1u << ( x >> GP_TILE_SHIFT );
+}
+
+/* Internal function to fill a clipped rectangle in the tiled layout. Each 8x4 block is finished before the next
+   one is touched, so a small object only brings in the cache lines of the blocks it covers. */
+void Graphics_Pipeline_fillTiled ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour )
+{
+	unsigned short *block;
+	unsigned short *row;
+	unsigned int block_x;
+	unsigned int block_y;
+	unsigned int first_x;
+	unsigned int last_x;
+	unsigned int first_y;
+	unsigned int last_y;
+	unsigned int current_x;
+	unsigned int current_y;
+
+	for ( block_y = y1 & ~( GP_BLOCK_H - 1 ); block_y <= y2; block_y += GP_BLOCK_H )
+	{
+		first_y = MAX ( y1, block_y );
+		last_y = MIN ( y2, block_y + GP_BLOCK_H - 1 );
+
+		for ( block_x = x1 & ~( GP_BLOCK_W - 1 ); block_x <= x2; block_x += GP_BLOCK_W )
+		{
+			first_x = MAX ( x1, block_x ) & ( GP_BLOCK_W - 1 );
+			last_x = MIN ( x2, block_x + GP_BLOCK_W - 1 ) & ( GP_BLOCK_W - 1 );
+			block = &gp_buffer[gp_back][GP_TILED_INDEX(block_x,block_y)];
+
+			for ( current_y = first_y; current_y <= last_y; current_y++ )
+			{
+				row = block + ( ( current_y & ( GP_BLOCK_H - 1 ) ) << GP_BLOCK_W_SHIFT );
+				for ( current_x = first_x; current_x <= last_x; current_x++ )
+				{
+					row[current_x] = colour;
+				}
+			}
+		}
+	}
+}
+
+/* Function to fill a logical rectangle, both corners inclusive, in the back buffer. */
+void Graphics_Pipeline_fill ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour )
+{
+	unsigned short *row;
+	unsigned int current_x;
+	unsigned int current_y;
+
+	if ( x2 >= gp_width ) x2 = gp_width - 1;								// Clip to the logical screen.
+	if ( y2 >= gp_height ) y2 = gp_height - 1;
+	if ( x1 > x2 || y1 > y2 ) return;
+
+	if ( gp_layout == GP_LAYOUT_TILED )
+	{
+		Graphics_Pipeline_fillTiled ( x1, y1, x2, y2, colour );
+	}
+	else
+	{
+		for ( current_y = y1; current_y <= y2; current_y++ )
+		{
+			row = &gp_buffer[gp_back][GP_LINEAR_INDEX(0,current_y)];
+			for ( current_x = x1; current_x <= x2; current_x++ )
+			{
+				row[current_x] = colour;
+			}
+		}
+	}
+
+	Graphics_Pipeline_markDirty ( x1, y1, x2, y2 );
+}
+
+/* Function to copy an image of width x height logical pixels, stored row by row, into the back buffer at (x,y).
+   The image must fit on the logical screen. */
+void Graphics_Pipeline_blit ( unsigned int x, unsigned int y, unsigned int width, unsigned int height, const unsigned short *pixels )
+{
+	unsigned short *row;
+	unsigned int current_x;
+	unsigned int current_y;
+
+	if ( width == 0 || height == 0 || x + width > gp_width || y + height > gp_height ) return;
+
+	for ( current_y = y; current_y < y + height; current_y++ )
+	{
+		if ( gp_layout == GP_LAYOUT_TILED )
+		{
+			for ( current_x = x; current_x < x + width; current_x++ )
+			{
+				gp_buffer[gp_back][GP_TILED_INDEX(current_x,current_y)] = *pixels++;
+			}
+		}
+		else
+		{
+			row = &gp_buffer[gp_back][GP_LINEAR_INDEX(x,current_y)];
+			for ( current_x = 0; current_x < width; current_x++ )
+			{
+				row[current_x] = *pixels++;
+			}
+		}
+	}
+
+	Graphics_Pipeline_markDirty ( x, y, x + width - 1, y + height - 1 );
+}
+
+/* Function to return the back buffer to a fixed-size blitter, or NULL when it has to use Graphics_Pipeline_fill(). */
+unsigned short *Graphics_Pipeline_directTarget ( unsigned int *stride )
+{
+	if ( !gp_enabled || gp_shift != 0 || gp_layout != GP_LAYOUT_LINEAR ) return NULL;
+
+	*stride = gp_width;
+	return gp_buffer[gp_back];
+}
+
+/* Function to mark the tiles under a clipped logical rectangle, both corners inclusive, as drawn in this frame. */
+void Graphics_Pipeline_markDirty ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2 )
+{
+	unsigned int current_y;
+	unsigned int tile_mask;
+
+	/* Bits x1/16 to x2/16 of every tile row the rectangle touches. */
+	tile_mask = ( ( 2u << ( x2 >> GP_TILE_SHIFT ) ) - 1 ) & ~( ( 1u << ( x1 >> GP_TILE_SHIFT ) ) - 1 );
+	for ( current_y = y1 >> GP_TILE_SHIFT; current_y <= ( y2 >> GP_TILE_SHIFT ); current_y++ )
+	{
+		gp_dirty[gp_back][current_y] |= tile_mask;
+	}
+}
+
+/* Internal function to copy the dirty tiles of one buffer into the other. */
+void Graphics_Pipeline_copyDirty ( unsigned int from, unsigned int to )
+{
+	unsigned int tile_x;
+	unsigned int tile_y;
+	unsigned int x;
+	unsigned int y;
+	unsigned int x_end;
+	unsigned int y_end;
+	unsigned int index;
+	unsigned int index_end;
+
+	for ( tile_y = 0; tile_y < gp_tiles_y; tile_y++ )
+	{
+		if ( gp_dirty[from][tile_y] == 0 ) continue;						// Most rows of tiles are untouched.
+
+		y_end = MIN ( ( tile_y + 1 ) << GP_TILE_SHIFT, gp_height );
+		for ( tile_x = 0; tile_x < gp_tiles_x; tile_x++ )
+		{
+			if ( ( gp_dirty[from][tile_y] & ( 1u << tile_x ) ) == 0 ) continue;
+
+			x_end = MIN ( ( tile_x + 1 ) << GP_TILE_SHIFT, gp_width );
+			if ( gp_layout == GP_LAYOUT_TILED )
+			{
+				/* A tile is made of whole 8x4 blocks, and the blocks of one row of them are next to each other. */
+				for ( y = tile_y << GP_TILE_SHIFT; y < y_end; y += GP_BLOCK_H )
+				{
+					index = GP_TILED_INDEX(tile_x << GP_TILE_SHIFT, y);
+					index_end = index + ( ( x_end - ( tile_x << GP_TILE_SHIFT ) ) << GP_BLOCK_H_SHIFT );
+					for ( ; index < index_end; index++ ) gp_buffer[to][index] = gp_buffer[from][index];
+				}
+			}
+			else
+			{
+				for ( y = tile_y << GP_TILE_SHIFT; y < y_end; y++ )
+				{
+					for ( x = tile_x << GP_TILE_SHIFT; x < x_end; x++ )
+					{
+						gp_buffer[to][GP_LINEAR_INDEX(x,y)] = gp_buffer[from][GP_LINEAR_INDEX(x,y)];
+					}
+				}
+			}
+		}
+	}
+}
+
+/* Send one logical pixel to the LT24 window, twice at half resolution. */
+#define GP_SEND(colour) { LT24_write ( true, colour ); if ( gp_shift ) LT24_write ( true, colour ); }
+
+/* Internal function to send a run of tiles of one row of the front buffer to the LT24 as one window burst. */
+void Graphics_Pipeline_sendTiles ( unsigned int tile_y, unsigned int first_tile_x, unsigned int last_tile_x )
+{
+	const unsigned short *front = gp_buffer[gp_back ^ 1];
+	unsigned int x1 = first_tile_x << GP_TILE_SHIFT;
+	unsigned int x2 = MIN ( ( last_tile_x + 1 ) << GP_TILE_SHIFT, gp_width ) - 1;
+	unsigned int y1 = tile_y << GP_TILE_SHIFT;
+	unsigned int y2 = MIN ( ( tile_y + 1 ) << GP_TILE_SHIFT, gp_height ) - 1;
+	const unsigned short *pixels;
+	unsigned int block_x;
+	unsigned int x;
+	unsigned int y;
+	unsigned int pass;
+
+	LT24_setWindow ( x1 << gp_shift, y1 << gp_shift, ( x2 - x1 + 1 ) << gp_shift, ( y2 - y1 + 1 ) << gp_shift );
+
+	for ( y = y1; y <= y2; y++ )
+	{
+		/* Half resolution: every logical row is sent twice, every logical pixel twice per row. */
+		for ( pass = 0; pass < ( 1u << gp_shift ); pass++ )
+		{
+			if ( gp_layout == GP_LAYOUT_TILED )
+			{
+				/* The window is a whole number of 8x4 blocks wide, so the row is sent one block at a time. */
+				for ( block_x = x1; block_x <= x2; block_x += GP_BLOCK_W )
+				{
+					pixels = &front[GP_TILED_INDEX(block_x,y)];
+					for ( x = 0; x < GP_BLOCK_W; x++ ) GP_SEND ( pixels[x] );
+				}
+			}
+			else
+			{
+				pixels = &front[GP_LINEAR_INDEX(x1,y)];
+				for ( x = 0; x <= x2 - x1; x++ ) GP_SEND ( pixels[x] );
+			}
+		}
+	}
+}
+
+/* Function to stream up to max_tiles dirty tiles of the front buffer to the LT24. Returns true while work remains. */
+bool Graphics_Pipeline_flushStep ( unsigned int max_tiles )
+{
+	unsigned int front = gp_back ^ 1;
+	unsigned int total = gp_tiles_x * gp_tiles_y;
+	unsigned int tile_x;
+	unsigned int tile_y;
+	unsigned int last_x;
+
+	if ( !gp_flushing || gp_worker ) return false;						// In worker mode the frame is sent by the worker.
+
+	while ( max_tiles > 0 && gp_flush_tile < total )
+	{
+		tile_y = gp_flush_tile / gp_tiles_x;
+		tile_x = gp_flush_tile % gp_tiles_x;
+
+		if ( ( gp_dirty[front][tile_y] >> tile_x ) == 0 )					// Nothing left in this row of tiles.
+		{
+			gp_flush_tile = ( tile_y + 1 ) * gp_tiles_x;
+			continue;
+		}
+
+		if ( ( gp_dirty[front][tile_y] & ( 1u << tile_x ) ) == 0 )			// Skip a clean tile.
+		{
+			gp_flush_tile++;
+			continue;
+		}
+
+		/* Merge the run of dirty tiles starting here into one window. */
+		last_x = tile_x;
+		while ( last_x + 1 < gp_tiles_x && ( last_x - tile_x + 1 ) < max_tiles && ( gp_dirty[front][tile_y] & ( 1u << ( last_x + 1 ) ) ) )
+		{
+			last_x++;
+		}
+
+		Graphics_Pipeline_sendTiles ( tile_y, tile_x, last_x );
+
+		max_tiles = max_tiles - ( last_x - tile_x + 1 );
+		gp_flush_count = gp_flush_count + ( last_x - tile_x + 1 );
+		gp_flush_tile = tile_y * gp_tiles_x + last_x + 1;
+	}
+
+	if ( gp_flush_tile >= total )											// The whole front buffer is on the display.
+	{
+		gp_stats.flush_ticks = HPS_Timer_timestamp() - gp_flush_start;
+		gp_stats.flushed_tiles = gp_flush_count;
+		gp_flushing = false;
+	}
+
+	return gp_flushing;
+}
+
+/* Function to wait until the front buffer is completely on the LT24. */
+void Graphics_Pipeline_finish ( void )
+{
+	bool was_masked;
+
+	if ( gp_worker )
+	{
+		while ( gp_flushing ) GRAPHICS_RING_WAIT();							// The worker wakes this core when the frame is done.
+		GRAPHICS_RING_BARRIER();
+		return;
+	}
+
+	while ( gp_flushing )
+	{
+		/* Help the flush interrupt instead of spinning. Interrupts are masked so it cannot run the same step. */
+		was_masked = __disable_irq();
+		Graphics_Pipeline_flushStep ( GP_FLUSH_TILES_PER_STEP );
+		if ( !was_masked ) __enable_irq();
+	}
+}
+
+/* Internal function to queue a region for the worker, waiting while the ring is full. A frame has at most 8 runs per
+   row of tiles, so this only waits if the ring is made smaller than a frame. */
+void Graphics_Pipeline_queue ( unsigned int region )
+{
+	while ( !Graphics_Ring_push ( &gp_ring, region ) ) GRAPHICS_RING_WAIT();
+}
+
+/* Internal function to queue every run of dirty tiles of a buffer for the worker, then the end of the frame. */
+void Graphics_Pipeline_queueFrame ( unsigned int front )
+{
+	unsigned int dirty;
+	unsigned int tile_x;
+	unsigned int tile_y;
+	unsigned int last_x;
+
+	for ( tile_y = 0; tile_y < gp_tiles_y; tile_y++ )
+	{
+		dirty = gp_dirty[front][tile_y];
+		tile_x = 0;
+		while ( ( dirty >> tile_x ) != 0 )
+		{
+			if ( ( dirty & ( 1u << tile_x ) ) == 0 )						// Skip a clean tile.
+			{
+				tile_x++;
+				continue;
+			}
+
+			last_x = tile_x;
+			while ( dirty & ( 1u << ( last_x + 1 ) ) ) last_x++;			// A row has at most 15 tiles, so this stops in the word.
+
+			Graphics_Pipeline_queue ( GP_REGION ( tile_y, tile_x, last_x ) );
+			tile_x = last_x + 1;
+		}
+	}
+
+	Graphics_Pipeline_queue ( GP_REGION_END );
+}
+
+/* Function to switch between flushing with flushStep() and flushing with a render worker. */
+signed int Graphics_Pipeline_setWorker ( bool enabled )
+{
+	if ( !gp_enabled ) return GP_NOTENABLED;
+
+	Graphics_Pipeline_finish();												// The current frame is finished the way it was started.
+	Graphics_Ring_clear ( &gp_ring );
+	gp_worker = enabled;
+	GRAPHICS_RING_BARRIER();
+
+	return GP_SUCCESS;
+}
+
+/* Function to check whether frames are sent by the render worker. */
+bool Graphics_Pipeline_hasWorker ( void )
+{
+	return gp_worker;
+}
+
+/* Function run by the render worker: sends one queued run of tiles to the LT24. Returns false if nothing was queued. */
+bool Graphics_Pipeline_workStep ( void )
+{
+	unsigned int region;
+	unsigned int first_x;
+	unsigned int last_x;
+
+	if ( !Graphics_Ring_pop ( &gp_ring, &region ) ) return false;
+
+	if ( region == GP_REGION_END )											// The whole front buffer is on the display.
+	{
+		gp_stats.flush_ticks = HPS_Timer_timestamp() - gp_flush_start;
+		gp_stats.flushed_tiles = gp_flush_count;
+		GRAPHICS_RING_BARRIER();											// The display traffic and the statistics come before the hand-back.
+		gp_flushing = false;
+		GRAPHICS_RING_SIGNAL();
+		return true;
+	}
+
+	first_x = ( region >> 8 ) & 0xFF;
+	last_x = region & 0xFF;
+	Graphics_Pipeline_sendTiles ( region >> 16, first_x, last_x );
+	gp_flush_count = gp_flush_count + ( last_x - first_x + 1 );
+
+	return true;
+}
+
+/* Function to end the frame: waits for the previous flush, swaps the buffers and starts flushing the new front buffer. */
+signed int Graphics_Pipeline_swap ( void )
+{
+	unsigned int swap_start;
+	unsigned int stall_end;
+	unsigned int row;
+
+	if ( !gp_enabled ) return GP_NOTENABLED;
+
+	swap_start = HPS_Timer_timestamp();
+	Graphics_Pipeline_finish();												// The front buffer must be on the display before it is reused.
+	stall_end = HPS_Timer_timestamp();
+
+	/* The back buffer becomes the front buffer. */
+	gp_back = gp_back ^ 1;
+
+	/* Statistics of the frame that was just finished. */
+	gp_stats.frames++;
+	gp_stats.stall_ticks = stall_end - swap_start;
+	gp_stats.render_ticks = swap_start - gp_frame_start;
+	gp_stats.frame_ticks = stall_end - gp_frame_start;
+	if ( gp_stats.frame_ticks > gp_stats.max_frame_ticks ) gp_stats.max_frame_ticks = gp_stats.frame_ticks;
+
+	/* Start streaming the new front buffer. From here on the flush interrupt or the worker does the work, which only
+	   reads the front buffer, so it can start while the back buffer is brought up to date. */
+	gp_flush_tile = 0;
+	gp_flush_count = 0;
+	gp_flush_start = HPS_Timer_timestamp();
+	gp_flushing = true;
+	if ( gp_worker ) Graphics_Pipeline_queueFrame ( gp_back ^ 1 );
+
+	/* Bring the new back buffer up to date with the frame that was just finished. */
+	Graphics_Pipeline_copyDirty ( gp_back ^ 1, gp_back );
+	for ( row = 0; row < GP_TILES_Y; row++ ) gp_dirty[gp_back][row] = 0;
+
+	gp_frame_start = HPS_Timer_timestamp();
+
+	return GP_SUCCESS;
+}
+
+/* Function to read the per-frame timing statistics. */
+void Graphics_Pipeline_getStats ( Graphics_PipelineStats *stats )
+{
+	*stats = gp_stats;
+}
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Double-Buffered Render/Flush Pipeline for the LT24 Display
+ *  ----------------------------------------
+ *  File Name     : Graphics_Pipeline.h
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	When the pipeline is enabled the graphics engine draws into the back
+ *  	buffer instead of the LT24. Graphics_Pipeline_swap() ends a frame:
+ *  	the back buffer becomes the front buffer and its dirty tiles are
+ *  	streamed to the LT24 by Graphics_Pipeline_flushStep(), which is run
+ *  	from a timer interrupt, while the next frame is drawn into the other
+ *  	buffer. Only tiles that were drawn to are sent to the display.
+ *
+ *  	Alternatively the frames can be sent by a render worker running
+ *  	Graphics_Pipeline_workStep() on the other core, fed through a
+ *  	lock-free ring. Nothing else may touch the LT24 while it runs.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAPHICS_PIPELINE_H_
+#define GRAPHICS_PIPELINE_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+#include "../DE1SoC_LT24/DE1SoC_LT24.h"
+#include "../Game_Engine/Min_Max.h"
+
+/* Error Codes*/
+#define GP_SUCCESS       0
+#define GP_NOTENABLED   -1
+#define GP_INVALIDLAYOUT -2
+
+/* Dirty regions are tracked in square tiles of logical pixels. */
+#define GP_TILE_SHIFT    4
+#define GP_TILE_SIZE     ( 1 << GP_TILE_SHIFT )
+#define GP_TILES_X       ( LT24_WIDTH  / GP_TILE_SIZE )						// 15 tiles across at full resolution.
+#define GP_TILES_Y       ( LT24_HEIGHT / GP_TILE_SIZE )						// 20 tiles down at full resolution.
+
+/* Memory layouts of the frame buffers. */
+#define GP_LAYOUT_LINEAR 0													// Row after row, 480 bytes per row at full resolution.
+#define GP_LAYOUT_TILED  1													// 8x4 pixel blocks of 64 bytes (two cache lines), block rows left to right.
+
+/* Size of a memory block of the tiled layout. The logical width must be a multiple of 8 and the height of 4. */
+#define GP_BLOCK_W_SHIFT 3
+#define GP_BLOCK_H_SHIFT 2
+#define GP_BLOCK_W       ( 1 << GP_BLOCK_W_SHIFT )
+#define GP_BLOCK_H       ( 1 << GP_BLOCK_H_SHIFT )
+
+/* Default amount of work done by each call of the flush interrupt, in tiles. */
+#define GP_FLUSH_TILES_PER_STEP 2
+
+/* Per-frame timing statistics, in HPS_Timer_timestamp() ticks. */
+typedef struct {
+	unsigned int frames;													// Number of swaps since the pipeline was enabled.
+	unsigned int render_ticks;												// Time spent drawing the last frame (swap to swap, minus stalls).
+	unsigned int flush_ticks;												// Time taken to stream the last complete frame to the LT24.
+	unsigned int stall_ticks;												// Time the last swap waited for the previous flush to finish.
+	unsigned int frame_ticks;												// Time between the last two swaps.
+	unsigned int flushed_tiles;												// Number of tiles sent for the last complete frame.
+	unsigned int max_frame_ticks;											// Longest frame seen.
+} Graphics_PipelineStats;
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to enable the pipeline. Both buffers are cleared to a colour, and the whole screen is marked dirty. */
+signed int Graphics_Pipeline_initialise ( unsigned short colour, unsigned int scale_shift );
+
+/* Function to check whether drawing is going through the pipeline. */
+bool Graphics_Pipeline_isEnabled ( void );
+
+/* Function to change the logical resolution. Waits for the current flush, then clears both buffers to a colour. */
+signed int Graphics_Pipeline_reset ( unsigned short colour, unsigned int scale_shift );
+
+/* Function to select the memory layout of the frame buffers. Both buffers are cleared to a colour like a reset. */
+signed int Graphics_Pipeline_setLayout ( unsigned int layout, unsigned short colour );
+
+/* Function to read the memory layout of the frame buffers. */
+unsigned int Graphics_Pipeline_getLayout ( void );
+
+/* Functions used by the graphics engine to draw into the back buffer with logical coordinates. */
+void Graphics_Pipeline_plot ( unsigned short colour, unsigned int x, unsigned int y );
+void Graphics_Pipeline_fill ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, unsigned short colour );
+void Graphics_Pipeline_blit ( unsigned int x, unsigned int y, unsigned int width, unsigned int height, const unsigned short *pixels );
+
+/* Functions for fixed-size blitters that write the back buffer themselves. The target is NULL unless the pipeline
+   is enabled at full resolution with the linear layout, the row stride is in pixels. */
+unsigned short *Graphics_Pipeline_directTarget ( unsigned int *stride );
+void Graphics_Pipeline_markDirty ( unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2 );
+
+/* Function to end the frame: waits for the previous flush, swaps the buffers and starts flushing the new front buffer. */
+signed int Graphics_Pipeline_swap ( void );
+
+/* Function to stream up to max_tiles dirty tiles of the front buffer to the LT24. Returns true while work remains. */
+bool Graphics_Pipeline_flushStep ( unsigned int max_tiles );
+
+/* Function to switch between flushing with flushStep() and flushing with a render worker. The worker must be running
+   before a frame is swapped in worker mode. */
+signed int Graphics_Pipeline_setWorker ( bool enabled );
+
+/* Function to check whether frames are sent by the render worker. */
+bool Graphics_Pipeline_hasWorker ( void );
+
+/* Function run over and over by the render worker: sends one queued run of dirty tiles to the LT24. Returns false if
+   nothing was queued, when the worker can sleep until the next swap wakes it. */
+bool Graphics_Pipeline_workStep ( void );
+
+/* Function to wait until the front buffer is completely on the LT24. */
+void Graphics_Pipeline_finish ( void );
+
+/* Function to read the per-frame timing statistics. */
+void Graphics_Pipeline_getStats ( Graphics_PipelineStats *stats );
+
+#endif /* GRAPHICS_PIPELINE_H_ */
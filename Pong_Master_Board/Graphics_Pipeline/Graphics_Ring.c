@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Lock-Free Single-Producer/Single-Consumer Ring of Words
+ *  ----------------------------------------
+ *  File Name     : Graphics_Ring.c
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Push and pop of the single-producer/single-consumer ring.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Graphics_Ring.h"													// Invoking the main header file.
+
+/* Function to empty a ring. Neither side may be using it. */
+void Graphics_Ring_clear ( Graphics_Ring *ring )
+{
+	ring->head = 0;
+	ring->tail = 0;
+	GRAPHICS_RING_BARRIER();
+}
+
+/* Function to add a word, from the producer. Returns false if the ring is full. */
+bool Graphics_Ring_push ( Graphics_Ring *ring, unsigned int word )
+{
+	unsigned int head = ring->head;
+
+	if ( head - ring->tail >= GRAPHICS_RING_SIZE ) return false;
+
+	ring->slots[head & ( GRAPHICS_RING_SIZE - 1 )] = word;
+	GRAPHICS_RING_BARRIER();												// The word must be in memory before the consumer can see it.
+	ring->head = head + 1;
+	GRAPHICS_RING_SIGNAL();													// Wake the consumer if it sleeps.
+
+	return true;
+}
+
+/* Function to take the oldest word, from the consumer. Returns false if the ring is empty. */
+bool Graphics_Ring_pop ( Graphics_Ring *ring, unsigned int *word )
+{
+	unsigned int tail = ring->tail;
+
+	if ( tail == ring->head ) return false;
+
+	GRAPHICS_RING_BARRIER();												// Read the slot only after seeing the head that covers it.
+	*word = ring->slots[tail & ( GRAPHICS_RING_SIZE - 1 )];
+	GRAPHICS_RING_BARRIER();												// Finish reading it before the producer may reuse it.
+	ring->tail = tail + 1;
+	GRAPHICS_RING_SIGNAL();													// Wake the producer if it waits for room.
+
+	return true;
+}
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Lock-Free Single-Producer/Single-Consumer Ring of Words
+ *  ----------------------------------------
+ *  File Name     : Graphics_Ring.h
+ *  Target Device : ARM Cortex-A9 processor, Host PC
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Hands the work of the render pipeline from the core that draws to
+ *  	the core that sends to the LT24. Only one side ever writes the head
+ *  	(the producer) and only the other the tail (the consumer), so no
+ *  	lock is needed: a memory barrier makes a slot visible before the
+ *  	head moves past it, and finishes reading a slot before the tail
+ *  	frees it. On the board the waiting side sleeps with WFE and is
+ *  	woken by SEV; on a PC the same code runs on two threads.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAPHICS_RING_H_
+#define GRAPHICS_RING_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+
+/* Number of words in a ring. Must be a power of two. */
+#define GRAPHICS_RING_SIZE 256
+
+/* Ordering of memory accesses between the cores, and sleeping until the other side has done something. */
+#ifdef __ARMCC_VERSION
+#define GRAPHICS_RING_BARRIER() __dmb(0xF)
+#define GRAPHICS_RING_WAIT()    __wfe()
+#define GRAPHICS_RING_SIGNAL()  __sev()
+#else
+#include <sched.h>															// Importing sched_yield().
+#define GRAPHICS_RING_BARRIER() __sync_synchronize()
+#define GRAPHICS_RING_WAIT()    sched_yield()
+#define GRAPHICS_RING_SIGNAL()
+#endif
+
+/* A ring. The counters run freely and are masked when a slot is used, so head - tail is the number of words queued. */
+typedef struct {
+	volatile unsigned int head;												// Number of words pushed, written by the producer only.
+	volatile unsigned int tail;												// Number of words popped, written by the consumer only.
+	unsigned int slots [GRAPHICS_RING_SIZE];
+} Graphics_Ring;
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to empty a ring. Neither side may be using it. */
+void Graphics_Ring_clear ( Graphics_Ring *ring );
+
+/* Function to add a word, from the producer. Returns false if the ring is full. */
+bool Graphics_Ring_push ( Graphics_Ring *ring, unsigned int word );
+
+/* Function to take the oldest word, from the consumer. Returns false if the ring is empty. */
+bool Graphics_Ring_pop ( Graphics_Ring *ring, unsigned int *word );
+
+#endif /* GRAPHICS_RING_H_ */
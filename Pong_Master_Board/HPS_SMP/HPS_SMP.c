@@ -0,0 +1,114 @@
+/*
+ * Cyclone V HPS Second Core Start-Up
+ * ------------------------------
+ * Description:
+ * Driver for releasing the second Cortex-A9 core (CPU1) from
+ * reset and running a C function on it.
+ *
+ * Company: University of Leeds
+ * Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *
+ */
+
+#include "HPS_SMP.h"
+#include <stddef.h>
+
+//Reset manager: MPU module reset register, bit 1 holds CPU1 in reset
+#define RSTMGR_MPUMODRST   ((volatile unsigned int *)0xFFD05010)
+#define RSTMGR_CPU1        (1 << 1)
+
+//System manager: address CPU1 is sent to by the trampoline
+#define SYSMGR_CPU1START   ((volatile unsigned int *)0xFFD080C4)
+
+//CPU1 starts executing from address 0 when it leaves reset
+#define CPU1_RESET_VECTOR  ((volatile unsigned int *)0x00000000)
+
+//Attempts to wait for CPU1 to reach the C code
+#define CPU1_START_ATTEMPTS 10000000
+
+//Trampoline copied to address 0: load the start address register and jump to its value
+const unsigned int smp_trampoline [4] = {
+    0xE59F0004,           //LDR r0,[pc,#4]  ; Address of the start address register
+    0xE5901000,           //LDR r1,[r0]     ; Start address
+    0xE12FFF11,           //BX  r1
+    0xFFD080C4            //SYSMGR_CPU1START
+};
+
+//Stack of CPU1. The entry code loads smp_cpu1_stack_top into its SP.
+__align(8) unsigned char smp_cpu1_stack [HPS_SMP_CPU1_STACK_BYTES];
+unsigned char* smp_cpu1_stack_top = &smp_cpu1_stack[HPS_SMP_CPU1_STACK_BYTES];
+
+//Function run by CPU1 and its argument
+HPS_SMP_Entry smp_cpu1_entry = NULL;
+void* smp_cpu1_arg = NULL;
+volatile bool smp_cpu1_started = false;
+
+//C entry point of CPU1, called from the assembly entry once it has a stack
+void HPS_SMP_cpu1Main(void) {
+    smp_cpu1_started = true;
+    __dmb(0xF);
+    __sev();                              //Wake CPU0 if it waits in HPS_SMP_startCPU1()
+    smp_cpu1_entry(smp_cpu1_arg);
+}
+
+/*
+ * Entry point of CPU1, reached through the trampoline. As with the
+ * vector table this function is fed directly to the assembler.
+ * CPU1 comes out of reset in supervisor mode with its caches and
+ * VFP off and no stack.
+ */
+__asm void HPS_SMP_cpu1Entry(void) {
+    PRESERVE8
+    extern HPS_SMP_cpu1Main       ;
+    extern smp_cpu1_stack_top     ;
+    CPSID   if                    ; // Interrupts are only taken on CPU0
+    MRC     p15,0,r0,c1,c0,1      ; // Read ACTLR into r0
+    ORR     r0,r0,#(1<<6)         ; // SMP bit: take part in the coherency of the snoop control unit
+    MCR     p15,0,r0,c1,c0,1      ; // Store ACTLR
+    LDR     r0,=smp_cpu1_stack_top; // Address of the stack pointer to use
+    LDR     sp,[r0]               ; // Move onto the stack of CPU1
+    MRC     p15,0,r0,c1,c0,2      ; // Enable VFP like _platform_pre_stackheap_init() does for CPU0
+    ORR     r0,r0,#(3<<20)        ;
+    ORR     r0,r0,#(3<<22)        ;
+    BIC     r0,r0,#(3<<30)        ;
+    MCR     p15,0,r0,c1,c0,2      ;
+    ISB                           ;
+    MOV     r0,#(1<<30)           ;
+    VMSR    FPEXC,r0              ;
+    BL      HPS_SMP_cpu1Main      ; // Run the C code
+park
+    WFE                           ; // Should the function return, sleep forever
+    B       park                  ;
+}
+
+//Release CPU1 from reset and run entry(arg) on it
+signed int HPS_SMP_startCPU1(HPS_SMP_Entry entry, void* arg) {
+    unsigned int word;
+    unsigned int attempts;
+    if (smp_cpu1_started || !(*RSTMGR_MPUMODRST & RSTMGR_CPU1)) return HPS_SMP_RUNNING;
+    smp_cpu1_entry = entry;
+    smp_cpu1_arg = arg;
+    //Point the trampoline at the entry code, then copy it to the reset vector of CPU1
+    *SYSMGR_CPU1START = (unsigned int)&HPS_SMP_cpu1Entry;
+    for (word = 0; word < 4; word++) {
+        CPU1_RESET_VECTOR[word] = smp_trampoline[word];
+    }
+    __dsb(0xF);                           //Everything above must be in memory before CPU1 runs
+    *RSTMGR_MPUMODRST &= ~RSTMGR_CPU1;    //Let CPU1 go
+    for (attempts = 0; !smp_cpu1_started; attempts++) {
+        if (attempts == CPU1_START_ATTEMPTS) return HPS_SMP_NOSTART;
+    }
+    __dmb(0xF);
+    return HPS_SMP_SUCCESS;
+}
+
+//Check if CPU1 has been started
+bool HPS_SMP_isCPU1Running(void) {
+    return smp_cpu1_started;
+}
+
+//Get the number of the core calling this function, from the affinity bits of the MPIDR
+unsigned int HPS_SMP_cpuID(void) {
+    register unsigned int cp15_MPIDR __asm("cp15:0:c0:c0:5");
+    return cp15_MPIDR & 0x3;
+}
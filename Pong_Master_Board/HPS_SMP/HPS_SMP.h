@@ -0,0 +1,53 @@
+/*
+ * Cyclone V HPS Second Core Start-Up
+ * ------------------------------
+ * Description:
+ * Driver for releasing the second Cortex-A9 core (CPU1) from
+ * reset and running a C function on it.
+ *
+ * CPU1 is held in reset by the reset manager until it is
+ * released. It then starts from address 0, where a small
+ * trampoline jumps to the address held in the system manager's
+ * CPU1 start address register. The entry code enables VFP and
+ * cache coherency, moves onto a stack of its own and calls the
+ * function passed to HPS_SMP_startCPU1().
+ *
+ * CPU1 runs with interrupts masked: the vector table and the
+ * interrupt handlers belong to CPU0. It can wait with __wfe()
+ * and be woken by __sev() from CPU0.
+ *
+ * Company: University of Leeds
+ * Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *
+ */
+
+#ifndef HPS_SMP_H_
+#define HPS_SMP_H_
+
+#include <stdbool.h>
+
+//Error Codes
+#define HPS_SMP_SUCCESS      0
+#define HPS_SMP_RUNNING     -1
+#define HPS_SMP_NOSTART     -2
+
+//Size of the stack of CPU1 (CPU0 keeps the one from the scatter file)
+#define HPS_SMP_CPU1_STACK_BYTES 8192
+
+//Function run by CPU1. It should never return; if it does CPU1 waits for events forever.
+typedef void (*HPS_SMP_Entry)(void* arg);
+
+//Release CPU1 from reset and run entry(arg) on it.
+// - Waits until CPU1 has reached the C code before returning.
+// - Returns HPS_SMP_RUNNING if CPU1 was already started, or
+//   HPS_SMP_NOSTART if it did not come out of reset.
+// - Returns HPS_SMP_SUCCESS if successful
+signed int HPS_SMP_startCPU1(HPS_SMP_Entry entry, void* arg);
+
+//Check if CPU1 has been started
+bool HPS_SMP_isCPU1Running(void);
+
+//Get the number of the core calling this function, 0 or 1
+unsigned int HPS_SMP_cpuID(void);
+
+#endif /* HPS_SMP_H_ */
@@ -0,0 +1,82 @@
+/*
+ * Cyclone V HPS Timers
+ * ------------------------------
+ * Description:
+ * Driver for the HPS general purpose timers and the ARM A9
+ * global timer.
+ *
+ * Company: University of Leeds
+ * Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *
+ */
+
+#include "HPS_Timer.h"
+
+//HPS timer register offsets (Synopsys DesignWare APB timer)
+#define TIMER_LOAD    (0x00/sizeof(unsigned int))
+#define TIMER_VALUE   (0x04/sizeof(unsigned int))
+#define TIMER_CONTROL (0x08/sizeof(unsigned int))
+#define TIMER_EOI     (0x0C/sizeof(unsigned int))
+
+//Control register bits
+#define TIMER_ENABLE    (1 << 0)
+#define TIMER_USERMODE  (1 << 1) //Reload from TIMER_LOAD rather than free-running
+#define TIMER_IRQMASK   (1 << 2)
+
+//A9 global timer registers
+#define GLOBAL_TIMER_BASE    0xFFFEC200
+#define GLOBAL_TIMER_LOW     (0x00/sizeof(unsigned int))
+#define GLOBAL_TIMER_CONTROL (0x08/sizeof(unsigned int))
+
+#define HPS_TIMER_COUNT 3
+
+//Base address, clock rate in MHz and IRQ of each timer, indexed by HPSTimerID
+volatile unsigned int* const timer_base_ptr [HPS_TIMER_COUNT] = {
+    (unsigned int *)0xFFC08000, (unsigned int *)0xFFD00000, (unsigned int *)0xFFD01000
+};
+const unsigned int timer_clock_mhz [HPS_TIMER_COUNT] = { 100, 25, 25 };
+const HPSIRQSource timer_irq_id    [HPS_TIMER_COUNT] = { IRQ_TIMER_L4SP_0, IRQ_TIMER_OSC1_0, IRQ_TIMER_OSC1_1 };
+
+volatile unsigned int* global_timer_ptr = (unsigned int *)GLOBAL_TIMER_BASE;
+
+//Start a timer raising an interrupt every period_us microseconds
+signed int HPS_Timer_startPeriodic(HPSTimerID id, unsigned int period_us) {
+    volatile unsigned int* timer;
+    if ((unsigned int)id >= HPS_TIMER_COUNT) return HPS_TIMER_INVALIDID;
+    //The period must fit in the 32bit load register
+    if ((period_us == 0) || (period_us > (0xFFFFFFFF / timer_clock_mhz[id]))) return HPS_TIMER_INVALIDPERIOD;
+    timer = timer_base_ptr[id];
+    timer[TIMER_CONTROL] = 0;                                   //Disable while configuring
+    timer[TIMER_LOAD]    = (period_us * timer_clock_mhz[id]) - 1;
+    (void)timer[TIMER_EOI];                                     //Clear any stale interrupt
+    timer[TIMER_CONTROL] = TIMER_USERMODE | TIMER_ENABLE;       //Periodic, interrupt unmasked
+    return HPS_TIMER_SUCCESS;
+}
+
+//Stop a timer and mask its interrupt
+signed int HPS_Timer_stop(HPSTimerID id) {
+    if ((unsigned int)id >= HPS_TIMER_COUNT) return HPS_TIMER_INVALIDID;
+    timer_base_ptr[id][TIMER_CONTROL] = TIMER_IRQMASK;
+    (void)timer_base_ptr[id][TIMER_EOI];
+    return HPS_TIMER_SUCCESS;
+}
+
+//Clear the pending interrupt of a timer (reading EOI clears it)
+void HPS_Timer_acknowledge(HPSTimerID id) {
+    (void)timer_base_ptr[id][TIMER_EOI];
+}
+
+//Get the GIC interrupt ID of a timer
+HPSIRQSource HPS_Timer_irqID(HPSTimerID id) {
+    return timer_irq_id[id];
+}
+
+//Start the free running time stamp counter
+void HPS_Timer_startTimestamp(void) {
+    global_timer_ptr[GLOBAL_TIMER_CONTROL] = 0x1; //Enable, prescaler of 1, no comparator/interrupt
+}
+
+//Read the low 32 bits of the time stamp counter
+unsigned int HPS_Timer_timestamp(void) {
+    return global_timer_ptr[GLOBAL_TIMER_LOW];
+}
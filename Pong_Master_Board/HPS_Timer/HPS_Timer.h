@@ -0,0 +1,65 @@
+/*
+ * Cyclone V HPS Timers
+ * ------------------------------
+ * Description:
+ * Driver for the HPS general purpose timers and the ARM A9
+ * global timer.
+ *
+ * The HPS SP Timer 0 and the two OSC1 timers can be set up to
+ * raise a periodic interrupt. The handler is registered by the
+ * user through HPS_IRQ_registerHandler() with the ID returned by
+ * HPS_Timer_irqID(), and must call HPS_Timer_acknowledge().
+ * HPS SP Timer 1 is not available as it is used by usleep().
+ *
+ * The A9 global timer is used as a free running time stamp
+ * counter for measuring how long parts of the game take.
+ *
+ * Company: University of Leeds
+ * Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *
+ */
+
+#ifndef HPS_TIMER_H_
+#define HPS_TIMER_H_
+
+#include <stdbool.h>
+#include "../HPS_IRQ/HPS_IRQ_IDs.h"
+
+//Error Codes
+#define HPS_TIMER_SUCCESS        0
+#define HPS_TIMER_INVALIDID     -2
+#define HPS_TIMER_INVALIDPERIOD -4
+
+//Time stamp counter rate (A9 global timer runs from the 200MHz PERIPHCLK)
+#define HPS_TIMER_TICKS_PER_US  200
+
+//Timers that can be used for periodic interrupts
+typedef enum {
+    HPS_TIMER_SP0    = 0, //HPS SP Timer 0,   100MHz
+    HPS_TIMER_OSC1_0 = 1, //HPS OSC1 Timer 0, 25MHz
+    HPS_TIMER_OSC1_1 = 2  //HPS OSC1 Timer 1, 25MHz
+} HPSTimerID;
+
+//Start a timer raising an interrupt every period_us microseconds
+// - The interrupt is left unmasked in the timer, the handler must be
+//   registered with HPS_IRQ_registerHandler(HPS_Timer_irqID(id), ...)
+// - Returns HPS_TIMER_SUCCESS if successful
+signed int HPS_Timer_startPeriodic(HPSTimerID id, unsigned int period_us);
+
+//Stop a timer and mask its interrupt
+signed int HPS_Timer_stop(HPSTimerID id);
+
+//Clear the pending interrupt of a timer. Call from the IRQ handler.
+void HPS_Timer_acknowledge(HPSTimerID id);
+
+//Get the GIC interrupt ID of a timer
+HPSIRQSource HPS_Timer_irqID(HPSTimerID id);
+
+//Start the free running time stamp counter (safe to call more than once)
+void HPS_Timer_startTimestamp(void);
+
+//Read the low 32 bits of the time stamp counter.
+// - Wraps every ~21s, so only use it for differences.
+unsigned int HPS_Timer_timestamp(void);
+
+#endif /* HPS_TIMER_H_ */
@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Host Benchmark of the Collision Grid.
+ *  ----------------------------------------
+ *  File Name     : Grid_Benchmark.c
+ *  Target Device : Host PC (Linux, gcc)
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Moves hundreds of balls among fixed obstacles in the 220x300
+ *  	playfield and finds the touching pairs every tick, once with the
+ *  	uniform grid and once by testing every ball against every object.
+ *  	Prints the time and the number of box tests per tick for each
+ *  	object count, and checks that both find the same pairs.
+ *
+ *  Usage:
+ *  	make grid_benchmark && ./grid_benchmark
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "../Game_Engine/Collision_Grid.h"									// Importing the broad phase under test.
+#include <stdio.h>															// Importing printf().
+#include <stdlib.h>															// Importing rand() and abs().
+#include <time.h>															// Importing clock_gettime().
+
+#define BENCHMARK_TICKS      2000
+#define BENCHMARK_MAX        800
+#define BALL_SIZE            4
+#define OBSTACLE_SIZE        8
+
+/* The objects, one array per field like the game's entity store. */
+signed int object_x [BENCHMARK_MAX];
+signed int object_y [BENCHMARK_MAX];
+signed int object_dx [BENCHMARK_MAX];
+signed int object_dy [BENCHMARK_MAX];
+unsigned int object_size [BENCHMARK_MAX];
+unsigned int object_type [BENCHMARK_MAX];
+
+Collision_Grid_Pair pairs [BENCHMARK_MAX * 8];
+
+/* Internal function to read a monotonic time in nanoseconds. */
+unsigned long long Now ( void )
+{
+	struct timespec now;
+
+	clock_gettime ( CLOCK_MONOTONIC, &now );
+	return (unsigned long long)now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+/* Internal function to place the objects: one in eight is a fixed obstacle, the rest are moving balls. */
+void Place_Objects ( unsigned int count )
+{
+	unsigned int object;
+
+	srand ( 1 );
+	for ( object = 0; object < count; object++ )
+	{
+		object_type[object] = ( object % 8 == 7 ) ? GRID_OBSTACLE : GRID_BALL;
+		object_size[object] = ( object_type[object] == GRID_OBSTACLE ) ? OBSTACLE_SIZE : BALL_SIZE;
+		object_x[object] = GRID_ORIGIN_X + rand() % ( GRID_WIDTH - object_size[object] );
+		object_y[object] = GRID_ORIGIN_Y + rand() % ( GRID_HEIGHT - object_size[object] );
+		object_dx[object] = ( object_type[object] == GRID_OBSTACLE ) ? 0 : ( rand() % 5 ) - 2;
+		object_dy[object] = ( object_type[object] == GRID_OBSTACLE ) ? 0 : ( rand() % 5 ) - 2;
+	}
+}
+
+/* Internal function to move the balls by one tick, bouncing off the sides of the playfield. */
+void Move_Objects ( unsigned int count )
+{
+	unsigned int object;
+
+	for ( object = 0; object < count; object++ )
+	{
+		object_x[object] += object_dx[object];
+		object_y[object] += object_dy[object];
+		if ( object_x[object] < GRID_ORIGIN_X || object_x[object] > GRID_ORIGIN_X + GRID_WIDTH - (signed int)object_size[object] ) { object_dx[object] = -object_dx[object]; object_x[object] += 2 * object_dx[object]; }
+		if ( object_y[object] < GRID_ORIGIN_Y || object_y[object] > GRID_ORIGIN_Y + GRID_HEIGHT - (signed int)object_size[object] ) { object_dy[object] = -object_dy[object]; object_y[object] += 2 * object_dy[object]; }
+	}
+}
+
+/* Internal function to find the touching pairs with the grid. */
+unsigned int Grid_Pairs ( unsigned int count )
+{
+	unsigned int object;
+
+	Collision_Grid_reset();
+	for ( object = 0; object < count; object++ )
+	{
+		Collision_Grid_insert ( object_type[object], object, object_x[object], object_y[object],
+								object_x[object] + object_size[object] - 1, object_y[object] + object_size[object] - 1 );
+	}
+	Collision_Grid_build();
+
+	return Collision_Grid_findPairs ( pairs, BENCHMARK_MAX * 8 );
+}
+
+/* Internal function to find the touching pairs by testing every pair with a ball in it. */
+unsigned int Brute_Force_Pairs ( unsigned int count, unsigned int *tests )
+{
+	unsigned int found = 0;
+	unsigned int a;
+	unsigned int b;
+
+	for ( a = 0; a < count; a++ )
+	{
+		for ( b = a + 1; b < count; b++ )
+		{
+			if ( object_type[a] != GRID_BALL && object_type[b] != GRID_BALL ) continue;
+			( *tests )++;
+			if ( object_x[a] < object_x[b] + (signed int)object_size[b] && object_x[b] < object_x[a] + (signed int)object_size[a] &&
+				 object_y[a] < object_y[b] + (signed int)object_size[b] && object_y[b] < object_y[a] + (signed int)object_size[a] ) found++;
+		}
+	}
+
+	return found;
+}
+
+/* Main Function. */
+int main ( void )
+{
+	static const unsigned int counts[7] = { 25, 40, 50, 100, 200, 400, 800 };
+	unsigned long long start;
+	unsigned long long grid_time;
+	unsigned long long brute_time;
+	unsigned long long grid_tests;
+	unsigned long long brute_tests;
+	unsigned int tests;
+	unsigned int grid_found;
+	unsigned int brute_found;
+	unsigned int mismatches;
+	unsigned int index;
+	unsigned int tick;
+
+	printf ( "Collision grid: %ux%u cells of %u pixels, %u ticks per run\n", GRID_CELLS_X, GRID_CELLS_Y, GRID_CELL_SIZE, BENCHMARK_TICKS );
+	printf ( "objects   grid us/tick  tests/tick   all-pairs us/tick  tests/tick   speed-up\n" );
+
+	for ( index = 0; index < 7; index++ )
+	{
+		grid_time = brute_time = 0;
+		grid_tests = brute_tests = 0;
+		mismatches = 0;
+		Place_Objects ( counts[index] );
+
+		for ( tick = 0; tick < BENCHMARK_TICKS; tick++ )
+		{
+			Move_Objects ( counts[index] );
+
+			start = Now();
+			grid_found = Grid_Pairs ( counts[index] );
+			grid_time += Now() - start;
+			grid_tests += Collision_Grid_getTests();
+
+			tests = 0;
+			start = Now();
+			brute_found = Brute_Force_Pairs ( counts[index], &tests );
+			brute_time += Now() - start;
+			brute_tests += tests;
+
+			if ( grid_found != brute_found ) mismatches++;
+		}
+
+		printf ( "%7u   %12.2f  %10llu   %17.2f  %10llu   %7.1fx\n", counts[index],
+				 grid_time / 1000.0 / BENCHMARK_TICKS, grid_tests / BENCHMARK_TICKS,
+				 brute_time / 1000.0 / BENCHMARK_TICKS, brute_tests / BENCHMARK_TICKS,
+				 grid_time ? (double)brute_time / grid_time : 0.0 );
+
+		if ( mismatches != 0 )
+		{
+			printf ( "  %u ticks found different pairs\n", mismatches );
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  LT24 Display and Time Stamp Stand-Ins for the Host.
+ *  ----------------------------------------
+ *  File Name     : LT24_Panel.c
+ *  Target Device : Host PC (Linux, gcc)
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	The LT24 and HPS timer functions used by the render pipeline, so
+ *  	it can be built on a PC. A window and the data written into it go
+ *  	into lt24_panel, the pixels of the display, with the same
+ *  	auto-incrementing address as the real controller. The time stamp
+ *  	is the monotonic clock, in ticks of the board's global timer.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "../DE1SoC_LT24/DE1SoC_LT24.h"										// Importing the functions stood in for.
+#include "../HPS_Timer/HPS_Timer.h"
+#include <time.h>															// Importing clock_gettime().
+
+/* The pixels of the display, and the window being written. */
+unsigned short lt24_panel [LT24_WIDTH * LT24_HEIGHT];
+unsigned int lt24_window_x;
+unsigned int lt24_window_y;
+unsigned int lt24_window_width = LT24_WIDTH;
+unsigned int lt24_window_height = LT24_HEIGHT;
+unsigned int lt24_cursor = 0;
+unsigned long long lt24_pixels_written = 0;
+
+/* Function to select a window of the display. The next pixels written fill it row by row. */
+signed int LT24_setWindow ( unsigned int xleft, unsigned int ytop, unsigned int width, unsigned int height )
+{
+	if ( width == 0 || height == 0 || xleft + width > LT24_WIDTH || ytop + height > LT24_HEIGHT ) return LT24_INVALIDSIZE;
+
+	lt24_window_x = xleft;
+	lt24_window_y = ytop;
+	lt24_window_width = width;
+	lt24_window_height = height;
+	lt24_cursor = 0;
+
+	return LT24_SUCCESS;
+}
+
+/* Function to write a pixel into the window. Commands are ignored. */
+void LT24_write ( bool isData, unsigned short value )
+{
+	unsigned int x;
+	unsigned int y;
+
+	if ( !isData ) return;
+
+	x = lt24_window_x + lt24_cursor % lt24_window_width;
+	y = lt24_window_y + ( lt24_cursor / lt24_window_width ) % lt24_window_height;	// The controller wraps back to the top.
+	lt24_panel[y * LT24_WIDTH + x] = value;
+	lt24_cursor++;
+	lt24_pixels_written++;
+}
+
+/* Function to start the time stamp counter. The clock always runs. */
+void HPS_Timer_startTimestamp ( void )
+{
+}
+
+/* Function to read the time stamp counter. */
+unsigned int HPS_Timer_timestamp ( void )
+{
+	struct timespec now;
+
+	clock_gettime ( CLOCK_MONOTONIC, &now );
+	return (unsigned int)( ( now.tv_sec * 1000000000ull + now.tv_nsec ) / ( 1000 / HPS_TIMER_TICKS_PER_US ) );
+}
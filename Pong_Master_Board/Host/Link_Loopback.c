@@ -0,0 +1,355 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Loopback Check of the Board-to-Board Link on PC.
+ *  ----------------------------------------
+ *  File Name     : Link_Loopback.c
+ *  Target Device : Host PC (Linux, gcc)
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Connects a sender and a receiver of the link through two words
+ *  	standing in for the wires, and polls them in a random order, as two
+ *  	boards running at their own pace would. Random packets are sent and
+ *  	every packet received must be the one sent with its sequence number.
+ *  	Noise can be put on the data lines: a bit of a data line is flipped
+ *  	now and then until the sender drives the lines again. The CRC must
+ *  	then drop every damaged packet, and no damaged packet may get through.
+ *
+ *  	The bulk run sends blocks of words in bulk mode between paddle
+ *  	packets, the way a game state snapshot would go, and checks every
+ *  	block received. Both runs print the polls each byte took, and the
+ *  	share of packets or blocks dropped.
+ *
+ *  	The mirror run adds the mirror channel on the same two words, the
+ *  	other way, and sends it the view of a made-up match every tick while
+ *  	paddle packets go on the control channel. Every view the spectator
+ *  	decodes must be the one sent with that packet, and its last view the
+ *  	last one sent. It prints the bytes a tick took.
+ *
+ *  Usage:
+ *  	make link_loopback && ./link_loopback [packets] [noise per million polls] [bulk blocks] [mirror ticks]
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "../DE1SoC_Link/DE1SoC_Link.h"										// Importing the link under test.
+#include "../Game_Engine/Game_Mirror.h"										// Importing the mirror packets.
+#include <stdio.h>															// Importing printf().
+#include <stdlib.h>															// Importing atoi(), srand() and rand().
+#include <string.h>															// Importing memcmp().
+
+/* The wires: the lines driven by each end. */
+volatile unsigned int slave_lines = 0;
+volatile unsigned int master_lines = 0;
+
+/* The two ends of the control channel, and of the mirror channel. */
+Link sender;
+Link receiver;
+Link mirror_sender;
+Link mirror_receiver;
+
+/* The last 256 packets sent, by sequence number. */
+Link_Packet sent [256];
+
+/* Bulk blocks: two to send from in turn, as the one being sent must be left alone, and one to receive into. */
+#define BULK_MAX_WORDS 512
+unsigned int bulk_sent [2][BULK_MAX_WORDS];
+unsigned int bulk_received [BULK_MAX_WORDS];
+
+/* Views of the match sent on the mirror channel, by sequence number. */
+Game_MirrorView mirror_sent [256];
+
+/* Internal function to connect the ends of both channels afresh. */
+void Connect ( void )
+{
+	slave_lines = 0;
+	master_lines = 0;
+	Link_initialiseLoopback ( &sender, &master_lines, &slave_lines, &link_control, LINK_SENDER );
+	Link_initialiseLoopback ( &receiver, &slave_lines, &master_lines, &link_control, LINK_RECEIVER );
+	Link_initialiseLoopback ( &mirror_sender, &slave_lines, &master_lines, &link_mirror, LINK_SENDER );
+	Link_initialiseLoopback ( &mirror_receiver, &master_lines, &slave_lines, &link_mirror, LINK_RECEIVER );
+	Link_setBulkBuffer ( &receiver, bulk_received, BULK_MAX_WORDS );
+}
+
+/* Internal function to poll one of the ends a few times, as two boards running at their own pace would, and put
+   noise on the data lines driven by the sender. The mirror channel is only polled when mirror is true. */
+void Step ( unsigned int noise, unsigned int data_lines, bool mirror )
+{
+	Link *ends [4] = { &sender, &receiver, &mirror_sender, &mirror_receiver };
+
+	Link_poll ( ends[rand() % ( mirror ? 4 : 2 )], 1 + rand() % 4 );
+
+	if ( noise && (unsigned int)( rand() % 1000000 ) < noise )
+	{
+		slave_lines ^= 1u << ( LINK_DATA_SHIFT + rand() % data_lines );
+		if ( mirror ) master_lines ^= 1u << ( LINK_MIRROR_DATA_SHIFT + rand() % LINK_MIRROR_DATA_BITS );
+	}
+}
+
+/* Internal function to send random packets. Returns the number received wrong. */
+unsigned int Run_Packets ( unsigned int packets, unsigned int noise )
+{
+	unsigned long long polls = 0;
+	unsigned int queued = 0;
+	unsigned int received = 0;
+	unsigned int wrong = 0;
+	unsigned char payload [LINK_MAX_PAYLOAD];
+	unsigned int length;
+	unsigned int index;
+	unsigned char type;
+	Link_Packet packet;
+	Link_Stats stats;
+
+	Connect();
+	while ( queued < packets || !Link_isIdle ( &sender ) )
+	{
+		/* Queue as many random packets as fit. */
+		while ( queued < packets )
+		{
+			type = 1 + rand() % 3;
+			length = rand() % ( LINK_MAX_PAYLOAD + 1 );
+			for ( index = 0; index < length; index++ ) payload[index] = rand();
+			if ( Link_send ( &sender, type, payload, length ) != LINK_SUCCESS ) break;
+
+			packet.type = type;
+			packet.sequence = (unsigned char)queued;
+			packet.length = length;
+			memcpy ( packet.payload, payload, length );
+			sent[packet.sequence] = packet;
+			queued++;
+		}
+
+		Step ( noise, 8, false );
+		polls++;
+
+		while ( Link_receive ( &receiver, &packet ) )
+		{
+			received++;
+			if ( packet.type != sent[packet.sequence].type || packet.length != sent[packet.sequence].length ||
+				 memcmp ( packet.payload, sent[packet.sequence].payload, packet.length ) != 0 ) wrong++;
+		}
+	}
+
+	/* Let the last bytes through. */
+	for ( index = 0; index < 64; index++ )
+	{
+		Link_poll ( &receiver, 1 );
+		while ( Link_receive ( &receiver, &packet ) ) received++;
+	}
+
+	Link_getStats ( &receiver, &stats );
+	printf ( "Packets: %u sent, %u received, %u dropped for CRC (%.4f%%), %u lost, %u wrong; %.2f polls per byte\n",
+			 queued, received, stats.crc_errors, 100.0 * ( queued - received ) / queued, stats.lost, wrong, (double)polls / stats.bytes );
+
+	if ( noise == 0 && received != queued ) wrong++;
+	return wrong;
+}
+
+/* Internal function to send bulk blocks of random length, with a paddle packet before each. Returns the number received wrong. */
+unsigned int Run_Bulk ( unsigned int blocks, unsigned int noise )
+{
+	unsigned long long polls = 0;
+	unsigned long long words_sent = 0;
+	unsigned int sent_count [2] = { 0, 0 };
+	unsigned int queued = 0;
+	unsigned int received = 0;
+	unsigned int wrong = 0;
+	unsigned int words;
+	unsigned int index;
+	unsigned int block;
+	unsigned char paddle;
+	Link_Stats stats;
+
+	Connect();
+	while ( queued < blocks || !Link_isIdle ( &sender ) )
+	{
+		/* Fill the block not being sent, and queue it once the last one is out. */
+		if ( queued < blocks && Link_isIdle ( &sender ) )
+		{
+			block = queued & 1;
+			sent_count[block] = 1 + rand() % BULK_MAX_WORDS;
+			for ( index = 0; index < sent_count[block]; index++ ) bulk_sent[block][index] = Link_testWord ( queued, index );
+
+			paddle = rand();
+			Link_send ( &sender, LINK_MSG_PADDLE, &paddle, 1 );
+			Link_sendBulk ( &sender, bulk_sent[block], sent_count[block] );
+			words_sent += sent_count[block];
+			queued++;
+		}
+
+		Step ( noise, 24, false );
+		polls++;
+
+		words = Link_receiveBulk ( &receiver );
+		if ( words )
+		{
+			/* The first word says which block it is. */
+			for ( block = 0; block < 2 && bulk_sent[block][0] != bulk_received[0]; block++ );
+			received++;
+			if ( block == 2 || words != sent_count[block] || memcmp ( bulk_received, bulk_sent[block], words * 4 ) != 0 ) wrong++;
+		}
+	}
+
+	for ( index = 0; index < 64; index++ ) Link_poll ( &receiver, 1 );
+	if ( Link_receiveBulk ( &receiver ) ) received++;
+
+	Link_getStats ( &receiver, &stats );
+	printf ( "Bulk: %u blocks sent, %u received, %u dropped for CRC (%.4f%%), %u wrong; %.2f polls per byte\n",
+			 queued, received, stats.bulk_errors, 100.0 * ( queued - received ) / queued, wrong, (double)polls / ( words_sent * 4 ) );
+
+	if ( noise == 0 && received != queued ) wrong++;
+	return wrong;
+}
+
+/* Internal function to compare two views, the balls in play only. */
+bool Same_View ( const Game_MirrorView *a, const Game_MirrorView *b )
+{
+	unsigned int ball;
+
+	if ( a->valid != b->valid || a->paddle_x[0] != b->paddle_x[0] || a->paddle_x[1] != b->paddle_x[1] || a->score[0] != b->score[0] ||
+		 a->score[1] != b->score[1] || a->state != b->state || a->last_point_player != b->last_point_player || a->ball_count != b->ball_count ) return false;
+	for ( ball = 0; ball < a->ball_count; ball++ )
+	{
+		if ( a->ball_x[ball] != b->ball_x[ball] || a->ball_y[ball] != b->ball_y[ball] ) return false;
+	}
+	return true;
+}
+
+/* Internal function to move the made-up match on by a tick: paddles sliding, balls moving in straight lines and served
+   again from the middle now and then, points scored and the number of balls changed once in a while. */
+void Play_Tick ( Game_MirrorView *view, signed int *speed_x, signed int *speed_y )
+{
+	unsigned int ball;
+
+	view->paddle_x[rand() & 1] = 11 + rand() % 180;
+	if ( rand() % 500 == 0 )
+	{
+		view->score[rand() & 1]++;
+		view->last_point_player = 1 + ( rand() & 1 );
+		view->state = ( view->state == MIRROR_STATE_PLAYING ) ? MIRROR_STATE_SCORED : MIRROR_STATE_PLAYING;
+	}
+	if ( rand() % 2000 == 0 ) view->ball_count = 1 + rand() % MIRROR_BALLS;
+	for ( ball = 0; ball < view->ball_count; ball++ )
+	{
+		if ( rand() % 300 == 0 )
+		{
+			view->ball_x[ball] = 118;
+			view->ball_y[ball] = 158;
+			speed_x[ball] = rand() % 7 - 3;
+			speed_y[ball] = ( rand() & 1 ) ? 3 : -3;
+		}
+		if ( view->ball_x[ball] + speed_x[ball] < 12 || view->ball_x[ball] + speed_x[ball] > 225 ) speed_x[ball] = -speed_x[ball];
+		if ( view->ball_y[ball] + speed_y[ball] < 12 || view->ball_y[ball] + speed_y[ball] > 305 ) speed_y[ball] = -speed_y[ball];
+		view->ball_x[ball] += speed_x[ball];
+		view->ball_y[ball] += speed_y[ball];
+	}
+}
+
+/* Internal function to send the view of a made-up match on the mirror channel for a number of ticks, the way the master
+   board does, with a paddle packet going the other way every tick. Returns the number of views decoded wrong. */
+unsigned int Run_Mirror ( unsigned int ticks, unsigned int noise )
+{
+	Game_MirrorView now;
+	Game_MirrorView last_sent;
+	Game_MirrorView view;
+	signed int speed_x [MIRROR_BALLS];
+	signed int speed_y [MIRROR_BALLS];
+	unsigned char payload [MIRROR_MAX_BYTES];
+	unsigned char sequence = 0;
+	unsigned char expected = 0;
+	bool synced = false;
+	unsigned int key_ticks = MIRROR_KEY_TICKS;
+	unsigned int sent_count = 0;
+	unsigned int decoded = 0;
+	unsigned int wrong = 0;
+	unsigned int length;
+	unsigned int tick;
+	unsigned int step;
+	unsigned char paddle;
+	Link_Packet packet;
+	Link_Stats stats;
+
+	Connect();
+	now.valid = true;
+	now.paddle_x[0] = now.paddle_x[1] = 99;
+	now.score[0] = now.score[1] = 0;
+	now.state = MIRROR_STATE_PLAYING;
+	now.last_point_player = 0;
+	now.ball_count = 1;
+	for ( step = 0; step < MIRROR_BALLS; step++ )
+	{
+		now.ball_x[step] = 118;
+		now.ball_y[step] = 158;
+		speed_x[step] = 1;
+		speed_y[step] = 2;
+	}
+	last_sent.valid = false;
+	view.valid = false;
+
+	for ( tick = 0; tick < ticks; tick++ )
+	{
+		Play_Tick ( &now, speed_x, speed_y );
+
+		/* The master board: a view once the last one has gone, as changes from the last one sent. */
+		if ( key_ticks < MIRROR_KEY_TICKS ) key_ticks++;
+		if ( Link_isIdle ( &mirror_sender ) )
+		{
+			length = Game_Mirror_encode ( &now, &last_sent, key_ticks >= MIRROR_KEY_TICKS, payload );
+			if ( length > 0 && Link_send ( &mirror_sender, LINK_MSG_MIRROR, payload, length ) == LINK_SUCCESS )
+			{
+				if ( payload[0] & MIRROR_KEY ) key_ticks = 0;
+				last_sent = now;
+				mirror_sent[sequence++] = now;
+				sent_count++;
+			}
+		}
+
+		/* The slave board: its camera position every tick. */
+		paddle = rand();
+		Link_send ( &sender, LINK_MSG_PADDLE, &paddle, 1 );
+
+		/* A tick of the two boards running at their own pace. */
+		for ( step = 0; step < 200; step++ ) Step ( noise, 8, true );
+
+		while ( Link_receive ( &receiver, &packet ) );
+		while ( Link_receive ( &mirror_receiver, &packet ) )
+		{
+			if ( packet.type != LINK_MSG_MIRROR ) continue;
+			if ( synced && packet.sequence != expected ) view.valid = false;
+			synced = true;
+			expected = packet.sequence + 1;
+			if ( !Game_Mirror_decode ( &view, packet.payload, packet.length ) ) continue;
+			decoded++;
+			if ( !Same_View ( &view, &mirror_sent[packet.sequence] ) ) wrong++;
+		}
+	}
+
+	Link_getStats ( &mirror_receiver, &stats );
+	printf ( "Mirror: %u ticks, %u views sent, %u decoded, %u dropped for CRC, %u lost, %u wrong; %.2f bytes per tick\n",
+			 ticks, sent_count, decoded, stats.crc_errors, stats.lost, wrong, (double)stats.bytes / ticks );
+
+	/* Without noise every view gets through, and the spectator ends up with the last one sent. */
+	if ( noise == 0 && ( decoded + 1 < sent_count || !Same_View ( &view, &last_sent ) ) ) wrong++;
+	return wrong;
+}
+
+int main ( int argc, char **argv )
+{
+	unsigned int packets = ( argc > 1 ) ? atoi ( argv[1] ) : 100000;
+	unsigned int noise = ( argc > 2 ) ? atoi ( argv[2] ) : 0;
+	unsigned int blocks = ( argc > 3 ) ? atoi ( argv[3] ) : 2000;
+	unsigned int ticks = ( argc > 4 ) ? atoi ( argv[4] ) : 100000;
+	unsigned int wrong;
+
+	srand ( 1 );
+	wrong = Run_Packets ( packets, noise ) + Run_Bulk ( blocks, noise ) + Run_Mirror ( ticks, noise );
+
+	if ( wrong != 0 )
+	{
+		printf ( "FAILED\n" );
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Render Worker Check for PC.
+ *  ----------------------------------------
+ *  File Name     : Render_Worker.c
+ *  Target Device : Host PC (Linux, gcc, pthreads)
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Runs the render pipeline with the LT24 stand-in, the same way as
+ *  	the board does with two cores: the main thread draws random
+ *  	rectangles and swaps, a second thread runs the render worker. The
+ *  	same frames are drawn in a copy kept here, and after the last frame
+ *  	the display must match it pixel for pixel. Every layout and
+ *  	resolution is run with the worker and with the flush done on the
+ *  	drawing thread, and the time per frame of both is printed.
+ *
+ *  Usage:
+ *  	make render_worker && ./render_worker [frames] [rectangles per frame]
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "../Graphics_Pipeline/Graphics_Pipeline.h"							// Importing the pipeline under test.
+#include <pthread.h>														// Importing the thread of the render worker.
+#include <sched.h>															// Importing sched_yield().
+#include <stdio.h>															// Importing printf().
+#include <stdlib.h>															// Importing atoi(), srand() and rand().
+#include <time.h>															// Importing clock_gettime().
+
+/* The display of the LT24 stand-in. */
+extern unsigned short lt24_panel [LT24_WIDTH * LT24_HEIGHT];
+
+/* What the display should show, at the logical resolution. */
+unsigned short expected [LT24_WIDTH * LT24_HEIGHT];
+
+/* Set to stop the render worker thread. */
+volatile bool worker_stop = false;
+
+/* Internal function to read a monotonic time in seconds. */
+double Now ( void )
+{
+	struct timespec now;
+
+	clock_gettime ( CLOCK_MONOTONIC, &now );
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* The render worker thread, like the loop run by the second core of the board. */
+void *Worker_Thread ( void *arg )
+{
+	while ( !worker_stop )
+	{
+		if ( !Graphics_Pipeline_workStep() ) sched_yield();
+	}
+	return NULL;
+}
+
+/* Internal function to draw frames of random rectangles. Returns the seconds taken. */
+double Draw_Frames ( unsigned int frames, unsigned int rectangles, unsigned int shift )
+{
+	unsigned int width = LT24_WIDTH >> shift;
+	unsigned int height = LT24_HEIGHT >> shift;
+	unsigned int frame;
+	unsigned int count;
+	unsigned int x1, y1, x2, y2;
+	unsigned int x, y;
+	unsigned short colour;
+	double start = Now();
+
+	for ( frame = 0; frame < frames; frame++ )
+	{
+		for ( count = 0; count < rectangles; count++ )
+		{
+			x1 = rand() % width;
+			y1 = rand() % height;
+			x2 = x1 + rand() % 24;											// Mostly small objects, like the game draws.
+			y2 = y1 + rand() % 24;
+			colour = rand();
+			Graphics_Pipeline_fill ( x1, y1, x2, y2, colour );
+
+			for ( y = y1; y <= y2 && y < height; y++ )
+			{
+				for ( x = x1; x <= x2 && x < width; x++ ) expected[y * width + x] = colour;
+			}
+		}
+		Graphics_Pipeline_swap();
+	}
+	Graphics_Pipeline_finish();
+
+	return Now() - start;
+}
+
+/* Internal function to count the pixels of the display that differ from the expected frame. */
+unsigned int Count_Differences ( unsigned int shift )
+{
+	unsigned int width = LT24_WIDTH >> shift;
+	unsigned int differences = 0;
+	unsigned int x;
+	unsigned int y;
+
+	for ( y = 0; y < LT24_HEIGHT; y++ )
+	{
+		for ( x = 0; x < LT24_WIDTH; x++ )
+		{
+			if ( lt24_panel[y * LT24_WIDTH + x] != expected[( y >> shift ) * width + ( x >> shift )] ) differences++;
+		}
+	}
+	return differences;
+}
+
+/* Internal function to run one layout and resolution, with or without the worker. Returns the number of wrong pixels. */
+unsigned int Run ( unsigned int layout, unsigned int shift, bool worker, unsigned int frames, unsigned int rectangles )
+{
+	pthread_t thread;
+	unsigned int index;
+	unsigned int differences;
+	double seconds;
+
+	Graphics_Pipeline_setLayout ( layout, LT24_BLACK );
+	Graphics_Pipeline_reset ( LT24_BLACK, shift );
+	for ( index = 0; index < LT24_WIDTH * LT24_HEIGHT; index++ )
+	{
+		expected[index] = LT24_BLACK;
+		lt24_panel[index] = LT24_WHITE;										// The first frame must cover the whole display.
+	}
+
+	if ( worker )
+	{
+		worker_stop = false;
+		Graphics_Pipeline_setWorker ( true );
+		pthread_create ( &thread, NULL, Worker_Thread, NULL );
+	}
+
+	srand ( 1 );
+	seconds = Draw_Frames ( frames, rectangles, shift );
+
+	if ( worker )
+	{
+		worker_stop = true;
+		pthread_join ( thread, NULL );
+		Graphics_Pipeline_setWorker ( false );
+	}
+
+	differences = Count_Differences ( shift );
+	printf ( "%-6s %-4s %-6s: %6.1f us per frame, %u wrong pixels\n", layout == GP_LAYOUT_TILED ? "tiled" : "linear",
+			 shift ? "half" : "full", worker ? "worker" : "inline", seconds * 1e6 / frames, differences );
+	return differences;
+}
+
+int main ( int argc, char **argv )
+{
+	unsigned int frames = ( argc > 1 ) ? atoi ( argv[1] ) : 2000;
+	unsigned int rectangles = ( argc > 2 ) ? atoi ( argv[2] ) : 8;
+	unsigned int failures = 0;
+	unsigned int layout;
+	unsigned int shift;
+
+	Graphics_Pipeline_initialise ( LT24_BLACK, 0 );
+
+	for ( layout = GP_LAYOUT_LINEAR; layout <= GP_LAYOUT_TILED; layout++ )
+	{
+		for ( shift = 0; shift <= 1; shift++ )
+		{
+			if ( Run ( layout, shift, false, frames, rectangles ) ) failures++;
+			if ( Run ( layout, shift, true, frames, rectangles ) ) failures++;
+		}
+	}
+
+	printf ( failures ? "FAILED\n" : "All runs matched.\n" );
+	return failures ? 1 : 0;
+}
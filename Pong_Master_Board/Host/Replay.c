@@ -0,0 +1,321 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Replay Recorder and Player for PC.
+ *  ----------------------------------------
+ *  File Name     : Replay.c
+ *  Target Device : Host PC (Linux, gcc)
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Records a game between two computer players into a replay file, or
+ *  	plays a replay file recorded here or saved from the board. A replay
+ *  	plays unthrottled by default, or at the board's tick rate with
+ *  	--realtime, and ends by checking that the game finished in the
+ *  	recorded state.
+ *  	The rollback check plays a game with the camera position of
+ *  	paddle 1 on time, then again with it late and rolled back, and
+ *  	checks that both end in the same state and that the corrected log
+ *  	replays to it.
+ *  	The track check lets the computer opponent play paddle 1 through
+ *  	the camera tracker, and checks that the paddle stays close to
+ *  	where the opponent aims.
+ *
+ *  Usage:
+ *  	make replay
+ *  	./replay record <file> [ticks] [balls] [seed] [mode]
+ *  	./replay play <file> [--realtime]
+ *  	./replay rollback [ticks] [delay]
+ *  	./replay track [ticks] [level]
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "../Game_Engine/Game_Replay.h"										// Importing the replay log.
+#include "../Game_Engine/Game_Rollback.h"									// Importing the rollback of the late camera input.
+#include "../Game_Engine/Game_Opponent.h"									// Importing the computer opponent that plays the recorded games.
+#include <stdio.h>															// Importing printf() and the file functions.
+#include <stdlib.h>															// Importing strtoul().
+#include <string.h>															// Importing strcmp().
+#include <time.h>															// Importing clock_gettime() and nanosleep().
+
+/* Replay logs, too large for the stack: the log played or recorded, and the log corrected by the rollback check. */
+static Game_Replay replay;
+static Game_Replay corrected;
+
+/* Largest mean distance in pixels between paddle 1 and the position its opponent aims at, for the track check to pass.
+   The tracker smooths the camera, so the paddle lags a few pixels behind a target that jumps at every look. */
+#define TRACK_MAX_ERROR 10.0
+
+/* Internal function to read a monotonic time in seconds. */
+double Now ( void )
+{
+	struct timespec now;
+
+	clock_gettime ( CLOCK_MONOTONIC, &now );
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* Internal function to wait until a monotonic time in seconds. */
+void Wait_Until ( double time )
+{
+	double delay = time - Now();
+	struct timespec wait;
+
+	if ( delay <= 0 ) return;
+	wait.tv_sec = (time_t)delay;
+	wait.tv_nsec = (long)( ( delay - wait.tv_sec ) * 1e9 );
+	nanosleep ( &wait, NULL );
+}
+
+/* The two players of a recorded game. */
+static Game_Opponent players [GAME_PADDLES];
+
+/* Internal function to script the inputs of a tick the way the board reads them: the computer opponent plays both
+   paddles, and the multi-ball key is pressed every 20000 ticks. */
+void Script_Input ( const Game_State *state, Game_InputRecord *record )
+{
+	record->link = 0;
+	record->keys = ( state->ticks % 20000 == 19999 ) ? GAME_KEY_MULTI_BALL : 0x0;
+	record->switches = 0;
+
+	Game_Opponent_play ( &players[PADDLE_1], state, record );
+	Game_Opponent_play ( &players[PADDLE_2], state, record );
+}
+
+/* Internal function to record a game between two computer players into a file. */
+int Record ( const char *file_name, unsigned int ticks, unsigned int balls, unsigned int seed, unsigned int mode )
+{
+	Game_State state;
+	Game_InputRecord record;
+	Game_Input input;
+	FILE *file;
+	unsigned int tick;
+
+	if ( Game_Simulation_initialise ( &state, balls, seed ) != GAME_SUCCESS )
+	{
+		printf ( "The number of balls must be 1 to %u\n", GAME_MAX_BALLS );
+		return 1;
+	}
+	if ( Game_Simulation_setMode ( &state, mode ) != GAME_SUCCESS )
+	{
+		printf ( "The mode must be %u (classic) or %u (bricks)\n", GAME_MODE_CLASSIC, GAME_MODE_BRICKS );
+		return 1;
+	}
+	Game_Replay_startRecording ( &replay, seed, balls, &state );
+	Game_Opponent_initialise ( &players[PADDLE_1], PADDLE_1, GAME_OPPONENT_NORMAL, seed );
+	Game_Opponent_initialise ( &players[PADDLE_2], PADDLE_2, GAME_OPPONENT_EASY, seed + 1 );
+
+	for ( tick = 0; tick < ticks; tick++ )
+	{
+		Script_Input ( &state, &record );
+		if ( Game_Replay_record ( &replay, &record ) != GAME_REPLAY_SUCCESS ) break;
+
+		Game_Simulation_decodeInput ( &record, &input );
+		Game_Simulation_step ( &state, &input, NULL );
+		if ( state.state == GAME_STATE_OVER ) break;
+	}
+	Game_Replay_recordResult ( &replay, &state );
+
+	file = fopen ( file_name, "wb" );
+	if ( file == NULL || fwrite ( &replay, Game_Replay_size ( &replay ), 1, file ) != 1 )
+	{
+		printf ( "Cannot write %s\n", file_name );
+		return 1;
+	}
+	fclose ( file );
+
+	printf ( "Recorded %u ticks, %u-%u, checksum %08x\n", replay.header.ticks, state.player_1_score, state.player_2_score, replay.header.checksum );
+	return 0;
+}
+
+/* Internal function to play a replay file back and check its result. */
+int Play ( const char *file_name, bool realtime )
+{
+	Game_State state;
+	FILE *file;
+	unsigned int tick;
+	size_t records;
+	double start;
+	double seconds;
+
+	file = fopen ( file_name, "rb" );
+	if ( file == NULL || fread ( &replay.header, sizeof ( replay.header ), 1, file ) != 1 )
+	{
+		printf ( "Cannot read %s\n", file_name );
+		return 1;
+	}
+	records = fread ( replay.records, sizeof ( Game_InputRecord ), GAME_REPLAY_MAX_TICKS, file );
+	fclose ( file );
+
+	if ( Game_Replay_begin ( &replay, &state ) != GAME_REPLAY_SUCCESS || records < replay.header.ticks )
+	{
+		printf ( "%s is not a complete replay\n", file_name );
+		return 1;
+	}
+
+	start = Now();
+	for ( tick = 0; Game_Replay_step ( &replay, tick, &state, NULL ) == GAME_REPLAY_SUCCESS; tick++ )
+	{
+		if ( realtime ) Wait_Until ( start + ( tick + 1 ) * ( GAME_TICK_US / 1e6 ) );
+	}
+	seconds = Now() - start;
+
+	printf ( "Played %u ticks, %u-%u, in %.3f s (%.0fx real time): %s\n", tick, state.player_1_score, state.player_2_score, seconds,
+			 seconds > 0 ? tick * ( GAME_TICK_US / 1e6 ) / seconds : 0.0, Game_Replay_verify ( &replay, &state ) ? "matched" : "DID NOT MATCH" );
+
+	return Game_Replay_verify ( &replay, &state ) ? 0 : 2;
+}
+
+/* Internal function to script the inputs of a tick for the rollback check: the push buttons follow the first ball, and
+   so does the camera, swinging 16 pixels either side of it. The camera position is held still for the first delay ticks
+   and the last 2 * delay ticks, so that the late run has no value still to come at either end. */
+void Script_Follow ( const Game_State *state, unsigned int tick, unsigned int ticks, unsigned int delay, Game_InputRecord *record )
+{
+	signed int swing = (signed int)( ( tick % 64 < 32 ) ? tick % 64 : 64 - tick % 64 ) - 16;
+	signed int ball_x = FIXED_TO_INT ( state->balls.x[0] ) + ( BALL_SIZE / 2 );
+	signed int camera_x = ball_x - (signed int)( state->paddles.length[PADDLE_1] / 2 ) + swing;
+	signed int paddle_2_x = (signed int)( state->paddles.x[PADDLE_2] + state->paddles.length[PADDLE_2] / 2 );
+	unsigned char link = record->link;
+
+	record->keys = ( ball_x > paddle_2_x + 1 ) ? 0x1 : ( ball_x + 1 < paddle_2_x ) ? 0x2 : 0x0;
+	record->switches = 0;
+	record->link = (unsigned char)MIN ( MAX ( ( camera_x * 4 + 2 ) / 5, 0 ), 255 );
+	if ( ( tick > 0 && tick <= delay ) || tick + 2 * delay >= ticks ) record->link = link;
+}
+
+/* Internal function to play a game with the camera position on time, then with it late by delay ticks and rolled back.
+   Checks that both end in the same state, that the rollback corrected the log back to the inputs on time, and that
+   the corrected log replays to the same state. */
+int Rollback ( unsigned int ticks, unsigned int delay )
+{
+	Game_State state;
+	Game_Rollback rollback;
+	Game_InputRecord record;
+	Game_Input input;
+	unsigned int on_time;
+	unsigned int late;
+	unsigned int rolled_back;
+	unsigned int tick;
+	unsigned int back;
+	unsigned int wrong = 0;
+	bool replayed;
+
+	if ( ticks == 0 || ticks > GAME_REPLAY_MAX_TICKS || Game_Rollback_initialise ( &rollback, delay ) != GAME_ROLLBACK_SUCCESS )
+	{
+		printf ( "The ticks must be 1 to %u and the delay 0 to %u\n", GAME_REPLAY_MAX_TICKS, GAME_ROLLBACK_MAX_DELAY );
+		return 1;
+	}
+
+	/* On time: each tick is run with the camera position of that tick. */
+	Game_Simulation_initialise ( &state, 1, 1 );
+	Game_Replay_startRecording ( &replay, 1, 1, &state );
+	record.link = 0;
+	for ( tick = 0; tick < ticks; tick++ )
+	{
+		Script_Follow ( &state, tick, ticks, delay, &record );
+		Game_Replay_record ( &replay, &record );
+		Game_Simulation_decodeInput ( &record, &input );
+		Game_Simulation_step ( &state, &input, NULL );
+	}
+	Game_Replay_recordResult ( &replay, &state );
+	on_time = Game_Simulation_checksum ( &state );
+
+	/* Late: each tick gets the camera position of delay ticks before, and the rollback runs the ticks again when it changes.
+	   The log is corrected the way the board does it. */
+	Game_Simulation_initialise ( &state, 1, 1 );
+	Game_Replay_startRecording ( &corrected, 1, 1, &state );
+	for ( tick = 0; tick < ticks; tick++ )
+	{
+		record = replay.records[tick];
+		record.link = replay.records[( tick > delay ) ? tick - delay : 0].link;
+		Game_Replay_record ( &corrected, &record );
+		rolled_back = Game_Rollback_step ( &rollback, &state, &record, NULL );
+		for ( back = 1; back <= rolled_back; back++ ) Game_Replay_correct ( &corrected, back, Game_Rollback_input ( &rollback, back ) );
+	}
+	Game_Replay_recordResult ( &corrected, &state );
+	late = Game_Simulation_checksum ( &state );
+
+	for ( tick = 0; tick < ticks; tick++ )
+	{
+		if ( corrected.records[tick].link != replay.records[tick].link ) wrong++;
+	}
+
+	/* The corrected log played back from the start. */
+	replayed = Game_Replay_begin ( &corrected, &state ) == GAME_REPLAY_SUCCESS;
+	for ( tick = 0; replayed && Game_Replay_step ( &corrected, tick, &state, NULL ) == GAME_REPLAY_SUCCESS; tick++ );
+	replayed = replayed && Game_Replay_verify ( &corrected, &state ) && Game_Simulation_checksum ( &state ) == on_time;
+
+	printf ( "Rolled back %u times over %u ticks with the camera %u ticks late, %u ticks run again\n", rollback.rollbacks, ticks, delay, rollback.resimulated );
+	printf ( "Checksum on time %08x, late %08x: %s\n", on_time, late, ( on_time == late ) ? "matched" : "DID NOT MATCH" );
+	printf ( "Corrected log: %u ticks differ from the inputs on time, replay %s\n", wrong, replayed ? "matched" : "DID NOT MATCH" );
+
+	return ( on_time == late && wrong == 0 && replayed ) ? 0 : 2;
+}
+
+/* Internal function to let the computer opponent play paddle 1 through the camera tracker, and to measure how far the
+   paddle is from where the opponent aims. */
+int Track ( unsigned int ticks, unsigned int level )
+{
+	Game_State state;
+	Game_InputRecord record;
+	Game_Input input;
+	unsigned long long error = 0;
+	unsigned int tick;
+	double mean;
+
+	if ( Game_Opponent_initialise ( &players[PADDLE_1], PADDLE_1, level, 1 ) != GAME_OPPONENT_SUCCESS )
+	{
+		printf ( "The level must be %u (easy) to %u (hard)\n", GAME_OPPONENT_EASY, GAME_OPPONENT_HARD );
+		return 1;
+	}
+	Game_Opponent_initialise ( &players[PADDLE_2], PADDLE_2, GAME_OPPONENT_EASY, 2 );
+	Game_Simulation_initialise ( &state, 1, 1 );
+
+	for ( tick = 0; tick < ticks; tick++ )
+	{
+		Script_Input ( &state, &record );
+		Game_Simulation_decodeInput ( &record, &input );
+		Game_Simulation_step ( &state, &input, NULL );
+		error += abs ( (signed int)state.paddles.x[PADDLE_1] - (signed int)players[PADDLE_1].target_x );
+
+		if ( state.state == GAME_STATE_OVER ) Game_Simulation_initialise ( &state, 1, state.random );
+	}
+	mean = ticks ? (double)error / ticks : 0.0;
+
+	printf ( "Tracked paddle 1 for %u ticks at level %u: %.1f pixels from the target on average, %s\n", ticks, level, mean,
+			 ( mean <= TRACK_MAX_ERROR ) ? "within the limit" : "TOO FAR" );
+
+	return ( mean <= TRACK_MAX_ERROR ) ? 0 : 2;
+}
+
+/* Main Function. */
+int main ( int argc, char **argv )
+{
+	if ( argc >= 3 && strcmp ( argv[1], "record" ) == 0 )
+	{
+		return Record ( argv[2], ( argc > 3 ) ? (unsigned int)strtoul ( argv[3], NULL, 10 ) : GAME_REPLAY_MAX_TICKS,
+						( argc > 4 ) ? (unsigned int)strtoul ( argv[4], NULL, 10 ) : 1,
+						( argc > 5 ) ? (unsigned int)strtoul ( argv[5], NULL, 0 ) : 1,
+						( argc > 6 ) ? (unsigned int)strtoul ( argv[6], NULL, 10 ) : GAME_MODE_CLASSIC );
+	}
+	if ( argc >= 3 && strcmp ( argv[1], "play" ) == 0 )
+	{
+		return Play ( argv[2], argc > 3 && strcmp ( argv[3], "--realtime" ) == 0 );
+	}
+	if ( argc >= 2 && strcmp ( argv[1], "rollback" ) == 0 )
+	{
+		return Rollback ( ( argc > 2 ) ? (unsigned int)strtoul ( argv[2], NULL, 10 ) : GAME_REPLAY_MAX_TICKS,
+						  ( argc > 3 ) ? (unsigned int)strtoul ( argv[3], NULL, 10 ) : 8 );
+	}
+	if ( argc >= 2 && strcmp ( argv[1], "track" ) == 0 )
+	{
+		return Track ( ( argc > 2 ) ? (unsigned int)strtoul ( argv[2], NULL, 10 ) : 200000,
+					   ( argc > 3 ) ? (unsigned int)strtoul ( argv[3], NULL, 10 ) : GAME_OPPONENT_HARD );
+	}
+
+	printf ( "Usage: %s record <file> [ticks] [balls] [seed] [mode]\n       %s play <file> [--realtime]\n       %s rollback [ticks] [delay]\n"
+			 "       %s track [ticks] [level]\n", argv[0], argv[0], argv[0], argv[0] );
+	return 1;
+}
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Headless Soak Run of the Game Rules.
+ *  ----------------------------------------
+ *  File Name     : Soak.c
+ *  Target Device : Host PC (Linux, gcc)
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Plays games with the simulation library only: no display, sound or
+ *  	board. Both paddles follow the first ball with a small error, the
+ *  	games are restarted when a player wins, and every ball is checked
+ *  	to stay inside the court after every tick. Prints the number of
+ *  	ticks per second and the points and bounces per game. In the brick
+ *  	mode no ball may overlap a standing brick either.
+ *
+ *  Usage:
+ *  	make soak && ./soak [ticks] [balls] [speed 0-511] [mode 0-1]
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "../Game_Engine/Game_Simulation.h"									// Importing the rules of the game.
+#include "../Game_Engine/Game_Bricks.h"										// Importing the brick bitmap to check the balls against it.
+#include <stdio.h>															// Importing printf().
+#include <stdlib.h>															// Importing atoi(), srand() and rand().
+#include <time.h>															// Importing clock_gettime().
+
+/* Counts kept by the observer. */
+typedef struct {
+	unsigned long long bounces;
+	unsigned long long points;
+} Soak_Counts;
+
+/* Observer of the game. */
+void Soak_bounced ( void *context )
+{
+	( (Soak_Counts *)context )->bounces++;
+}
+
+void Soak_scored ( void *context, const Game_State *state )
+{
+	( (Soak_Counts *)context )->points++;
+}
+
+/* Internal function to read a monotonic time in seconds. */
+double Now ( void )
+{
+	struct timespec now;
+
+	clock_gettime ( CLOCK_MONOTONIC, &now );
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* Internal function to make the inputs of a tick: both paddles chase the first ball and miss now and then. */
+void Soak_Input ( const Game_State *state, Game_Input *input, unsigned int speed )
+{
+	signed int target = FIXED_TO_INT ( state->balls.x[0] ) + ( BALL_SIZE / 2 ) - ( PADDLE_LENGTH / 2 ) + ( rand() % 61 ) - 30;
+	signed int paddle_2_x = (signed int)state->paddles.x[PADDLE_2];
+
+	input->paddle_1_x = ( target < 0 ) ? 0 : (unsigned int)target;
+	input->paddle_2_move = ( target > paddle_2_x ) ? 1 : ( target < paddle_2_x ) ? -1 : 0;
+	input->speed = speed;
+	input->multi_ball = false;
+}
+
+/* Internal function to check that every ball is inside the court, and clear of the bricks. */
+bool Soak_Check ( const Game_State *state )
+{
+	unsigned int ball;
+
+	for ( ball = 0; ball < state->balls.count; ball++ )
+	{
+		if ( state->balls.x[ball] < INT_TO_FIXED(BALL_MINIMUM_X) || state->balls.x[ball] > INT_TO_FIXED(BALL_MAXIMUM_X) ||
+			 state->balls.y[ball] < INT_TO_FIXED(BALL_MINIMUM_Y) || state->balls.y[ball] > INT_TO_FIXED(BALL_MAXIMUM_Y) ) return false;
+		if ( state->mode == GAME_MODE_BRICKS && state->state == GAME_STATE_PLAYING &&
+			 Game_Bricks_occupied ( FIXED_ROUND ( state->balls.x[ball] ), FIXED_ROUND ( state->balls.y[ball] ) ) ) return false;
+	}
+
+	return true;
+}
+
+/* Main Function. */
+int main ( int argc, char **argv )
+{
+	unsigned long long ticks = ( argc > 1 ) ? strtoull ( argv[1], NULL, 10 ) : 10000000ull;
+	unsigned int balls = ( argc > 2 ) ? (unsigned int)atoi ( argv[2] ) : 1;
+	unsigned int speed = ( argc > 3 ) ? (unsigned int)atoi ( argv[3] ) : 0;
+	unsigned int mode = ( argc > 4 ) ? (unsigned int)atoi ( argv[4] ) : GAME_MODE_CLASSIC;
+	Soak_Counts counts = { 0, 0 };
+	Game_Observer observer = { &counts, Soak_bounced, Soak_scored, NULL };
+	Game_State state;
+	Game_Input input;
+	unsigned long long tick;
+	unsigned long long games = 0;
+	double start;
+	double seconds;
+
+	srand ( 1 );
+	if ( Game_Simulation_initialise ( &state, balls, 1 ) != GAME_SUCCESS )
+	{
+		printf ( "The number of balls must be 1 to %u\n", GAME_MAX_BALLS );
+		return 1;
+	}
+	if ( Game_Simulation_setMode ( &state, mode ) != GAME_SUCCESS )
+	{
+		printf ( "The mode must be %u (classic) or %u (bricks)\n", GAME_MODE_CLASSIC, GAME_MODE_BRICKS );
+		return 1;
+	}
+
+	start = Now();
+	for ( tick = 0; tick < ticks; tick++ )
+	{
+		Soak_Input ( &state, &input, speed );
+		Game_Simulation_step ( &state, &input, &observer );
+
+		if ( !Soak_Check ( &state ) )
+		{
+			printf ( "A ball left the court at tick %llu\n", tick );
+			return 1;
+		}
+
+		if ( state.state == GAME_STATE_OVER )
+		{
+			Game_Simulation_restart ( &state );
+			games++;
+		}
+	}
+	seconds = Now() - start;
+
+	printf ( "%llu ticks with %u balls at speed %u, mode %u, in %.2f s: %.2f million ticks/s (%.0fx real time)\n", ticks, balls, speed, mode,
+			 seconds, ticks / seconds / 1e6, ticks * ( GAME_TICK_US / 1e6 ) / seconds );
+	printf ( "%llu games, %.1f points and %.1f bounces per game\n", games,
+			 games ? (double)counts.points / games : 0.0, games ? (double)counts.bounces / games : 0.0 );
+
+	return 0;
+}
@@ -22,8 +22,15 @@
 #include "DE1SoC_LT24/DE1SoC_LT24.h"										// Importing the LCD library for interfacing with the LT24 terasic LCD.
 #include "HPS_Watchdog/HPS_Watchdog.h"										// Importing the watchdog timer library to ensure the program doesn't stay in an infinite loop.
 #include "HPS_usleep/HPS_usleep.h"											// Importing the sleep library to create instances of time delay.
+#include "HPS_IRQ/HPS_IRQ.h"												// Importing the interrupt library to register the display flush handler.
+#include "HPS_Timer/HPS_Timer.h"											// Importing the timer library that paces the display flush.
+#include "Graphics_Pipeline/Graphics_Pipeline.h"							// Importing the double-buffered render/flush pipeline.
+#include "HPS_SMP/HPS_SMP.h"												// Importing the start-up of the second core for the render worker.
+#include "DE1SoC_Link/DE1SoC_Link.h"										// Importing the packet link from the slave board.
+#include "DE1SoC_SevenSeg/DE1SoC_SevenSeg.h"								// Importing the seven segment display driver.
+#include "Benchmark/Benchmark.h"											// Importing the on-board benchmarks.
 #include <stdlib.h>															// Importing the standard library functions to perform necessary actions.
-#include <time.h>															// Importing the time library so that its values can be used as seed value for generating random numbers.
+#include <stdio.h>															// Importing printf() to report the result of a replay to the debugger console.
 
 void exitOnFail(signed int status, signed int successStatus)				// Exit on fail sub-routine is used to ensure that the processor doesn't malfunction.
 {
@@ -33,61 +40,218 @@ void exitOnFail(signed int status, signed int successStatus)				// Exit on fail
     }
 }
 
+/* Render mode switch. SW9 selects half resolution (2x2 pixel-doubled) rendering. */
+#define RENDER_MODE_SWITCH 0x200
+
+/* Source of the inputs: GAME_INPUT_LIVE, GAME_INPUT_RECORD to also fill the game_replay log (save it with the debugger,
+   Game_Replay_size() bytes) or GAME_INPUT_REPLAY to play back a log loaded into game_replay with the debugger. */
+#define INPUT_MODE GAME_INPUT_LIVE
+
+/* Define REPLAY_UNTHROTTLED to play a replay as fast as the board can instead of in real time. */
+//#define REPLAY_UNTHROTTLED
+#define REPLAY_TICKS_PER_FRAME 32
+
+/* Ticks the camera position of paddle 1 lags behind by when it reaches the master: one PWM pulse of the slave board and its
+   camera frame. The game runs ahead with the last position and is rolled back when a new one arrives. 0 never rolls back. */
+#define LINK_DELAY_TICKS 5
+
+/* Court: GAME_MODE_CLASSIC, or GAME_MODE_BRICKS with two walls of bricks between the paddles. */
+#define COURT_MODE GAME_MODE_CLASSIC
+
+/* Single player: KEY3 lets the computer play this paddle, PADDLE_1 (camera) or PADDLE_2 (push buttons), at this level. */
+#define CPU_PADDLE PADDLE_2
+#define CPU_LEVEL  GAME_OPPONENT_NORMAL
+
+/* Memory layout of the frame buffers: GP_LAYOUT_LINEAR or GP_LAYOUT_TILED (8x4 pixel blocks). */
+#define FRAMEBUFFER_LAYOUT GP_LAYOUT_LINEAR
+
+/* Define RUN_BENCHMARKS to print the on-board benchmarks to the debugger console before the game starts. */
+//#define RUN_BENCHMARKS
+#define BENCHMARK_FRAMES 500
+#define BENCHMARK_OBJECTS 10000
+
+/* Define RUN_LINK_BENCHMARK, here and on the slave board, to measure the bulk mode of the link before the game starts. */
+//#define RUN_LINK_BENCHMARK
+#define LINK_BENCHMARK_BLOCKS 1000
+
+/* Define RENDER_WORKER to send the frames to the LT24 from the second core, leaving the first one to the input and the
+   game. Otherwise, or if the second core does not start, a timer interrupt on the first core sends them between the ticks. */
+#define RENDER_WORKER
+
+/* Period of the display flush interrupt in microseconds. Each interrupt sends GP_FLUSH_TILES_PER_STEP tiles. */
+#define FLUSH_PERIOD_US 500
+
+/* Function run by the second core: sends every frame queued by Graphics_present() and sleeps until the next one. */
+void Render_Worker ( void* arg )
+{
+	while (1)
+	{
+		if ( !Graphics_Pipeline_workStep() ) __wfe();						// Woken by the first core when it queues work.
+	}
+}
+
+/* Interrupt handler that streams the front buffer to the LT24 a few tiles at a time, while the next frame is drawn. */
+void Flush_IRQHandler ( HPSIRQSource interruptID, bool isInit, void* initParams )
+{
+	if ( !isInit )
+	{
+		HPS_Timer_acknowledge ( HPS_TIMER_SP0 );								// Clear the interrupt before doing the work.
+		Graphics_Pipeline_flushStep ( GP_FLUSH_TILES_PER_STEP );
+	}
+}
+
+/* Interrupt handler of the fixed timestep. Each interrupt is one game tick of GAME_TICK_US microseconds. */
+void Tick_IRQHandler ( HPSIRQSource interruptID, bool isInit, void* initParams )
+{
+	if ( !isInit )
+	{
+		HPS_Timer_acknowledge ( HPS_TIMER_OSC1_0 );
+		Game_timerTick();													// The main loop runs the tick, the handler only counts it.
+	}
+}
+
+/* Interrupt handler of the parallel port the slave board is wired to: a line of the link changed. */
+void Link_IRQHandler ( HPSIRQSource interruptID, bool isInit, void* initParams )
+{
+	if ( !isInit )
+	{
+		Game_linkInterrupt();												// Clears the edges and takes the byte, the game loop reads the mailbox.
+	}
+}
+
+/* Function to draw the gaming area. White Border on two sides and grey sides on two sides. Grey Fill. */
+void Draw_Gaming_Area ( void )
+{
+	Graphics_drawBox(10,10,230,310,LT24_WHITE,false,0x39E7); HPS_ResetWatchdog();
+	Graphics_drawLine(10,10,230,10,0x39E7); HPS_ResetWatchdog();
+	Graphics_drawLine(10,310,230,310,0x39E7); HPS_ResetWatchdog();
+
+	/* Line. Drawing a Dashed Net between the two players. */
+	Graphics_drawDash(11,160,229,160,LT24_WHITE); HPS_ResetWatchdog();
+}
+
+/* Function to follow the render mode switch. The screen is redrawn in the new mode when the switch changes. */
+void Update_Render_Mode ( void )
+{
+	/* Slide switches Base Address. */
+	volatile unsigned int *SW_ptr = (unsigned int *) 0xFF200040;
+	
+	unsigned int mode = ( *SW_ptr & RENDER_MODE_SWITCH ) ? GRAPHICS_HALF_RESOLUTION : GRAPHICS_FULL_RESOLUTION;
+	
+	if ( mode != Graphics_getRenderMode() )
+	{
+		Graphics_setRenderMode(mode);
+		Graphics_clearScreen(LT24_BLACK); HPS_ResetWatchdog();				// Remove everything drawn in the previous mode.
+		Draw_Gaming_Area();
+		Game_forceRedraw();													// The ball, paddles and score boxes are redrawn by the next frame.
+	}
+}
+
+/* Function to print the result of a replay once it has played to the end. */
+void Report_Replay ( unsigned long long replay_time )
+{
+	static bool reported = false;
+	
+	if ( reported || !Game_isReplayDone() ) return;
+	reported = true;
+	
+	printf("Replay of %u ticks %s in %llu us.\n", game.ticks, Game_verifyReplay() ? "matched" : "DID NOT MATCH", replay_time / HPS_TIMER_TICKS_PER_US);
+}
+
 /* Main Function.*/
 int main(void)
 {	
-	/* GPIO Port Base Address. */
-	volatile unsigned char *GPIO_ptr  = (unsigned char *) 0xFF200070;		// The GPIO of the master board is connected to the slave board for board-to-board communication.
-	
-	/* Variable to hold the value from the slave board */
-	unsigned int slave_board_data = 0;										// This information holds the value of the touch screen and the paddle 1 control values from the slave board. 
+	unsigned long long replay_time = 0;										// Global timer ticks spent playing a replay.
+	unsigned int frame_start;
 	
-	/* Setting all pin as Input. */
-	*(GPIO_ptr+4)  = 0x000000;												// The master board only receives values from the slave board.
+	/* The GPIO of the master board is connected to the slave board for board-to-board communication: packets from the slave
+	   on the control channel, the view of the match to it on the mirror channel. Once the interrupts are set up, the port
+	   interrupts when the slave board moves a line, and the link is polled from the handler. */
+#ifdef RUN_LINK_BENCHMARK
+	exitOnFail( Benchmark_link(LINK_BENCHMARK_BLOCKS), BENCHMARK_SUCCESS);
+#endif
+	exitOnFail( Game_openLink(LINK_PORT_BASE), LINK_SUCCESS);
 	
     /* Initialise the LCD Display and exit if not successful. */
     exitOnFail( LT24_initialise(0xFF200060,0xFF200080),  LT24_SUCCESS);
 
 	HPS_ResetWatchdog();													// Reset the watch dog timer so that it doesn't run out and restarts the processor.
+	
+	/* Draw into the back buffer from now on. The flush interrupt sends finished frames to the LT24. */
+	exitOnFail( Graphics_Pipeline_initialise(LT24_BLACK, 0), GP_SUCCESS);
+#ifdef RUN_BENCHMARKS
+	exitOnFail( Benchmark_framebufferLayouts(BENCHMARK_FRAMES), BENCHMARK_SUCCESS);
+	exitOnFail( Benchmark_blitters(BENCHMARK_OBJECTS), BENCHMARK_SUCCESS);
+#endif
+	exitOnFail( Graphics_Pipeline_setLayout(FRAMEBUFFER_LAYOUT, LT24_BLACK), GP_SUCCESS);
+	exitOnFail( HPS_IRQ_initialise(NULL), HPS_IRQ_SUCCESS);
+#ifdef RENDER_WORKER
+	if ( HPS_SMP_startCPU1(Render_Worker, NULL) == HPS_SMP_SUCCESS )
+	{
+		exitOnFail( Graphics_Pipeline_setWorker(true), GP_SUCCESS);
+	}
+	else																	// The second core did not start, the flush interrupt sends the frames instead.
+#endif
+	{
+		exitOnFail( HPS_IRQ_registerHandler(HPS_Timer_irqID(HPS_TIMER_SP0), Flush_IRQHandler), HPS_IRQ_SUCCESS);
+		exitOnFail( HPS_Timer_startPeriodic(HPS_TIMER_SP0, FLUSH_PERIOD_US), HPS_TIMER_SUCCESS);
+	}
+	exitOnFail( HPS_IRQ_registerHandler(HPS_Timer_irqID(HPS_TIMER_OSC1_0), Tick_IRQHandler), HPS_IRQ_SUCCESS);
+	exitOnFail( HPS_IRQ_registerHandler(IRQ_LSC_GPIO_JP2, Link_IRQHandler), HPS_IRQ_SUCCESS);
+	exitOnFail( Game_enableLinkInterrupt(), LINK_SUCCESS);					// The slave board is no longer busy-polled.
+	HPS_ResetWatchdog();
 			
-	/* Drawing the gaming area. White Border on two sides and grey sides on two sides. Grey Fill. */
-	Graphics_drawBox(10,10,230,310,LT24_WHITE,false,0x39E7); HPS_ResetWatchdog();
-	Graphics_drawLine(10,10,230,10,0x39E7); HPS_ResetWatchdog();
-	Graphics_drawLine(10,310,230,310,0x39E7); HPS_ResetWatchdog();
-
-	/* Line. Drawing a Dashed Net between the two players. */
-	Graphics_drawDash(11,160,229,160,LT24_WHITE); HPS_ResetWatchdog();
+	/* Start in the render mode selected by SW9. */
+	Graphics_setRenderMode( ( *(volatile unsigned int *) 0xFF200040 & RENDER_MODE_SWITCH ) ? GRAPHICS_HALF_RESOLUTION : GRAPHICS_FULL_RESOLUTION );
 	
-	/* Initialize the ball with its starting positions. */
-    Ball_Initialize(); HPS_ResetWatchdog();
+	/* Drawing the gaming area. */
+	Draw_Gaming_Area();
 	
-    /* Initialize the two paddles with their starting positions. */
-    Paddle_1_Initialize(); HPS_ResetWatchdog();
-    Paddle_2_Initialize(); HPS_ResetWatchdog();
+	/* Initialize the ball and the two paddles with their starting positions. */
+    exitOnFail( Game_Initialize(1, COURT_MODE, INPUT_MODE), GAME_SUCCESS); HPS_ResetWatchdog();
+	exitOnFail( Game_setLinkDelay(LINK_DELAY_TICKS), GAME_SUCCESS);
+	exitOnFail( Game_setOpponent(CPU_PADDLE, CPU_LEVEL), GAME_SUCCESS);
+	Game_Render(GAME_ALPHA_ONE); HPS_ResetWatchdog();
+	Graphics_present(); HPS_ResetWatchdog();								// Show the first frame.
+#ifdef RUN_BENCHMARKS
+	exitOnFail( Benchmark_multiBall(BENCHMARK_FRAMES), BENCHMARK_SUCCESS);
+	Graphics_clearScreen(LT24_BLACK);
+	Draw_Gaming_Area();
+	Game_forceRedraw();
+#endif
 	
 	/* The seven-segment display is used to display player scores and the word Pong. */
-	Display_Seven_Segment(1,0);
-	Display_Seven_Segment(2,16);
-	Display_Seven_Segment(3,16);
-	Display_Seven_Segment(4,16);
-	Display_Seven_Segment(5,16);
-	Display_Seven_Segment(6,0);
+	SevenSeg_initialise();
+	Game_showScores();
 	HPS_ResetWatchdog();
 	
+	/* Start the game ticks. */
+	exitOnFail( HPS_Timer_startPeriodic(HPS_TIMER_OSC1_0, GAME_TICK_US), HPS_TIMER_SUCCESS);
+	
 	/* Infinite Loop. */
 	while (1)
 	{	
-		slave_board_data = *GPIO_ptr & 0xFFFFFFF0;							// Keep storing the data from the slave board as it can stop and start the game.
+		Game_pollLink();													// Keep reading the slave board as it can stop and start the game.
 	
-		while ( slave_board_data == 0 ) 									// If the slave board data is 0, then the game should be paused. 
+		while ( !Game_isSlavePlaying() && INPUT_MODE != GAME_INPUT_REPLAY )	// In the stop mode of the slave board the game is paused. A replay plays the recorded inputs instead.
 		{
-			slave_board_data = *GPIO_ptr & 0xFFFFFFF0;						// Keep checking for new data from the slave board that can change from stop mode to start mode and vice-versa.
+			Game_pollLink();												// Keep checking for the slave board changing from stop mode to start mode.
+			Game_discardPendingTicks();										// Time does not pass in the game while it is paused.
 			HPS_ResetWatchdog();
+			__wfi();														// Sleep until the link interrupt brings the start mode, or the next tick.
 		}
 		
-		Move_Ball();														// If start mode, then keep moving the ball around the gaming area.
-		Move_Paddle_1();													// Move paddle 1 continuously in the start mode based on the user input.
-		Move_Paddle_2();													// Move paddle 2 continuously in the start mode based on the user input.
+		Update_Render_Mode();												// Follow SW9 between full and half resolution rendering.
+		frame_start = HPS_Timer_timestamp();
+#ifdef REPLAY_UNTHROTTLED
+		Game_runTicks(REPLAY_TICKS_PER_FRAME);								// Play the replay as fast as the frames can be drawn.
+#else
+		Game_runPendingTicks();												// Move the ball and the paddles by the ticks raised since the last frame.
+#endif
+		Game_Render(Game_tickFraction());									// Draw as fast as the frames can be sent, between the last two ticks.
+		Graphics_present();													// Hand the finished frame over to the render worker or the flush interrupt.
+		if ( !Game_isReplayDone() ) replay_time += HPS_Timer_timestamp() - frame_start;
+		Report_Replay(replay_time);
 		HPS_ResetWatchdog();												// Reset the watch dog timer.
 	} 
 }
@@ -0,0 +1,414 @@
+/*
+ * DE1-SoC Board-to-Board Link Driver
+ * ------------------------------
+ * Description:
+ * Packet protocol between the slave and the master board over the
+ * JP2 parallel port (GPIO 1).
+ *
+ * Company: University of Leeds
+ * Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *
+ */
+
+#include "DE1SoC_Link.h"
+
+//Steps of sending a byte
+#define TX_IDLE  0                    //Acknowledge matches strobe, the next byte can go on the data lines
+#define TX_SETUP 1                    //Data is on the lines, strobe goes next so the data settles first
+#define TX_WAIT  2                    //Strobe toggled, waiting for the acknowledge
+#define TX_WAIT_BULK 3                //Bulk beat and strobe stored together, waiting for the acknowledge
+
+//Fields of a packet being received
+#define RX_HUNT     0
+#define RX_TYPE     1
+#define RX_SEQUENCE 2
+#define RX_LENGTH   3
+#define RX_PAYLOAD  4
+#define RX_CRC_HIGH 5
+#define RX_CRC_LOW  6
+
+//The two channels of the port
+const Link_Channel link_control = { LINK_STROBE, LINK_ACK, LINK_DATA_SHIFT, 8, LINK_BULK_DATA };
+const Link_Channel link_mirror = { LINK_MIRROR_STROBE, LINK_MIRROR_ACK, LINK_MIRROR_DATA_SHIFT, LINK_MIRROR_DATA_BITS, 0 };
+
+//CRC-16 (CCITT) four bits at a time
+const unsigned short link_crc_table [16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+//CRC-16 (CCITT) of a block of bytes, continuing from crc (0xFFFF to start)
+unsigned short Link_crc(unsigned short crc, const unsigned char* bytes, unsigned int length) {
+    while (length--) {
+        crc = (crc << 4) ^ link_crc_table[(crc >> 12) ^ (*bytes >> 4)];
+        crc = (crc << 4) ^ link_crc_table[(crc >> 12) ^ (*bytes & 0xF)];
+        bytes++;
+    }
+    return crc;
+}
+
+//Data lines of a symbol of a channel, from data_shift up
+#define LINK_SYMBOL_MASK(channel) ((1u << (channel)->data_bits) - 1)
+
+//Reset the state of both sides of an end on a channel
+static void Link_reset(Link* link, const Link_Channel* channel, bool sender) {
+    link->channel = channel;
+    link->sender = sender;
+    if (sender) {
+        link->outputs = channel->strobe | (channel->bulk ? channel->bulk : LINK_SYMBOL_MASK(channel) << channel->data_shift);
+    } else {
+        link->outputs = channel->ack;
+    }
+    link->symbols = (8 + channel->data_bits - 1) / channel->data_bits;
+    link->lines = 0;
+    *link->out &= ~link->outputs;
+    link->tx_head = 0;
+    link->tx_tail = 0;
+    link->tx_phase = TX_IDLE;
+    link->tx_sequence = 0;
+    link->tx_symbol = 0;
+    link->tx_bulk_pending = false;
+    link->tx_bulk_active = false;
+    link->rx_state = RX_HUNT;
+    link->rx_byte = 0;
+    link->rx_symbol = 0;
+    link->rx_unsynced = 0;
+    link->rx_head = 0;
+    link->rx_tail = 0;
+    link->rx_synced = false;
+    link->rx_bulk = 0;
+    link->rx_bulk_capacity = 0;
+    link->rx_bulk_ready = 0;
+    link->rx_bulk_active = false;
+    link->stats.bytes = 0;
+    link->stats.packets = 0;
+    link->stats.crc_errors = 0;
+    link->stats.lost = 0;
+    link->stats.overruns = 0;
+    link->stats.bulk_blocks = 0;
+    link->stats.bulk_errors = 0;
+}
+
+//Initialise one end of a channel of the link on the parallel port at port_address
+signed int Link_initialise(Link* link, unsigned int port_address, const Link_Channel* channel, bool sender) {
+    volatile unsigned int* port = (unsigned int *)(unsigned long)port_address;
+    unsigned int lines = channel->strobe | channel->ack | (channel->bulk ? channel->bulk : LINK_SYMBOL_MASK(channel) << channel->data_shift);
+    link->in = port;
+    link->out = port;
+    link->port = port;
+    Link_reset(link, channel, sender);
+    port[1] = (port[1] & ~lines) | link->outputs;
+    return LINK_SUCCESS;
+}
+
+//Initialise one end of a channel on two plain words, for a loopback on a PC
+void Link_initialiseLoopback(Link* link, volatile unsigned int* in, volatile unsigned int* out, const Link_Channel* channel, bool sender) {
+    link->in = in;
+    link->out = out;
+    link->port = 0;
+    Link_reset(link, channel, sender);
+}
+
+//Raise the interrupt of the port when the line driven by the other end changes
+signed int Link_setInterrupt(Link* link, bool enable) {
+    unsigned int line = link->sender ? link->channel->ack : link->channel->strobe;
+    if (!link->port) return LINK_NOPORT;
+    link->port[3] = line;                                        //Forget the edges seen so far
+    link->port[2] = enable ? (link->port[2] | line) : (link->port[2] & ~line);
+    return LINK_SUCCESS;
+}
+
+//Clear the edges captured on the port
+void Link_acknowledgeInterrupt(Link* link) {
+    if (link->port) link->port[3] = link->sender ? link->channel->ack : link->channel->strobe;
+}
+
+//Queue a packet to be sent
+signed int Link_send(Link* link, unsigned char type, const unsigned char* payload, unsigned int length) {
+    unsigned char header [3];
+    unsigned short crc;
+    unsigned int head = link->tx_head;
+    unsigned int index;
+    if (length > LINK_MAX_PAYLOAD) return LINK_INVALIDLENGTH;
+    if (LINK_TX_BYTES - (head - link->tx_tail) < length + LINK_OVERHEAD) return LINK_BUSY;
+    header[0] = type;
+    header[1] = link->tx_sequence++;
+    header[2] = (unsigned char)length;
+    crc = Link_crc(Link_crc(0xFFFF, header, 3), payload, length);
+    link->tx[head++ & (LINK_TX_BYTES - 1)] = LINK_SYNC;
+    for (index = 0; index < 3; index++) link->tx[head++ & (LINK_TX_BYTES - 1)] = header[index];
+    for (index = 0; index < length; index++) link->tx[head++ & (LINK_TX_BYTES - 1)] = payload[index];
+    link->tx[head++ & (LINK_TX_BYTES - 1)] = (unsigned char)(crc >> 8);
+    link->tx[head++ & (LINK_TX_BYTES - 1)] = (unsigned char)crc;
+    LINK_BARRIER();                                              //The bytes are in place before the handler can see them
+    link->tx_head = head;
+    return LINK_SUCCESS;
+}
+
+//Queue a bulk block of count words to be sent after the packets already queued
+signed int Link_sendBulk(Link* link, const unsigned int* words, unsigned int count) {
+    unsigned char header [2];
+    signed int status;
+    if (!link->channel->bulk) return LINK_NOBULK;
+    if ((count == 0) || (count > LINK_MAX_BULK)) return LINK_INVALIDLENGTH;
+    if (link->tx_bulk_pending || link->tx_bulk_active) return LINK_BUSY;
+    header[0] = (unsigned char)count;
+    header[1] = (unsigned char)(count >> 8);
+    status = Link_send(link, LINK_MSG_BULK, header, 2);
+    if (status != LINK_SUCCESS) return status;
+    link->tx_bulk = words;
+    link->tx_bulk_bytes = count * 4;
+    link->tx_bulk_beats = (count * 4 + 2) / 3;
+    link->tx_bulk_beat = 0;
+    link->tx_bulk_start = link->tx_head;
+    link->tx_bulk_crc = 0xFFFF;
+    link->tx_bulk_pending = true;
+    return LINK_SUCCESS;
+}
+
+//Check if everything queued has been sent
+bool Link_isIdle(Link* link) {
+    return (link->tx_head == link->tx_tail) && !link->tx_bulk_pending && !link->tx_bulk_active;
+}
+
+//Byte index of a block of words, lowest byte of each word first
+#define LINK_BULK_BYTE(words, index) ((unsigned char)((words)[(index) >> 2] >> (((index) & 3) * 8)))
+
+//Lines of the next beat of the bulk block being sent: three bytes of the block, or the CRC after the last one
+static unsigned int Link_nextBeat(Link* link) {
+    unsigned int beat = 0;
+    unsigned int index = link->tx_bulk_beat * 3;
+    unsigned int byte;
+    unsigned char value;
+    if (link->tx_bulk_beat == link->tx_bulk_beats) {
+        return ((unsigned int)(link->tx_bulk_crc >> 8) | ((unsigned int)(link->tx_bulk_crc & 0xFF) << 8)) << link->channel->data_shift;
+    }
+    for (byte = 0; (byte < 3) && (index + byte < link->tx_bulk_bytes); byte++) {
+        value = LINK_BULK_BYTE(link->tx_bulk, index + byte);
+        link->tx_bulk_crc = Link_crc(link->tx_bulk_crc, &value, 1);
+        beat |= (unsigned int)value << (byte * 8);
+    }
+    return beat << link->channel->data_shift;
+}
+
+//Take a bulk beat: three bytes of the block, or the CRC after the last one
+static void Link_parseBeat(Link* link, unsigned int beat) {
+    unsigned int byte;
+    unsigned int index;
+    unsigned char value;
+    unsigned int words = link->rx_bulk_bytes / 4;
+    if (link->rx_bulk_index == link->rx_bulk_bytes) {
+        link->rx_bulk_active = false;
+        if ((((beat & 0xFF) << 8) | ((beat >> 8) & 0xFF)) != link->rx_bulk_crc) {
+            link->stats.bulk_errors++;
+        } else if (words > link->rx_bulk_capacity) {
+            link->stats.overruns++;
+        } else {
+            link->stats.bulk_blocks++;
+            link->rx_bulk_ready = words;
+        }
+        return;
+    }
+    for (byte = 0; (byte < 3) && (link->rx_bulk_index < link->rx_bulk_bytes); byte++) {
+        index = link->rx_bulk_index++;
+        value = (unsigned char)(beat >> (byte * 8));
+        link->rx_bulk_crc = Link_crc(link->rx_bulk_crc, &value, 1);
+        if ((index >> 2) < link->rx_bulk_capacity) {
+            if ((index & 3) == 0) link->rx_bulk[index >> 2] = 0;
+            link->rx_bulk[index >> 2] |= (unsigned int)value << ((index & 3) * 8);
+        }
+    }
+}
+
+//Drive the lines of this end. The other channel may share the register, its lines are written back as they are.
+static void Link_drive(Link* link, unsigned int lines) {
+    link->lines = lines;
+    *link->out = (*link->out & ~link->outputs) | lines;
+}
+
+//Take a good packet: count the missing sequence numbers and queue it
+static void Link_accept(Link* link) {
+    if (link->rx_synced) link->stats.lost += (unsigned char)(link->rx_packet.sequence - link->rx_sequence);
+    link->rx_synced = true;
+    link->rx_unsynced = 0;
+    link->rx_sequence = link->rx_packet.sequence + 1;
+    link->stats.packets++;
+    if ((link->rx_packet.type == LINK_MSG_BULK) && (link->rx_packet.length == 2) && link->channel->bulk) {
+        //The block follows in bulk beats
+        link->rx_bulk_bytes = (link->rx_packet.payload[0] | (link->rx_packet.payload[1] << 8)) * 4;
+        link->rx_bulk_index = 0;
+        link->rx_bulk_crc = 0xFFFF;
+        link->rx_bulk_active = (link->rx_bulk_bytes != 0);
+        return;
+    }
+    if (link->rx_head - link->rx_tail >= LINK_RX_PACKETS) {
+        link->stats.overruns++;
+        return;
+    }
+    link->rx_queue[link->rx_head++ % LINK_RX_PACKETS] = link->rx_packet;
+}
+
+//Feed a received byte to the packet being put together
+static void Link_parse(Link* link, unsigned char byte) {
+    Link_Packet* packet = &link->rx_packet;
+    switch (link->rx_state) {
+        case RX_HUNT:
+            if (byte == LINK_SYNC) link->rx_state = RX_TYPE;
+            return;
+        case RX_TYPE:
+            packet->type = byte;
+            link->rx_crc = Link_crc(0xFFFF, &byte, 1);
+            link->rx_state = RX_SEQUENCE;
+            return;
+        case RX_SEQUENCE:
+            packet->sequence = byte;
+            link->rx_crc = Link_crc(link->rx_crc, &byte, 1);
+            link->rx_state = RX_LENGTH;
+            return;
+        case RX_LENGTH:
+            if (byte > LINK_MAX_PAYLOAD) {
+                link->stats.crc_errors++;
+                link->rx_state = RX_HUNT;
+                return;
+            }
+            packet->length = byte;
+            link->rx_crc = Link_crc(link->rx_crc, &byte, 1);
+            link->rx_index = 0;
+            link->rx_state = byte ? RX_PAYLOAD : RX_CRC_HIGH;
+            return;
+        case RX_PAYLOAD:
+            packet->payload[link->rx_index++] = byte;
+            link->rx_crc = Link_crc(link->rx_crc, &byte, 1);
+            if (link->rx_index == packet->length) link->rx_state = RX_CRC_HIGH;
+            return;
+        case RX_CRC_HIGH:
+            link->rx_crc_received = (unsigned short)(byte << 8);
+            link->rx_state = RX_CRC_LOW;
+            return;
+        default:
+            if ((link->rx_crc_received | byte) == link->rx_crc) {
+                Link_accept(link);
+            } else {
+                link->stats.crc_errors++;
+            }
+            link->rx_state = RX_HUNT;
+            return;
+    }
+}
+
+//One step of the sender. Returns the number of bytes taken by the receiver: 1, 3 for a bulk beat, or 0.
+static unsigned int Link_stepSender(Link* link) {
+    const Link_Channel* channel = link->channel;
+    bool strobe = (link->lines & channel->strobe) != 0;
+    bool ack = (*link->in & channel->ack) != 0;
+    unsigned int symbol;
+    switch (link->tx_phase) {
+        case TX_IDLE:
+            if (link->tx_bulk_pending && (link->tx_tail == link->tx_bulk_start)) {
+                link->tx_bulk_pending = false;
+                link->tx_bulk_active = true;
+            }
+            if (link->tx_bulk_active) {
+                //Data and strobe in one store: the receiver reads twice to see the lines settled
+                Link_drive(link, ((link->lines & ~channel->bulk) | Link_nextBeat(link)) ^ channel->strobe);
+                link->tx_phase = TX_WAIT_BULK;
+                return 0;
+            }
+            if (link->tx_head == link->tx_tail) return 0;
+            symbol = (link->tx[link->tx_tail & (LINK_TX_BYTES - 1)] >> (link->tx_symbol * channel->data_bits)) & LINK_SYMBOL_MASK(channel);
+            Link_drive(link, (link->lines & ~(LINK_SYMBOL_MASK(channel) << channel->data_shift)) | (symbol << channel->data_shift));
+            link->tx_phase = TX_SETUP;
+            return 0;
+        case TX_SETUP:
+            Link_drive(link, link->lines ^ channel->strobe);
+            link->tx_phase = TX_WAIT;
+            return 0;
+        case TX_WAIT_BULK:
+            if (ack != strobe) return 0;
+            if (link->tx_bulk_beat++ == link->tx_bulk_beats) link->tx_bulk_active = false;  //The CRC beat was taken
+            link->tx_phase = TX_IDLE;
+            link->stats.bytes += 3;
+            return 3;
+        default:
+            if (ack != strobe) return 0;
+            link->tx_phase = TX_IDLE;
+            if (++link->tx_symbol < link->symbols) return 0;
+            link->tx_symbol = 0;
+            link->tx_tail++;
+            link->stats.bytes++;
+            return 1;
+    }
+}
+
+//One step of the receiver. Returns the number of bytes taken: 1, 3 for a bulk beat, or 0.
+static unsigned int Link_stepReceiver(Link* link) {
+    const Link_Channel* channel = link->channel;
+    unsigned int first = *link->in;
+    unsigned int second;
+    unsigned int byte;
+    bool ack = (link->lines & channel->ack) != 0;
+    if (((first & channel->strobe) != 0) == ack) return 0;       //Nothing new
+    second = *link->in;
+    if (second != first) return 0;                               //Lines still changing, look again next step
+    Link_drive(link, link->lines ^ channel->ack);
+    if (link->rx_bulk_active) {
+        Link_parseBeat(link, (first & channel->bulk) >> channel->data_shift);
+        link->stats.bytes += 3;
+        return 3;
+    }
+    link->rx_byte |= ((first >> channel->data_shift) & LINK_SYMBOL_MASK(channel)) << (link->rx_symbol * channel->data_bits);
+    if (++link->rx_symbol < link->symbols) return 0;
+    byte = link->rx_byte;
+    link->rx_byte = 0;
+    link->rx_symbol = 0;
+    Link_parse(link, (unsigned char)byte);
+    if ((link->symbols > 1) && (++link->rx_unsynced > LINK_SLIP_BYTES)) {
+        //No good packet for too long: the bytes may be put together across two. The next symbol ends a byte on its own,
+        // so the next byte starts one symbol later, and every alignment is tried in turn.
+        link->rx_unsynced = 0;
+        link->rx_symbol = link->symbols - 1;
+    }
+    link->stats.bytes++;
+    return 1;
+}
+
+//Move the handshake on by up to polls steps
+unsigned int Link_poll(Link* link, unsigned int polls) {
+    unsigned int bytes = 0;
+    while (polls--) {
+        bytes += link->sender ? Link_stepSender(link) : Link_stepReceiver(link);
+    }
+    return bytes;
+}
+
+//Take the oldest packet received
+bool Link_receive(Link* link, Link_Packet* packet) {
+    if (link->rx_head == link->rx_tail) return false;
+    *packet = link->rx_queue[link->rx_tail++ % LINK_RX_PACKETS];
+    return true;
+}
+
+//Give the receiver a buffer for bulk blocks of up to capacity words
+void Link_setBulkBuffer(Link* link, unsigned int* words, unsigned int capacity) {
+    link->rx_bulk = words;
+    link->rx_bulk_capacity = words ? capacity : 0;
+}
+
+//Check for a bulk block
+unsigned int Link_receiveBulk(Link* link) {
+    unsigned int words = link->rx_bulk_ready;
+    link->rx_bulk_ready = 0;
+    return words;
+}
+
+//Word index of test block number block, for checking the link from both ends
+unsigned int Link_testWord(unsigned int block, unsigned int index) {
+    unsigned int word = (block * 0x9E3779B9u) ^ (index * 0x85EBCA6Bu);
+    if (index == 0) return block;
+    return word ^ (word >> 15);
+}
+
+//Read the counts of the link
+void Link_getStats(Link* link, Link_Stats* stats) {
+    *stats = link->stats;
+}
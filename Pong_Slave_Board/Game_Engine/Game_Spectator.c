@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Spectator View of PONG on the Slave Board.
+ *  ----------------------------------------
+ *  File Name     : Game_Spectator.c
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Keeps the view of the match sent by the master board and draws the
+ *  	changes with the graphics engine of the slave board.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#include "Game_Spectator.h"													// Invoking the main header file.
+#include "../Graphics_Engine/Graphics_Engine.h"								// Importing the Graphics Engine driver library.
+#include "../DE1Soc_LT24/DE1SoC_LT24.h"	 									// Importing the Leeds SoC LT24 driver controller.
+#include "../HPS_Watchdog/HPS_Watchdog.h"									// Importing the Watch dog timer driver controller.
+
+/* Colours of the balls, as on the master board. */
+static const unsigned short spectator_ball_colours [8] = { LT24_WHITE, LT24_YELLOW, LT24_CYAN, LT24_MAGENTA, LT24_GREEN, LT24_RED, 0xFD20, 0x07FF };
+
+/* The view of the match, and the link sequence number of the next mirror packet. */
+Game_MirrorView spectator_view;
+bool spectator_changed = false;												// The view changed since it was last drawn.
+bool spectator_synced = false;												// A mirror packet has been received.
+unsigned char spectator_sequence;
+
+/* What is on the screen. */
+bool spectator_shown = false;												// False while the menu is on the screen.
+bool spectator_court_drawn = false;
+unsigned int spectator_drawn_state;
+unsigned int spectator_drawn_ball_count;
+unsigned int spectator_drawn_ball_x [MIRROR_BALLS];
+unsigned int spectator_drawn_ball_y [MIRROR_BALLS];
+unsigned int spectator_drawn_paddle_x [2];
+bool spectator_paddles_drawn;
+unsigned int spectator_drawn_score [2];
+
+/* Internal function to draw the dashed net, as Graphics_drawDash() on the master board. */
+void Spectator_Net ( void )
+{
+	unsigned int x;
+
+	for ( x = 12; x < 224; x += 10 ) Graphics_drawLine ( x, SPECTATOR_NET_Y, x + 5, SPECTATOR_NET_Y, LT24_WHITE );
+}
+
+/* Internal function to clear the screen and draw the empty court. */
+void Spectator_Court ( void )
+{
+	Graphics_drawBox ( 0, 0, LT24_WIDTH - 1, LT24_HEIGHT - 1, LT24_BLACK, false, LT24_BLACK ); ResetWDT();
+	Graphics_drawBox ( 10, 10, 230, 310, LT24_WHITE, false, SPECTATOR_BACKGROUND_GREY ); ResetWDT();
+	Graphics_drawLine ( 10, 10, 230, 10, SPECTATOR_BACKGROUND_GREY );			// The goal lines are open.
+	Graphics_drawLine ( 10, 310, 230, 310, SPECTATOR_BACKGROUND_GREY );
+	Spectator_Net();
+
+	spectator_court_drawn = true;
+	spectator_drawn_state = MIRROR_STATE_PLAYING;
+	spectator_drawn_ball_count = 0;
+	spectator_paddles_drawn = false;
+	spectator_drawn_score[0] = 0xFF;											// No points drawn yet.
+	spectator_drawn_score[1] = 0xFF;
+}
+
+/* Internal function to draw the points of a player. */
+void Spectator_Points ( unsigned int player, unsigned int score )
+{
+	unsigned int point;
+	unsigned int y;
+
+	for ( point = 0; point < SPECTATOR_POINTS; point++ )
+	{
+		if ( player == 0 ) y = SPECTATOR_NET_Y - ( point + 1 ) * SPECTATOR_POINT_STEP;
+		else               y = SPECTATOR_NET_Y + SPECTATOR_POINT_STEP - SPECTATOR_POINT_SIZE + point * SPECTATOR_POINT_STEP;
+		Graphics_drawBox ( SPECTATOR_POINT_X, y, SPECTATOR_POINT_X + SPECTATOR_POINT_SIZE - 1, y + SPECTATOR_POINT_SIZE - 1,
+						   LT24_WHITE, false, ( point < score ) ? LT24_WHITE : LT24_BLACK );
+	}
+	spectator_drawn_score[player] = score;
+}
+
+/* Internal function to draw the boxes of the last point, green on the side of the player who won it and red on the other. */
+void Spectator_PointBoxes ( unsigned int last_point_player, bool shown )
+{
+	unsigned short top = shown ? ( ( last_point_player == 1 ) ? LT24_GREEN : LT24_RED ) : SPECTATOR_BACKGROUND_GREY;
+	unsigned short bottom = shown ? ( ( last_point_player == 1 ) ? LT24_RED : LT24_GREEN ) : SPECTATOR_BACKGROUND_GREY;
+
+	Graphics_drawBox ( 115, 75, 125, 85, top, false, top );
+	Graphics_drawBox ( 115, 235, 125, 245, bottom, false, bottom );
+}
+
+/* Internal function to draw the winner screen: the half of the winner green and the other red. */
+void Spectator_Winner ( unsigned int player )
+{
+	unsigned short top = ( player == 1 ) ? LT24_GREEN : LT24_RED;
+	unsigned short bottom = ( player == 1 ) ? LT24_RED : LT24_GREEN;
+
+	if ( spectator_paddles_drawn )
+	{
+		Graphics_drawBox ( spectator_drawn_paddle_x[0], SPECTATOR_PADDLE_1_Y, spectator_drawn_paddle_x[0] + SPECTATOR_PADDLE_LENGTH, SPECTATOR_PADDLE_1_Y + SPECTATOR_PADDLE_WIDTH, LT24_BLACK, false, LT24_BLACK );
+		Graphics_drawBox ( spectator_drawn_paddle_x[1], SPECTATOR_PADDLE_2_Y, spectator_drawn_paddle_x[1] + SPECTATOR_PADDLE_LENGTH, SPECTATOR_PADDLE_2_Y + SPECTATOR_PADDLE_WIDTH, LT24_BLACK, false, LT24_BLACK );
+	}
+	Graphics_drawBox ( 10, 10, 230, SPECTATOR_NET_Y, LT24_BLACK, false, top ); ResetWDT();
+	Graphics_drawBox ( 10, SPECTATOR_NET_Y, 230, 310, LT24_BLACK, false, bottom ); ResetWDT();
+
+	spectator_drawn_ball_count = 0;
+	spectator_paddles_drawn = false;
+}
+
+/* Internal function to erase the balls that moved or left play, then draw the balls in play, as Render_Balls() on the master board. */
+void Spectator_Balls ( void )
+{
+	unsigned int count = ( spectator_view.state == MIRROR_STATE_PLAYING ) ? spectator_view.ball_count : 0;
+	unsigned int ball;
+	unsigned int x;
+	unsigned int y;
+	bool net_touched = false;
+
+	for ( ball = 0; ball < spectator_drawn_ball_count; ball++ )
+	{
+		x = spectator_drawn_ball_x[ball];
+		y = spectator_drawn_ball_y[ball];
+		if ( ball >= count || x != spectator_view.ball_x[ball] || y != spectator_view.ball_y[ball] )
+		{
+			Graphics_drawBox ( x, y, x + SPECTATOR_BALL_SIZE - 1, y + SPECTATOR_BALL_SIZE - 1, SPECTATOR_BACKGROUND_GREY, false, SPECTATOR_BACKGROUND_GREY );
+			if ( y + SPECTATOR_BALL_SIZE > SPECTATOR_NET_Y && y <= SPECTATOR_NET_Y ) net_touched = true;
+		}
+	}
+	if ( net_touched ) Spectator_Net();
+
+	for ( ball = 0; ball < count; ball++ )
+	{
+		x = spectator_view.ball_x[ball];
+		y = spectator_view.ball_y[ball];
+		Graphics_drawBox ( x, y, x + SPECTATOR_BALL_SIZE - 1, y + SPECTATOR_BALL_SIZE - 1, spectator_ball_colours[ball % 8], false, spectator_ball_colours[ball % 8] );
+		spectator_drawn_ball_x[ball] = x;
+		spectator_drawn_ball_y[ball] = y;
+	}
+	spectator_drawn_ball_count = count;
+}
+
+/* Internal function to draw the paddles that moved. */
+void Spectator_Paddles ( void )
+{
+	static const unsigned int paddle_y [2] = { SPECTATOR_PADDLE_1_Y, SPECTATOR_PADDLE_2_Y };
+	unsigned int paddle;
+	unsigned int x;
+
+	for ( paddle = 0; paddle < 2; paddle++ )
+	{
+		x = spectator_view.paddle_x[paddle];
+		if ( spectator_paddles_drawn && x == spectator_drawn_paddle_x[paddle] ) continue;
+
+		if ( spectator_paddles_drawn )
+		{
+			Graphics_drawBox ( spectator_drawn_paddle_x[paddle], paddle_y[paddle], spectator_drawn_paddle_x[paddle] + SPECTATOR_PADDLE_LENGTH,
+							   paddle_y[paddle] + SPECTATOR_PADDLE_WIDTH, LT24_BLACK, false, LT24_BLACK );
+		}
+		Graphics_drawBox ( x, paddle_y[paddle], x + SPECTATOR_PADDLE_LENGTH, paddle_y[paddle] + SPECTATOR_PADDLE_WIDTH, LT24_WHITE, false, LT24_WHITE );
+		spectator_drawn_paddle_x[paddle] = x;
+	}
+	spectator_paddles_drawn = true;
+}
+
+/* Function to start watching: nothing is drawn until the match is shown and a keyframe arrives. */
+void Game_Spectator_initialise ( void )
+{
+	spectator_view.valid = false;
+	spectator_changed = false;
+	spectator_synced = false;
+	spectator_shown = false;
+	spectator_court_drawn = false;
+}
+
+/* Function to hide the match while the menu is drawn on the screen, or to show it again. */
+void Game_Spectator_show ( bool shown )
+{
+	if ( shown && !spectator_shown )
+	{
+		spectator_court_drawn = false;										// The menu is over the court, it is all drawn again.
+		spectator_changed = true;
+	}
+	spectator_shown = shown;
+}
+
+/* Function to take the mirror packets received on a link. */
+void Game_Spectator_receive ( Link *link )
+{
+	Link_Packet packet;
+
+	while ( Link_receive ( link, &packet ) )
+	{
+		if ( packet.type != LINK_MSG_MIRROR ) continue;
+
+		/* The changes are from the packet before, once one is lost they are from a view the spectator does not have. */
+		if ( spectator_synced && packet.sequence != spectator_sequence ) spectator_view.valid = false;
+		spectator_synced = true;
+		spectator_sequence = packet.sequence + 1;
+
+		if ( Game_Mirror_decode ( &spectator_view, packet.payload, packet.length ) ) spectator_changed = true;
+	}
+}
+
+/* Function to check whether a match is being shown. */
+bool Game_Spectator_isWatching ( void )
+{
+	return spectator_court_drawn;
+}
+
+/* Function to draw what changed in the view since the last call. */
+signed int Game_Spectator_render ( void )
+{
+	unsigned int player;
+
+	if ( !spectator_shown || !spectator_changed || !spectator_view.valid ) return GAME_SPECTATOR_SUCCESS;
+	spectator_changed = false;
+
+	if ( !spectator_court_drawn || ( spectator_drawn_state == MIRROR_STATE_OVER && spectator_view.state != MIRROR_STATE_OVER ) ) Spectator_Court();
+
+	if ( spectator_view.state == MIRROR_STATE_OVER )
+	{
+		if ( spectator_drawn_state != MIRROR_STATE_OVER ) Spectator_Winner ( spectator_view.last_point_player );
+		spectator_drawn_state = MIRROR_STATE_OVER;
+		return GAME_SPECTATOR_SUCCESS;
+	}
+
+	if ( spectator_view.state != spectator_drawn_state )
+	{
+		if ( spectator_view.state == MIRROR_STATE_SCORED ) Spectator_Balls();	// Remove the ball that went past the paddle before the boxes go up.
+		Spectator_PointBoxes ( spectator_view.last_point_player, spectator_view.state == MIRROR_STATE_SCORED );
+		spectator_drawn_state = spectator_view.state;
+	}
+
+	Spectator_Balls();
+	Spectator_Paddles();
+	for ( player = 0; player < 2; player++ )
+	{
+		if ( spectator_view.score[player] != spectator_drawn_score[player] ) Spectator_Points ( player, spectator_view.score[player] );
+	}
+	ResetWDT();
+
+	return GAME_SPECTATOR_SUCCESS;
+}
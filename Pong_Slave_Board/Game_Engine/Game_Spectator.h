@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////
+/*
+ *  Spectator View of PONG on the Slave Board.
+ *  ----------------------------------------
+ *  File Name     : Game_Spectator.h
+ *  Target Device : ARM Cortex-A9 processor
+ *
+ *  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+ *  Location 	  : University of Leeds
+ *  Module 		  : ELEC5620M Embedded Microprocessor System Design
+ *
+ *  Description of the file:
+ *  	Draws the match played on the master board on the LT24 of the slave
+ *  	board, from the view the master sends on the mirror channel of the
+ *  	link. The court, the paddles and the balls are laid out as on the
+ *  	master board, and the scores are shown as a column of points next to
+ *  	each half of the court. Only what changed is drawn again.
+ *  	The match is hidden while the menu is on the screen. Once it is
+ *  	shown, the court is drawn over the menu with the next view.
+ */
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAME_SPECTATOR_H_
+#define GAME_SPECTATOR_H_
+
+/* Importing the required libraries. */
+/* Boolean variable type "bool" and "true"/"false" constants. */
+#include <stdbool.h>
+#include "../DE1SoC_Link/DE1SoC_Link.h"
+#include "Game_Mirror.h"
+
+/* Error Codes*/
+#define GAME_SPECTATOR_SUCCESS    0
+
+/* The court, as on the master board. */
+#define SPECTATOR_BACKGROUND_GREY (0x39E7)
+#define SPECTATOR_BALL_SIZE       4
+#define SPECTATOR_PADDLE_LENGTH   40											// PADDLE_LENGTH, the box drawn includes both corners.
+#define SPECTATOR_PADDLE_WIDTH    2
+#define SPECTATOR_PADDLE_1_Y      7
+#define SPECTATOR_PADDLE_2_Y      311
+#define SPECTATOR_NET_Y           160
+
+/* The points of each player, in the column right of the court: player 1 from the net up, player 2 from the net down. */
+#define SPECTATOR_POINTS          10											// WINNING_SCORE.
+#define SPECTATOR_POINT_X         233
+#define SPECTATOR_POINT_SIZE      5
+#define SPECTATOR_POINT_STEP      12
+
+//////////////////////////////////////// DECLARATION OF FUNCTIONS  ///////////////////////////////////////
+
+/* Function to start watching: nothing is drawn until the match is shown and a keyframe arrives. */
+void Game_Spectator_initialise ( void );
+
+/* Function to hide the match while the menu is drawn on the screen, or to show it again. Once shown again, the next
+   render draws the court and the whole view. */
+void Game_Spectator_show ( bool shown );
+
+/* Function to take the mirror packets received on a link. A packet lost on the way leaves the view as it is until the next
+   keyframe. */
+void Game_Spectator_receive ( Link *link );
+
+/* Function to check whether a match is being shown. */
+bool Game_Spectator_isWatching ( void );
+
+/* Function to draw what changed in the view since the last call. */
+signed int Game_Spectator_render ( void );
+
+#endif /* GAME_SPECTATOR_H_ */
@@ -553,4 +553,44 @@ signed int Graphics_drawLetter(unsigned int x1, unsigned int y1, unsigned int x2
 	
 	return 0;
 
+}
+
+/* Function to decode a run-length encoded image straight into an LT24 window with its top-left corner at (x,y). */
+signed int Graphics_drawImageRLE ( const Graphics_RLEImage *image, unsigned int x, unsigned int y )
+{
+	/* Declaring the local variables required for decoding the image */
+	signed int GE_status = 0;												// Status variable to check for errors.
+	
+	const unsigned short *stream = image->data;								// The next word of the encoded stream.
+	const unsigned short *stream_end = image->data + image->length;			// One past the last word of the encoded stream.
+	unsigned int pixels_left = image->width * image->height;				// Number of pixels still to be sent to the window.
+	unsigned int count;														// Number of pixels described by the current token.
+	unsigned short colour;													// Colour of the current run.
+	
+	GE_status = LT24_setWindow ( x, y, image->width, image->height );		// Open a window the size of the image, the display auto-increments within it.
+	if ( GE_status != GE_SUCCESS) return GE_status;							// If there is an error, report it.
+	
+	while ( pixels_left > 0 && stream < stream_end )
+	{
+		count = *stream & GE_RLE_COUNT;										// Number of pixels in this token.
+		if ( count == 0 || count > pixels_left ) return GE_INVALIDIMAGE;	// A token may never run past the end of the image.
+		
+		if ( *stream++ & GE_RLE_RUN_FLAG )									// Run: one colour repeated count times.
+		{
+			if ( stream >= stream_end ) return GE_INVALIDIMAGE;				// The colour of the run is missing.
+			colour = *stream++;
+			pixels_left = pixels_left - count;
+			while ( count-- ) LT24_write ( true, colour );					// Write the run without re-reading memory.
+		}
+		else																// Literal: count raw colours follow the token.
+		{
+			if ( (unsigned int)( stream_end - stream ) < count ) return GE_INVALIDIMAGE;	// The literal is truncated.
+			pixels_left = pixels_left - count;
+			while ( count-- ) LT24_write ( true, *stream++ );				// Copy the literal colours to the display.
+		}
+	}
+	
+	if ( pixels_left != 0 ) return GE_INVALIDIMAGE;							// The stream ended before the window was filled.
+	
+	return GE_SUCCESS;
 }
\ No newline at end of file
@@ -26,6 +26,21 @@
 
 /* Error Codes*/
 #define GE_SUCCESS       0
+#define GE_INVALIDIMAGE -8
+
+/* Run-length encoded RGB565 image, generated by Tools/RLE565_Image_Converter.py.
+   The stream is a sequence of 16-bit tokens:
+       0x8000 | n, colour          -> n copies of colour (run)
+       n, colour_1 ... colour_n    -> n raw colours (literal) */
+#define GE_RLE_RUN_FLAG  0x8000
+#define GE_RLE_COUNT     0x7FFF
+
+typedef struct {
+	unsigned int width;														// Width of the decoded image in pixels.
+	unsigned int height;													// Height of the decoded image in pixels.
+	unsigned int length;													// Number of 16-bit words in the encoded stream.
+	const unsigned short *data;												// The encoded stream.
+} Graphics_RLEImage;
 
 /* Creating a function that returns maximum and minimum of two numbers. */
 #define MAX(number_1, number_2) (((number_1) > (number_2)) ? (number_1) : (number_2))
@@ -60,4 +75,8 @@ unsigned int* Graphics_Engine_Swap_Vertices ( unsigned int point_x, unsigned int
 /* Draw letter on the LCD. */
 signed int Graphics_drawLetter(unsigned int x1, unsigned int y1, unsigned int x2,  unsigned int y2, unsigned int score, unsigned short colour);
 
+/* Function to decode a run-length encoded image straight into an LT24 window with its top-left corner at (x,y).
+   No intermediate frame buffer is used: every run is streamed to the display as it is decoded. */
+signed int Graphics_drawImageRLE ( const Graphics_RLEImage *image, unsigned int x, unsigned int y );
+
 #endif /* GRAPHICS_ENGINE_H_ */
@@ -12,7 +12,9 @@
  *
  *  Description of the file:
  *  	The driver is used to control different aspects of the game such as
- *      read the player's input using the camera and touch screen. 
+ *      read the player's input using the camera and touch screen. Once
+ *      the game is started, the LCD shows the match as the master board
+ *      plays it.
  */
 ////////////////////////////////////////////////////////////////////////////
 
@@ -20,9 +22,11 @@
 #include "DE1SoC_LT24/DE1SoC_LT24.h"										// Importing the LCD library for interfacing with the LT24 terasic LCD.
 #include "HPS_Watchdog/HPS_Watchdog.h"										// Importing the watchdog timer library to ensure the program doesn't stay in an infinite loop.
 #include "HPS_usleep/HPS_usleep.h"											// Importing the sleep library to create instances of time delay.
+#include "DE1SoC_Link/DE1SoC_Link.h"										// Importing the packet link to the master board.
+#include "Game_Engine/Game_Spectator.h"										// Importing the view of the match played on the master board.
 #include <stdlib.h>															// Importing the standard library functions to perform necessary actions.
 #include <time.h>															// Importing the time library so that its values can be used as seed value for generating random numbers.
-#include "pong.h"															// Importing the pong library that has the bit map of the image to be displayed.
+#include "pong.h"															// Importing the pong library that has the compressed bit map of the image to be displayed.
 
 void exitOnFail(signed int status, signed int successStatus)				// Exit on fail sub-routine is used to ensure that the processor doesn't malfunction.
 {
@@ -32,6 +36,75 @@ void exitOnFail(signed int status, signed int successStatus)				// Exit on fail
     }
 }
 
+/* The link to the master board: the control channel to it, and the mirror channel the view of the match comes back on. */
+Link link;
+Link mirror;
+
+/* Define RUN_LINK_BENCHMARK, here and on the master board, to send test blocks in the bulk mode of the link forever
+   instead of playing. */
+//#define RUN_LINK_BENCHMARK
+
+/* Function to send test blocks to the master board forever. */
+void Send_Test_Blocks ( void )
+{
+	static unsigned int words [LINK_TEST_WORDS];
+	unsigned int block = 0;
+	unsigned int index;
+	
+	while (1)
+	{
+		for ( index = 0; index < LINK_TEST_WORDS; index++ ) words[index] = Link_testWord(block, index);
+		Link_sendBulk(&link, words, LINK_TEST_WORDS);
+		while ( !Link_isIdle(&link) )												// The words must be left alone until they are sent.
+		{
+			Link_poll(&link, 64);
+			HPS_ResetWatchdog();
+		}
+		block++;
+	}
+}
+
+/* Function to tell the master board the mode, 0 for stop and 1 for start. Dropped if the link is busy, it is sent again. */
+void Send_Mode ( int mode )
+{
+	unsigned char value = (unsigned char)mode;
+	
+	Link_send(&link, LINK_MSG_MODE, &value, 1);
+}
+
+/* Function to draw the main screen of the game: the image, and the START and STOP halves of the menu. */
+void Draw_Menu ( void )
+{
+	Graphics_drawBox(0,0,LT24_WIDTH-1,LT24_HEIGHT-1,LT24_BLACK,false,LT24_BLACK); ResetWDT();	// Clear the court of the match.
+	exitOnFail( Graphics_drawImageRLE(&pong,10,160), GE_SUCCESS); HPS_ResetWatchdog();
+	
+	Graphics_drawBox(10,10,230,310,LT24_WHITE,true,0x39E7); ResetWDT();
+
+	//START
+	Graphics_drawBox(10,10,120,160,LT24_WHITE,false,LT24_GREEN); ResetWDT();
+	//STOP
+	Graphics_drawBox(120,10,230,160,LT24_WHITE,false,LT24_RED); ResetWDT();
+
+	//S=1
+	Graphics_drawLetter(50,125,80,145,1,LT24_BLACK); ResetWDT();
+	//T=2
+	Graphics_drawLetter(50,100,80,120,2,LT24_BLACK); ResetWDT();
+	//A=3
+	Graphics_drawLetter(50,75,80,95,3,LT24_BLACK); ResetWDT();
+	//R=4
+	Graphics_drawLetter(50,50,80,70,4,LT24_BLACK); ResetWDT();
+	//T=2
+	Graphics_drawLetter(50,25,80,45,2,LT24_BLACK); ResetWDT();
+
+	//S=1
+	Graphics_drawLetter(150,115,180,135,1,LT24_WHITE); ResetWDT();
+	//T=2
+	Graphics_drawLetter(150,90,180,110,2,LT24_WHITE); ResetWDT();
+	//O=5
+	Graphics_drawLetter(150,65,180,85,5,LT24_WHITE); ResetWDT();
+	//P=6
+	Graphics_drawLetter(150,40,180,60,6,LT24_WHITE); ResetWDT();
+}
 
 /* Main Function. */
 int main(void)
@@ -55,7 +128,7 @@ int main(void)
 	/* Touch screen Port Base Address. */
 	volatile unsigned int *TOUCH_SCREEN_ptr  = (unsigned int *) 0xFF200060; 
 	
-	/* The GPIO port is used to communicate between the master board and slave board. */
+	/* The GPIO port is used to read the camera, and to communicate between the master board and slave board. */
 	/* GPIO Port Base Address. */
 	volatile unsigned char *GPIO_ptr  = (unsigned char *) 0xFF200070; 
 	
@@ -72,6 +145,7 @@ int main(void)
 	/* Hold Initial Value, Final Value */
     unsigned int initial_count = 0;
 	unsigned int final_count = 0;
+	unsigned char paddle_value;
 	
 	/* Variable to hold the value of the touch screen. */
 	/* Touch screen value. */
@@ -83,46 +157,21 @@ int main(void)
   	
 	/* Initialise the LCD Display and exit if not successful. */
     exitOnFail( LT24_initialise(0xFF200060,0xFF200080),  LT24_SUCCESS); HPS_ResetWatchdog();
-	exitOnFail( LT24_copyFrameBuffer(pong,10,160,220,150), LT24_SUCCESS); HPS_ResetWatchdog();
 	
-	//////////////////////////////////////////////////////////////////////////////////////////
-	/////////////////////////  DRAW THE MAIN SCREEN OF THE GAME //////////////////////////////
-	//////////////////////////////////////////////////////////////////////////////////////////
-	
-	Graphics_drawBox(10,10,230,310,LT24_WHITE,true,0x39E7); ResetWDT();
-
-	//START
-	Graphics_drawBox(10,10,120,160,LT24_WHITE,false,LT24_GREEN); ResetWDT();
-	//STOP
-	Graphics_drawBox(120,10,230,160,LT24_WHITE,false,LT24_RED); ResetWDT();
-
-	//S=1
-	Graphics_drawLetter(50,125,80,145,1,LT24_BLACK); ResetWDT();
-	//T=2
-	Graphics_drawLetter(50,100,80,120,2,LT24_BLACK); ResetWDT();
-	//A=3
-	Graphics_drawLetter(50,75,80,95,3,LT24_BLACK); ResetWDT();
-	//R=4
-	Graphics_drawLetter(50,50,80,70,4,LT24_BLACK); ResetWDT();
-	//T=2
-	Graphics_drawLetter(50,25,80,45,2,LT24_BLACK); ResetWDT();
-
-	//S=1
-	Graphics_drawLetter(150,115,180,135,1,LT24_WHITE); ResetWDT();
-	//T=2
-	Graphics_drawLetter(150,90,180,110,2,LT24_WHITE); ResetWDT();
-	//O=5
-	Graphics_drawLetter(150,65,180,85,5,LT24_WHITE); ResetWDT();
-	//P=6
-	Graphics_drawLetter(150,40,180,60,6,LT24_WHITE); ResetWDT();
-	
-	//////////////////////////////////////////////////////////////////////////////
+	/* Draw the main screen of the game. It stays up until the game is started, and comes back whenever it is stopped. */
+	Draw_Menu();
 	
 	/* Loading the timer load with a value. */
 	*private_timer_load = 100000000;
 	
-	/* Setting the first pin as Input and the remaining as output. */
+	/* Setting the first pin as Input and the remaining as output. The link sets the lines driven by the master board as inputs. */
 	*(GPIO_ptr+4)  = 0xFFFFFFFE;
+	exitOnFail( Link_initialise(&link, LINK_PORT_BASE, &link_control, LINK_SENDER), LINK_SUCCESS);
+	exitOnFail( Link_initialise(&mirror, LINK_PORT_BASE, &link_mirror, LINK_RECEIVER), LINK_SUCCESS);
+	Game_Spectator_initialise();
+#ifdef RUN_LINK_BENCHMARK
+	Send_Test_Blocks();
+#endif
     
 	/* Checking if the touch screen has been tapped. */
 	touch_screen_value = *TOUCH_SCREEN_ptr & 0x20000000;
@@ -131,15 +180,18 @@ int main(void)
 	while ( touch_screen_value != 0 )
 	{
 		touch_screen_value = *TOUCH_SCREEN_ptr & 0x20000000;						// Keep monitoring the touch screen for taps.
-		*GPIO_ptr = 0;																// Inform the current mode to the master board.
+		if ( Link_isIdle(&link) ) Send_Mode(mode);									// Keep informing the master board of the current mode.
+		Link_poll(&link, 1);
+		Link_poll(&mirror, 1);
 		HPS_ResetWatchdog();														// Reset the watch dog timer periodically.
 	}
 	
 	/* Mode = start. */
 	mode = mode ^ 0x1; 																// Change mode to start.
 
-	*GPIO_ptr = 0xFF;																// Inform the master board that the mode is start game.
-	usleep(5000);																	// Do nothing for 5 ms so that the master board has received the data.
+	Link_send(&link, LINK_MSG_TOUCH, NULL, 0);
+	Send_Mode(mode);																// Inform the master board that the mode is start game.
+	Game_Spectator_show(true);														// The match is drawn over the menu.
 	
     /* Main Run Loop. */
     while (1) 
@@ -149,9 +201,22 @@ int main(void)
 		{
 			/* Invert the mode. */
 			mode = mode ^ 0x1;														// Change modes to stop or start.
+			Link_send(&link, LINK_MSG_TOUCH, NULL, 0);
+			Send_Mode(mode);
+			Game_Spectator_show(mode == 1);											// The menu is shown while the game is stopped.
+			if ( mode == 0 ) Draw_Menu();
 			usleep(50000);															
 		}	
 		
+		Link_poll(&link, 1);														// Move the packets on to the master board a byte at a time.
+		Link_poll(&mirror, 1);														// And the view of the match back from it.
+		Game_Spectator_receive(&mirror);
+		if ( (*GPIO_ptr & 0x1) == 0 )												// Draw between the pulses of the camera.
+		{
+			Game_Spectator_render();
+			previous_GPIO_value = *GPIO_ptr & 0x1;									// A pulse that rose while drawing is skipped, not measured short.
+		}
+		
 		/* In start mode the slave pong board must communicate with the camera module and retrieve the location of the paddle. */
 		if ( mode == 1 )
 		{
@@ -165,6 +230,8 @@ int main(void)
 				while ( current_GPIO_value == 1 )									
 				{
 					current_GPIO_value = *GPIO_ptr & 0x1;
+					Link_poll(&link, 1);											// The link keeps moving while the pulse is measured.
+					Link_poll(&mirror, 1);
 
 					HPS_ResetWatchdog();
 
@@ -172,7 +239,8 @@ int main(void)
 					{
 						*private_timer_control = (0 << 8) | (0 << 2) | (1 << 1) | (0 << 0);
 						final_count = initial_count - *private_timer_value;
-						*GPIO_ptr = final_count / 100;								// The pulse width conveying the location of the paddle is sent to the master board as 8-bit parallel signal.
+						paddle_value = (unsigned char)( final_count / 100 );
+						Link_send(&link, LINK_MSG_PADDLE, &paddle_value, 1);		// The pulse width conveying the location of the paddle is sent to the master board in a packet.
 						*LED_ptr = final_count / 100;
 						HPS_ResetWatchdog();
 					}
@@ -187,7 +255,7 @@ int main(void)
 		
 		else if ( mode == 0 )														// If the mode is stop notify the master pong board about the same.
 		{
-			*GPIO_ptr = 0x00000000;
+			if ( Link_isIdle(&link) ) Send_Mode(mode);
 		}
 		
 		/* Finally reset the watchdog. */
@@ -1,2079 +1,1539 @@
-// Generated by   : ImageConverter 565 Online
-// Generated from : pong.jpg
-// Time generated : Mon, 13 May 19 01:39:50 +0200  (Server timezone: CET)
+// Generated by   : RLE565_Image_Converter.py
+// Generated from : pong.jpg (via the ImageConverter 565 array)
 // Image Size     : 220x150 pixels
-// Memory usage   : 66000 bytes
+// Memory usage   : 48888 bytes (66000 bytes uncompressed)
 
+#include "Graphics_Engine/Graphics_Engine.h"
 
-#if defined(__AVR__)
-    #include <avr/pgmspace.h>
-#elif defined(__PIC32MX__)
-    #define PROGMEM
-#elif defined(__arm__)
-    #define PROGMEM
-#endif
-
-const unsigned short pong[33000] ={
-0xDEBA, 0xD6BA, 0xDEDA, 0xDEDA, 0xDEDB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5C, 0xE73C, 0xE71C,   // 0x0010 (16) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xE71B, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF3C, 0xEF5D, 0xEF5C, 0xEF7D, 0xEF5D, 0xEF5D, 0xE73C, 0xE6FB,   // 0x0020 (32) pixels
-0xE6FB, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5C, 0xEF7D, 0xEF5C, 0xEF5D, 0xF79E, 0xF79D, 0xEF5C, 0xEF5D,   // 0x0030 (48) pixels
-0xF7BE, 0xF79E, 0xF77D, 0xF79D, 0xFFBE, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0040 (64) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0050 (80) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0060 (96) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0070 (112) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0080 (128) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF,   // 0x0090 (144) pixels
-0xFFFF, 0xFFDE, 0xFFBE, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0xF79D, 0xFFBE, 0xF79D, 0xF79D, 0xF7BE, 0xF7BE, 0xF77D, 0xF79D, 0xEF7D,   // 0x00A0 (160) pixels
-0xF79D, 0xEF7D, 0xE71C, 0xEF7D, 0xEF5D, 0xEF3C, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xE73C, 0xE73C,   // 0x00B0 (176) pixels
-0xE73C, 0xEF3C, 0xEF5C, 0xEF5D, 0xEF5C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xDEFB,   // 0x00C0 (192) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xEF3C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF3C, 0xEF5C, 0xEF5C, 0xEF5D,   // 0x00D0 (208) pixels
-0xEF5D, 0xEF5D, 0xEF5C, 0xE73C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE6FB, 0xE71B, 0xE73C, 0xEF3C,   // 0x00E0 (224) pixels
-0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C,   // 0x00F0 (240) pixels
-0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF7D, 0xEF7D, 0xEF5C, 0xEF5C, 0xE73C, 0xEF5C, 0xEF3C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5C, 0xE73C,   // 0x0100 (256) pixels
-0xEF3C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF3C, 0xEF7D, 0xEF5C, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5C, 0xF79D, 0xFFDE, 0xFFFF, 0xFFDE, 0xEF7D,   // 0x0110 (272) pixels
-0xF79D, 0xF77D, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0120 (288) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0130 (304) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0140 (320) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0150 (336) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0160 (352) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0170 (368) pixels
-0xFFBE, 0xF7BE, 0xF79E, 0xFFBE, 0xFFDF, 0xF7BE, 0xF79D, 0xF79E, 0xF79E, 0xEF7D, 0xF79D, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF3C, 0xEF7D,   // 0x0180 (384) pixels
-0xEF5D, 0xEF5C, 0xE73C, 0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xEF3C, 0xEF5D, 0xF79D, 0xEF7D, 0xEF7D, 0xF77D, 0xEF5D, 0xE73C, 0xE71C,   // 0x0190 (400) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B,   // 0x01A0 (416) pixels
-0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xE71C,   // 0x01B0 (432) pixels
-0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE71C,   // 0x01C0 (448) pixels
-0xEF5C, 0xEF3C, 0xE73C, 0xE71C, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5D, 0xEF3C, 0xE71C, 0xE71C, 0xE71C,   // 0x01D0 (464) pixels
-0xEF5C, 0xEF5C, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xE71B, 0xEF5C, 0xF79E, 0xF79E, 0xF79D, 0xEF7D, 0xEF5D, 0xEF3C,   // 0x01E0 (480) pixels
-0xEF7D, 0xEF5C, 0xF79D, 0xEF5C, 0xEF7D, 0xE71C, 0xEF5D, 0xEF7D, 0xF79E, 0xF79D, 0xF7BE, 0xF79D, 0xF79E, 0xF79E, 0xFFFF, 0xF7BE,   // 0x01F0 (496) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0200 (512) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0210 (528) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0220 (544) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0230 (560) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0240 (576) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xFFDF, 0xFFDF, 0xF79D, 0xF7BE,   // 0x0250 (592) pixels
-0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xF79E, 0xEF5D, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF3C, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF5D,   // 0x0260 (608) pixels
-0xEF5C, 0xEF3C, 0xEF5C, 0xEF3C, 0xE73C, 0xEF5C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE6FB,   // 0x0270 (624) pixels
-0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0xEF3C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x0280 (640) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xEF5C, 0xEF3C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71C,   // 0x0290 (656) pixels
-0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xE71B, 0xE71C, 0xE73C, 0xE73C,   // 0x02A0 (672) pixels
-0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xEF3C, 0xEF5D, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xEF7D,   // 0x02B0 (688) pixels
-0xEF7D, 0xF79D, 0xF77D, 0xF79D, 0xF7BE, 0xF79D, 0xEF5D, 0xEF3C, 0xEF5D, 0xF77D, 0xF77D, 0xEF5D, 0xEF5C, 0xE73C, 0xEF3C, 0xEF7D,   // 0x02C0 (704) pixels
-0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0xEF7D, 0xFFBE, 0xFFBE, 0xF79E, 0xFFDE, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02D0 (720) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02E0 (736) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x02F0 (752) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0300 (768) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0310 (784) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0320 (800) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xFFDF, 0xFFDE, 0xF79E, 0xFFBE, 0xF7BE, 0xF79D, 0xF7BE, 0xEF7D,   // 0x0330 (816) pixels
-0xF79D, 0xF77D, 0xF79D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5D, 0xF79E, 0xF79D, 0xE73C, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C,   // 0x0340 (832) pixels
-0xE73C, 0xEF5C, 0xE71C, 0xE71C, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C,   // 0x0350 (848) pixels
-0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xEF3C, 0xEF3C, 0xEF3C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5C,   // 0x0360 (864) pixels
-0xEF5C, 0xEF5C, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71C,   // 0x0370 (880) pixels
-0xDEFB, 0xDEFB, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xDEFB, 0xDEDA, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xEF3C,   // 0x0380 (896) pixels
-0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xEF3C,   // 0x0390 (912) pixels
-0xE6FB, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xF79D, 0xF7BE, 0xEF7D, 0xEF5D, 0xEF5D, 0xF79D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D,   // 0x03A0 (928) pixels
-0xF7BE, 0xF79D, 0xEF7D, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03B0 (944) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03C0 (960) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03D0 (976) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03E0 (992) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x03F0 (1008) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x0400 (1024) pixels
-0xFFDF, 0xFFFF, 0xF7BE, 0xFFBE, 0xFFBE, 0xF79E, 0xF7BE, 0xF79E, 0xF7BE, 0xEF7D, 0xF7BE, 0xEF5C, 0xEF7D, 0xF79E, 0xEF5D, 0xEF7D,   // 0x0410 (1040) pixels
-0xEF7D, 0xEF7D, 0xF77D, 0xF79E, 0xF77D, 0xE73C, 0xE73C, 0xEF5C, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xE73C, 0xEF7D, 0xE71C, 0xE71C,   // 0x0420 (1056) pixels
-0xE71C, 0xEF5C, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71C,   // 0x0430 (1072) pixels
-0xEF3C, 0xEF5C, 0xEF3C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C,   // 0x0440 (1088) pixels
-0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE73C, 0xEF3C, 0xEF3C, 0xEF3C, 0xEF5C, 0xE71C, 0xE6FB, 0xE71B, 0xE6FB,   // 0x0450 (1104) pixels
-0xE73C, 0xEF5D, 0xEF7D, 0xF79E, 0xE71C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF5C, 0xE71B, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B,   // 0x0460 (1120) pixels
-0xE73C, 0xEF5D, 0xF77D, 0xEF7D, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xE71B, 0xE71B,   // 0x0470 (1136) pixels
-0xE73C, 0xEF5D, 0xEF5D, 0xEF5C, 0xE73C, 0xE71C, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79E, 0xF7BE, 0xEF7D, 0xFFDE, 0xF79E, 0xFFDE,   // 0x0480 (1152) pixels
-0xF7BE, 0xFFDE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0490 (1168) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04A0 (1184) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04B0 (1200) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04C0 (1216) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x04D0 (1232) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xF79D, 0xFFBE,   // 0x04E0 (1248) pixels
-0xF7BE, 0xF77D, 0xFFBE, 0xEF7D, 0xF79E, 0xEF7D, 0xF7BE, 0xEF7D, 0xEF7D, 0xF7BE, 0xE73C, 0xEF5C, 0xEF7D, 0xEF7D, 0xF77D, 0xEF5D,   // 0x04F0 (1264) pixels
-0xEF5C, 0xEF3C, 0xEF5D, 0xEF5D, 0xEF3C, 0xEF5C, 0xE73C, 0xEF5C, 0xE71B, 0xEF5D, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xEF3C,   // 0x0500 (1280) pixels
-0xEF3C, 0xEF3C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xDEDB, 0xDEDB, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF3C,   // 0x0510 (1296) pixels
-0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C,   // 0x0520 (1312) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xE71B, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB,   // 0x0530 (1328) pixels
-0xEF7D, 0xEF5D, 0xEF3C, 0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xEF7D, 0xEF5C,   // 0x0540 (1344) pixels
-0xEF7D, 0xEF5D, 0xEF3C, 0xEF3C, 0xE71C, 0xE73C, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF7D, 0xF77D, 0xF77D, 0xF79D, 0xF79D, 0xF79D,   // 0x0550 (1360) pixels
-0xEF5D, 0xF77D, 0xEF7D, 0xF79D, 0xEF3C, 0xEF7D, 0xF77D, 0xF79E, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDF, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x0560 (1376) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0570 (1392) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0580 (1408) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0590 (1424) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05A0 (1440) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x05B0 (1456) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xFFBE, 0xF7BE, 0xFFDE, 0xF79D, 0xEF5D, 0xF79E, 0xF79D,   // 0x05C0 (1472) pixels
-0xF7BE, 0xF7BE, 0xF79D, 0xF77D, 0xEF7D, 0xF7BE, 0xEF5D, 0xF79D, 0xE73C, 0xEF5C, 0xEF7D, 0xEF3C, 0xEF5C, 0xE73C, 0xE71C, 0xDEFB,   // 0x05D0 (1488) pixels
-0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF5C, 0xE73C, 0xE71B, 0xE73C, 0xEF5C, 0xEF5D, 0xEF7D,   // 0x05E0 (1504) pixels
-0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF3C, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x05F0 (1520) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xE71C,   // 0x0600 (1536) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5D, 0xEF3C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xEF3C, 0xEF5D, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x0610 (1552) pixels
-0xE71C, 0xEF3C, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF7D, 0xF79D, 0xF77D, 0xE6FB, 0xE71C, 0xE73C, 0xF77D,   // 0x0620 (1568) pixels
-0xF77D, 0xF79D, 0xF79D, 0xF79E, 0xF77D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xF77D, 0xEF7D, 0xFFDF, 0xFFBE, 0xFFDE, 0xEF7D,   // 0x0630 (1584) pixels
-0xF79E, 0xF79D, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0640 (1600) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0650 (1616) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0660 (1632) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0670 (1648) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0680 (1664) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0690 (1680) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF7BE, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF77D, 0xEF5D, 0xF79E, 0xEF5D, 0xF79E,   // 0x06A0 (1696) pixels
-0xF77D, 0xF79E, 0xEF7D, 0xEF7D, 0xEF5C, 0xE73C, 0xEF5C, 0xE73C, 0xEF5D, 0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xEF5C, 0xE71C,   // 0x06B0 (1712) pixels
-0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xEF3C, 0xEF3C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF7D,   // 0x06C0 (1728) pixels
-0xEF5C, 0xE73C, 0xE6FB, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE73C,   // 0x06D0 (1744) pixels
-0xEF5D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF3C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF3C, 0xE73C, 0xE71B, 0xDEFB,   // 0x06E0 (1760) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5C,   // 0x06F0 (1776) pixels
-0xE73C, 0xEF5C, 0xEF5D, 0xEF5C, 0xEF5D, 0xF77D, 0xF79E, 0xF7BE, 0xEF7D, 0xEF5D, 0xEF5D, 0xF77D, 0xF79E, 0xF79E, 0xF79E, 0xF79E,   // 0x0700 (1792) pixels
-0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xEF5D, 0xE71C, 0xF79E, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xEF7D,   // 0x0710 (1808) pixels
-0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0720 (1824) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0730 (1840) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0740 (1856) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0750 (1872) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0760 (1888) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE,   // 0x0770 (1904) pixels
-0xF79E, 0xF79E, 0xEF7D, 0xF79E, 0xFFDE, 0xF77D, 0xE73C, 0xF79D, 0xEF7D, 0xFFDE, 0xEF5D, 0xF79D, 0xEF7D, 0xEF5D, 0xF79D, 0xEF5C,   // 0x0780 (1920) pixels
-0xEF5C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF7D, 0xE73C, 0xE71C, 0xE71C, 0xF79E, 0xE73C, 0xE73C, 0xEF3C, 0xE71C, 0xDEDB, 0xE71B, 0xE6FB,   // 0x0790 (1936) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xEF5C, 0xE73C, 0xE71B, 0xE6FB, 0xE71B,   // 0x07A0 (1952) pixels
-0xEF3C, 0xEF5C, 0xEF5C, 0xE73C, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71C,   // 0x07B0 (1968) pixels
-0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xEF5C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE73C, 0xEF5C, 0xE73C,   // 0x07C0 (1984) pixels
-0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE73C, 0xEF3C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF3C, 0xEF3C, 0xEF5D, 0xEF7D, 0xEF7D,   // 0x07D0 (2000) pixels
-0xEF7D, 0xEF5D, 0xE73C, 0xE71B, 0xEF5D, 0xEF7D, 0xEF5D, 0xE73C, 0xE71B, 0xE71C, 0xEF3C, 0xEF5C, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF7D,   // 0x07E0 (2016) pixels
-0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xEF7D, 0xFFDE, 0xF79E, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x07F0 (2032) pixels
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,   // 0x0800 (2048) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x0810 (2064) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0820 (2080) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0830 (2096) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0840 (2112) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF79D, 0xFFFF, 0xEF5D, 0xFFDE, 0xF79D, 0xF7BE, 0xF7BE, 0xF79E,   // 0x0850 (2128) pixels
-0xF79E, 0xF79D, 0xEF7D, 0xF77D, 0xFFBE, 0xF79E, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF5C, 0xEF7D, 0xEF5D, 0xEF5C, 0xE73C, 0xE71C,   // 0x0860 (2144) pixels
-0xE73C, 0xE73C, 0xE73C, 0xEF7D, 0xEF7D, 0xEF3C, 0xE71B, 0xEF5C, 0xEF5C, 0xEF5C, 0xE71C, 0xE71C, 0xDEFB, 0xE71B, 0xE71C, 0xE73C,   // 0x0870 (2160) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xEF5C, 0xE73C, 0xE73C, 0xEF3C, 0xEF3C,   // 0x0880 (2176) pixels
-0xEF3C, 0xEF3C, 0xEF5C, 0xEF5C, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xEF5C, 0xE73C, 0xE71B, 0xE71B,   // 0x0890 (2192) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xEF7D, 0xEF5C, 0xE73C, 0xE71B, 0xF77D, 0xEF3C, 0xE6FB, 0xDEFB, 0xE71C, 0xEF5D, 0xEF7D, 0xEF5D,   // 0x08A0 (2208) pixels
-0xEF5C, 0xEF5D, 0xEF5D, 0xEF5C, 0xE73C, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x08B0 (2224) pixels
-0xEF7D, 0xF79D, 0xF79D, 0xEF5D, 0xE73C, 0xEF5C, 0xEF7D, 0xF79D, 0xF77D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5D,   // 0x08C0 (2240) pixels
-0xEF7D, 0xEF7D, 0xF79D, 0xEF7D, 0xFFFF, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08D0 (2256) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x08E0 (2272) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x08F0 (2288) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0900 (2304) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0910 (2320) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0920 (2336) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79D, 0xF79E, 0xF7BE, 0xF79E, 0xEF5C, 0xF79E, 0xF79E, 0xF79E, 0xEF7D, 0xF77D, 0xF7BE,   // 0x0930 (2352) pixels
-0xF79D, 0xE73C, 0xF77D, 0xF79E, 0xEF7D, 0xEF5D, 0xEF3C, 0xE73C, 0xF77D, 0xEF5D, 0xEF5D, 0xEF7D, 0xE73C, 0xE73C, 0xEF5D, 0xEF7D,   // 0x0940 (2368) pixels
-0xE71C, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xDEFB, 0xE73C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF5C, 0xE73C, 0xE71C, 0xE71C,   // 0x0950 (2384) pixels
-0xE71C, 0xEF5D, 0xEF5C, 0xEF5C, 0xEF7D, 0xEF3C, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C,   // 0x0960 (2400) pixels
-0xE73C, 0xEF3C, 0xEF3C, 0xE71C, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xDEFB,   // 0x0970 (2416) pixels
-0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x0980 (2432) pixels
-0xE73C, 0xEF5D, 0xEF7D, 0xEF7D, 0xF77D, 0xEF7D, 0xEF5C, 0xEF5C, 0xEF3C, 0xEF3C, 0xEF5C, 0xEF7D, 0xF79E, 0xF79E, 0xF79D, 0xF79D,   // 0x0990 (2448) pixels
-0xF79D, 0xF79D, 0xF79D, 0xF79E, 0xF79D, 0xF77D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79D, 0xF77D, 0xF79D, 0xEF7D,   // 0x09A0 (2464) pixels
-0xF79D, 0xF7BE, 0xFFDE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09B0 (2480) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09C0 (2496) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09D0 (2512) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09E0 (2528) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x09F0 (2544) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDF, 0xFFFF, 0xF7BE,   // 0x0A00 (2560) pixels
-0xFFDE, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFBE, 0xF79D, 0xFFDE, 0xEF7D, 0xF79D, 0xF77D, 0xF79D, 0xEF7D, 0xF79D, 0xF79D, 0xF77D, 0xE73C,   // 0x0A10 (2576) pixels
-0xEF7D, 0xEF5D, 0xEF5C, 0xF79E, 0xEF5C, 0xE71C, 0xEF5D, 0xF7BE, 0xE73C, 0xEF5C, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF5D, 0xE73C, 0xE6FB,   // 0x0A20 (2592) pixels
-0xEF5C, 0xE71C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE73C, 0xEF3C, 0xE73C, 0xE71C,   // 0x0A30 (2608) pixels
-0xEF3C, 0xEF3C, 0xE73C, 0xEF5C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B,   // 0x0A40 (2624) pixels
-0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEDA, 0xDEDB, 0xE73C, 0xE73C, 0xE71C, 0xEF3C, 0xF79D, 0xF79D, 0xEF7D, 0xEF5C, 0xE73C,   // 0x0A50 (2640) pixels
-0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF5C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xEF3C,   // 0x0A60 (2656) pixels
-0xEF5C, 0xEF5C, 0xEF7D, 0xF77D, 0xEF7D, 0xEF3C, 0xE71C, 0xE71C, 0xF79D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF77D,   // 0x0A70 (2672) pixels
-0xF79D, 0xF79E, 0xF79E, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xFFBE, 0xFFDE, 0xF79E, 0xF7BE, 0xF79D, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A80 (2688) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0A90 (2704) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AA0 (2720) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AB0 (2736) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AC0 (2752) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0AD0 (2768) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDF, 0xFFBE,   // 0x0AE0 (2784) pixels
-0xF7BE, 0xF79E, 0xFFDE, 0xEF5C, 0xF79E, 0xEF7D, 0xF77D, 0xEF5D, 0xF77D, 0xF77D, 0xF79E, 0xF79D, 0xEF7D, 0xEF5C, 0xEF7D, 0xEF5D,   // 0x0AF0 (2800) pixels
-0xEF5C, 0xE73C, 0xEF5C, 0xEF7D, 0xE71C, 0xE73C, 0xEF5C, 0xEF3C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xEF5D, 0xEF3C, 0xE73C, 0xE71B,   // 0x0B00 (2816) pixels
-0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xE73C, 0xEF5C, 0xE73C,   // 0x0B10 (2832) pixels
-0xEF7D, 0xEF7D, 0xEF5D, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xDEFB,   // 0x0B20 (2848) pixels
-0xDEFB, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xE73C, 0xEF7D, 0xF77D,   // 0x0B30 (2864) pixels
-0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0xE71B, 0xE6FB, 0xE71C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF5D, 0xE73C, 0xEF5D, 0xF79D, 0xF7BE,   // 0x0B40 (2880) pixels
-0xF79E, 0xF77D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0xF79E, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF7D, 0xF79E, 0xF7BE, 0xFFBE,   // 0x0B50 (2896) pixels
-0xF7BE, 0xF79D, 0xEF7D, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF7D, 0xFFDF, 0xF79E, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B60 (2912) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B70 (2928) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B80 (2944) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0B90 (2960) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BA0 (2976) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0BB0 (2992) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDF, 0xF79D, 0xFFFF, 0xEF3C, 0xEF7D, 0xEF7D, 0xF79E, 0xEF7D,   // 0x0BC0 (3008) pixels
-0xFFBE, 0xEF5D, 0xF77D, 0xF79D, 0xF79D, 0xEF7D, 0xEF7D, 0xF79E, 0xEF5C, 0xE71C, 0xEF7D, 0xEF5C, 0xEF5C, 0xEF7D, 0xE73C, 0xE73C,   // 0x0BD0 (3024) pixels
-0xEF3C, 0xE73C, 0xE71B, 0xEF5C, 0xEF5D, 0xEF3C, 0xE73C, 0xE73C, 0xDEFB, 0xE73C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5C, 0xE73C, 0xE71C,   // 0x0BE0 (3040) pixels
-0xE71C, 0xE73C, 0xEF3C, 0xEF3C, 0xEF5D, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xEF5C, 0xF79E, 0xEF7D, 0xEF3C, 0xEF5C, 0xEF5C, 0xEF5C,   // 0x0BF0 (3056) pixels
-0xEF3C, 0xE73C, 0xEF3C, 0xEF3C, 0xF79D, 0xF79E, 0xF79D, 0xEF7D, 0xEF3C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB, 0xE71C,   // 0x0C00 (3072) pixels
-0xE71C, 0xDEFB, 0xE71B, 0xEF3C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71C,   // 0x0C10 (3088) pixels
-0xEF5D, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5C, 0xEF3C, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79D,   // 0x0C20 (3104) pixels
-0xF79E, 0xFFDE, 0xFFBE, 0xF77D, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF3C, 0xEF5D, 0xEF7D, 0xF79E, 0xF7BE, 0xF79E, 0xF79D, 0xF77D, 0xF77D,   // 0x0C30 (3120) pixels
-0xF79D, 0xF79D, 0xEF7D, 0xF7BE, 0xFFDF, 0xF7BE, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C40 (3136) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,   // 0x0C50 (3152) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C60 (3168) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C70 (3184) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0C80 (3200) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x0C90 (3216) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xF7BE, 0xF7BE, 0xF77D, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xEF7D, 0xF79D, 0xEF5D, 0xF7BE, 0xEF5D,   // 0x0CA0 (3232) pixels
-0xEF5C, 0xF79E, 0xE73C, 0xEF3C, 0xF79D, 0xEF5C, 0xE71C, 0xEF7D, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xEF5C, 0xEF3C, 0xE73C, 0xEF3C,   // 0x0CB0 (3248) pixels
-0xEF5C, 0xE73C, 0xE73C, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF3C, 0xE71B, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE73C, 0xE73C, 0xE73C,   // 0x0CC0 (3264) pixels
-0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE71C, 0xE73C, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C,   // 0x0CD0 (3280) pixels
-0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB,   // 0x0CE0 (3296) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xEF5C, 0xEF7D, 0xF79D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C,   // 0x0CF0 (3312) pixels
-0xE73C, 0xEF3C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF7D, 0xF79D, 0xF79D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5C,   // 0x0D00 (3328) pixels
-0xEF5C, 0xEF7D, 0xF79D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79D, 0xF79D, 0xF79D, 0xF79E, 0xF77D, 0xEF5D, 0xF77D, 0xFFDE,   // 0x0D10 (3344) pixels
-0xF7BE, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D20 (3360) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2945, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x0D30 (3376) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x2104, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D40 (3392) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D50 (3408) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0D60 (3424) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79D,   // 0x0D70 (3440) pixels
-0xFFDE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF5D, 0xE73C, 0xF79E, 0xEF5C, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF7D,   // 0x0D80 (3456) pixels
-0xEF5C, 0xF77D, 0xEF7D, 0xE71C, 0xEF7D, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5D, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C,   // 0x0D90 (3472) pixels
-0xEF5C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xE71C, 0xE73C, 0xE73C, 0xE73C,   // 0x0DA0 (3488) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0xEF3C, 0xEF3C,   // 0x0DB0 (3504) pixels
-0xEF3C, 0xE73C, 0xE71C, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE73C,   // 0x0DC0 (3520) pixels
-0xDEDA, 0xE71B, 0xEF5C, 0xEF7D, 0xEF7D, 0xEF5C, 0xEF5C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF5C, 0xEF5D, 0xF77D, 0xF79D,   // 0x0DD0 (3536) pixels
-0xF79E, 0xF77D, 0xEF5C, 0xEF5C, 0xEF5D, 0xF79E, 0xF79E, 0xF79D, 0xFFFF, 0xFFDE, 0xFFBE, 0xF79D, 0xF77D, 0xEF7D, 0xF79E, 0xF7BE,   // 0x0DE0 (3552) pixels
-0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF79D, 0xEF7D, 0xEF7D, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,   // 0x0DF0 (3568) pixels
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E00 (3584) pixels
-0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 0x2104, 0x18E3, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x0E10 (3600) pixels
-0x18E4, 0x18E4, 0x18C3, 0x18C3, 0x8410, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E20 (3616) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E30 (3632) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0E40 (3648) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFFF, 0xF79E, 0xFFDF, 0xFFBE, 0xF79D, 0xEF7D,   // 0x0E50 (3664) pixels
-0xF79D, 0xF79D, 0xF7BE, 0xEF5D, 0xEF7D, 0xF79E, 0xEF7D, 0xE73C, 0xE73C, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C,   // 0x0E60 (3680) pixels
-0xEF5D, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xE71B, 0xE73C, 0xE71B, 0xEF7D, 0xEF7D, 0xEF5C, 0xE73C, 0xEF5D, 0xEF3C,   // 0x0E70 (3696) pixels
-0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xE73C, 0xEF3C,   // 0x0E80 (3712) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C,   // 0x0E90 (3728) pixels
-0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xEF5C, 0xE73C, 0xE71B, 0xE6FB,   // 0x0EA0 (3744) pixels
-0xE71C, 0xEF3C, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0xF7BE, 0xFFDE, 0xF7BE, 0xF79E, 0xEF7D,   // 0x0EB0 (3760) pixels
-0xEF7D, 0xEF7D, 0xF77D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5C, 0xEF7D, 0xEF7D, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x0EC0 (3776) pixels
-0xFFDF, 0xF79E, 0xEF7D, 0xEF7D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79D, 0xFFDE, 0xFFFF, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x0ED0 (3792) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B4D, 0x2104, 0x18C3, 0x2124,   // 0x0EE0 (3808) pixels
-0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x2104, 0x20E4,   // 0x0EF0 (3824) pixels
-0x20E3, 0x18C3, 0x20E3, 0x52AA, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F00 (3840) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0F10 (3856) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x0F20 (3872) pixels
-0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFBE, 0xF77D, 0xF79E, 0xEF5D, 0xEF7D, 0xF79D, 0xFFDE, 0xF7BE, 0xEF5C, 0xFFBE, 0xEF7D, 0xEF5C,   // 0x0F30 (3888) pixels
-0xEF7D, 0xEF5C, 0xF79E, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF5C, 0xE73C, 0xEF5C, 0xEF5C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF5C,   // 0x0F40 (3904) pixels
-0xEF7D, 0xE71C, 0xE71C, 0xEF5D, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE73C, 0xE71C, 0xEF5C, 0xE71C, 0xE71C, 0xE71C, 0xE71C,   // 0x0F50 (3920) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71C,   // 0x0F60 (3936) pixels
-0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71C,   // 0x0F70 (3952) pixels
-0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5C, 0xF79D, 0xEF7D, 0xEF3C, 0xE73C, 0xEF5C, 0xEF7D, 0xEF7D, 0xEF7D,   // 0x0F80 (3968) pixels
-0xF77D, 0xEF7D, 0xEF7D, 0xEF5C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF5C, 0xE71B, 0xE73C, 0xEF7D, 0xEF7D, 0xF79D, 0xEF7D, 0xF77D, 0xEF7D,   // 0x0F90 (3984) pixels
-0xEF7D, 0xEF7D, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDF, 0xFFFF,   // 0x0FA0 (4000) pixels
-0xFFDE, 0xFFFF, 0xFFDF, 0xF7BE, 0xFFFF, 0xFFFF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0FB0 (4016) pixels
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2104, 0x18E3, 0x2104, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x2104, 0x2104,   // 0x0FC0 (4032) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x2104, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x18E3,   // 0x0FD0 (4048) pixels
-0x18E3, 0x39C7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0FE0 (4064) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0FF0 (4080) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,   // 0x1000 (4096) pixels
-0xFFDF, 0xF79E, 0xFFDF, 0xFFBE, 0xFFDE, 0xF7BE, 0xFFBE, 0xF77D, 0xF7BE, 0xE73C, 0xFFFF, 0xFFDE, 0xE73C, 0xE73C, 0xEF5C, 0xEF7D,   // 0x1010 (4112) pixels
-0xF79E, 0xE73C, 0xE71C, 0xEF5C, 0xEF5D, 0xEF5C, 0xEF5C, 0xE71C, 0xE73C, 0xEF7D, 0xE73C, 0xE71B, 0xEF7D, 0xEF5D, 0xE71C, 0xE71C,   // 0x1020 (4128) pixels
-0xE71B, 0xEF7D, 0xE71B, 0xF79D, 0xE71C, 0xF79D, 0xDEDB, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF7D,   // 0x1030 (4144) pixels
-0xEF5C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE6FB,   // 0x1040 (4160) pixels
-0xEF3C, 0xEF3C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B,   // 0x1050 (4176) pixels
-0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF3C, 0xEF3C, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79E, 0xF79E, 0xF79D, 0xF77D,   // 0x1060 (4192) pixels
-0xEF7D, 0xF77D, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xE73C, 0xEF7D, 0xEF5D, 0xFFFF, 0xFFDF, 0xFFFF, 0xF79E, 0xF79D, 0xF79D, 0xEF7D,   // 0x1070 (4208) pixels
-0xF77D, 0xF77D, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFFF, 0xF79D, 0xFFFF, 0xFFFF,   // 0x1080 (4224) pixels
-0xF7BE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x1090 (4240) pixels
-0x31A6, 0x2104, 0x18E3, 0x18E3, 0x10A2, 0x2124, 0x2104, 0x18E3, 0x2104, 0x2104, 0x18E3, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x10A0 (4256) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x18C3, 0x2104, 0x18E3, 0x2124, 0x18E3, 0xB575, 0xDEBA,   // 0x10B0 (4272) pixels
-0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x10C0 (4288) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x10D0 (4304) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFBE, 0xF79E, 0xF79D, 0xF79E, 0xF77D,   // 0x10E0 (4320) pixels
-0xF7BE, 0xF79E, 0xF79D, 0xF77D, 0xEF5C, 0xF79D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5D, 0xF79E, 0xE71B, 0xEF5D, 0xE73C, 0xE73C, 0xEF3C,   // 0x10F0 (4336) pixels
-0xEF3C, 0xEF3C, 0xEF5C, 0xE73C, 0xE71C, 0xEF7D, 0xEF5D, 0xDEFB, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xEF5C, 0xDEDB,   // 0x1100 (4352) pixels
-0xEF7D, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xEF3C,   // 0x1110 (4368) pixels
-0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,   // 0x1120 (4384) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C,   // 0x1130 (4400) pixels
-0xEF3C, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79D, 0xEF7D, 0xEF5D,   // 0x1140 (4416) pixels
-0xEF3C, 0xEF7D, 0xFFFF, 0xFFBE, 0xFFFF, 0xF77D, 0xF7BE, 0xF79D, 0xEF5D, 0xEF7D, 0xF79E, 0xF79E, 0xFFBE, 0xF7BE, 0xFFDE, 0xFFDE,   // 0x1150 (4432) pixels
-0xFFDE, 0xF7BE, 0xF79D, 0xF79E, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFDF,   // 0x1160 (4448) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x6B4D, 0x2104, 0x18E3, 0x18C3, 0x18E3,   // 0x1170 (4464) pixels
-0x2104, 0x18C3, 0x18C3, 0x2104, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1180 (4480) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x20E4, 0x20E3, 0x83CE, 0x62CB, 0xEEFB, 0xFF9D, 0xFFDE,   // 0x1190 (4496) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x11A0 (4512) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x11B0 (4528) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFDE, 0xFFDE, 0xF79D, 0xF7BE, 0xF79E, 0xF7BE, 0xF77D,   // 0x11C0 (4544) pixels
-0xFFBE, 0xEF5C, 0xEF5C, 0xEF5C, 0xF79D, 0xEF5C, 0xE71C, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D,   // 0x11D0 (4560) pixels
-0xEF5C, 0xEF5D, 0xEF5D, 0xE73C, 0xE73C, 0xE71B, 0xE73C, 0xEF5C, 0xF79D, 0xF79D, 0xEF7D, 0xEF5D, 0xE73C, 0xEF5C, 0xE71C, 0xE71C,   // 0x11E0 (4576) pixels
-0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C,   // 0x11F0 (4592) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C,   // 0x1200 (4608) pixels
-0xEF5C, 0xEF3C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xEF5C,   // 0x1210 (4624) pixels
-0xEF5C, 0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xEF7D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79E, 0xF79D, 0xEF5C, 0xEF5D,   // 0x1220 (4640) pixels
-0xEF5C, 0xF79D, 0xF77D, 0xF77D, 0xFFFF, 0xFFDE, 0xF7BE, 0xEF5D, 0xEF5D, 0xEF5D, 0xF79E, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1230 (4656) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1240 (4672) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2104, 0x18E3, 0x18C3, 0x18C3, 0x2124, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x18E3,   // 0x1250 (4688) pixels
-0x10A2, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1904, 0x1903, 0x1903,   // 0x1260 (4704) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x28E3, 0xB534, 0x62AA, 0xE699, 0xFF7C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1270 (4720) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1280 (4736) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1290 (4752) pixels
-0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF, 0xF79E, 0xF77D, 0xF7BE, 0xF79E, 0xF79D, 0xF79E, 0xFFDF, 0xEF5C, 0xEF3C, 0xE71B, 0xEF5C, 0xEF5C,   // 0x12A0 (4768) pixels
-0xEF5C, 0xEF5C, 0xF79D, 0xF79E, 0xEF5D, 0xEF5D, 0xE71C, 0xE73C, 0xEF5D, 0xE73C, 0xE71C, 0xEF5C, 0xEF7D, 0xE73C, 0xE73C, 0xE73C,   // 0x12B0 (4784) pixels
-0xEF3C, 0xEF5C, 0xEF3C, 0xDEFB, 0xDEFB, 0xDEDA, 0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B,   // 0x12C0 (4800) pixels
-0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x12D0 (4816) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x12E0 (4832) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xF79D, 0xEF7D, 0xEF5C, 0xE73C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF7D,   // 0x12F0 (4848) pixels
-0xF79D, 0xF79D, 0xF77D, 0xF79D, 0xF79D, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79D, 0xF79D, 0xF79D, 0xFFBE, 0xF7BE, 0xF7BE,   // 0x1300 (4864) pixels
-0xFFDE, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFBE,   // 0x1310 (4880) pixels
-0xFFDF, 0xFFFF, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,   // 0x1320 (4896) pixels
-0xFFFF, 0x10A2, 0x18E3, 0x18C3, 0x2104, 0x2104, 0x10A2, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x18C3, 0x2104,   // 0x1330 (4912) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1904, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,   // 0x1340 (4928) pixels
-0x18C3, 0x18A3, 0x2904, 0x20A2, 0x1841, 0xA4B1, 0x6AA9, 0xC595, 0xF71B, 0xF77D, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1350 (4944) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1360 (4960) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDE,   // 0x1370 (4976) pixels
-0xFFDF, 0xF77D, 0xF79E, 0xF77D, 0xEF5D, 0xEF5C, 0xF79E, 0xE71C, 0xEF5C, 0xEF5C, 0xE71B, 0xE73C, 0xF77D, 0xE73C, 0xE73C, 0xEF5C,   // 0x1380 (4992) pixels
-0xEF5C, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5D, 0xE73C, 0xEF3C, 0xEF5D, 0xE71C, 0xE73C, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xE6FB,   // 0x1390 (5008) pixels
-0xEF5C, 0xE6FB, 0xEF3C, 0xE71B, 0xEF3C, 0xDEFB, 0xE71C, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xEF5C, 0xEF5C,   // 0x13A0 (5024) pixels
-0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C,   // 0x13B0 (5040) pixels
-0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xEF3C,   // 0x13C0 (5056) pixels
-0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0xF79D, 0xF77D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5C, 0xEF3C, 0xEF3C, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D,   // 0x13D0 (5072) pixels
-0xEF7D, 0xEF7D, 0xF79D, 0xF7BE, 0xF79E, 0xF77D, 0xEF5D, 0xEF3C, 0xEF7D, 0xF7BE, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFBE, 0xFFDF, 0xFFDF,   // 0x13E0 (5088) pixels
-0xFFFF, 0xFFBE, 0xF7BE, 0xF79E, 0xFFBE, 0xF7BE, 0xF79D, 0xF79D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDF, 0xFFFF,   // 0x13F0 (5104) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x18E3,   // 0x1400 (5120) pixels
-0x18C3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1410 (5136) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x20E4, 0x2104, 0x20C3, 0x20C3,   // 0x1420 (5152) pixels
-0x3124, 0x20A1, 0xACF2, 0xACB1, 0xC595, 0xDE59, 0xF75C, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1430 (5168) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1440 (5184) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDE, 0xF7BE, 0xF79D, 0xFFDF, 0xF79E, 0xF79D, 0xF77D,   // 0x1450 (5200) pixels
-0xF79E, 0xEF7D, 0xF7BE, 0xF79D, 0xF79D, 0xEF5C, 0xEF7D, 0xE71B, 0xE71B, 0xEF5C, 0xF79D, 0xE71B, 0xE71C, 0xE73C, 0xEF5C, 0xEF7D,   // 0x1460 (5216) pixels
-0xEF5D, 0xEF5D, 0xEF5D, 0xE71B, 0xE71C, 0xE71C, 0xEF5D, 0xEF5D, 0xEF5C, 0xE71B, 0xE73C, 0xEF5D, 0xEF5C, 0xE71C, 0xE71C, 0xE73C,   // 0x1470 (5232) pixels
-0xE73C, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEDB, 0xE71C, 0xE71C, 0xE71C, 0xE71B,   // 0x1480 (5248) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5C,   // 0x1490 (5264) pixels
-0xE73C, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5C,   // 0x14A0 (5280) pixels
-0xF77D, 0xEF7D, 0xF79D, 0xF7BE, 0xF7BE, 0xEF7D, 0xEF5C, 0xEF5D, 0xF79E, 0xF79D, 0xEF7D, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xEF7D,   // 0x14B0 (5296) pixels
-0xEF7D, 0xF79E, 0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79E, 0xF79D, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDE,   // 0x14C0 (5312) pixels
-0xFFDE, 0xF7BE, 0xF79E, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x14D0 (5328) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x14E0 (5344) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x14F0 (5360) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18C3, 0x20E4, 0x18A2, 0x2904, 0x20A2, 0x28E2, 0xA491, 0x9C70,   // 0x1500 (5376) pixels
-0xACD2, 0xDE37, 0xEEFB, 0xF75C, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1510 (5392) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1520 (5408) pixels
-0xFFDE, 0xFFBE, 0xF7BE, 0xF79D, 0xF77D, 0xFFDE, 0xF7BE, 0xF7BE, 0xEF7D, 0xFFBE, 0xEF5C, 0xF7BE, 0xE73C, 0xEF7D, 0xE73C, 0xEF7D,   // 0x1530 (5424) pixels
-0xEF7D, 0xEF3C, 0xE73C, 0xEF7D, 0xEF5C, 0xDEFB, 0xEF5C, 0xDEFB, 0xEF5D, 0xE71C, 0xEF5D, 0xEF5D, 0xEF7D, 0xE73C, 0xE73C, 0xEF5D,   // 0x1540 (5440) pixels
-0xE73C, 0xEF5D, 0xE71C, 0xE73C, 0xEF3C, 0xEF3C, 0xEF5D, 0xDEDB, 0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xDEDA, 0xE73C, 0xE71C, 0xDEFB,   // 0x1550 (5456) pixels
-0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71B,   // 0x1560 (5472) pixels
-0xEF5C, 0xEF5C, 0xEF5C, 0xEF3C, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE73C,   // 0x1570 (5488) pixels
-0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D,   // 0x1580 (5504) pixels
-0xF77D, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xEF7D, 0xEF7D, 0xF77D, 0xF79D, 0xF79E, 0xF79D, 0xF77D, 0xEF7D,   // 0x1590 (5520) pixels
-0xF77D, 0xF79D, 0xF79D, 0xF77D, 0xFFDE, 0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xF7BE, 0xF79E, 0xF79D, 0xF79E,   // 0x15A0 (5536) pixels
-0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x15B0 (5552) pixels
-0xFFFF, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x15C0 (5568) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x15D0 (5584) pixels
-0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E4, 0x2104, 0x20E4, 0x20E3, 0x20C2, 0x20C2, 0x1860, 0x9C70, 0x5A27, 0xA470, 0xB513, 0xDE78,   // 0x15E0 (5600) pixels
-0xE6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x15F0 (5616) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79D,   // 0x1600 (5632) pixels
-0xF79D, 0xFFDE, 0xF7BE, 0xF79D, 0xFFDE, 0xF79D, 0xEF7D, 0xEF5C, 0xF77D, 0xF79D, 0xEF7D, 0xE73C, 0xEF5C, 0xEF5C, 0xE71B, 0xE71B,   // 0x1610 (5648) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xEF5D, 0xE71C, 0xE73C, 0xE71B, 0xEF5C, 0xE73C, 0xE73C, 0xE71B, 0xEF3C, 0xEF7D,   // 0x1620 (5664) pixels
-0xEF5C, 0xE71B, 0xE71B, 0xEF5D, 0xDEDB, 0xE71C, 0xE6FB, 0xE73C, 0xDEFB, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB,   // 0x1630 (5680) pixels
-0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x1640 (5696) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xEF3C, 0xEF5D, 0xEF3C, 0xE71C, 0xE71B, 0xE71C, 0xE71B, 0xE71B,   // 0x1650 (5712) pixels
-0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF7D, 0xF77D, 0xEF7D,   // 0x1660 (5728) pixels
-0xEF7D, 0xEF7D, 0xEF5D, 0xEF7D, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xF77D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0xF79D,   // 0x1670 (5744) pixels
-0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,   // 0x1680 (5760) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AA, 0x18E3, 0x18C3, 0x18E3,   // 0x1690 (5776) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x16A0 (5792) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E4, 0x20E4, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3,   // 0x16B0 (5808) pixels
-0x18E4, 0x10A2, 0x18E3, 0x18A2, 0x2103, 0x20E2, 0x28E2, 0x1860, 0xA470, 0x5A27, 0xA450, 0xBD54, 0xCDF7, 0xE6FB, 0xF79E, 0xFFFF,   // 0x16C0 (5824) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x16D0 (5840) pixels
-0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFFF, 0xF77D, 0xFFBE, 0xFFDE, 0xF79D, 0xF79D, 0xF7BE, 0xEF5C,   // 0x16E0 (5856) pixels
-0xEF7D, 0xF7BE, 0xEF3C, 0xEF5C, 0xE71B, 0xE73C, 0xDEFB, 0xF77D, 0xE73C, 0xDEDA, 0xE6FB, 0xDEBA, 0xE71B, 0xE71B, 0xE73C, 0xDEDA,   // 0x16F0 (5872) pixels
-0xE73C, 0xEF5C, 0xE71C, 0xEF5D, 0xEF3C, 0xE73C, 0xF77D, 0xF77D, 0xE73C, 0xE73C, 0xE73C, 0xE6FB, 0xE6FB, 0xEF5C, 0xEF5D, 0xE73C,   // 0x1700 (5888) pixels
-0xE71C, 0xE71B, 0xDEDB, 0xE71B, 0xDEBA, 0xE71C, 0xEF3C, 0xEF7D, 0xEF5D, 0xE73C, 0xE6FB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x1710 (5904) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x1720 (5920) pixels
-0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xEF5C, 0xEF3C, 0xE71C, 0xE71C,   // 0x1730 (5936) pixels
-0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF7D, 0xF79E, 0xF79E, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xEF7D,   // 0x1740 (5952) pixels
-0xEF5C, 0xEF5D, 0xF79E, 0xFFDF, 0xFFDE, 0xF7BE, 0xF77D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF,   // 0x1750 (5968) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,   // 0x1760 (5984) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x18E3, 0x2124, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,   // 0x1770 (6000) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1780 (6016) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x18C3, 0x18E3,   // 0x1790 (6032) pixels
-0x20E3, 0x20E3, 0x20C2, 0x1860, 0xA46F, 0x5A06, 0x8BCD, 0xACF2, 0xBD95, 0xDE99, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x17A0 (6048) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE,   // 0x17B0 (6064) pixels
-0xFFFF, 0xFFDE, 0xFFBE, 0xFFBE, 0xF77D, 0xF79E, 0xF79E, 0xF77D, 0xF79D, 0xEF5C, 0xEF7D, 0xFFDE, 0xF7BE, 0xF77D, 0xEF5C, 0xEF5C,   // 0x17C0 (6080) pixels
-0xE71B, 0xEF5C, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEDA, 0xEF7D, 0xE71B, 0xDEBA, 0xE73C, 0xE73C, 0xE71B, 0xEF7D, 0xE73C, 0xE71B,   // 0x17D0 (6096) pixels
-0xE71B, 0xEF3C, 0xEF7D, 0xE71B, 0xEF7D, 0xE71C, 0xDEFB, 0xEF5C, 0xEF5D, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xEF5D, 0xE71B, 0xDEDB,   // 0x17E0 (6112) pixels
-0xE71B, 0xE71C, 0xDEDA, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF5D, 0xE73C, 0xE71C, 0xE71B, 0xE71C,   // 0x17F0 (6128) pixels
-0xE71B, 0xDEDB, 0xDEDA, 0xDEDB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B,   // 0x1800 (6144) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C,   // 0x1810 (6160) pixels
-0xF79D, 0xF77D, 0xEF5D, 0xEF5C, 0xEF5D, 0xF79D, 0xFFBE, 0xFFDE, 0xF79E, 0xF77D, 0xEF7D, 0xF77D, 0xF79E, 0xF79E, 0xEF7D, 0xEF5D,   // 0x1820 (6176) pixels
-0xEF5D, 0xEF7D, 0xF79D, 0xF79D, 0xF79D, 0xF79E, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE,   // 0x1830 (6192) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1840 (6208) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x2104, 0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3,   // 0x1850 (6224) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1860 (6240) pixels
-0x18E4, 0x18E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x1040,   // 0x1870 (6256) pixels
-0xA44F, 0xBCF1, 0x5A47, 0xA4B1, 0xB533, 0xC5F6, 0xDEBA, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1880 (6272) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFFE, 0xF7BD, 0xFFDE,   // 0x1890 (6288) pixels
-0xF77D, 0xFFFF, 0xF79E, 0xEF3C, 0xFFBE, 0xF79D, 0xEF7D, 0xEF7D, 0xEF5C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xDEDA, 0xE71B, 0xE71B,   // 0x18A0 (6304) pixels
-0xDEFB, 0xDEFB, 0xF79D, 0xD699, 0xDEBA, 0xE6FB, 0xDEFB, 0xEF5C, 0xEF3C, 0xE71B, 0xE73C, 0xE71B, 0xEF5D, 0xE71B, 0xE73C, 0xE73C,   // 0x18B0 (6320) pixels
-0xE73C, 0xEF5D, 0xEF3C, 0xE71C, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xE71B, 0xDEDB, 0xDEDB, 0xDEBA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEBA,   // 0x18C0 (6336) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEDA,   // 0x18D0 (6352) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xEF3C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE71B, 0xE71C,   // 0x18E0 (6368) pixels
-0xEF3C, 0xEF3C, 0xE73C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D,   // 0x18F0 (6384) pixels
-0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF77D,   // 0x1900 (6400) pixels
-0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1910 (6416) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18C3, 0x2124,   // 0x1920 (6432) pixels
-0x18C3, 0x18C3, 0x2104, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1930 (6448) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E3, 0x18E3,   // 0x1940 (6464) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x1903, 0x18E3, 0x2104, 0x18C3, 0x2124, 0x18E3, 0x1860, 0xC573, 0xAC8F, 0xA48F, 0x8BCD,   // 0x1950 (6480) pixels
-0xA4D1, 0xAD33, 0xD679, 0xEF5C, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1960 (6496) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xF7BD, 0xFFBE, 0xF79D, 0xF79D, 0xEF5C, 0xF77D,   // 0x1970 (6512) pixels
-0xF79E, 0xEF3C, 0xEF7D, 0xF79D, 0xEF7D, 0xEF5C, 0xEF7D, 0xEF3C, 0xDEDA, 0xDEFB, 0xDEDA, 0xDEDA, 0xE6FB, 0xDEFB, 0xDEDA, 0xDEFB,   // 0x1980 (6528) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEDA, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xE73C, 0xEF3C, 0xEF3C, 0xEF5C, 0xE71C, 0xEF3C, 0xE6FB,   // 0x1990 (6544) pixels
-0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xE73C, 0xDEDA, 0xD69A, 0xD6BA, 0xD699, 0xD6BA, 0xE6FB, 0xE73C,   // 0x19A0 (6560) pixels
-0xE71C, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x19B0 (6576) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE73C, 0xEF5C, 0xE71B, 0xE73C, 0xE73C, 0xE73C,   // 0x19C0 (6592) pixels
-0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xE73C, 0xEF5C, 0xEF7D, 0xF79E, 0xF7BE, 0xF79E, 0xF79D, 0xEF7D,   // 0x19D0 (6608) pixels
-0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xF79E, 0xEF7D, 0xEF5C, 0xEF5D, 0xF79D, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE,   // 0x19E0 (6624) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF,   // 0x19F0 (6640) pixels
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4208, 0x2104, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x2104,   // 0x1A00 (6656) pixels
-0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1A10 (6672) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1A20 (6688) pixels
-0x18C3, 0x1904, 0x18C3, 0x2104, 0x2104, 0x18E3, 0x18C2, 0x1060, 0xC5B4, 0xACD0, 0xACF1, 0x7B4B, 0x9C90, 0xAD12, 0xCE38, 0xEF1C,   // 0x1A30 (6704) pixels
-0xFFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1A40 (6720) pixels
-0xFFFE, 0xFFDE, 0xFFFF, 0xF7BD, 0xFFFF, 0xEF7C, 0xFF9D, 0xEF5C, 0xEF5C, 0xFFBE, 0xF77D, 0xF77D, 0xEF5D, 0xF77D, 0xF79D, 0xE71B,   // 0x1A50 (6736) pixels
-0x10A2, 0x0020, 0x0840, 0xB595, 0xD6BA, 0xE6FB, 0xD69A, 0xE6FB, 0xD6BA, 0xD699, 0xDEDA, 0xDEDA, 0xDEDA, 0xD699, 0xDEFB, 0xDEDA,   // 0x1A60 (6752) pixels
-0xE6FB, 0xEF5C, 0xDEFB, 0xF79D, 0xE73C, 0xEF5C, 0xE73C, 0xEF5C, 0xEF5C, 0xDEFB, 0xE73C, 0xE73C, 0xEF3C, 0xEF5D, 0xDEFB, 0xDEDA,   // 0x1A70 (6768) pixels
-0xDEFB, 0xD6BA, 0xD6BA, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xD6BA, 0xD6BA, 0xD6BA,   // 0x1A80 (6784) pixels
-0xDEDB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB,   // 0x1A90 (6800) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEDB, 0xDEBA, 0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C,   // 0x1AA0 (6816) pixels
-0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE73C, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFDF, 0xFFDF, 0xE73C, 0xEF3C, 0xEF5C, 0xEF5D,   // 0x1AB0 (6832) pixels
-0xEF7D, 0xF79D, 0xF79E, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE, 0xF79E, 0xF79E, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,   // 0x1AC0 (6848) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1AD0 (6864) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x2124, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1AE0 (6880) pixels
-0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1AF0 (6896) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x1904, 0x2104,   // 0x1B00 (6912) pixels
-0x18C3, 0x2104, 0x18E3, 0x1060, 0xC593, 0xEED8, 0xACD0, 0x8BCD, 0x83AC, 0xA4D1, 0xC5F6, 0xE6FA, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x1B10 (6928) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xF7BE, 0xFFDE, 0xF79D, 0xFFFF,   // 0x1B20 (6944) pixels
-0xF79D, 0xFFDE, 0xFFBE, 0xF7BD, 0xF79E, 0xEF3C, 0xF79E, 0xF79E, 0x83EF, 0x10A2, 0x0840, 0x0861, 0x18A2, 0x1081, 0x1061, 0x0000,   // 0x1B30 (6960) pixels
-0x8C70, 0xD6BA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEBA, 0xD699, 0xDEDA, 0xDEFB, 0xDEDA, 0xDEFB, 0xDEBA, 0xE71B, 0xDEFB, 0xE73C,   // 0x1B40 (6976) pixels
-0xEF7D, 0xE73C, 0xF77D, 0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEDA, 0xD6BA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB, 0xD6BA, 0xDEDB,   // 0x1B50 (6992) pixels
-0xD6BA, 0xDEDB, 0xD6BA, 0xD699, 0xDEDA, 0xD6BA, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB,   // 0x1B60 (7008) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x1B70 (7024) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C,   // 0x1B80 (7040) pixels
-0xF79D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79D, 0xFFBE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xFFBE,   // 0x1B90 (7056) pixels
-0xFFDF, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79D, 0xF79E, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE,   // 0x1BA0 (7072) pixels
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x1BB0 (7088) pixels
-0x2104, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1BC0 (7104) pixels
-0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1BD0 (7120) pixels
-0x1903, 0x1903, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x20E3, 0x1060,   // 0x1BE0 (7136) pixels
-0xACF0, 0xDE35, 0xE676, 0xB511, 0x7B6A, 0x9C8F, 0xB573, 0xD699, 0xEF7C, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1BF0 (7152) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xF7BE, 0xEF5C, 0xFFFF, 0xEF7D, 0xF79E, 0xF79D, 0xF77D, 0xEF7D,   // 0x1C00 (7168) pixels
-0xEF7D, 0xB5B6, 0x0840, 0x10A2, 0x1082, 0x1081, 0x10A1, 0x18C2, 0x0861, 0x0861, 0x0861, 0x0000, 0x8C70, 0xD698, 0xBDD6, 0xD699,   // 0x1C10 (7184) pixels
-0xC617, 0xD699, 0xD679, 0xCE38, 0xD699, 0xDEBA, 0xDEDA, 0xE71B, 0xE6FB, 0xE6FB, 0xEF3C, 0xE71B, 0xE71B, 0xEF5C, 0xE71B, 0xEF3C,   // 0x1C20 (7200) pixels
-0xDEFB, 0xE73C, 0xD6BA, 0xEF3C, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEBA, 0xD679, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEBA, 0xD6BA, 0xDEDA,   // 0x1C30 (7216) pixels
-0xD6BA, 0xD6BA, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE6FB, 0xDEFB,   // 0x1C40 (7232) pixels
-0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB,   // 0x1C50 (7248) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D,   // 0x1C60 (7264) pixels
-0xEF7D, 0xF79D, 0xF79D, 0xF77D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF77D, 0xF77D, 0xF79D, 0xF79D, 0xFFDF, 0xFFFF,   // 0x1C70 (7280) pixels
-0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1C80 (7296) pixels
-0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFDF, 0x18C3, 0x2104, 0x18E3, 0x18E3,   // 0x1C90 (7312) pixels
-0x18E3, 0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1CA0 (7328) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1CB0 (7344) pixels
-0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x1060, 0xB511, 0xDE55, 0xD614, 0xDE55,   // 0x1CC0 (7360) pixels
-0xB510, 0x942D, 0xAD32, 0xCE36, 0xE71B, 0xF79D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7DE, 0xFFDE, 0xFFFF, 0xFFBE, 0xFFDE, 0xF79D,   // 0x1CD0 (7376) pixels
-0xF79D, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFDE, 0xEF5C, 0xEF5C, 0xF79E, 0xF7BE, 0xEF5D, 0x18E3, 0x1082, 0x1081, 0x1081, 0x10A2, 0x10A2,   // 0x1CE0 (7392) pixels
-0x0841, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x1082, 0x0841, 0x1061, 0x9470, 0x39C5, 0x9CD2, 0xB575, 0xB575, 0xBDD6, 0xC617, 0xCE38,   // 0x1CF0 (7408) pixels
-0xD69A, 0xDEBA, 0xD6BA, 0xDEBA, 0xE71B, 0xE6FB, 0xDEDA, 0xEF3C, 0xEF7C, 0xE6FB, 0xEF3C, 0xEF3C, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x1D00 (7424) pixels
-0xD6BA, 0xCE79, 0xD6BA, 0xDEDA, 0xDEDA, 0xD6BA, 0xD679, 0xCE79, 0xDEDB, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEDA, 0xD6BA, 0xDEDA, 0xDEBA,   // 0x1D10 (7440) pixels
-0xD6BA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEBA, 0xD6BA, 0xD6BA, 0xD6BA,   // 0x1D20 (7456) pixels
-0xDEBA, 0xDEDA, 0xDEDA, 0xDEBA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x1D30 (7472) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEBA, 0xDEDB, 0xDEFB, 0xE71B, 0xEF7D, 0xF77D, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE,   // 0x1D40 (7488) pixels
-0xEF7D, 0xEF7D, 0xF77D, 0xF79E, 0xF7BE, 0xF79E, 0xF79D, 0xF77D, 0xF79D, 0xF79D, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDF,   // 0x1D50 (7504) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1D60 (7520) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x18E3,   // 0x1D70 (7536) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1D80 (7552) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E4, 0x18E4,   // 0x1D90 (7568) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x1060, 0xACAF, 0xE675, 0xDE55, 0xD5F3, 0xC5B3, 0xCDF4, 0x9C8F, 0xBD93,   // 0x1DA0 (7584) pixels
-0xD678, 0xE71B, 0xEF5C, 0xFFDE, 0xFFFF, 0xFFBE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xFFDE, 0xFFFF, 0xF77D, 0xF79D, 0xEF7D,   // 0x1DB0 (7600) pixels
-0x5ACB, 0x0841, 0x18C3, 0x0861, 0x1061, 0x10A2, 0x18C3, 0x1062, 0x10A2, 0x0821, 0x18A3, 0x1082, 0x0861, 0x1082, 0x0861, 0x1081,   // 0x1DC0 (7616) pixels
-0x18C2, 0x18A3, 0x18C3, 0x0020, 0x9470, 0x1060, 0x6B0B, 0x8C30, 0xAD54, 0xB575, 0xBDB6, 0xC5F7, 0xC618, 0xCE58, 0xD679, 0xD6BA,   // 0x1DD0 (7632) pixels
-0xDEBA, 0xE71B, 0xEF3C, 0xDEDA, 0xE6FB, 0xEF5C, 0xDEBA, 0xE6FB, 0xE71B, 0xD679, 0xDEDA, 0xD699, 0xD6BA, 0xD6BA, 0xD699, 0xD6BA,   // 0x1DE0 (7648) pixels
-0xD6BA, 0xD69A, 0xD699, 0xCE79, 0xD6BA, 0xD699, 0xD699, 0xD699, 0xD699, 0xD699, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x1DF0 (7664) pixels
-0xDEDB, 0xDEDA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDA, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA,   // 0x1E00 (7680) pixels
-0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEBA, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB,   // 0x1E10 (7696) pixels
-0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xEF5D, 0xEF7D, 0xF7BE, 0xFFDE, 0xF7BE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79E, 0xF7BE,   // 0x1E20 (7712) pixels
-0xFFBE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDF, 0xEF7D, 0xF77D, 0xF79E, 0xF7BE,   // 0x1E30 (7728) pixels
-0xFFBE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1E40 (7744) pixels
-0xFFDF, 0xFFFF, 0xFFDF, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1E50 (7760) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1E60 (7776) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E3, 0x18E4, 0x18E3, 0x18E3,   // 0x1E70 (7792) pixels
-0x18E3, 0x18E3, 0x18C3, 0x1881, 0xACCF, 0xC551, 0xD5F3, 0xD5F3, 0xCDD3, 0xDE56, 0xBD73, 0xB573, 0xBD95, 0xE6DA, 0xF75C, 0xF77D,   // 0x1E80 (7808) pixels
-0xF79D, 0xFFDE, 0xFFFF, 0xFFBE, 0xF79D, 0xF7BE, 0xF79E, 0xEF7D, 0xEF3C, 0xE71B, 0x2965, 0x10A2, 0x1081, 0x1081, 0x18C3, 0x0861,   // 0x1E90 (7824) pixels
-0x18A2, 0x18C3, 0x1082, 0x1082, 0x1082, 0x18A3, 0x0841, 0x1082, 0x1083, 0x1082, 0x0881, 0x0881, 0x0841, 0x18E3, 0x1082, 0x0000,   // 0x1EA0 (7840) pixels
-0x8C2F, 0x2102, 0x5AA9, 0x9450, 0x9CB2, 0xA513, 0xAD54, 0xB595, 0xBDD6, 0xC617, 0xCE58, 0xD6BA, 0xDEFB, 0xE71B, 0xEF3C, 0xEF3C,   // 0x1EB0 (7856) pixels
-0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xD6BA, 0xDEDA, 0xD699, 0xDEFB, 0xD6BA, 0xD679, 0xD699, 0xD679, 0xD6BA, 0xDEDA, 0xD699,   // 0x1EC0 (7872) pixels
-0xD69A, 0xD699, 0xD679, 0xCE79, 0xD699, 0xCE79, 0xCE79, 0xCE59, 0xCE79, 0xDEDA, 0xDEFB, 0xDEFB, 0xDEDB, 0xD6BA, 0xD69A, 0xD69A,   // 0x1ED0 (7888) pixels
-0xD6BA, 0xDEBA, 0xDEDA, 0xDEDB, 0xD69A, 0xD69A, 0xD69A, 0xD6BA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x1EE0 (7904) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB,   // 0x1EF0 (7920) pixels
-0xF79D, 0xF77D, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF79D, 0xF77D, 0xF79D, 0xF77D, 0xEF7D, 0xEF5D, 0xEF5D,   // 0x1F00 (7936) pixels
-0xEF7D, 0xEF7D, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,   // 0x1F10 (7952) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x2104, 0x2104,   // 0x1F20 (7968) pixels
-0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1F30 (7984) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x1F40 (8000) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C1,   // 0x1F50 (8016) pixels
-0x942D, 0xD5F3, 0xDE34, 0xD614, 0xDE76, 0xD656, 0xC5B4, 0xC5F5, 0xC5F6, 0x9471, 0x6B0B, 0x738D, 0x20E3, 0x1041, 0x0840, 0x0840,   // 0x1F60 (8032) pixels
-0x0861, 0x18C3, 0x0861, 0x18C3, 0x10A2, 0x0861, 0x10A2, 0x18C3, 0x0861, 0x1082, 0x0841, 0x10A2, 0x10A2, 0x0841, 0x0861, 0x18C3,   // 0x1F70 (8048) pixels
-0x1082, 0x10A3, 0x18A3, 0x1062, 0x1082, 0x0841, 0x1081, 0x1061, 0x18A2, 0x0841, 0x0820, 0x0820, 0x9470, 0x734B, 0x6AEA, 0x7B8D,   // 0x1F80 (8064) pixels
-0x9450, 0xA4F3, 0xA513, 0xB575, 0xC5F7, 0xCE58, 0xCE58, 0xD6BA, 0xDEFB, 0xE6FB, 0xD6BA, 0xE71B, 0x1081, 0x1081, 0xE73C, 0xDEFB,   // 0x1F90 (8080) pixels
-0xDEDA, 0xD699, 0xCE79, 0xDEDA, 0xD6BA, 0xD6BA, 0xD699, 0xD6BA, 0xD6BA, 0xDEDA, 0xD6BA, 0xD699, 0xD679, 0xDEBA, 0xD679, 0xCE79,   // 0x1FA0 (8096) pixels
-0xCE59, 0xCE79, 0xD699, 0xD699, 0xD699, 0xD6BA, 0xD6BA, 0xD69A, 0xDEBA, 0xD6BA, 0xD69A, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEDA,   // 0x1FB0 (8112) pixels
-0xD6BA, 0xD6BA, 0xD6BA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEFB, 0xE71B,   // 0x1FC0 (8128) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xF77D, 0xEF7D, 0xF79D, 0xF79E,   // 0x1FD0 (8144) pixels
-0xF79D, 0xF79D, 0xF77D, 0xF79E, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79E, 0xF7BE, 0xF79D, 0xF7BE, 0xF7BE,   // 0x1FE0 (8160) pixels
-0xF7BE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x1FF0 (8176) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3,   // 0x2000 (8192) pixels
-0x2124, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2010 (8208) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2020 (8224) pixels
-0x18E4, 0x18E4, 0x18E4, 0x18E4, 0x18E3, 0x18E4, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20C2, 0x942D, 0xCDF4, 0xD635, 0xD635,   // 0x2030 (8240) pixels
-0xCE15, 0xB552, 0x1040, 0x20C1, 0x18A1, 0x1881, 0x0820, 0x1061, 0x0841, 0x1061, 0x18A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x0841,   // 0x2040 (8256) pixels
-0x1082, 0x18C3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x1082, 0x0841, 0x1082, 0x1082, 0x0861, 0x0861, 0x1082, 0x0000, 0x0841, 0x0821,   // 0x2050 (8272) pixels
-0x1062, 0x0841, 0x0861, 0x0861, 0x1061, 0x1081, 0x1882, 0x0820, 0x7B8C, 0x736C, 0x62CA, 0x6B2C, 0x83EF, 0x9CB2, 0xA4F3, 0xAD34,   // 0x2060 (8288) pixels
-0xB595, 0xC5F7, 0xC617, 0xD699, 0xDEDA, 0xE71B, 0xDEDA, 0x18E3, 0x1061, 0x1081, 0x0020, 0x2124, 0xD699, 0xD699, 0xCE79, 0xCE79,   // 0x2070 (8304) pixels
-0xCE79, 0xCE79, 0xCE79, 0xCE58, 0xD6BA, 0xD699, 0xD679, 0xD699, 0xCE79, 0xD6BA, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xD699, 0xD679,   // 0x2080 (8320) pixels
-0xD679, 0xD6BA, 0xDEDA, 0xDEDA, 0xD6BA, 0xD6BA, 0xDEDA, 0xDEDB, 0xDEDA, 0xD6BA, 0xD69A, 0xD69A, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA,   // 0x2090 (8336) pixels
-0xD6BA, 0xDEBA, 0xDEBA, 0xDEBA, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEDA, 0xD6BA, 0xDEDB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B,   // 0x20A0 (8352) pixels
-0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xF77D, 0xEF7D, 0xF7BE, 0xFFDE, 0xF7BE, 0xF79E, 0xF77D, 0xF79D,   // 0x20B0 (8368) pixels
-0xEF7D, 0xEF5D, 0xEF7D, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDE,   // 0x20C0 (8384) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF7BE, 0xF79D, 0xEF7D, 0xEF7D, 0xF79E, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x20D0 (8400) pixels
-0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x2104, 0x18E3, 0x18C3, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104,   // 0x20E0 (8416) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x20F0 (8432) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4,   // 0x2100 (8448) pixels
-0x18E3, 0x18E4, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x20E2, 0x8BEE, 0xC5B4, 0xCE15, 0x734B, 0x20E1, 0x1060, 0x18A1, 0x0840,   // 0x2110 (8464) pixels
-0x0840, 0x1061, 0x0841, 0x0861, 0x10A2, 0x1082, 0x1082, 0x18A2, 0x0861, 0x1082, 0x1082, 0x18C3, 0x1082, 0x0861, 0x1082, 0x0861,   // 0x2120 (8480) pixels
-0x1082, 0x0841, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0841, 0x0841, 0x1082, 0x1062, 0x0862, 0x0862, 0x0841, 0x0861, 0x0861,   // 0x2130 (8496) pixels
-0x1061, 0x1061, 0x0841, 0x0840, 0x8C0E, 0x8C2E, 0x5A89, 0x6B0B, 0x7B8D, 0x9490, 0xA513, 0xB574, 0xB595, 0xC5F7, 0xCE38, 0xDEDA,   // 0x2140 (8512) pixels
-0xDEDA, 0xE73C, 0x18C2, 0x10A2, 0x0020, 0x0841, 0x0861, 0x10A2, 0x0841, 0xBDD6, 0xB5B6, 0xC617, 0xCE58, 0xCE38, 0xCE79, 0xCE79,   // 0x2150 (8528) pixels
-0xCE79, 0xCE58, 0xCE58, 0xD679, 0xCE79, 0xD699, 0xCE58, 0xCE59, 0xCE58, 0xCE58, 0xD699, 0xD69A, 0xD69A, 0xD6BA, 0xD6BA, 0xD6BA,   // 0x2160 (8544) pixels
-0xD6BA, 0xDEDA, 0xDEDA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEBA, 0xDEDA, 0xDEDA, 0xDEDA,   // 0x2170 (8560) pixels
-0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEBA, 0xD6BA, 0xDEDA, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB,   // 0x2180 (8576) pixels
-0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xF79D, 0xF79D, 0xFFDE, 0xFFFF, 0xF7BE, 0xEF7D, 0xEF3C, 0xE73C, 0xF79E, 0xF79D, 0xF79E, 0xFFBE,   // 0x2190 (8592) pixels
-0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFBE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDE, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE,   // 0x21A0 (8608) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x21B0 (8624) pixels
-0xFFFF, 0x5AEB, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x2104, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x21C0 (8640) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x21D0 (8656) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E4, 0x2104, 0x18E3, 0x18E4, 0x18E4, 0x18E3, 0x18E4, 0x18E3, 0x18E3,   // 0x21E0 (8672) pixels
-0x18E3, 0x18C3, 0x18E3, 0x20E3, 0x41E6, 0x1880, 0x1040, 0x18A1, 0x1081, 0x10A1, 0x0860, 0x0861, 0x1061, 0x1082, 0x1082, 0x10A3,   // 0x21F0 (8688) pixels
-0x1082, 0x18A3, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1082, 0x0861, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x1082, 0x10A2, 0x1082, 0x1082,   // 0x2200 (8704) pixels
-0x1082, 0x0841, 0x0862, 0x0861, 0x0862, 0x0861, 0x0862, 0x0841, 0x0842, 0x0841, 0x0861, 0x0840, 0x0861, 0x1061, 0x1041, 0x0000,   // 0x2210 (8720) pixels
-0x8C0E, 0x8C2E, 0x5A88, 0x6AEB, 0x736C, 0x8C2F, 0x9CB2, 0xAD54, 0xAD54, 0xBDD6, 0xC638, 0xD6BA, 0xE6FB, 0x4207, 0x0861, 0x0861,   // 0x2220 (8736) pixels
-0x1082, 0x0861, 0x0861, 0x0020, 0x0840, 0x0861, 0xA514, 0xB595, 0xB5B6, 0xBDF7, 0xBDF7, 0xBDD6, 0xCE79, 0xC638, 0xCE58, 0xCE38,   // 0x2230 (8752) pixels
-0xCE59, 0xD69A, 0xCE79, 0xCE59, 0xCE79, 0xCE59, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE79, 0xD679, 0xCE79,   // 0x2240 (8768) pixels
-0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xDEDA, 0xDEDA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xD699, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB,   // 0x2250 (8784) pixels
-0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C,   // 0x2260 (8800) pixels
-0xFFDF, 0xFFBE, 0xFFBE, 0xF79E, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xEF7D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xF77D, 0xEF7D,   // 0x2270 (8816) pixels
-0xEF7D, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2280 (8832) pixels
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18C3, 0x2104, 0x18C3,   // 0x2290 (8848) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x22A0 (8864) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18E3,   // 0x22B0 (8880) pixels
-0x20E3, 0x18C3, 0x2104, 0x20E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,   // 0x22C0 (8896) pixels
-0x18A2, 0x1061, 0x18A2, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x0862, 0x1082, 0x1082, 0x0882, 0x0862, 0x0862, 0x0862, 0x0862,   // 0x22D0 (8912) pixels
-0x0862, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0861, 0x0841, 0x0020, 0x0861, 0x0841,   // 0x22E0 (8928) pixels
-0x0841, 0x0841, 0x0841, 0x0861, 0x0862, 0x0861, 0x0861, 0x0860, 0x0861, 0x0861, 0x0840, 0x0820, 0x7BAC, 0x83ED, 0x5A88, 0x5AA9,   // 0x22F0 (8944) pixels
-0x6B2B, 0x83EE, 0xA4F2, 0xAD54, 0xAD54, 0xC617, 0xCE58, 0xCE79, 0xA514, 0x1081, 0x0861, 0x0841, 0x0841, 0x10A2, 0x0020, 0x0861,   // 0x2300 (8960) pixels
-0x0861, 0x1062, 0x0841, 0xA534, 0xB5B6, 0xB596, 0xBDB6, 0xCE58, 0xC617, 0xBDF7, 0xBDF7, 0xC638, 0xC638, 0xC5F7, 0xCE79, 0xCE59,   // 0x2310 (8976) pixels
-0xCE79, 0xCE59, 0xCE79, 0xD699, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xD699, 0xD69A, 0xD69A, 0xD69A,   // 0x2320 (8992) pixels
-0xCE79, 0xCE79, 0xD699, 0xD69A, 0xDEBA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x2330 (9008) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xEF5D, 0xF79D, 0xFFDE, 0xFFDF,   // 0x2340 (9024) pixels
-0xFFFF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFDE, 0xF79E, 0xEF7D, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFDE,   // 0x2350 (9040) pixels
-0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2360 (9056) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF5D, 0x10A2, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2370 (9072) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2380 (9088) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x2104, 0x18E3, 0x2124, 0x18E3, 0x18C3, 0x2104, 0x20E4, 0x18E3, 0x2104, 0x18C3,   // 0x2390 (9104) pixels
-0x10A2, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x1061, 0x18A2, 0x1081, 0x0861,   // 0x23A0 (9120) pixels
-0x10A2, 0x0861, 0x0862, 0x0862, 0x0862, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x23B0 (9136) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0861, 0x0881, 0x0882, 0x1082,   // 0x23C0 (9152) pixels
-0x1082, 0x1082, 0x1081, 0x1081, 0x10A2, 0x1081, 0x1061, 0x1060, 0x5AA9, 0x8C0E, 0x5A89, 0x630B, 0x630B, 0x7BCE, 0x9470, 0xA4F3,   // 0x23D0 (9168) pixels
-0xAD54, 0xC5F7, 0xC638, 0xC617, 0x10A2, 0x1081, 0x0861, 0x0840, 0x1082, 0x0861, 0x1082, 0x10A2, 0x0861, 0x0020, 0x1082, 0x9492,   // 0x23E0 (9184) pixels
-0x9CF3, 0xAD54, 0xB595, 0xB595, 0xB5B6, 0xC617, 0xC638, 0xCE58, 0xC617, 0xC618, 0xCE59, 0xC638, 0xCE59, 0xCE38, 0xCE59, 0xCE79,   // 0x23F0 (9200) pixels
-0xCE59, 0xCE59, 0xCE59, 0xCE79, 0xD69A, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDB, 0xD6BA, 0xD679, 0xCE79, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA,   // 0x2400 (9216) pixels
-0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB,   // 0x2410 (9232) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xEF3C, 0xEF5D, 0xF79E, 0xF79E, 0xFFBE, 0xF7BE, 0xFFDF, 0xFFDF,   // 0x2420 (9248) pixels
-0xFFFF, 0xFFDF, 0xFFDF, 0xF7BE, 0xF79D, 0xF79D, 0xF7BE, 0xFFFF, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E,   // 0x2430 (9264) pixels
-0xFFDF, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFFF,   // 0x2440 (9280) pixels
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2450 (9296) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2460 (9312) pixels
-0x2124, 0x18C3, 0x2104, 0x2104, 0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x2924, 0x20E4, 0x18C3, 0x18E3, 0x18E3,   // 0x2470 (9328) pixels
-0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x1061, 0x1082, 0x0841, 0x0862, 0x1082, 0x0841, 0x1082, 0x0841,   // 0x2480 (9344) pixels
-0x1082, 0x1082, 0x1081, 0x0861, 0x1081, 0x1081, 0x0861, 0x1061, 0x1082, 0x0861, 0x0861, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841,   // 0x2490 (9360) pixels
-0x0841, 0x1082, 0x0861, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x24A0 (9376) pixels
-0x10A2, 0x0840, 0x1081, 0x0000, 0x18A1, 0x8C0E, 0x734C, 0x62EA, 0x6B4C, 0x83EE, 0x9491, 0xA513, 0xAD74, 0xC5F7, 0xBDF7, 0x10A2,   // 0x24B0 (9392) pixels
-0x0861, 0x0861, 0x0841, 0x1082, 0x1082, 0x0841, 0x1082, 0x0020, 0x1062, 0x0861, 0x0841, 0x1082, 0x1082, 0x94B2, 0xAD75, 0xA513,   // 0x24C0 (9408) pixels
-0xB595, 0xB595, 0xB5B6, 0xBDD6, 0xC617, 0xC617, 0xC618, 0xC638, 0xC638, 0xC618, 0xCE58, 0xCE59, 0xCE58, 0xCE59, 0xCE79, 0xCE79,   // 0x24D0 (9424) pixels
-0xC638, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xD679, 0xD699, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEBA, 0xD6BA, 0xD6BA,   // 0x24E0 (9440) pixels
-0xE71B, 0xE71B, 0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDB, 0xE6FB,   // 0x24F0 (9456) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xFFBE, 0xF7BE, 0xF79E, 0xF77D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDE, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D,   // 0x2500 (9472) pixels
-0xF77D, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xEF7D, 0xEF7D, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF,   // 0x2510 (9488) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,   // 0x2520 (9504) pixels
-0x18C3, 0x2124, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2530 (9520) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x2104, 0x2104, 0x18C3,   // 0x2540 (9536) pixels
-0x18E3, 0x2945, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18E3,   // 0x2550 (9552) pixels
-0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x0841, 0x0841, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0841, 0x0841, 0x0840, 0x0840, 0x0840,   // 0x2560 (9568) pixels
-0x1081, 0x0860, 0x0820, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x2570 (9584) pixels
-0x10A2, 0x10A2, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861, 0x0881, 0x0881, 0x1081, 0x1081, 0x1061, 0x0820,   // 0x2580 (9600) pixels
-0x18C1, 0x7BCD, 0x5268, 0x6B2B, 0x62EA, 0x840F, 0x8C50, 0xA513, 0xBDB6, 0xBDF7, 0xC617, 0x1061, 0x0841, 0x0841, 0x0861, 0x1082,   // 0x2590 (9616) pixels
-0x0861, 0x1082, 0x0861, 0x1082, 0x0841, 0x0821, 0x1061, 0x1062, 0x0020, 0x9491, 0xAD34, 0xA513, 0xB5B6, 0xAD54, 0xBDD6, 0xBDD6,   // 0x25A0 (9632) pixels
-0xC617, 0xC617, 0xC5F7, 0xC618, 0xC618, 0xC618, 0xCE59, 0xCE79, 0xCE59, 0xCE58, 0xC638, 0xC618, 0xCE79, 0xD69A, 0xD6BA, 0xD6BA,   // 0x25B0 (9648) pixels
-0xD6BA, 0xD69A, 0xD69A, 0xD6BA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEBA,   // 0x25C0 (9664) pixels
-0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71C, 0xEF3C, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x25D0 (9680) pixels
-0xF79D, 0xF77D, 0xF79D, 0xF79D, 0xF79E, 0xF79D, 0xF79D, 0xEF7D, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xF7BE, 0xF79D, 0xEF7D,   // 0x25E0 (9696) pixels
-0xF77D, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF,   // 0x25F0 (9712) pixels
-0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x2104, 0x18C3, 0x18C3,   // 0x2600 (9728) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2610 (9744) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x10A2, 0x18E3, 0x2104, 0x18E3, 0x2104, 0x2104,   // 0x2620 (9760) pixels
-0x2104, 0x2103, 0x18C3, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x2104, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,   // 0x2630 (9776) pixels
-0x0841, 0x1062, 0x0862, 0x0841, 0x0842, 0x0862, 0x1082, 0x18E3, 0x18C2, 0x18A2, 0x1081, 0x1081, 0x18A2, 0x18A2, 0x18A2, 0x18A2,   // 0x2640 (9792) pixels
-0x1082, 0x1061, 0x0861, 0x0841, 0x0861, 0x1081, 0x10A2, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x1081, 0x0841, 0x0861, 0x0861, 0x0840,   // 0x2650 (9808) pixels
-0x0840, 0x0840, 0x0840, 0x0840, 0x0841, 0x0840, 0x0860, 0x0860, 0x1081, 0x0820, 0x1061, 0x0000, 0x18C1, 0x7BAD, 0x5248, 0x6B4C,   // 0x2660 (9824) pixels
-0x6B4C, 0x7BCE, 0x9CB2, 0xA513, 0xAD54, 0x10A2, 0x0861, 0x0861, 0x0841, 0x1082, 0x0841, 0x0841, 0x0862, 0x1082, 0x0841, 0x0841,   // 0x2670 (9840) pixels
-0x0861, 0x1062, 0x0861, 0x0861, 0x1061, 0x18C2, 0x1081, 0x9491, 0x9CD2, 0xAD75, 0xAD75, 0xB595, 0xB575, 0xB575, 0xC618, 0xC617,   // 0x2680 (9856) pixels
-0xC5F7, 0xBDF7, 0xC617, 0xC617, 0xC618, 0xCE79, 0xD699, 0xD699, 0xD679, 0xD69A, 0xD6BA, 0xD6BA, 0xD69A, 0xD699, 0xCE79, 0xCE59,   // 0x2690 (9872) pixels
-0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEDA, 0xDEBA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEBA, 0xDEDB,   // 0x26A0 (9888) pixels
-0xDEBA, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xEF5C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xF79E, 0xF79E, 0xF7BE, 0xF79E,   // 0x26B0 (9904) pixels
-0xF7BE, 0xF79D, 0xF79E, 0xF79D, 0xF77D, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x26C0 (9920) pixels
-0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xEF7D, 0xEF7D,   // 0x26D0 (9936) pixels
-0xF79E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x18C3, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x26E0 (9952) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x26F0 (9968) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x18C3, 0x18E3, 0xD69A, 0xFFFF, 0xFFBE, 0xD679, 0x20E3, 0x18C3,   // 0x2700 (9984) pixels
-0x2104, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x0020, 0x0861, 0x0841, 0x0862,   // 0x2710 (10000) pixels
-0x1082, 0x1082, 0x10A3, 0x10A2, 0x1081, 0x1081, 0x0861, 0x0840, 0x0840, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x2720 (10016) pixels
-0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0840, 0x0861, 0x0861, 0x0841, 0x0841, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840,   // 0x2730 (10032) pixels
-0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x1061, 0x1061, 0x0800, 0x20E2, 0x8C0E, 0x5A69, 0x6AEB, 0x7B8D, 0x8C50, 0xA4F3, 0xAD34,   // 0x2740 (10048) pixels
-0x2944, 0x0840, 0x1082, 0x0840, 0x1082, 0x0861, 0x0862, 0x1082, 0x0841, 0x0841, 0x0861, 0x1082, 0x0861, 0x1062, 0x0861, 0x1082,   // 0x2750 (10064) pixels
-0x18E3, 0x0841, 0x0840, 0x1081, 0x8C50, 0x9CF3, 0x9CD2, 0xAD75, 0xBDB6, 0xBDD6, 0xC617, 0xC638, 0xCE38, 0xC618, 0xC618, 0xC617,   // 0x2760 (10080) pixels
-0xC618, 0xCE59, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xCE59, 0xCE58, 0xCE79, 0xD679, 0xD699, 0xD699, 0xD6BA, 0xD6BA, 0xD6BA, 0xD69A,   // 0x2770 (10096) pixels
-0xD69A, 0xD69A, 0xD699, 0xD699, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE73C, 0xE71C, 0xE71C, 0xE73C,   // 0x2780 (10112) pixels
-0xEF3C, 0xEF3C, 0xE73C, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xFFDE, 0xF7BE, 0xF7BE, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79D,   // 0x2790 (10128) pixels
-0xF7BE, 0xF79E, 0xF79D, 0xF79E, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x27A0 (10144) pixels
-0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x27B0 (10160) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x2104, 0x18C3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x27C0 (10176) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x27D0 (10192) pixels
-0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFFBE, 0xE71B, 0x5289, 0x18C3, 0x10A2, 0x18E3, 0x18E3,   // 0x27E0 (10208) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x0881, 0x0041, 0x0041, 0x0882, 0x0862, 0x10A3, 0x10A3, 0x0862,   // 0x27F0 (10224) pixels
-0x0862, 0x0861, 0x0881, 0x0861, 0x0841, 0x0841, 0x0842, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841,   // 0x2800 (10240) pixels
-0x0861, 0x0861, 0x0861, 0x0840, 0x1061, 0x0861, 0x0820, 0x1061, 0x0820, 0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x0820, 0x0820,   // 0x2810 (10256) pixels
-0x0820, 0x0820, 0x0820, 0x0800, 0x6B2B, 0x734B, 0x62CA, 0x7B6D, 0x7BAE, 0x8C50, 0x9CB2, 0xAD54, 0x18A2, 0x1061, 0x0020, 0x0861,   // 0x2820 (10272) pixels
-0x0861, 0x0861, 0x1082, 0x0841, 0x0841, 0x1082, 0x0841, 0x0841, 0x0862, 0x0841, 0x1082, 0x1061, 0x10A2, 0x0861, 0x1081, 0x0861,   // 0x2830 (10288) pixels
-0x2124, 0x9491, 0xA534, 0xA513, 0xB5B6, 0xB595, 0xBDF7, 0xBDD7, 0xBDD6, 0xBDF7, 0xC618, 0xC638, 0xCE38, 0xCE79, 0xCE59, 0xCE38,   // 0x2840 (10304) pixels
-0xCE59, 0xCE79, 0xCE79, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEBA, 0xDEBA, 0xDEBA,   // 0x2850 (10320) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C,   // 0x2860 (10336) pixels
-0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xF79E, 0xF77D, 0xF77D, 0xEF7D, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE,   // 0x2870 (10352) pixels
-0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE,   // 0x2880 (10368) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x2890 (10384) pixels
-0x10A2, 0x2104, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x28A0 (10400) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x2124, 0x8C51, 0xFFFF,   // 0x28B0 (10416) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF79E, 0xEF5D, 0xEF5C, 0xDEBA, 0xCE58, 0xAD34, 0x18A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3,   // 0x28C0 (10432) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x0882, 0x0861, 0x10A3, 0x0862, 0x0861, 0x10A3, 0x0021, 0x1082, 0x1082, 0x0021, 0x0841, 0x1082,   // 0x28D0 (10448) pixels
-0x0841, 0x0020, 0x0861, 0x1082, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0840,   // 0x28E0 (10464) pixels
-0x2944, 0x41E7, 0x5269, 0x736D, 0x7BAD, 0x7BCE, 0x83EE, 0x83EF, 0x83EF, 0x83EF, 0x840F, 0x8C0F, 0x8C30, 0x8C0F, 0x9491, 0x8C30,   // 0x28F0 (10480) pixels
-0x5268, 0x2923, 0x83EE, 0x9450, 0x9491, 0x94B1, 0x9471, 0x10A2, 0x0840, 0x0840, 0x1081, 0x0861, 0x1082, 0x0841, 0x0861, 0x1082,   // 0x2900 (10496) pixels
-0x0841, 0x0841, 0x0862, 0x0841, 0x1062, 0x1062, 0x0841, 0x1082, 0x0840, 0x1082, 0x0000, 0x1081, 0x0861, 0x0820, 0x9CD2, 0xAD54,   // 0x2910 (10512) pixels
-0xA514, 0xBDD6, 0xB5B6, 0xBDB6, 0xBDB6, 0xB5B6, 0xBDD6, 0xB5B6, 0xBDD6, 0xC618, 0xCE58, 0xCE58, 0xCE58, 0xCE79, 0xCE79, 0xCE79,   // 0x2920 (10528) pixels
-0xCE79, 0xD679, 0xD699, 0xD6BA, 0xD699, 0xD699, 0xD69A, 0xD6BA, 0xDEDA, 0xDEFB, 0xDEFB, 0xDEFB, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEBA,   // 0x2930 (10544) pixels
-0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB,   // 0x2940 (10560) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF79D, 0xF79D, 0xF7BE, 0xFFDE, 0xFFBE, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF,   // 0x2950 (10576) pixels
-0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF,   // 0x2960 (10592) pixels
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xF7BE, 0xD6BA, 0x2104, 0x18E3, 0x1082, 0x2124,   // 0x2970 (10608) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2980 (10624) pixels
-0x2104, 0x18C3, 0x2104, 0x2124, 0x18E3, 0x18C3, 0x2104, 0x18C3, 0x18E4, 0x31A7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDE,   // 0x2990 (10640) pixels
-0xFFDE, 0xE73B, 0xD6BA, 0xD6BA, 0xC618, 0xBDD7, 0xB596, 0x18A3, 0x18A2, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x10C2, 0x10C3, 0x10C2,   // 0x29A0 (10656) pixels
-0x0020, 0x0841, 0x0020, 0x18A2, 0x1061, 0x0841, 0x1062, 0x0862, 0x1082, 0x0861, 0x1061, 0x0000, 0x0000, 0x0840, 0x0000, 0x0020,   // 0x29B0 (10672) pixels
-0x0020, 0x0820, 0x1061, 0x736D, 0x7BCE, 0x7BAE, 0x630B, 0x2903, 0x1061, 0x5248, 0x736D, 0x630B, 0x738D, 0x734C, 0x738D, 0x736C,   // 0x29C0 (10688) pixels
-0x7BCE, 0x738D, 0x7BCE, 0x736D, 0x840F, 0x83EF, 0x7B8D, 0x83EE, 0x7BAE, 0x83EE, 0x840F, 0x83EE, 0x840F, 0x8C2F, 0x9471, 0x9471,   // 0x29D0 (10704) pixels
-0x9CB2, 0x83EF, 0x18C2, 0x0841, 0x0841, 0x0861, 0x1082, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x1082, 0x0841, 0x0841, 0x1082,   // 0x29E0 (10720) pixels
-0x1062, 0x1082, 0x0841, 0x1082, 0x1082, 0x0841, 0x10A2, 0x0840, 0x0820, 0x2103, 0x8C71, 0xAD54, 0xAD75, 0xB595, 0xBDF7, 0xBDD7,   // 0x29F0 (10736) pixels
-0xBDD7, 0xBDB6, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDF7, 0xC5F7, 0xC5F7, 0xC5F7, 0xC618, 0xC617, 0xC617, 0xC618, 0xCE38, 0xCE58, 0xCE59,   // 0x2A00 (10752) pixels
-0xD699, 0xD699, 0xCE79, 0xCE79, 0xD69A, 0xD69A, 0xD699, 0xD699, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x2A10 (10768) pixels
-0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE,   // 0x2A20 (10784) pixels
-0xF7BE, 0xF7BE, 0xF79E, 0xF77D, 0xF79D, 0xF79D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF77D, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF,   // 0x2A30 (10800) pixels
-0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x2A40 (10816) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2A50 (10832) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1904, 0x18E3,   // 0x2A60 (10848) pixels
-0x18E3, 0x2104, 0x18E3, 0x2104, 0x18E4, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xDEFB, 0xD699, 0xC618,   // 0x2A70 (10864) pixels
-0xCE59, 0xBDB6, 0xAD55, 0x7BAE, 0x1082, 0x1082, 0x18C2, 0x18A2, 0x18C2, 0x10C2, 0x10C2, 0x18E3, 0x0000, 0x1081, 0x1061, 0x1060,   // 0x2A80 (10880) pixels
-0x1020, 0x1060, 0x1882, 0x1061, 0x0840, 0x0841, 0x0800, 0x0820, 0x0800, 0x0820, 0x4227, 0x73AD, 0x738D, 0x630B, 0x0840, 0x5A89,   // 0x2A90 (10896) pixels
-0x62EB, 0x62EA, 0x6B4C, 0x630B, 0x6B2C, 0x734C, 0x7B8D, 0x736D, 0x7BAD, 0x7BAD, 0x736C, 0x7BCE, 0x7BCE, 0x7BAE, 0x8C30, 0x8C30,   // 0x2AA0 (10912) pixels
-0x83EE, 0x83EE, 0x83EF, 0x840F, 0x8C0F, 0x8C50, 0x8C2F, 0x9491, 0x8C70, 0x8C50, 0x9491, 0x9491, 0x8C71, 0x18A2, 0x0861, 0x1081,   // 0x2AB0 (10928) pixels
-0x0861, 0x0841, 0x0841, 0x1082, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x1082, 0x0861, 0x1082,   // 0x2AC0 (10944) pixels
-0x10A2, 0x0841, 0x0861, 0x0000, 0x5289, 0x52AA, 0x7BCE, 0x9CD2, 0xA4F3, 0xB575, 0xAD75, 0xAD55, 0xB575, 0xB595, 0xBDF7, 0xC5F7,   // 0x2AD0 (10960) pixels
-0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xC618, 0xC638, 0xCE58, 0xCE38, 0xCE58, 0xC638, 0xC638, 0xCE58, 0xCE79, 0xCE79, 0xCE79,   // 0x2AE0 (10976) pixels
-0xD699, 0xD69A, 0xD69A, 0xD6BA, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB,   // 0x2AF0 (10992) pixels
-0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xF7BE, 0xF79E, 0xF77D, 0xF77D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF,   // 0x2B00 (11008) pixels
-0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFBE, 0xF7BE, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF,   // 0x2B10 (11024) pixels
-0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF79E, 0xEF7D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xFFDF,   // 0x2B20 (11040) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0x7BEF, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2B30 (11056) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x1904, 0x18C3, 0x2104, 0x2104, 0x2104, 0x18C3, 0x18C3,   // 0x2B40 (11072) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF7D, 0xE73C, 0xDEFB, 0xE73C, 0xC638, 0xC638, 0xBDD6, 0xAD75, 0x94B2,   // 0x2B50 (11088) pixels
-0x10A2, 0x1082, 0x1081, 0x10A2, 0x1062, 0x18C3, 0x18C3, 0x10A2, 0x0820, 0x0800, 0x1020, 0x1020, 0x1860, 0x1020, 0x0800, 0x1040,   // 0x2B60 (11104) pixels
-0x0820, 0x0820, 0x3143, 0x6AEA, 0x734B, 0x734C, 0x39A5, 0x5268, 0x5AA9, 0x5AC9, 0x62EA, 0x630B, 0x6B2C, 0x6B4B, 0x6B2B, 0x734C,   // 0x2B70 (11120) pixels
-0x6B4C, 0x83EE, 0x736D, 0x7BAD, 0x7BAD, 0x738D, 0x8C30, 0x7BCE, 0x83EF, 0x8C30, 0x8C30, 0x9491, 0x9491, 0x9CB1, 0x9471, 0x9491,   // 0x2B80 (11136) pixels
-0x9CB2, 0x9CB2, 0x9CD2, 0x9CB1, 0xA4F3, 0x9CD2, 0xA4F3, 0x9CB2, 0x9CD3, 0x0861, 0x0861, 0x0841, 0x10A2, 0x0861, 0x0861, 0x0861,   // 0x2B90 (11152) pixels
-0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1062, 0x0821, 0x10A2, 0x0000, 0x0841, 0x0820, 0x0000, 0x5289,   // 0x2BA0 (11168) pixels
-0x5AEB, 0x632C, 0x738D, 0x8430, 0xA513, 0xAD54, 0xB575, 0xB595, 0xAD55, 0xAD75, 0xBDB6, 0xBDD7, 0xB5B6, 0xBDD6, 0xBDD7, 0xBDD7,   // 0x2BB0 (11184) pixels
-0xBDF7, 0xC638, 0xC618, 0xC617, 0xC5F7, 0xC638, 0xCE58, 0xCE59, 0xD699, 0xD699, 0xD679, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xCE59,   // 0x2BC0 (11200) pixels
-0xD6BA, 0xDEDB, 0xDEDB, 0xDEBA, 0xD699, 0xCE79, 0xD679, 0xD6BA, 0xDEBA, 0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xDEFB,   // 0x2BD0 (11216) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xF79D, 0xF79D, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE,   // 0x2BE0 (11232) pixels
-0xFFDE, 0xF7BE, 0xF79E, 0xF79D, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE,   // 0x2BF0 (11248) pixels
-0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFFF, 0x8C71,   // 0x2C00 (11264) pixels
-0x18E3, 0x2104, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2C10 (11280) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x18C3, 0x2104, 0x18C3, 0x18C3, 0x2124, 0x2104, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2C20 (11296) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xE71B, 0xDEFB, 0xCE59, 0xC618, 0xBDF7, 0x9CF3, 0xA534, 0xA534, 0x8430, 0x0841, 0x18A2, 0x1082,   // 0x2C30 (11312) pixels
-0x18C3, 0x1082, 0x1082, 0x18C3, 0x1040, 0x7B8C, 0xB532, 0xBD73, 0xB532, 0xC593, 0xACF1, 0xA4D0, 0x9C90, 0x8C2E, 0x6AE9, 0x6AE9,   // 0x2C40 (11328) pixels
-0x4A06, 0x5207, 0x5AA9, 0x62CA, 0x630B, 0x62EA, 0x6B0B, 0x734C, 0x630B, 0x6B4B, 0x736C, 0x6B2B, 0x7BCE, 0x736D, 0x83EE, 0x83EF,   // 0x2C50 (11344) pixels
-0x8C50, 0x8C50, 0x9471, 0x94B1, 0x9491, 0xAD34, 0x9491, 0xA513, 0xA513, 0xAD33, 0x9CD2, 0xAD33, 0xA513, 0xA4F3, 0xAD33, 0xAD54,   // 0x2C60 (11360) pixels
-0x9CD2, 0xBDB6, 0xAD34, 0xAD34, 0x18E3, 0x10A2, 0x1061, 0x1081, 0x0861, 0x10A2, 0x1082, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x2C70 (11376) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0862, 0x1082, 0x0020, 0x0861, 0x0020, 0x6B4C, 0x4A48, 0x630B, 0x6B6D, 0x73AE, 0x73AE,   // 0x2C80 (11392) pixels
-0x9CD3, 0x9CD3, 0xAD54, 0xA534, 0xAD75, 0xAD55, 0xB595, 0xB595, 0xB575, 0xB596, 0xB596, 0xB595, 0xB575, 0xBDD7, 0xBDD7, 0xBDD7,   // 0x2C90 (11408) pixels
-0xBDD7, 0xC618, 0xC638, 0xC638, 0xD699, 0xD69A, 0xD699, 0xD699, 0xD699, 0xD699, 0xD679, 0xD699, 0xDEDA, 0xDEBA, 0xD6BA, 0xDEDA,   // 0x2CA0 (11424) pixels
-0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE6FB,   // 0x2CB0 (11440) pixels
-0xF79D, 0xF79D, 0xF79D, 0xF79E, 0xF79D, 0xEF7D, 0xEF7D, 0xF79D, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF79E, 0xF79D,   // 0x2CC0 (11456) pixels
-0xF79D, 0xF79E, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2CD0 (11472) pixels
-0xFFFF, 0xF79E, 0xF77D, 0xF79D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9471, 0x18E3, 0x10A2, 0x2104, 0x20E3,   // 0x2CE0 (11488) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2CF0 (11504) pixels
-0x2104, 0x2104, 0x18E3, 0x2104, 0x18E4, 0x18E4, 0x18E4, 0x18E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF79E, 0xE71B,   // 0x2D00 (11520) pixels
-0xDEDB, 0xD699, 0xC617, 0xB595, 0xAD54, 0xAD74, 0x9CD2, 0x8C71, 0x94B2, 0x1081, 0x0820, 0x18A2, 0x1082, 0x1062, 0x20C3, 0x1862,   // 0x2D10 (11536) pixels
-0x1040, 0x942F, 0xCDF5, 0xD5F5, 0xCDD4, 0xC5B3, 0xC5D3, 0xD676, 0xA4F1, 0x6B2A, 0x5AA8, 0x3984, 0x5A88, 0x62AA, 0x62CA, 0x62CA,   // 0x2D20 (11552) pixels
-0x62EA, 0x6B0B, 0x6B0B, 0x734C, 0x6B0B, 0x83EE, 0x83EE, 0x8C4F, 0x9491, 0x9491, 0x9CD2, 0x9CF2, 0xA513, 0x9CD2, 0xA4F3, 0xAD54,   // 0x2D30 (11568) pixels
-0xAD54, 0xB5B5, 0xAD34, 0xBDB6, 0xAD34, 0xB575, 0xB595, 0xB575, 0xBDB6, 0xB575, 0xB575, 0xB595, 0xBDF7, 0xAD34, 0xAD54, 0x18C2,   // 0x2D40 (11584) pixels
-0x0861, 0x1082, 0x1082, 0x0861, 0x10A2, 0x0020, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081,   // 0x2D50 (11600) pixels
-0x1082, 0x10A2, 0x0020, 0x0000, 0x0840, 0x4A49, 0x52AA, 0x6B2C, 0x6B4C, 0x738D, 0x73AE, 0x7BAE, 0x8C51, 0x94B2, 0xA4F3, 0x9CF3,   // 0x2D60 (11616) pixels
-0x9CF3, 0x9CF3, 0xA534, 0xAD55, 0xAD75, 0xB5B6, 0xBDD6, 0xB5B6, 0xBDD7, 0xC638, 0xCE58, 0xC638, 0xC638, 0xCE58, 0xC638, 0xC618,   // 0x2D70 (11632) pixels
-0xCE79, 0xD699, 0xD69A, 0xD699, 0xD699, 0xCE79, 0xD679, 0xD69A, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEFB,   // 0x2D80 (11648) pixels
-0xE6FB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xF79E, 0xF7BE, 0xFFFF, 0xFFFF,   // 0x2D90 (11664) pixels
-0xFFDF, 0xF7BE, 0xF79D, 0xF79D, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E,   // 0x2DA0 (11680) pixels
-0xF79D, 0xF77D, 0xF77D, 0xF79D, 0xFFBE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFBF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x2DB0 (11696) pixels
-0xFFFF, 0xF7BE, 0xEF7D, 0xF79E, 0xFFFF, 0xFFFF, 0xFFBE, 0xD699, 0x10A2, 0x2124, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2DC0 (11712) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2124, 0x18E3,   // 0x2DD0 (11728) pixels
-0x18E3, 0x18C3, 0x2104, 0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF5D, 0xDEFB, 0xCE59, 0xCE59, 0xB596, 0xBDB6,   // 0x2DE0 (11744) pixels
-0x9CD2, 0x9CB2, 0xAD34, 0x9CD2, 0x8C50, 0x8C50, 0x1061, 0x0841, 0x1062, 0x1082, 0x1862, 0x1882, 0x0820, 0x83AD, 0xB511, 0xC573,   // 0x2DF0 (11760) pixels
-0xCDB3, 0xD5F4, 0xC5B3, 0x62A7, 0x62A7, 0x3983, 0x49E5, 0x5247, 0x5AA9, 0x5269, 0x62CB, 0x62EB, 0x6B2B, 0x7B8D, 0x8C2F, 0x9470,   // 0x2E00 (11776) pixels
-0x9CB1, 0xA512, 0xA4F2, 0xAD53, 0xAD33, 0xB574, 0xB595, 0xAD74, 0xB595, 0xBDF7, 0xB596, 0xB5B6, 0xCE38, 0xC5F7, 0xBDB6, 0xCE38,   // 0x2E10 (11792) pixels
-0xBDD6, 0xCE37, 0xCE58, 0xC5F6, 0xCE38, 0xBDD6, 0xCE38, 0xC637, 0xC5F7, 0xBDF7, 0x10A2, 0x0840, 0x0841, 0x1082, 0x1062, 0x1082,   // 0x2E20 (11808) pixels
-0x0861, 0x0861, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x1082, 0x1082, 0x0861, 0x0841, 0x1082, 0x0821, 0x0000, 0x0020, 0x39A6,   // 0x2E30 (11824) pixels
-0x4A69, 0x52AA, 0x6B4C, 0x6B2C, 0x738D, 0x738D, 0x7BCE, 0x7BEF, 0x8410, 0x8C51, 0x9CD2, 0x9CF3, 0x9CD2, 0x9CD3, 0xA514, 0xA514,   // 0x2E40 (11840) pixels
-0xA513, 0xAD54, 0xAD75, 0xAD55, 0xAD55, 0xB5B6, 0xBDB6, 0xBDB6, 0xBDD6, 0xC618, 0xC618, 0xC638, 0xD679, 0xCE79, 0xCE59, 0xCE59,   // 0x2E50 (11856) pixels
-0xD699, 0xD69A, 0xD679, 0xCE79, 0xDEDB, 0xDEDA, 0xD6BA, 0xDEDB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71C,   // 0x2E60 (11872) pixels
-0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE,   // 0x2E70 (11888) pixels
-0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E,   // 0x2E80 (11904) pixels
-0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDE, 0xF79E, 0xFFBE,   // 0x2E90 (11920) pixels
-0xFFDF, 0xFFDE, 0xFFBE, 0xEF3C, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2EA0 (11936) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E4, 0x18C3, 0x2104, 0x18E3, 0x2124, 0x18E3, 0x18E3, 0xC638,   // 0x2EB0 (11952) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xE73C, 0xD6BA, 0xD67A, 0xCE38, 0xAD34, 0xAD34, 0xA4F3, 0x9CD2, 0x9CB2, 0x9491,   // 0x2EC0 (11968) pixels
-0x9471, 0x8C30, 0x0820, 0x0820, 0x1061, 0x1061, 0x1062, 0x18A2, 0x0820, 0x83AD, 0xBD52, 0xC572, 0xC552, 0xBD52, 0x838B, 0x6287,   // 0x2ED0 (11984) pixels
-0x5246, 0x49E5, 0x4184, 0x4A06, 0x5248, 0x62EB, 0x528A, 0x630C, 0x6B2C, 0x8C2F, 0xA4D2, 0x9CD2, 0x9CB1, 0xAD53, 0xAD33, 0xAD53,   // 0x2EE0 (12000) pixels
-0xB595, 0xAD54, 0xB595, 0xBDF6, 0xBDD6, 0xBDD6, 0xBDB6, 0xD679, 0xCE38, 0xC617, 0xC617, 0xC637, 0xC637, 0xC617, 0xCE38, 0xCE38,   // 0x2EF0 (12016) pixels
-0xCE78, 0xCE58, 0xC618, 0xCE38, 0xCE38, 0x18C2, 0x0861, 0x0841, 0x1082, 0x1082, 0x1062, 0x1062, 0x1082, 0x0861, 0x0861, 0x0021,   // 0x2F00 (12032) pixels
-0x0861, 0x0841, 0x0841, 0x1082, 0x1081, 0x0861, 0x0841, 0x0861, 0x0861, 0x0000, 0x0840, 0x4A49, 0x5ACB, 0x632C, 0x632C, 0x736D,   // 0x2F10 (12048) pixels
-0x73AE, 0x6B6D, 0x73AE, 0x7BCE, 0x8430, 0x8C30, 0x9CF3, 0x9CF3, 0x9CD2, 0x9CF3, 0xAD34, 0xAD54, 0xAD34, 0xB595, 0xB5B6, 0xB5B6,   // 0x2F20 (12064) pixels
-0xB5B6, 0xC617, 0xC618, 0xC617, 0xC5F7, 0xC638, 0xC618, 0xC618, 0xCE59, 0xCE58, 0xCE38, 0xCE79, 0xDEDA, 0xE71B, 0xDEFB, 0xDEDB,   // 0x2F30 (12080) pixels
-0xDEBA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xD6BA, 0xDEBA, 0xDEFB, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B,   // 0x2F40 (12096) pixels
-0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x2F50 (12112) pixels
-0xFFFF, 0xFFDE, 0xF79E, 0xEF7D, 0xF77D, 0xF79D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFFF,   // 0x2F60 (12128) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBF, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF,   // 0x2F70 (12144) pixels
-0x20E3, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2F80 (12160) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x2F90 (12176) pixels
-0xF79D, 0xF7BE, 0xDEBA, 0xDEDB, 0xCE59, 0xB575, 0xAD34, 0xA4D2, 0x8C30, 0x9C91, 0x9470, 0x9450, 0x9471, 0x840F, 0x0820, 0x0841,   // 0x2FA0 (12192) pixels
-0x0820, 0x1062, 0x1882, 0x1061, 0x1060, 0x7B6B, 0xACF1, 0xC572, 0xC572, 0x72E8, 0x6266, 0x49C4, 0x49C5, 0x41A4, 0x5247, 0x5A48,   // 0x2FB0 (12208) pixels
-0x62AA, 0x5A89, 0x6B2C, 0x9492, 0x9CD3, 0xAD34, 0xAD34, 0xB5B5, 0xBDD6, 0xB594, 0xB595, 0xC5F6, 0xC5F6, 0xC617, 0xC637, 0xC617,   // 0x2FC0 (12224) pixels
-0xCE58, 0xD679, 0xD699, 0xCE38, 0xD679, 0xCE58, 0xD699, 0xCE78, 0xDEBA, 0xD699, 0xDEBA, 0xE6FB, 0xDEBA, 0xDEBA, 0xD699, 0xD6BA,   // 0x2FD0 (12240) pixels
-0x1082, 0x0861, 0x1061, 0x1082, 0x18C3, 0x1082, 0x1082, 0x0841, 0x0841, 0x0841, 0x1082, 0x0862, 0x0861, 0x0841, 0x0861, 0x1082,   // 0x2FE0 (12256) pixels
-0x0841, 0x0861, 0x0861, 0x0000, 0x0020, 0x3165, 0x5289, 0x5AEB, 0x5AEB, 0x632C, 0x6B6D, 0x6B6D, 0x73AE, 0x7BCE, 0x7BEF, 0x840F,   // 0x2FF0 (12272) pixels
-0x8430, 0x8410, 0x94B2, 0x9471, 0x9491, 0x9CD2, 0xAD34, 0xAD75, 0xB575, 0xBDD6, 0xBDD6, 0xB5B6, 0xBDB6, 0xC618, 0xC638, 0xCE38,   // 0x3000 (12288) pixels
-0xC638, 0xCE59, 0xCE59, 0xCE79, 0xD69A, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEBA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB,   // 0x3010 (12304) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB,   // 0x3020 (12320) pixels
-0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFDE, 0xFFBE, 0xF79E, 0xF79D, 0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xFFBE,   // 0x3030 (12336) pixels
-0xFFDE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xF79D, 0xF77D, 0xF77D, 0xEF7D, 0xEF7D, 0xF79E, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x3040 (12352) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFDF, 0x18A2, 0x2104, 0x18C3, 0x2103,   // 0x3050 (12368) pixels
-0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3060 (12384) pixels
-0x20E3, 0x20E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x4A69, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFDE, 0xE71B, 0xD699, 0xD679,   // 0x3070 (12400) pixels
-0xBDB6, 0xB555, 0x9CB2, 0x9451, 0x9430, 0x9430, 0x8BEF, 0x9430, 0x9430, 0x7BAE, 0x0820, 0x0820, 0x0841, 0x0861, 0x1082, 0x1081,   // 0x3080 (12416) pixels
-0x1040, 0x6AE8, 0xA4AF, 0xC572, 0xBD31, 0x6266, 0x49C4, 0x3983, 0x41E5, 0x4A26, 0x41C5, 0x5247, 0x5AA9, 0x62EB, 0x9CD2, 0xAD34,   // 0x3090 (12432) pixels
-0xB575, 0xBDB6, 0xBDB6, 0xC617, 0xC638, 0xCE58, 0xCE58, 0xD699, 0xC617, 0xD6B9, 0xD679, 0xCE58, 0xCE58, 0xD658, 0xDEBA, 0xD679,   // 0x30A0 (12448) pixels
-0xDEBA, 0xDEBA, 0xDEBA, 0xD679, 0xDEBA, 0xDEDA, 0xDEBA, 0xD6B9, 0xDEDA, 0xDEDA, 0xDEFB, 0x10A2, 0x1061, 0x0841, 0x1082, 0x18C3,   // 0x30B0 (12464) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0862, 0x0841, 0x1082, 0x0841, 0x0861, 0x0861, 0x1081, 0x1081, 0x0000, 0x20E3,   // 0x30C0 (12480) pixels
-0x3185, 0x4A69, 0x5AAA, 0x6B4C, 0x632C, 0x6B4D, 0x6B6D, 0x736D, 0x7BEF, 0x73AE, 0x7BEF, 0x7BEF, 0x8430, 0x840F, 0x9491, 0x9491,   // 0x30D0 (12496) pixels
-0x94B2, 0x94B2, 0xAD55, 0xAD75, 0xAD75, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xC638, 0xCE38, 0xCE58, 0xCE58, 0xD699, 0xD6BA, 0xD6BA,   // 0x30E0 (12512) pixels
-0xDEDA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEDB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE71B,   // 0x30F0 (12528) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xFFFF, 0xFFDF, 0xF7BE, 0xF79D,   // 0x3100 (12544) pixels
-0xEF7D, 0xF77D, 0xF79D, 0xF79D, 0xEF5C, 0xEF5D, 0xEF7D, 0xF77D, 0xF79D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF,   // 0x3110 (12560) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFBE, 0xFFDE,   // 0x3120 (12576) pixels
-0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF7BE, 0xFFFF, 0xFFDE, 0xFFDE, 0x2103, 0x18C2, 0x2104, 0x18C3, 0x2104, 0x2104, 0x18E3, 0x18E3,   // 0x3130 (12592) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18C3, 0x18E3,   // 0x3140 (12608) pixels
-0x2104, 0x2104, 0x18E3, 0x2104, 0xFFFF, 0xF7BE, 0xFFFF, 0xF7BE, 0xF7BE, 0xE71B, 0xD699, 0xCE38, 0xB575, 0xB554, 0xA4B2, 0x8BEF,   // 0x3150 (12624) pixels
-0x8BCE, 0x93EF, 0x940F, 0x8BCE, 0x83CE, 0x62CA, 0x0841, 0x0820, 0x0841, 0x0861, 0x10A2, 0x0860, 0x1060, 0x7329, 0xA48F, 0xB511,   // 0x3160 (12640) pixels
-0x6AC8, 0x6AC8, 0x3963, 0x4A26, 0x41E6, 0x4A27, 0x4A47, 0x5268, 0x62EA, 0x83EE, 0xAD74, 0xAD75, 0xBDB7, 0xCE38, 0xC638, 0xCE59,   // 0x3170 (12656) pixels
-0xCE59, 0xCE79, 0xCE58, 0xCE58, 0xD699, 0xCE58, 0xD699, 0xCE38, 0xD679, 0xDEBA, 0xD679, 0xD699, 0xD699, 0xDEDA, 0xDEDA, 0xE6FB,   // 0x3180 (12672) pixels
-0xDEDA, 0xDEDA, 0xE71B, 0xDEBA, 0xDEBA, 0xDEBA, 0x4A69, 0x0820, 0x10A2, 0x0861, 0x10A2, 0x0861, 0x1082, 0x1062, 0x0861, 0x0841,   // 0x3190 (12688) pixels
-0x0841, 0x1082, 0x0861, 0x0862, 0x10A2, 0x0861, 0x0841, 0x10A2, 0x1081, 0x0020, 0x52AA, 0x4A28, 0x528A, 0x5AEB, 0x5AEB, 0x6B2C,   // 0x31A0 (12704) pixels
-0x632C, 0x738E, 0x738D, 0x73AE, 0x7BEF, 0x7BCF, 0x7BEF, 0x840F, 0x8430, 0x8C51, 0x9CF3, 0xA534, 0xA4F3, 0xA534, 0xBDF7, 0xBDF7,   // 0x31B0 (12720) pixels
-0xBDF7, 0xCE59, 0xD699, 0xD6BA, 0xD69A, 0xD699, 0xCE58, 0xCE59, 0xCE79, 0xDEDA, 0xDEBA, 0xD69A, 0xDEDA, 0xDEBA, 0xD6BA, 0xDEDA,   // 0x31C0 (12736) pixels
-0xE71C, 0xEF5C, 0xE73C, 0xE71C, 0xDEFB, 0xE71B, 0xE6FB, 0xE6FB, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xDEDB, 0xDEDB,   // 0x31D0 (12752) pixels
-0xE6FB, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xEF5C, 0xEF7D, 0xF79D, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF77D,   // 0x31E0 (12768) pixels
-0xFFFF, 0xFFDF, 0xFFBE, 0xF7BE, 0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0xF79E,   // 0x31F0 (12784) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFFF,   // 0x3200 (12800) pixels
-0xFFDE, 0xFFFF, 0xEF7D, 0xFFFF, 0x18E3, 0x2103, 0x18E3, 0x2103, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3210 (12816) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x2124, 0x18C3, 0x18E3, 0x2104, 0x10A2, 0x18E3,   // 0x3220 (12832) pixels
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFBE, 0xEF3C, 0xDEDA, 0xC617, 0xC5F7, 0xAD34, 0x9450, 0x8BEF, 0x9430, 0x8BCE, 0x838D, 0x8BAE, 0x8BCF,   // 0x3230 (12848) pixels
-0x6AEB, 0x1020, 0x0000, 0x0841, 0x0841, 0x0861, 0x0881, 0x1081, 0x1020, 0x6AE9, 0x9C4E, 0xBD52, 0x6287, 0x6287, 0x3984, 0x39C5,   // 0x3240 (12864) pixels
-0x41E6, 0x4207, 0x4A47, 0x4A07, 0x9450, 0xB554, 0xBDB6, 0xC617, 0xC618, 0xCE59, 0xCE39, 0xCE59, 0xD679, 0xCE79, 0xD679, 0xD6B9,   // 0x3250 (12880) pixels
-0xD6BA, 0xD699, 0xD699, 0xD699, 0xDEB9, 0xDEBA, 0xDE99, 0xDEBA, 0xE6FB, 0xDEFA, 0xD6B9, 0xDEDA, 0xDEBA, 0xE6FB, 0xE71B, 0xE71B,   // 0x3260 (12896) pixels
-0xDEDA, 0xB595, 0x0861, 0x10A2, 0x0841, 0x10A2, 0x0861, 0x1082, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x0861, 0x0861, 0x1082,   // 0x3270 (12912) pixels
-0x0000, 0x0841, 0x10A2, 0x0861, 0x0000, 0x5AEB, 0x4A69, 0x5289, 0x5ACA, 0x632C, 0x6B2C, 0x738D, 0x738D, 0x6B6D, 0x7BAE, 0x73AE,   // 0x3280 (12928) pixels
-0x7BEF, 0x7BEF, 0x7BEF, 0x8C71, 0x9CD2, 0xAD55, 0xB596, 0xB596, 0xB575, 0xB595, 0xC618, 0xCE38, 0xCE38, 0xD699, 0xD679, 0xCE79,   // 0x3290 (12944) pixels
-0xD679, 0xDEBA, 0xDEDB, 0xDEFB, 0xDEDB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71C,   // 0x32A0 (12960) pixels
-0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB,   // 0x32B0 (12976) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xF79E, 0xF79D, 0xF79D, 0xF79D, 0xF77D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE,   // 0x32C0 (12992) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFBE, 0xF7BE, 0xF79E, 0xFFBE, 0xFFFF, 0xFFFF,   // 0x32D0 (13008) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF79D, 0xFFDF, 0xFFFF,   // 0x32E0 (13024) pixels
-0x18E3, 0x2104, 0x18E3, 0x2103, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x32F0 (13040) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x2124, 0x18E3, 0xFFFF, 0xFFFF, 0xF7BE, 0xE73C,   // 0x3300 (13056) pixels
-0xEF3C, 0xD699, 0xC5D7, 0xBDB6, 0xA4D3, 0x9430, 0x9C50, 0x8BCE, 0x940F, 0x9C2F, 0x7B2C, 0x838D, 0x7B4D, 0x0800, 0x0821, 0x0821,   // 0x3310 (13072) pixels
-0x0020, 0x0861, 0x0861, 0x1081, 0x1860, 0x51E5, 0x9C2D, 0x6267, 0x5A26, 0x3942, 0x49E5, 0x3984, 0x4A47, 0x4A27, 0x4A07, 0x62CA,   // 0x3320 (13088) pixels
-0xA4F2, 0xC5D6, 0xBD95, 0xCE38, 0xC5F7, 0xCE18, 0xCE38, 0xD679, 0xD69A, 0xD69A, 0xD699, 0xCE58, 0xD699, 0xDEDA, 0xD699, 0xDEDA,   // 0x3330 (13104) pixels
-0xDEDA, 0xD699, 0xDEB9, 0xD699, 0xE71B, 0xD6B9, 0xDEDA, 0xE6FB, 0xDEBA, 0xDEFA, 0xD699, 0xDEBA, 0xDEDA, 0x10A2, 0x0841, 0x0841,   // 0x3340 (13120) pixels
-0x0862, 0x0000, 0x1082, 0x0841, 0x1082, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0861, 0x1082, 0x1082, 0x0861, 0x0000,   // 0x3350 (13136) pixels
-0x2944, 0x4A69, 0x5289, 0x5ACA, 0x632C, 0x630C, 0x6B4D, 0x6B4D, 0x738D, 0x7BCE, 0x73AE, 0x7BCE, 0x7BAE, 0x840F, 0x8C51, 0x9CD3,   // 0x3360 (13152) pixels
-0xA534, 0xB595, 0xBDB6, 0xB5B6, 0xBDB6, 0xBDD7, 0xCE79, 0xD699, 0xCE79, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEDA, 0xDEBA, 0xDEDA,   // 0x3370 (13168) pixels
-0xD6BA, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71B,   // 0x3380 (13184) pixels
-0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71C, 0xEF3C, 0xEF3C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B,   // 0x3390 (13200) pixels
-0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFBE, 0xF79D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE,   // 0x33A0 (13216) pixels
-0xF77D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF,   // 0x33B0 (13232) pixels
-0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFDE, 0x7BCE, 0x18E3, 0x20E3, 0x18C3,   // 0x33C0 (13248) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x33D0 (13264) pixels
-0x18C3, 0x2104, 0x10A2, 0x18E3, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x8C50, 0xFFDE, 0xFFDE, 0xE71C, 0xDEBA, 0xD659, 0xB575, 0xA4B2,   // 0x33E0 (13280) pixels
-0x9CB2, 0x9410, 0x940F, 0x8BAE, 0x8BAE, 0x838D, 0x8BCE, 0x732C, 0x0800, 0x0000, 0x1061, 0x0841, 0x0861, 0x0840, 0x1061, 0x1060,   // 0x33F0 (13296) pixels
-0x1860, 0x5A47, 0x942E, 0x5A26, 0x5A46, 0x4163, 0x49C5, 0x49E6, 0x5228, 0x4A07, 0x5AA9, 0x8C0E, 0xBD94, 0xC5D6, 0xD678, 0xCE38,   // 0x3400 (13312) pixels
-0xD658, 0xD659, 0xD658, 0xD679, 0xD679, 0xDEBA, 0xDEDA, 0xD679, 0xDEDA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEDA, 0xDEDA, 0xD6B9, 0xDEBA,   // 0x3410 (13328) pixels
-0xDEDA, 0xDEDA, 0xDEBA, 0xD699, 0xE6FB, 0xD699, 0xDEBA, 0xD679, 0x1081, 0x10A2, 0x0861, 0x0841, 0x1082, 0x18C3, 0x0021, 0x0882,   // 0x3420 (13344) pixels
-0x1082, 0x0861, 0x10A2, 0x1082, 0x0861, 0x1082, 0x0861, 0x10A2, 0x1082, 0x0841, 0x0840, 0x31A6, 0x4A69, 0x52AA, 0x630B, 0x5AEA,   // 0x3430 (13360) pixels
-0x6B4C, 0x738D, 0x6B4C, 0x738D, 0x738D, 0x7BCE, 0x7BCF, 0x7BEF, 0x83EF, 0x8C30, 0x94B2, 0xA514, 0xBDF7, 0xC638, 0xD69A, 0xCE59,   // 0x3440 (13376) pixels
-0xCE59, 0xCE79, 0xD6BA, 0xDEBA, 0xDEDA, 0xE71B, 0xE73C, 0xEF5C, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB,   // 0x3450 (13392) pixels
-0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0xE71B,   // 0x3460 (13408) pixels
-0xEF3C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xEF7D, 0xEF7D, 0xF79D, 0xF79E,   // 0x3470 (13424) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xEF5C, 0xEF5C, 0xEF7D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE,   // 0x3480 (13440) pixels
-0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFDE,   // 0x3490 (13456) pixels
-0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF79D, 0xF79E, 0xFFDF, 0xFFDF, 0x18E3, 0x18C3, 0x20E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x34A0 (13472) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x2104, 0x2104,   // 0x34B0 (13488) pixels
-0x18C3, 0x2104, 0x18C3, 0x18E3, 0x2103, 0x18E3, 0xEF3C, 0xDEBA, 0xD699, 0xB595, 0xB575, 0xA4D2, 0x9450, 0x9C50, 0x8BCE, 0x940F,   // 0x34C0 (13504) pixels
-0x836C, 0x7B4C, 0x732B, 0x1040, 0x1041, 0x1882, 0x0841, 0x0020, 0x0841, 0x1041, 0x1041, 0x1861, 0x2060, 0x6247, 0x93CD, 0x7267,   // 0x34D0 (13520) pixels
-0x6206, 0x5184, 0x51A5, 0x51A5, 0x51A6, 0x51A5, 0x9C0F, 0xA470, 0xCDB5, 0xCDD5, 0xCDF7, 0xCDD6, 0xD658, 0xD658, 0xD638, 0xDE99,   // 0x34E0 (13536) pixels
-0xD679, 0xD699, 0xD679, 0xCE59, 0xD6BA, 0xCE79, 0xD699, 0xCE79, 0xD699, 0xD699, 0xD698, 0xDEDA, 0xD699, 0xD699, 0xD699, 0xDEBA,   // 0x34F0 (13552) pixels
-0xDEBA, 0xD699, 0x1082, 0x1081, 0x0861, 0x0840, 0x0861, 0x1082, 0x0841, 0x0862, 0x1082, 0x0841, 0x0021, 0x1082, 0x1082, 0x1082,   // 0x3500 (13568) pixels
-0x0861, 0x0841, 0x10A2, 0x0841, 0x0020, 0x0020, 0x4207, 0x52AA, 0x5AAA, 0x5ACA, 0x6B4C, 0x6B4C, 0x632C, 0x6B4C, 0x7BCE, 0x738D,   // 0x3510 (13584) pixels
-0x7BCF, 0x7BCE, 0x7BCE, 0x8430, 0x9491, 0xA513, 0xBDB6, 0xBDD7, 0xCE59, 0xCE58, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEFB, 0xDEFB,   // 0x3520 (13600) pixels
-0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF5C, 0xEF5C, 0xEF3C, 0xEF5C, 0xDEFB, 0xE71B, 0xE71B, 0xE71B,   // 0x3530 (13616) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB,   // 0x3540 (13632) pixels
-0xDEDB, 0xDEDB, 0xDEFB, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xF79E, 0xF79D, 0xF79D, 0xEF7D, 0xF77D, 0xF79D, 0xF79E, 0xF79E,   // 0x3550 (13648) pixels
-0xF79D, 0xF79D, 0xF79E, 0xFFBE, 0xFFDE, 0xF7BE, 0xEF7D, 0xEF5D, 0xEF7D, 0xF79D, 0xF79E, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE,   // 0x3560 (13664) pixels
-0xEF7D, 0xF77D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF79E, 0xF77D, 0xF7BE, 0xFFBE, 0xF7BE, 0xF79D, 0xF7BE, 0xFFDE, 0xFFFF,   // 0x3570 (13680) pixels
-0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xF79E, 0x2104, 0x18C3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3580 (13696) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2124, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3590 (13712) pixels
-0x18E3, 0x2103, 0xE71B, 0xDEBA, 0xC617, 0xBDB6, 0xA4D3, 0xA4B2, 0x9450, 0x9410, 0x8BCE, 0x8BCE, 0x8BCE, 0x838D, 0x4A07, 0x1061,   // 0x35A0 (13728) pixels
-0x1061, 0x0820, 0x0841, 0x1062, 0x1041, 0x1041, 0x1020, 0x2040, 0x2820, 0x61C5, 0x8AA8, 0x71C5, 0x58E2, 0x79A5, 0x6923, 0x7165,   // 0x35B0 (13744) pixels
-0xAB6D, 0xCC71, 0xAB8D, 0xABAE, 0xDD54, 0xD554, 0xD595, 0xDDF7, 0xD617, 0xDE99, 0xD638, 0xDE99, 0xD679, 0xD699, 0xCE59, 0xDEBA,   // 0x35C0 (13760) pixels
-0xD6BA, 0xDEDA, 0xDEDA, 0xD699, 0xDEDA, 0xD699, 0xDEFA, 0xDEFA, 0xD679, 0xDEBA, 0xDEBA, 0xD699, 0xD699, 0x10A1, 0x1061, 0x0820,   // 0x35D0 (13776) pixels
-0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x0021, 0x0841, 0x0862, 0x0861, 0x10A2, 0x0841, 0x0861, 0x10A2, 0x0841, 0x1081, 0x0840,   // 0x35E0 (13792) pixels
-0x0020, 0x5AEB, 0x4A48, 0x4A69, 0x62EB, 0x632B, 0x6B4C, 0x632C, 0x6B4C, 0x6B4C, 0x73AE, 0x6B6D, 0x8C30, 0x7BCE, 0x8430, 0x9491,   // 0x35F0 (13808) pixels
-0x9CF3, 0xAD55, 0xBDD7, 0xC618, 0xD69A, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEFB, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xE71C, 0xE73C,   // 0x3600 (13824) pixels
-0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xDEFB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x3610 (13840) pixels
-0xEF5D, 0xEF5C, 0xEF5D, 0xEF5C, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xE71C, 0xE6FB, 0xE6FB, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB,   // 0x3620 (13856) pixels
-0xE6FB, 0xE71B, 0xE73C, 0xEF3C, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xF79E, 0xF79D, 0xF79E,   // 0x3630 (13872) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xF7BE, 0xF79D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xF77D, 0xF79D, 0xFFDE, 0xF7BE, 0xF79E, 0xF7BE,   // 0x3640 (13888) pixels
-0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF,   // 0x3650 (13904) pixels
-0xFFBF, 0xFFBF, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3660 (13920) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x20E4, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0x3670 (13936) pixels
-0xC617, 0xBDB6, 0xA4F3, 0x9C92, 0x9C91, 0x940F, 0x940F, 0x8BAE, 0x62AA, 0x1040, 0x1061, 0x1040, 0x1041, 0x1082, 0x1041, 0x1841,   // 0x3680 (13952) pixels
-0x1000, 0x2020, 0x2800, 0x3000, 0x58A1, 0x9A89, 0xA289, 0xAA88, 0xB268, 0xAA28, 0xAA28, 0xBAAA, 0xB269, 0xAA89, 0xAA49, 0xAAAA,   // 0x3690 (13968) pixels
-0x9A28, 0x9A89, 0xCC2F, 0xBC2F, 0xAC2F, 0xD5D5, 0xD5F6, 0xD637, 0xD658, 0xE6DA, 0xD658, 0xD699, 0xD699, 0xDEBA, 0xDEFA, 0xCE78,   // 0x36A0 (13984) pixels
-0xDEDA, 0xDED9, 0xDEDA, 0xCE78, 0xDEDA, 0xD679, 0xCE78, 0xDEBA, 0x18C2, 0x1081, 0x0841, 0x1081, 0x0820, 0x0841, 0x0862, 0x0862,   // 0x36B0 (14000) pixels
-0x0862, 0x0862, 0x1082, 0x0862, 0x0861, 0x0861, 0x1082, 0x0841, 0x0861, 0x0861, 0x0840, 0x3185, 0x4208, 0x4A69, 0x5ACA, 0x5B0B,   // 0x36C0 (14016) pixels
-0x62EB, 0x6B6C, 0x6B2C, 0x736D, 0x736D, 0x738D, 0x73AE, 0x7BCE, 0x8430, 0x8430, 0x8C50, 0xA534, 0xB595, 0xBDF7, 0xC5F8, 0xD67A,   // 0x36D0 (14032) pixels
-0xDEDB, 0xE71C, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE73C,   // 0x36E0 (14048) pixels
-0xE71C, 0xE73C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xE73C, 0xE71C,   // 0x36F0 (14064) pixels
-0xE6FB, 0xE6FB, 0xE6FB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB,   // 0x3700 (14080) pixels
-0xEF7D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5D, 0xEF7D, 0xF79D, 0xF77D, 0xEF7D, 0xEF7D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79D, 0xEF7D, 0xF77D,   // 0x3710 (14096) pixels
-0xEF7D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFFBE, 0xFFDE, 0xF79E, 0xFFBE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E,   // 0x3720 (14112) pixels
-0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDE, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDF, 0xF79E, 0x18E3, 0x18E3,   // 0x3730 (14128) pixels
-0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3740 (14144) pixels
-0x1903, 0x18E3, 0x20E3, 0x20E3, 0x20E4, 0x20E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x18E3, 0x18C2, 0x2103, 0x18C2, 0x2103,   // 0x3750 (14160) pixels
-0x20C2, 0x1881, 0x28E3, 0x20A2, 0x1061, 0x1882, 0x1041, 0x1882, 0x1861, 0x1020, 0x1841, 0x1800, 0x3000, 0x4840, 0xA269, 0xBA8A,   // 0x3760 (14176) pixels
-0xBA48, 0xC248, 0xBA27, 0xC268, 0xB9E6, 0xC228, 0xCA68, 0xC207, 0xC228, 0xC228, 0xC228, 0xBA27, 0xBA48, 0xBA48, 0xB227, 0xAA68,   // 0x3770 (14192) pixels
-0x9A88, 0xCCB0, 0xBCD1, 0xBD32, 0xC5D5, 0xC5F6, 0xC5F6, 0xCE37, 0xD658, 0xDE79, 0xDE78, 0xDEB9, 0xDEB9, 0xD698, 0xD699, 0xD698,   // 0x3780 (14208) pixels
-0xD699, 0xCE58, 0x52A9, 0x0840, 0x1081, 0x0840, 0x1081, 0x0841, 0x0861, 0x1062, 0x1062, 0x0862, 0x1062, 0x10A2, 0x1082, 0x0861,   // 0x3790 (14224) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x4207, 0x4A48, 0x5289, 0x5ACA, 0x5ACA, 0x6B2C, 0x632B, 0x6B4C, 0x7BCE, 0x73AE,   // 0x37A0 (14240) pixels
-0x73AE, 0x738D, 0x7BEF, 0x8430, 0x8410, 0xA513, 0xB596, 0xB575, 0xC617, 0xD679, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xEF7D,   // 0x37B0 (14256) pixels
-0xEF5D, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B,   // 0x37C0 (14272) pixels
-0xDEFB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB,   // 0x37D0 (14288) pixels
-0xDEFB, 0xDEDA, 0xDEDB, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xF79E, 0xF79E, 0xF79E, 0xF79E,   // 0x37E0 (14304) pixels
-0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF,   // 0x37F0 (14320) pixels
-0xFFDF, 0xFFBE, 0xF79E, 0xF77D, 0xF7BE, 0xFFDE, 0xFFBE, 0xF7BE, 0xFFDF, 0xFFDF, 0xF7BE, 0xF79E, 0xF77D, 0xF79D, 0xF77D, 0xEF7D,   // 0x3800 (14336) pixels
-0xF77D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0x20E3, 0x18E3, 0x18E3, 0x2124, 0x18C3, 0x2104,   // 0x3810 (14352) pixels
-0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x18E3, 0x20E3, 0x20C3,   // 0x3820 (14368) pixels
-0x20E4, 0x20E4, 0x18E3, 0x18E3, 0x18C3, 0x2103, 0x18E3, 0x18E3, 0x2103, 0x18E3, 0x18C3, 0x20E3, 0x2103, 0x20E3, 0x1081, 0x1882,   // 0x3830 (14384) pixels
-0x1082, 0x1041, 0x1882, 0x1021, 0x1820, 0x2821, 0x2800, 0x3800, 0x8A07, 0xB289, 0xBA28, 0xC207, 0xC1E7, 0xCA07, 0xCA27, 0xC9E7,   // 0x3840 (14400) pixels
-0xC9C6, 0xD228, 0xC1C6, 0xD207, 0xCA07, 0xC9E7, 0xC9E7, 0xCA27, 0xC207, 0xC207, 0xCA28, 0xBA07, 0xB267, 0x8163, 0xDCF1, 0xBC6F,   // 0x3850 (14416) pixels
-0xB4F1, 0xCDD4, 0xD636, 0xC5B5, 0xD616, 0xDE57, 0xD637, 0xDE98, 0xDE98, 0xD678, 0xDE98, 0xDEB9, 0xD678, 0xBDB6, 0x10A2, 0x0840,   // 0x3860 (14432) pixels
-0x1081, 0x0840, 0x0861, 0x0841, 0x10A3, 0x0862, 0x0021, 0x0041, 0x1082, 0x10A2, 0x1081, 0x0861, 0x1082, 0x0861, 0x0840, 0x0861,   // 0x3870 (14448) pixels
-0x0861, 0x0020, 0x2924, 0x5289, 0x5ACA, 0x52AA, 0x62EB, 0x630B, 0x6B4C, 0x73AE, 0x6B6C, 0x7BCE, 0x73AE, 0x83EF, 0x7BEF, 0x9491,   // 0x3880 (14464) pixels
-0x94B2, 0xB575, 0xBDF7, 0xBDB6, 0xD699, 0xD699, 0xDEDB, 0xE6FB, 0xE71C, 0xEF5C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE71C, 0xE73C,   // 0x3890 (14480) pixels
-0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE71C,   // 0x38A0 (14496) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B,   // 0x38B0 (14512) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xF79E,   // 0x38C0 (14528) pixels
-0xFFDE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF7BE,   // 0x38D0 (14544) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xFFBE, 0xF7BE, 0xF79D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF,   // 0x38E0 (14560) pixels
-0xFFDE, 0xFFDE, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFFF, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18C3, 0x2104,   // 0x38F0 (14576) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x18E3, 0x20E3, 0x20E3, 0x20E4, 0x18E4, 0x18E3, 0x18E3,   // 0x3900 (14592) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18C2, 0x2104, 0x18C2, 0x18C2, 0x20E3, 0x10A2, 0x18E3, 0x0882, 0x18C3, 0x1041, 0x2081,   // 0x3910 (14608) pixels
-0x2820, 0x3800, 0xA2AA, 0xA208, 0xBA49, 0xC208, 0xC1C7, 0xD228, 0xCA07, 0xD248, 0xCA07, 0xC9E6, 0xD227, 0xD227, 0xC9E7, 0xD207,   // 0x3920 (14624) pixels
-0xCA07, 0xD207, 0xC9E6, 0xCA07, 0xCA07, 0xCA07, 0xCA07, 0xC206, 0xC227, 0xB227, 0xB288, 0xDC8F, 0xCCB0, 0xCD52, 0xC572, 0xCDF4,   // 0x3930 (14640) pixels
-0xB511, 0xCDB3, 0xCD93, 0xD5F4, 0xC572, 0xC593, 0xDE36, 0xC5D5, 0xB574, 0x1081, 0x0840, 0x0861, 0x0861, 0x1082, 0x0861, 0x10A2,   // 0x3940 (14656) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x10A2, 0x0020, 0x1081, 0x1081, 0x0020, 0x39C6, 0x41E7, 0x4A69, 0x5289,   // 0x3950 (14672) pixels
-0x5ACA, 0x6B2C, 0x632C, 0x6B4C, 0x6B4C, 0x6B6D, 0x7BEF, 0x73AE, 0x7BAE, 0x8410, 0x8430, 0xA534, 0xB595, 0xC617, 0xCE58, 0xCE79,   // 0x3960 (14688) pixels
-0xD69A, 0xDEDB, 0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x3970 (14704) pixels
-0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5C,   // 0x3980 (14720) pixels
-0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,   // 0x3990 (14736) pixels
-0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xFFDE, 0xFFBE, 0xF79E, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xFFFF,   // 0x39A0 (14752) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDE, 0xF7BE, 0xF79E,   // 0x39B0 (14768) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,   // 0x39C0 (14784) pixels
-0xFFDE, 0xF79D, 0xEF7D, 0x2104, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x39D0 (14800) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E4, 0x18E4, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x18E3, 0x18C2,   // 0x39E0 (14816) pixels
-0x2104, 0x20C3, 0x18C3, 0x20E3, 0x20C3, 0x18A2, 0x1903, 0x10C3, 0x10C2, 0x1882, 0x2061, 0x2820, 0x4040, 0x9A48, 0xAA28, 0xBA07,   // 0x39F0 (14832) pixels
-0xC9E7, 0xD208, 0xD1E7, 0xD207, 0xD227, 0xC9E7, 0xC9E7, 0xC9E6, 0xD207, 0xD207, 0xD207, 0xC9E6, 0xD207, 0xC9E7, 0xD227, 0xC9C6,   // 0x3A00 (14848) pixels
-0xC9E7, 0xD227, 0xC1C6, 0xCA07, 0xCA07, 0xC1E6, 0xC247, 0x8922, 0xCBED, 0xD4F0, 0xCD51, 0xC591, 0xD5F3, 0xCDD3, 0xDE14, 0xC551,   // 0x3A10 (14864) pixels
-0xE655, 0xCDD4, 0xCDB3, 0x8BCD, 0x18C2, 0x1061, 0x1081, 0x1081, 0x0841, 0x1082, 0x10A2, 0x0861, 0x0020, 0x0861, 0x0861, 0x0840,   // 0x3A20 (14880) pixels
-0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x0861, 0x0000, 0x5AEB, 0x39E7, 0x4A48, 0x5289, 0x630B, 0x6B2C, 0x632C, 0x632C, 0x738D,   // 0x3A30 (14896) pixels
-0x738D, 0x6B8D, 0x7BEE, 0x7BCE, 0x83EF, 0x8430, 0x9CF3, 0xBDF7, 0xBDD7, 0xD679, 0xD6BA, 0xDEDA, 0xE73C, 0xDEFB, 0xE71C, 0xE73C,   // 0x3A40 (14912) pixels
-0xDEFB, 0xE6FB, 0xE73C, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C,   // 0x3A50 (14928) pixels
-0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB,   // 0x3A60 (14944) pixels
-0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B,   // 0x3A70 (14960) pixels
-0xF7BE, 0xF79E, 0xF79D, 0xF77D, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xEF5D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE,   // 0x3A80 (14976) pixels
-0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF77D, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE,   // 0x3A90 (14992) pixels
-0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFFF, 0xF79E, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xF79E,   // 0x3AA0 (15008) pixels
-0x2104, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3AB0 (15024) pixels
-0x18E3, 0x18E3, 0x20E3, 0x20C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x18E3, 0x18E3, 0x20E3, 0x20C3, 0x20C3, 0x20E4, 0x18E3,   // 0x3AC0 (15040) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x1882, 0x30A2, 0x3020, 0x7986, 0xA228, 0xBA68, 0xB9E7, 0xD207, 0xDA07, 0xD1C6, 0xDA27, 0xC9E7,   // 0x3AD0 (15056) pixels
-0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xC9E7, 0xC1A6, 0xDA28, 0xC9C6, 0xD1E7, 0xD207, 0xC9C6, 0xD207, 0xC9E7, 0xC9C6, 0xD248, 0xC9E7,   // 0x3AE0 (15072) pixels
-0xD1E7, 0xC9C6, 0xC9E7, 0xC227, 0x9163, 0xCBEC, 0xCCCF, 0xD591, 0xCDB1, 0xDE33, 0xCD92, 0xE635, 0xC572, 0xDE15, 0xD615, 0x20C1,   // 0x3AF0 (15088) pixels
-0x1081, 0x0861, 0x0841, 0x0821, 0x0841, 0x1083, 0x0841, 0x0862, 0x0861, 0x0861, 0x0040, 0x0040, 0x0881, 0x1082, 0x1081, 0x0861,   // 0x3B00 (15104) pixels
-0x10A2, 0x0000, 0x1081, 0x39C6, 0x4228, 0x52AA, 0x5ACA, 0x62EB, 0x632C, 0x6B4C, 0x738D, 0x6B4C, 0x738D, 0x7BEE, 0x7BCE, 0x7BEF,   // 0x3B10 (15120) pixels
-0x840F, 0xA534, 0xAD75, 0xBDD6, 0xC638, 0xD6BA, 0xD679, 0xDEDB, 0xE71C, 0xE71C, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C,   // 0x3B20 (15136) pixels
-0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x3B30 (15152) pixels
-0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x3B40 (15168) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xFFFF, 0xFFDF, 0xFFDE, 0xF7BE,   // 0x3B50 (15184) pixels
-0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x3B60 (15200) pixels
-0xFFFF, 0xFFDE, 0xF7BE, 0xF79E, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xF79D, 0xEF7D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x3B70 (15216) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xFFBE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFDF, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3B80 (15232) pixels
-0x18E3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3,   // 0x3B90 (15248) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x2124, 0x18E3, 0x18C3, 0x20E4, 0x20C3, 0x18E4, 0x1904, 0x18C3, 0x20E3, 0x18C3, 0x2082,   // 0x3BA0 (15264) pixels
-0x3082, 0x3841, 0x9A49, 0xAA29, 0xBA28, 0xC207, 0xC9E6, 0xC9C5, 0xDA06, 0xD1E6, 0xC9E6, 0xD207, 0xD207, 0xC9C6, 0xD228, 0xC9E7,   // 0x3BB0 (15280) pixels
-0xD1E7, 0xD207, 0xD1E7, 0xD207, 0xD1E7, 0xC9C6, 0xD207, 0xC9E7, 0xC9E7, 0xD207, 0xCA07, 0xD207, 0xD1E7, 0xD207, 0xD1E7, 0xCA07,   // 0x3BC0 (15296) pixels
-0xC248, 0x91A4, 0xCC0D, 0xC48E, 0xCD50, 0xCD70, 0xDE13, 0xCD92, 0xDE15, 0xDE36, 0xCDF5, 0x1860, 0x1060, 0x1061, 0x0841, 0x1083,   // 0x3BD0 (15312) pixels
-0x0841, 0x18C3, 0x1082, 0x0021, 0x0861, 0x0840, 0x0861, 0x0881, 0x1081, 0x0861, 0x0861, 0x1081, 0x0840, 0x4228, 0x31A6, 0x41E7,   // 0x3BE0 (15328) pixels
-0x5289, 0x630B, 0x5ACA, 0x630B, 0x632C, 0x6B6D, 0x6B6D, 0x73AE, 0x73AE, 0x738D, 0x8430, 0x8C71, 0x9CD3, 0xB5B6, 0xBDD7, 0xCE79,   // 0x3BF0 (15344) pixels
-0xD679, 0xDEDA, 0xE73C, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xE73C, 0xDEFB, 0xDEFB, 0xE73C, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB,   // 0x3C00 (15360) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B,   // 0x3C10 (15376) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xE71B,   // 0x3C20 (15392) pixels
-0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE,   // 0x3C30 (15408) pixels
-0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xEF7D, 0xF77D, 0xF79E, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79D, 0xF77D, 0xF79D, 0xF7BE,   // 0x3C40 (15424) pixels
-0xFFDF, 0xFFDF, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79D, 0xF79D, 0xF7BE,   // 0x3C50 (15440) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x10A2, 0x2103, 0x2124, 0x18C3, 0x2103, 0x18E3, 0x18C3,   // 0x3C60 (15456) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3C70 (15472) pixels
-0x18E4, 0x18E3, 0x18E4, 0x18E3, 0x20E4, 0x18C3, 0x1904, 0x18E3, 0x18E2, 0x20E3, 0x28C3, 0x3061, 0x4841, 0xA24A, 0xB209, 0xC228,   // 0x3C80 (15488) pixels
-0xCA27, 0xC9E6, 0xD226, 0xD206, 0xC9C5, 0xD206, 0xD227, 0xCA07, 0xCA07, 0xD207, 0xC9E7, 0xC9C6, 0xD1E7, 0xD207, 0xD1E7, 0xD1E7,   // 0x3C90 (15504) pixels
-0xD1E7, 0xD207, 0xD1E7, 0xC9C6, 0xD1E7, 0xD207, 0xC9C6, 0xD207, 0xC1C6, 0xCA08, 0xC9E7, 0xC1C6, 0xCA28, 0xBA27, 0x91C5, 0xC40D,   // 0x3CA0 (15520) pixels
-0xD530, 0xD5B2, 0xCDD3, 0xDE55, 0xDE77, 0xC5B5, 0x2081, 0x1861, 0x1061, 0x0861, 0x0861, 0x10A2, 0x10A3, 0x0862, 0x0021, 0x1082,   // 0x3CB0 (15536) pixels
-0x0861, 0x0040, 0x0861, 0x10A1, 0x1081, 0x0861, 0x0861, 0x0841, 0x0000, 0x2124, 0x39E7, 0x4A48, 0x5289, 0x5ACA, 0x5AEB, 0x632C,   // 0x3CC0 (15552) pixels
-0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x840F, 0x9CD2, 0x94D2, 0xAD75, 0xBDD7, 0xBDF7, 0xD69A, 0xDEDB, 0xDEBA, 0xE73C, 0xE71B,   // 0x3CD0 (15568) pixels
-0xDEDA, 0xDEFB, 0xDEDB, 0xDEFB, 0xE73C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C,   // 0x3CE0 (15584) pixels
-0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B,   // 0x3CF0 (15600) pixels
-0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x3D00 (15616) pixels
-0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF,   // 0x3D10 (15632) pixels
-0xFFDE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xEF7D, 0xF79E, 0xF7BE, 0xFFDE,   // 0x3D20 (15648) pixels
-0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF79D, 0xF77D, 0xF7BE, 0xFFDE, 0xF7BE, 0xFFFF,   // 0x3D30 (15664) pixels
-0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x2124, 0x18C2, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3D40 (15680) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E4, 0x18C3, 0x2125, 0x10A3,   // 0x3D50 (15696) pixels
-0x2104, 0x20E4, 0x18E3, 0x1903, 0x2103, 0x20C2, 0x3061, 0x5062, 0xAA4A, 0xBA09, 0xCA29, 0xCA07, 0xC9E6, 0xCA06, 0xD206, 0xD206,   // 0x3D60 (15712) pixels
-0xD207, 0xD206, 0xCA06, 0xCA27, 0xC9E7, 0xD207, 0xD1E7, 0xC9E7, 0xD1E7, 0xC9C6, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207,   // 0x3D70 (15728) pixels
-0xD1E7, 0xD1E7, 0xD207, 0xC9E7, 0xCA07, 0xC1C6, 0xD228, 0xD208, 0xC9E7, 0xCA48, 0xA9E6, 0x8983, 0xCC8E, 0xCD30, 0xD5D3, 0xE696,   // 0x3D80 (15744) pixels
-0xC5B4, 0x20A1, 0x1041, 0x1061, 0x1082, 0x0861, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x0841, 0x0882, 0x0882, 0x0861, 0x1082, 0x1082,   // 0x3D90 (15760) pixels
-0x0840, 0x0841, 0x0861, 0x0840, 0x738D, 0x39A6, 0x4228, 0x4A69, 0x5AEB, 0x632C, 0x6B4D, 0x6B2C, 0x738D, 0x73AE, 0x7BCE, 0x73AE,   // 0x3DA0 (15776) pixels
-0x7BEF, 0x8430, 0x9CF3, 0xAD75, 0xBDF7, 0xCE58, 0xD699, 0xDEDA, 0xE71C, 0xE6FB, 0xE71C, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xE71C,   // 0x3DB0 (15792) pixels
-0xE6FB, 0xDEDB, 0xE71B, 0xE73C, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xDEFB,   // 0x3DC0 (15808) pixels
-0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x3DD0 (15824) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA,   // 0x3DE0 (15840) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE,   // 0x3DF0 (15856) pixels
-0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFFF, 0xFFFF,   // 0x3E00 (15872) pixels
-0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xF79E, 0xFFFF, 0xFFDE, 0xF7BE, 0xFFFF, 0xFFDF,   // 0x3E10 (15888) pixels
-0xFFDE, 0xFFFF, 0xF77D, 0x2103, 0x18C3, 0x18C3, 0x2103, 0x18C2, 0x18E3, 0x2104, 0x18E3, 0x18C3, 0x20E3, 0x18E3, 0x18E3, 0x18E3,   // 0x3E20 (15904) pixels
-0x18E4, 0x18E4, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x20E4, 0x20E4, 0x20C4, 0x2104, 0x18C3, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x18E3,   // 0x3E30 (15920) pixels
-0x20A1, 0x38E2, 0x4020, 0xB26A, 0xB9E8, 0xD228, 0xCA07, 0xC9E6, 0xCA06, 0xCA06, 0xD207, 0xD207, 0xD1E7, 0xD1E6, 0xC9E6, 0xD207,   // 0x3E40 (15936) pixels
-0xC9E7, 0xC9E6, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xCA07,   // 0x3E50 (15952) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC1E6, 0xC227, 0xB267, 0x7983, 0xD4F0, 0xCD92, 0xBD52, 0x1880, 0x1881, 0x1041, 0x1041,   // 0x3E60 (15968) pixels
-0x10A2, 0x0861, 0x18C3, 0x0861, 0x1082, 0x1082, 0x0020, 0x1082, 0x1082, 0x0861, 0x0862, 0x1082, 0x0821, 0x0821, 0x0821, 0x1082,   // 0x3E70 (15984) pixels
-0x3165, 0x41E7, 0x4A69, 0x5289, 0x5ACA, 0x630B, 0x632C, 0x6B4D, 0x738D, 0x7BCE, 0x7BEF, 0x8C30, 0x9CF3, 0xAD54, 0xBDD6, 0xC617,   // 0x3E80 (16000) pixels
-0xCE58, 0xCE79, 0xDEFB, 0xE71B, 0xE71B, 0xDEDB, 0xE71C, 0xDEDA, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB,   // 0x3E90 (16016) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB,   // 0x3EA0 (16032) pixels
-0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C,   // 0x3EB0 (16048) pixels
-0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xF79E, 0xF79E, 0xF79E, 0xF79E,   // 0x3EC0 (16064) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE,   // 0x3ED0 (16080) pixels
-0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE, 0xFFDE,   // 0x3EE0 (16096) pixels
-0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79E, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFDF, 0xF7BE, 0xFFDE, 0xFFFF, 0x31A6,   // 0x3EF0 (16112) pixels
-0x2103, 0x18C3, 0x18E3, 0x2104, 0x20E3, 0x18C3, 0x20E3, 0x20E4, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x18E4, 0x18E4, 0x18E3, 0x18E3,   // 0x3F00 (16128) pixels
-0x18E3, 0x18E3, 0x20E4, 0x20C4, 0x20E4, 0x20E4, 0x18E4, 0x18E4, 0x10A2, 0x2104, 0x20C2, 0x28C2, 0x30A1, 0x4881, 0xA249, 0xC249,   // 0x3F10 (16144) pixels
-0xD208, 0xDA28, 0xCA07, 0xCA27, 0xCA27, 0xCA27, 0xD207, 0xD1E7, 0xD1E7, 0xD1C7, 0xD1E7, 0xD1E7, 0xD207, 0xCA07, 0xD1E7, 0xD207,   // 0x3F20 (16160) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xCA07, 0xCA07, 0xC9E6,   // 0x3F30 (16176) pixels
-0xD227, 0xCA07, 0xCA06, 0xC227, 0xAA66, 0xD46E, 0xC4AF, 0xCD93, 0x1840, 0x1060, 0x1061, 0x1882, 0x1061, 0x18C3, 0x0840, 0x1081,   // 0x3F40 (16192) pixels
-0x1081, 0x0840, 0x10A1, 0x0861, 0x0861, 0x1082, 0x0862, 0x0021, 0x0841, 0x0820, 0x630C, 0x2944, 0x31A5, 0x4A68, 0x4A28, 0x52AA,   // 0x3F50 (16208) pixels
-0x5AEB, 0x62EB, 0x6B6D, 0x738E, 0x7BCE, 0x73AE, 0x73AE, 0x840F, 0x9CF3, 0xAD54, 0xBDF7, 0xC638, 0xD6BA, 0xDEBA, 0xDEDB, 0xDEFB,   // 0x3F60 (16224) pixels
-0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C,   // 0x3F70 (16240) pixels
-0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEDB,   // 0x3F80 (16256) pixels
-0xE71B, 0xE71C, 0xE71B, 0xE71C, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x3F90 (16272) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xFFDF, 0xFFDE, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E,   // 0x3FA0 (16288) pixels
-0xFFBE, 0xFFBE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE,   // 0x3FB0 (16304) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF,   // 0x3FC0 (16320) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFBE, 0xFFFF, 0xF7BE, 0xFFDE, 0xF79D, 0xFFDE, 0xFFDE, 0xF7BE, 0xFFDE, 0x2103, 0x18E3, 0x18C3,   // 0x3FD0 (16336) pixels
-0x18E3, 0x20E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E4, 0x20E4,   // 0x3FE0 (16352) pixels
-0x20C4, 0x20E4, 0x18E3, 0x18E3, 0x2124, 0x20C2, 0x28C2, 0x38A1, 0x4861, 0xAA8A, 0xBA08, 0xCA08, 0xD207, 0xD1E6, 0xC9E6, 0xC1E5,   // 0x3FF0 (16368) pixels
-0xCA27, 0xCA07, 0xD1E7, 0xD1C7, 0xD1C7, 0xD1C7, 0xD1E7, 0xD207, 0xD207, 0xCA07, 0xCA07, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD207,   // 0x4000 (16384) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xC9C6, 0xCA07, 0xC9E6, 0xD207, 0xC9E6, 0xD227, 0xC1E6,   // 0x4010 (16400) pixels
-0xBA27, 0xAA47, 0xC3ED, 0x4902, 0x2080, 0x1060, 0x1061, 0x0861, 0x0862, 0x0861, 0x1081, 0x0861, 0x0840, 0x10A1, 0x0860, 0x1081,   // 0x4020 (16416) pixels
-0x0861, 0x0841, 0x0821, 0x1062, 0x0841, 0x6B2C, 0x2945, 0x39A6, 0x39C6, 0x4227, 0x5269, 0x630B, 0x5AEB, 0x6B4C, 0x6B6D, 0x7BAE,   // 0x4030 (16432) pixels
-0x736D, 0x7BEF, 0x8C51, 0xA514, 0xB596, 0xC618, 0xCE79, 0xD699, 0xDEDA, 0xE71B, 0xE6FB, 0xE71C, 0xE71B, 0xE71C, 0xDEFB, 0xDEFB,   // 0x4040 (16448) pixels
-0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71C, 0xE73C,   // 0x4050 (16464) pixels
-0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xDEFB, 0xDEDB, 0xDEBA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xE73C,   // 0x4060 (16480) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C,   // 0x4070 (16496) pixels
-0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xEF7D, 0xF79D, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE,   // 0x4080 (16512) pixels
-0xF79E, 0xF79E, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFBE, 0xF7BE,   // 0x4090 (16528) pixels
-0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFDE,   // 0x40A0 (16544) pixels
-0xF79D, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDE, 0xF79D, 0xFFDE, 0x6B4C, 0x18C3, 0x2104, 0x18C3, 0x20E3, 0x18E3, 0x18E3,   // 0x40B0 (16560) pixels
-0x2104, 0x20E3, 0x18C3, 0x20E3, 0x18E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E4, 0x20E4, 0x20A3, 0x20E4, 0x18E4, 0x2124,   // 0x40C0 (16576) pixels
-0x10A1, 0x28C2, 0x3881, 0x4861, 0xAA8A, 0xB228, 0xCA28, 0xD1E7, 0xD9E7, 0xC9C5, 0xD206, 0xD247, 0xCA07, 0xD1E7, 0xD1C7, 0xD1C7,   // 0x40D0 (16592) pixels
-0xD1E7, 0xD1E8, 0xD1E7, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7,   // 0x40E0 (16608) pixels
-0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9E6, 0xC9E6, 0xC9C6, 0xD207, 0xC9E6, 0xC9E6, 0xD207, 0xC9E7, 0xC248, 0x8984, 0x3800,   // 0x40F0 (16624) pixels
-0x1800, 0x1860, 0x1081, 0x0861, 0x0021, 0x1082, 0x0861, 0x0881, 0x1081, 0x0860, 0x10A1, 0x0860, 0x0841, 0x0841, 0x0861, 0x0000,   // 0x4100 (16640) pixels
-0x4207, 0x3165, 0x39E6, 0x4207, 0x4A48, 0x5ACA, 0x5AAA, 0x630B, 0x6B4C, 0x6B6D, 0x738D, 0x840F, 0x7BEF, 0x9471, 0xAD55, 0xB596,   // 0x4110 (16656) pixels
-0xC638, 0xC638, 0xD6BA, 0xDEDA, 0xE73C, 0xE71C, 0xDEDA, 0xDEFB, 0xDEFB, 0xE73C, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xEF3C,   // 0x4120 (16672) pixels
-0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x4130 (16688) pixels
-0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71C,   // 0x4140 (16704) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xEF5C, 0xE73C, 0xE71B, 0xDEFB,   // 0x4150 (16720) pixels
-0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE,   // 0x4160 (16736) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4170 (16752) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF79E, 0xFFBE, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x4180 (16768) pixels
-0xF7BE, 0xFFDE, 0xF7BE, 0xFFFF, 0xF79D, 0xFFDE, 0xDEDB, 0x18E3, 0x2103, 0x2103, 0x18C3, 0x2104, 0x18C3, 0x18E3, 0x2104, 0x18E3,   // 0x4190 (16784) pixels
-0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x20E4, 0x18C3, 0x20E3, 0x18E3, 0x2102, 0x30E2, 0x4040, 0x99E7,   // 0x41A0 (16800) pixels
-0xBA28, 0xCA28, 0xCA07, 0xD207, 0xD207, 0xD1E6, 0xDA27, 0xC9C5, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xCA07, 0xC9E7,   // 0x41B0 (16816) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x41C0 (16832) pixels
-0xC9E7, 0xC9C6, 0xC9E7, 0xCA07, 0xC1C6, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xB9C7, 0xBA69, 0x7924, 0x3000, 0x2861, 0x1881, 0x0820,   // 0x41D0 (16848) pixels
-0x0841, 0x0841, 0x10A2, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861, 0x1061, 0x0841, 0x0820, 0x0840, 0x630B, 0x3185, 0x39A6, 0x4A27,   // 0x41E0 (16864) pixels
-0x4A48, 0x4227, 0x62EB, 0x5ACA, 0x632C, 0x738D, 0x7BCE, 0x8410, 0x94B2, 0x9CF3, 0xAD75, 0xC617, 0xCE58, 0xD6BA, 0xE6FB, 0xEF3C,   // 0x41F0 (16880) pixels
-0xDEFB, 0xDEFB, 0xE73C, 0xE73C, 0xE71B, 0xE71C, 0xE71B, 0xE6FB, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB,   // 0x4200 (16896) pixels
-0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,   // 0x4210 (16912) pixels
-0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x4220 (16928) pixels
-0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79E,   // 0x4230 (16944) pixels
-0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x4240 (16960) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x4250 (16976) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF79D,   // 0x4260 (16992) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x2103, 0x18C2, 0x20E4, 0x18C3, 0x20E4, 0x18E3, 0x18C3, 0x18C3, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0x4270 (17008) pixels
-0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18C4, 0x20E4, 0x20E3, 0x20E3, 0x2902, 0x30A1, 0xA289, 0xBA49, 0xCA28, 0xC9E7, 0xD228, 0xC9C6,   // 0x4280 (17024) pixels
-0xD207, 0xD207, 0xD1E6, 0xDA47, 0xC9E6, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xC9E7, 0xC9E6, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7,   // 0x4290 (17040) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E6, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xD207, 0xC1C6, 0xC9E7,   // 0x42A0 (17056) pixels
-0xC9E7, 0xD207, 0xC9C6, 0xD1E7, 0xD1E7, 0xC9E7, 0xBA08, 0xAA28, 0x6103, 0x2800, 0x1800, 0x1061, 0x1061, 0x1082, 0x0861, 0x1082,   // 0x42B0 (17072) pixels
-0x0861, 0x0841, 0x0861, 0x0861, 0x0840, 0x0840, 0x0820, 0x5AEA, 0x3185, 0x4207, 0x4206, 0x4A27, 0x4207, 0x630B, 0x5289, 0x736D,   // 0x42C0 (17088) pixels
-0x632C, 0x7BAE, 0x738E, 0x8430, 0xA534, 0xAD75, 0xC638, 0xC638, 0xD6BA, 0xDEFB, 0xE71B, 0xDEDA, 0xEF5D, 0xDEFB, 0xE71B, 0xDEFB,   // 0x42D0 (17104) pixels
-0xDEFB, 0xE73C, 0xE73C, 0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x42E0 (17120) pixels
-0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71B,   // 0x42F0 (17136) pixels
-0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x4300 (17152) pixels
-0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFBE, 0xF7BE,   // 0x4310 (17168) pixels
-0xFFFF, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4320 (17184) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xF79E, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE,   // 0x4330 (17200) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFFF, 0xF7BE, 0xFFBE,   // 0x4340 (17216) pixels
-0xF7BE, 0xA513, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x2104, 0x20E3, 0x20C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4,   // 0x4350 (17232) pixels
-0x20E4, 0x20C4, 0x20E3, 0x20E3, 0x20C1, 0x40C1, 0xB28A, 0xC228, 0xCA07, 0xD227, 0xC9E6, 0xC9E6, 0xD227, 0xC9E6, 0xC9C6, 0xD227,   // 0x4360 (17248) pixels
-0xCA06, 0xCA06, 0xC9E7, 0xD1E7, 0xD1E7, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7,   // 0x4370 (17264) pixels
-0xC9C7, 0xD1E7, 0xD1E7, 0xC9C7, 0xC9C7, 0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xC9E7, 0xC9C6, 0xD1E7, 0xC9C6, 0xD1E7, 0xC9E7, 0xC9C6,   // 0x4380 (17280) pixels
-0xC9E6, 0xCA07, 0xC1E7, 0xBA28, 0xB26A, 0x68E4, 0x2800, 0x1820, 0x1061, 0x1082, 0x0841, 0x1082, 0x0841, 0x0841, 0x1062, 0x0840,   // 0x4390 (17296) pixels
-0x0820, 0x0000, 0x62EA, 0x6B4B, 0x3184, 0x41E6, 0x5248, 0x5268, 0x4A48, 0x5289, 0x5ACA, 0x630B, 0x632C, 0x738D, 0x8410, 0x9CD2,   // 0x43A0 (17312) pixels
-0xAD34, 0xBDB7, 0xCE59, 0xCE79, 0xD69A, 0xE71C, 0xE71B, 0xDEDB, 0xE71C, 0xDEFB, 0xE73C, 0xE71B, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB,   // 0x43B0 (17328) pixels
-0xDEFB, 0xDEFB, 0xE73C, 0xE71C, 0xE6FB, 0xE71B, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C,   // 0x43C0 (17344) pixels
-0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE71C, 0xE71B,   // 0x43D0 (17360) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB,   // 0x43E0 (17376) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF,   // 0x43F0 (17392) pixels
-0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4400 (17408) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x4410 (17424) pixels
-0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79D, 0xF79D, 0xEF3D, 0x5AEB,   // 0x4420 (17440) pixels
-0x20E4, 0x2104, 0x2104, 0x18A3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1904, 0x18E4, 0x20E4, 0x20E4, 0x20C2, 0x20A1,   // 0x4430 (17456) pixels
-0x38E1, 0x5081, 0xBA49, 0xCA08, 0xD207, 0xCA06, 0xCA07, 0xCA07, 0xD207, 0xD207, 0xD207, 0xCA07, 0xCA27, 0xCA27, 0xD207, 0xD207,   // 0x4440 (17472) pixels
-0xD1E7, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xD1E7, 0xD1E7, 0xC9C7, 0xD1E7, 0xC9C7, 0xD1E7, 0xD1E7, 0xD1E7,   // 0x4450 (17488) pixels
-0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC208,   // 0x4460 (17504) pixels
-0xB228, 0xAA49, 0x68E3, 0x3000, 0x1841, 0x0821, 0x1882, 0x0841, 0x0841, 0x1082, 0x0840, 0x0820, 0x1881, 0x736B, 0x736B, 0x7B8C,   // 0x4470 (17520) pixels
-0x39A5, 0x41E6, 0x5248, 0x5248, 0x5248, 0x5AA9, 0x62EB, 0x6B4C, 0x6B4C, 0x7BEF, 0x8C50, 0xAD75, 0xC618, 0xC618, 0xDEBA, 0xDEFB,   // 0x4480 (17536) pixels
-0xE71C, 0xE71B, 0xE6FB, 0xE6FB, 0xE71C, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xDEDB, 0xE6FB, 0xE71B, 0xDEDB, 0xE6FB, 0xDEFB,   // 0x4490 (17552) pixels
-0xE71B, 0xEF3C, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C,   // 0x44A0 (17568) pixels
-0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x44B0 (17584) pixels
-0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x44C0 (17600) pixels
-0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x44D0 (17616) pixels
-0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,   // 0x44E0 (17632) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x44F0 (17648) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDF, 0xFFDE, 0xF79D, 0xF79E, 0xE71C, 0xE73C, 0x18C3, 0x2104,   // 0x4500 (17664) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x2103, 0x1904, 0x18E3, 0x20C3, 0x20C3, 0x28E2, 0x30C1, 0x60E2, 0xAA28, 0xC228, 0xD1E7,   // 0x4510 (17680) pixels
-0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9C6, 0xC9E6, 0xD1E7, 0xD1E7,   // 0x4520 (17696) pixels
-0xC9E6, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD1E7, 0xC9E6, 0xC9E6, 0xD1E7, 0xD207, 0xD1E7,   // 0x4530 (17712) pixels
-0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA28, 0xB9E7, 0xBA48, 0xAA28, 0x6081,   // 0x4540 (17728) pixels
-0x2000, 0x1841, 0x0800, 0x1062, 0x0841, 0x0820, 0x0820, 0x732A, 0xACF1, 0xCDD4, 0xBD52, 0x7B6B, 0x41C5, 0x5227, 0x5A89, 0x5249,   // 0x4550 (17744) pixels
-0x4A07, 0x5AEA, 0x5ACA, 0x630B, 0x83EF, 0x9CD3, 0xA4F3, 0xC5F7, 0xC617, 0xD6BA, 0xDEBA, 0xDEDB, 0xEF5C, 0xE73C, 0xDEDB, 0xE71C,   // 0x4560 (17760) pixels
-0xEF3C, 0xE71B, 0xE71B, 0xE71C, 0xEF3C, 0xE73C, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xEF5C, 0xE71C, 0xDEFB, 0xE71B,   // 0x4570 (17776) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71C, 0xE73C, 0xEF3C,   // 0x4580 (17792) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB,   // 0x4590 (17808) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDE,   // 0x45A0 (17824) pixels
-0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE,   // 0x45B0 (17840) pixels
-0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x45C0 (17856) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x45D0 (17872) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xEF3C, 0xE6FB, 0xDEBA, 0x840F, 0x20E3, 0x18E3, 0x18E3, 0x18E3,   // 0x45E0 (17888) pixels
-0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20C3, 0x28C2, 0x30E2, 0x3860, 0xAA69, 0xC248, 0xC1C7, 0xD208, 0xD1E7, 0xD207, 0xD207, 0xD207,   // 0x45F0 (17904) pixels
-0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7,   // 0x4600 (17920) pixels
-0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x4610 (17936) pixels
-0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xD207, 0xD207, 0xC1A6, 0xCA07, 0xCA28, 0xB9E7, 0xC248, 0x8103, 0x3800, 0x2820, 0x2020, 0x1020,   // 0x4620 (17952) pixels
-0x0820, 0x0820, 0x730A, 0xBD72, 0xC592, 0xC592, 0xD615, 0x6AE9, 0x5A88, 0x4A07, 0x5228, 0x5A69, 0x5AAA, 0x5AEA, 0x62EB, 0x736D,   // 0x4630 (17968) pixels
-0x7BAE, 0x9CB2, 0xB575, 0xCE38, 0xCE58, 0xDEBA, 0xDEFB, 0xDEDB, 0xDEFB, 0xE73C, 0xE71B, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB,   // 0x4640 (17984) pixels
-0xE71B, 0xE71B, 0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xE6FB, 0xE73C, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71C,   // 0x4650 (18000) pixels
-0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x4660 (18016) pixels
-0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B,   // 0x4670 (18032) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4680 (18048) pixels
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4690 (18064) pixels
-0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x46A0 (18080) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF,   // 0x46B0 (18096) pixels
-0xFFFF, 0xFFDE, 0xFFDF, 0xF7BE, 0xF7BE, 0xEF7D, 0xEF7D, 0xE73C, 0xDEDB, 0xD69A, 0xD679, 0xD658, 0xCE17, 0xBD96, 0xAD55, 0xAD34,   // 0x46C0 (18112) pixels
-0x9C91, 0xBD13, 0xBCD1, 0xD470, 0xAA28, 0xC208, 0xD208, 0xD1C7, 0xD1E7, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xD1E6, 0xD1E7, 0xD207,   // 0x46D0 (18128) pixels
-0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD1E7, 0xC9E7,   // 0x46E0 (18144) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x46F0 (18160) pixels
-0xC9C6, 0xC9C6, 0xCA07, 0xC9E7, 0xC1C6, 0xCA28, 0xB9E6, 0xBA48, 0xA269, 0x4000, 0x2000, 0x1800, 0x942E, 0xD615, 0xCDD4, 0xCD92,   // 0x4700 (18176) pixels
-0xD5D3, 0xD614, 0xC5B3, 0x41E5, 0x4A27, 0x5268, 0x5248, 0x5AAA, 0x5289, 0x62EB, 0x6B2C, 0x840F, 0x9492, 0xB595, 0xC618, 0xD69A,   // 0x4710 (18192) pixels
-0xE73C, 0xDEFB, 0xE73C, 0xEF5D, 0xE6FB, 0xDEFB, 0xE71C, 0xDEDB, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,   // 0x4720 (18208) pixels
-0xE71C, 0xEF3C, 0xE71B, 0xEF3C, 0xE71B, 0xE6FB, 0xEF3C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB,   // 0x4730 (18224) pixels
-0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B,   // 0x4740 (18240) pixels
-0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xEF5C,   // 0x4750 (18256) pixels
-0xEF3C, 0xE73C, 0xE71B, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4760 (18272) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4770 (18288) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4780 (18304) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF,   // 0x4790 (18320) pixels
-0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xEF3C, 0xDEDA, 0xDEBA, 0xDE79, 0xD638, 0xCE18, 0xD638, 0xC5B6, 0xCD74, 0xDD13, 0xA289,   // 0x47A0 (18336) pixels
-0xBA48, 0xCA28, 0xC9E7, 0xD207, 0xD1E7, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xD1E6, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xD207, 0xD207,   // 0x47B0 (18352) pixels
-0xD1E7, 0xD1E7, 0xD207, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xC9E7, 0xC9E7, 0xD207,   // 0x47C0 (18368) pixels
-0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD228, 0xC1C6,   // 0x47D0 (18384) pixels
-0xC9E7, 0xC207, 0xC1E7, 0xC248, 0xBA48, 0xA227, 0x7184, 0xB44E, 0xC531, 0xC572, 0xCDB2, 0xDDF3, 0xD5F3, 0xBD51, 0x83CB, 0x4A05,   // 0x47E0 (18400) pixels
-0x5268, 0x4A07, 0x5ACA, 0x5289, 0x4A48, 0x62EB, 0x83EF, 0xA4F3, 0xA513, 0xC5F7, 0xD69A, 0xDEDB, 0xDEDB, 0xEF5D, 0xE73C, 0xE6FB,   // 0x47F0 (18416) pixels
-0xE73C, 0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0xE73C, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71C, 0xE71B, 0xDEDB, 0xE73C, 0xE71B, 0xDEFB,   // 0x4800 (18432) pixels
-0xE73C, 0xE6FB, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE73C, 0xEF5C, 0xEF7D, 0xEF7D,   // 0x4810 (18448) pixels
-0xEF5D, 0xE73C, 0xE71C, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF3C, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB,   // 0x4820 (18464) pixels
-0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB,   // 0x4830 (18480) pixels
-0xFFBF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,   // 0x4840 (18496) pixels
-0xFFFF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4850 (18512) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4860 (18528) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79E, 0xF79D, 0xF79E,   // 0x4870 (18544) pixels
-0xF77D, 0xEF5C, 0xE71B, 0xE6FA, 0xDEDA, 0xDE99, 0xD658, 0xD638, 0xCE17, 0xD595, 0xD470, 0xB289, 0xCA69, 0xC1E6, 0xC9E7, 0xD227,   // 0x4880 (18560) pixels
-0xD207, 0xD207, 0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6,   // 0x4890 (18576) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xD1E7, 0xC9E7, 0xD1E7,   // 0x48A0 (18592) pixels
-0xC9E7, 0xD207, 0xCA07, 0xCA07, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xD207, 0xC9C6, 0xC9E7, 0xD207, 0xC9C7, 0xCA08, 0xC1E7,   // 0x48B0 (18608) pixels
-0xC207, 0xBA47, 0xAA67, 0xBBCC, 0xCCCF, 0xCD51, 0xE634, 0xCD71, 0xCD91, 0xD5F3, 0x8BEC, 0x5287, 0x4A27, 0x5ACA, 0x4A48, 0x62CA,   // 0x48C0 (18624) pixels
-0x5AAA, 0x5ACA, 0x7BCE, 0xA513, 0xB575, 0xC617, 0xCE38, 0xDEDB, 0xDEDA, 0xE71B, 0xE71C, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71C,   // 0x48D0 (18640) pixels
-0xE71C, 0xE73C, 0xE6FB, 0xE71B, 0xE71C, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE71B, 0xE71C, 0xDEDB, 0xE71C, 0xE71B, 0xDEDB, 0xDEFB,   // 0x48E0 (18656) pixels
-0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0xE73C,   // 0x48F0 (18672) pixels
-0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE6FB,   // 0x4900 (18688) pixels
-0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x4910 (18704) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4920 (18720) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4930 (18736) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4940 (18752) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFBE, 0xEF7D, 0xEF5C,   // 0x4950 (18768) pixels
-0xEF3B, 0xEF1B, 0xEEFB, 0xEEDA, 0xE678, 0xF637, 0xAAAA, 0xB248, 0xB9E7, 0xD248, 0xD207, 0xD227, 0xD207, 0xD207, 0xD207, 0xD207,   // 0x4960 (18784) pixels
-0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xD207, 0xD1E7, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207,   // 0x4970 (18800) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xD207, 0xD207, 0xCA07,   // 0x4980 (18816) pixels
-0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9C6, 0xD207, 0xC9C6, 0xC9E7, 0xC9E7, 0xD207, 0xC9C6, 0xC1E6, 0xBA47, 0xA246,   // 0x4990 (18832) pixels
-0xAB49, 0xC4AE, 0xC4EF, 0xC530, 0xE614, 0xD5F4, 0x83AB, 0x4205, 0x4A47, 0x4A88, 0x5AAA, 0x5289, 0x5AAA, 0x7BCE, 0x9CB2, 0xAD54,   // 0x49A0 (18848) pixels
-0xBDD6, 0xD699, 0xD699, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDB, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xE71C,   // 0x49B0 (18864) pixels
-0xE73C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xDEFB, 0xE71C, 0xE71C, 0xE6FB, 0xE73C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x49C0 (18880) pixels
-0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71B,   // 0x49D0 (18896) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B,   // 0x49E0 (18912) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x49F0 (18928) pixels
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4A00 (18944) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4A10 (18960) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x4A20 (18976) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFBE, 0xF79D, 0xF79D, 0xEF9D, 0xEF7C, 0xEF5C, 0xEF1B, 0xF6FB,   // 0x4A30 (18992) pixels
-0xFEB9, 0xFE37, 0xAA68, 0xC248, 0xCA47, 0xCA06, 0xD206, 0xD1E6, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E6,   // 0x4A40 (19008) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xD207, 0xD207, 0xC9E6, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x4A50 (19024) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x4A60 (19040) pixels
-0xD207, 0xC9E6, 0xD1E7, 0xD1E7, 0xD207, 0xC9A6, 0xD1E7, 0xC9C7, 0xC9C7, 0xC9E7, 0xC207, 0xBA47, 0xA267, 0xB36A, 0xD4F0, 0xDD92,   // 0x4A70 (19056) pixels
-0xDDD3, 0xCDB3, 0x8BAC, 0x41E5, 0x4A47, 0x52A9, 0x5ACA, 0x62EA, 0x734C, 0x7BEE, 0x9492, 0xC5F7, 0xCE38, 0xD679, 0xD69A, 0xDEBA,   // 0x4A80 (19072) pixels
-0xDEDB, 0xDEDB, 0xE71B, 0xE6FB, 0xDEBA, 0xE71B, 0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71B, 0xDEFB, 0xE71C,   // 0x4A90 (19088) pixels
-0xE71C, 0xDEFB, 0xE71C, 0xE73C, 0xE71B, 0xE73C, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB,   // 0x4AA0 (19104) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x4AB0 (19120) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71C,   // 0x4AC0 (19136) pixels
-0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4AD0 (19152) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4AE0 (19168) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4AF0 (19184) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,   // 0x4B00 (19200) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7DE, 0xF7DE, 0xF7BD, 0xF79D, 0xF77C, 0xFF5C, 0xFEDA, 0xA2AA, 0xBA69, 0xC207,   // 0x4B10 (19216) pixels
-0xCA07, 0xC9E6, 0xD207, 0xD1E7, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xD207, 0xD1E7, 0xD1E7, 0xC9E7,   // 0x4B20 (19232) pixels
-0xC9E7, 0xD1E7, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x4B30 (19248) pixels
-0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xD1E7,   // 0x4B40 (19264) pixels
-0xD1E7, 0xD1E7, 0xD1C6, 0xD1E7, 0xC9C7, 0xC9C7, 0xC1C7, 0xC207, 0xB247, 0x89A4, 0xD46E, 0xCCAF, 0xE5B3, 0xC532, 0x9C4E, 0x5267,   // 0x4B50 (19280) pixels
-0x4206, 0x5288, 0x62CA, 0x62AA, 0x6B2C, 0x9471, 0x9CB2, 0xBDD6, 0xCE38, 0xD699, 0xE6FB, 0xE6FB, 0xDEDA, 0xDEFB, 0xE6FB, 0xE71C,   // 0x4B60 (19296) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE6FB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xE73C, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB,   // 0x4B70 (19312) pixels
-0xE73C, 0xE6FB, 0xE71B, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDB, 0xE6FB, 0xE71C, 0xE73C, 0xE73C,   // 0x4B80 (19328) pixels
-0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B,   // 0x4B90 (19344) pixels
-0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xEF3C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xEF3C, 0xE73C, 0xE71B, 0xE6FB,   // 0x4BA0 (19360) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4BB0 (19376) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4BC0 (19392) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4BD0 (19408) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4BE0 (19424) pixels
-0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFF3C, 0xFE9A, 0xAA89, 0xC228, 0xCA27, 0xCA06, 0xD227, 0xD1E6, 0xDA07,   // 0x4BF0 (19440) pixels
-0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xD207, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x4C00 (19456) pixels
-0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xD207, 0xCA07, 0xC9E7, 0xC9E7,   // 0x4C10 (19472) pixels
-0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9C7,   // 0x4C20 (19488) pixels
-0xD208, 0xC1C6, 0xD208, 0xC1E7, 0xC207, 0xB247, 0x8143, 0xD44F, 0xCC90, 0xD593, 0xDE56, 0x7B8B, 0x5AA8, 0x62C9, 0x62AA, 0x62EB,   // 0x4C30 (19504) pixels
-0x738D, 0x9491, 0xA514, 0xBDB6, 0xCE38, 0xD699, 0xDEDB, 0xDEDB, 0xDEDB, 0xE73C, 0xDEDA, 0xDEDB, 0xE6FB, 0xDEDB, 0xE71B, 0xE6FB,   // 0x4C40 (19520) pixels
-0xDEFB, 0xE73C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B,   // 0x4C50 (19536) pixels
-0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x4C60 (19552) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71C,   // 0x4C70 (19568) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4C80 (19584) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4C90 (19600) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4CA0 (19616) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4CB0 (19632) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF79E, 0xFFDE,   // 0x4CC0 (19648) pixels
-0xF79D, 0xFFBE, 0xFF9D, 0xFF5C, 0xAAEB, 0xBA6A, 0xCA08, 0xD207, 0xD227, 0xD1E6, 0xD1C6, 0xDA07, 0xD207, 0xD207, 0xD207, 0xD207,   // 0x4CD0 (19664) pixels
-0xD207, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x4CE0 (19680) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7,   // 0x4CF0 (19696) pixels
-0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9E7,   // 0x4D00 (19712) pixels
-0xC1E6, 0xC227, 0xBA88, 0x8143, 0xC3ED, 0xDD73, 0xC532, 0x942E, 0x4A26, 0x5247, 0x6B0B, 0x6B0C, 0x738D, 0x9CB2, 0xBDB6, 0xC617,   // 0x4D10 (19728) pixels
-0xC617, 0xCE58, 0xDEDB, 0xE6FB, 0xDEDB, 0xE73C, 0xE71C, 0xE71B, 0xE73C, 0xE71C, 0xDEFB, 0xE71B, 0xDEDB, 0xEF5C, 0xDEDB, 0xDEFB,   // 0x4D20 (19744) pixels
-0xE73C, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEDB,   // 0x4D30 (19760) pixels
-0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71C,   // 0x4D40 (19776) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xDEDB, 0xDEBA, 0xDEDB, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE6FB,   // 0x4D50 (19792) pixels
-0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4D60 (19808) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4D70 (19824) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4D80 (19840) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4D90 (19856) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDF, 0xFFBE, 0xFFFE, 0xFF7C,   // 0x4DA0 (19872) pixels
-0xA26A, 0xC249, 0xCA07, 0xD207, 0xD207, 0xC9C6, 0xDA48, 0xC9C6, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207,   // 0x4DB0 (19888) pixels
-0xC9E7, 0xD1E7, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x4DC0 (19904) pixels
-0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7,   // 0x4DD0 (19920) pixels
-0xC9E6, 0xCA06, 0xCA06, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xCA07, 0xC1E6, 0xC9E6, 0xC9C6, 0xC9E6, 0xCA27, 0xB9E6, 0xBA68,   // 0x4DE0 (19936) pixels
-0x91E6, 0xCC6F, 0xDD93, 0x838B, 0x5AC8, 0x5AA9, 0x62EA, 0x6B2C, 0x7BCE, 0x9CB2, 0xBDD6, 0xC5F7, 0xCE38, 0xD679, 0xD69A, 0xDEBA,   // 0x4DF0 (19952) pixels
-0xDEFB, 0xD6BA, 0xE71B, 0xDEFB, 0xDEDA, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xDEFB, 0xE71B, 0xE71C, 0xDEDA, 0xE71B,   // 0x4E00 (19968) pixels
-0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB,   // 0x4E10 (19984) pixels
-0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x4E20 (20000) pixels
-0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xE6FB, 0xE73C, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x4E30 (20016) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4E40 (20032) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4E50 (20048) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4E60 (20064) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4E70 (20080) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFF5C, 0xAA8A, 0xC228, 0xC1A6, 0xDA27,   // 0x4E80 (20096) pixels
-0xC9C5, 0xC9C6, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xC9E7, 0xD1E7, 0xD207, 0xD207,   // 0x4E90 (20112) pixels
-0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7,   // 0x4EA0 (20128) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xCA06, 0xCA06, 0xC9E6,   // 0x4EB0 (20144) pixels
-0xC9E6, 0xCA06, 0xC9E6, 0xC9E6, 0xC9E6, 0xC1E6, 0xD1E6, 0xD1C6, 0xD1E6, 0xC9C6, 0xCA27, 0xB1C6, 0xB227, 0x91C5, 0xCC8F, 0x93AB,   // 0x4EC0 (20160) pixels
-0x5A87, 0x4A46, 0x5AA9, 0x734D, 0x7BAE, 0xAD34, 0xAD54, 0xBDD7, 0xCE58, 0xCE38, 0xDEBA, 0xD69A, 0xD6BA, 0xDEDA, 0xE71B, 0xDEFB,   // 0x4ED0 (20176) pixels
-0xDEFB, 0xE71B, 0xDEFB, 0xEF5C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xDEDB, 0xDEDB, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C,   // 0x4EE0 (20192) pixels
-0xE6FB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x4EF0 (20208) pixels
-0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xEF5C, 0xE73C, 0xE73C, 0xE73C,   // 0x4F00 (20224) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5C, 0xEF3C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x4F10 (20240) pixels
-0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4F20 (20256) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4F30 (20272) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4F40 (20288) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4F50 (20304) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFF5C, 0xAA69, 0xC208, 0xD227, 0xD206, 0xD206, 0xD207, 0xCA07, 0xD228,   // 0x4F60 (20320) pixels
-0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7,   // 0x4F70 (20336) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x4F80 (20352) pixels
-0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xCA07, 0xC9E7, 0xCA07, 0xCA07, 0xD1E7, 0xC9E6,   // 0x4F90 (20368) pixels
-0xC1E6, 0xCA06, 0xD1C6, 0xD1E6, 0xC9C6, 0xCA07, 0xCA07, 0xC207, 0xC227, 0xAA07, 0xCBED, 0xC48F, 0x8BCC, 0x5287, 0x62EB, 0x6B0C,   // 0x4FA0 (20384) pixels
-0x83EF, 0xA4F3, 0xA514, 0xB595, 0xC617, 0xD679, 0xD679, 0xD69A, 0xDEFB, 0xDEDA, 0xE71C, 0xE73C, 0xDEDB, 0xDEFB, 0xE73C, 0xE71C,   // 0x4FB0 (20400) pixels
-0xE71C, 0xDEFB, 0xE73C, 0xE73C, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE71C,   // 0x4FC0 (20416) pixels
-0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB,   // 0x4FD0 (20432) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xDEFB,   // 0x4FE0 (20448) pixels
-0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x4FF0 (20464) pixels
-0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5000 (20480) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5010 (20496) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5020 (20512) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5030 (20528) pixels
-0xFFFF, 0xFFBE, 0xFFBD, 0xFF3B, 0xBA8A, 0xCA08, 0xC9E6, 0xD226, 0xC9C5, 0xDA27, 0xCA07, 0xC9E7, 0xCA07, 0xD207, 0xD207, 0xD207,   // 0x5040 (20544) pixels
-0xD207, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7,   // 0x5050 (20560) pixels
-0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x5060 (20576) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xD207, 0xC9A5,   // 0x5070 (20592) pixels
-0xD207, 0xC1C6, 0xCA27, 0xB9A6, 0xC9E7, 0xBA07, 0xAA47, 0x9AC8, 0x9BCC, 0x1840, 0x5AA9, 0x736D, 0x840F, 0x9CD2, 0xAD34, 0xBDD6,   // 0x5080 (20608) pixels
-0xBDB6, 0xCE38, 0xD679, 0xDEBA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDA, 0xE6FB, 0xE73C, 0xEF5D, 0xE71C, 0xEF5C, 0xE71B,   // 0x5090 (20624) pixels
-0xE71B, 0xE73C, 0xDEDB, 0xE71B, 0xE73C, 0xE71C, 0xE6FB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB,   // 0x50A0 (20640) pixels
-0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C,   // 0x50B0 (20656) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x50C0 (20672) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x50D0 (20688) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x50E0 (20704) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x50F0 (20720) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5100 (20736) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFE, 0xFF9D, 0x92AA,   // 0x5110 (20752) pixels
-0xBA49, 0xCA08, 0xD206, 0xD206, 0xDA26, 0xD1E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207,   // 0x5120 (20768) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xC9E7,   // 0x5130 (20784) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9C6, 0xD1E7, 0xD1E7,   // 0x5140 (20800) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9E7, 0xD1E7, 0xC9E6, 0xC9E7, 0xC9E6, 0xD1E7, 0xC9C6, 0xC9E7, 0xC1C6, 0xC9E7, 0xCA07,   // 0x5150 (20816) pixels
-0xC9E7, 0xCA27, 0xBA47, 0xAA88, 0xA36B, 0x93AD, 0x5228, 0x630B, 0x8C50, 0x9491, 0xAD34, 0xB596, 0xBDB6, 0xD679, 0xCE58, 0xD69A,   // 0x5160 (20832) pixels
-0xDEDA, 0xDEBA, 0xDEFB, 0xE73C, 0xE71B, 0xDEFB, 0xE71C, 0xE6FB, 0xE71B, 0xE73C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xDEFB,   // 0x5170 (20848) pixels
-0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB,   // 0x5180 (20864) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C,   // 0x5190 (20880) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB,   // 0x51A0 (20896) pixels
-0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x51B0 (20912) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x51C0 (20928) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x51D0 (20944) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x51E0 (20960) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFBE, 0xFF5D, 0xA2EB, 0xBA49, 0xC9E7, 0xD207, 0xD226,   // 0x51F0 (20976) pixels
-0xD1E5, 0xD206, 0xD207, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7,   // 0x5200 (20992) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7,   // 0x5210 (21008) pixels
-0xC9E7, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x5220 (21024) pixels
-0xC9E6, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9C7, 0xC9C7, 0xC9E7, 0xCA07, 0xC1E7, 0xC1E6, 0xC9E7, 0xC9E7, 0xB9C5, 0xB227,   // 0x5230 (21040) pixels
-0x89E6, 0xA3AD, 0x5227, 0x6B4C, 0x840F, 0x9CB2, 0xAD34, 0xBDB6, 0xBDD6, 0xC5F7, 0xCE38, 0xDEBA, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEFB,   // 0x5240 (21056) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xE73C, 0xE73C, 0xDEFB, 0xE71C, 0xE73C, 0xE71B, 0xE71C, 0xE73C, 0xEF3C, 0xE73C,   // 0x5250 (21072) pixels
-0xE71C, 0xDEFB, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x5260 (21088) pixels
-0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71C,   // 0x5270 (21104) pixels
-0xE73C, 0xEF5D, 0xEF3C, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEBA, 0xDEDA, 0xE71B, 0xEF5C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB,   // 0x5280 (21120) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5290 (21136) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x52A0 (21152) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x52B0 (21168) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x52C0 (21184) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFBE, 0xFF5C, 0x9AAA, 0xBA48, 0xCA07, 0xCA07, 0xD206, 0xD1E6, 0xD206, 0xD207, 0xCA07,   // 0x52D0 (21200) pixels
-0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xD207, 0xC9E6, 0xC9E6, 0xC9E7, 0xD207, 0xD1E7, 0xC9E6, 0xD207, 0xD1E7, 0xC9C6, 0xC9E7, 0xD1E7,   // 0x52E0 (21216) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD207, 0xD1E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xCA07,   // 0x52F0 (21232) pixels
-0xC9E7, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x5300 (21248) pixels
-0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xCA06, 0xCA06, 0xC9E6, 0xC9E7, 0xC9E7, 0xBA07, 0x91C6, 0xAB6C, 0x2040, 0x62CA,   // 0x5310 (21264) pixels
-0x738D, 0x9471, 0xA513, 0xBDD6, 0xBDB6, 0xC617, 0xC618, 0xD679, 0xE71B, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C,   // 0x5320 (21280) pixels
-0xE73C, 0xDEFB, 0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xEF3C, 0xE71C, 0xDEFB, 0xE71C, 0xE71C,   // 0x5330 (21296) pixels
-0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x5340 (21312) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xEF3C, 0xEF5D, 0xE73C, 0xE71B,   // 0x5350 (21328) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5360 (21344) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5370 (21360) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5380 (21376) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5390 (21392) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x53A0 (21408) pixels
-0xFFFF, 0xFFBE, 0xFF1B, 0xA289, 0xBA48, 0xCA07, 0xD207, 0xD207, 0xD1E6, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E6, 0xC9E6,   // 0x53B0 (21424) pixels
-0xD207, 0xD207, 0xD1E7, 0xD207, 0xC9E6, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xC9E7, 0xD207, 0xD207, 0xD207, 0xD1E7,   // 0x53C0 (21440) pixels
-0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xCA07, 0xCA07, 0xC9E6, 0xC9E6,   // 0x53D0 (21456) pixels
-0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9C6, 0xC9C6,   // 0x53E0 (21472) pixels
-0xC9E6, 0xC9E6, 0xCA06, 0xCA06, 0xCA07, 0xC1A6, 0xC9E7, 0xCA28, 0xAA07, 0xB32C, 0x2840, 0x6AEA, 0x734C, 0x8C50, 0x9CD2, 0xAD34,   // 0x53F0 (21488) pixels
-0xB575, 0xC617, 0xC618, 0xD69A, 0xCE79, 0xDEDA, 0xE71C, 0xE6FB, 0xDEDB, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xDEFB, 0xDEDB,   // 0x5400 (21504) pixels
-0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xDEFB, 0xDEDB, 0xDEDB, 0xE71B, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE73C,   // 0x5410 (21520) pixels
-0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C,   // 0x5420 (21536) pixels
-0xE73C, 0xEF5C, 0xEF5D, 0xEF7D, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x5430 (21552) pixels
-0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5440 (21568) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5450 (21584) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5460 (21600) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5470 (21616) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFDE, 0xFFFF, 0xFFBD, 0xFF1B, 0xB2CA,   // 0x5480 (21632) pixels
-0xC248, 0xCA07, 0xD207, 0xD207, 0xD1E6, 0xD1E6, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xD207, 0xD207, 0xD1E7, 0xD207,   // 0x5490 (21648) pixels
-0xD1E7, 0xC9E7, 0xC9C6, 0xD207, 0xD207, 0xC9E6, 0xC9E7, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xD207,   // 0x54A0 (21664) pixels
-0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xC9E6, 0xC9E6, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7,   // 0x54B0 (21680) pixels
-0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1E6, 0xC1C6,   // 0x54C0 (21696) pixels
-0xC1E6, 0xC9E7, 0xC9E7, 0xC1E6, 0xB227, 0x8185, 0x934C, 0x5207, 0x736C, 0x9471, 0x9CD2, 0xA533, 0xB595, 0xC5F7, 0xC5F7, 0xCE38,   // 0x54D0 (21712) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xDEDB, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xEF5C, 0xEF3C, 0xE71B, 0xE71B,   // 0x54E0 (21728) pixels
-0xE6FB, 0xE6FB, 0xE71B, 0xE73C, 0xE71B, 0xDEDB, 0xE71B, 0xE71C, 0xE73C, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C,   // 0x54F0 (21744) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B,   // 0x5500 (21760) pixels
-0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE73C, 0xE73C, 0xEF5C, 0xE73C, 0xE6FB,   // 0x5510 (21776) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5520 (21792) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5530 (21808) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5540 (21824) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5550 (21840) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFF5C, 0xFE38, 0xAA28, 0xC247, 0xCA06, 0xCA06, 0xD207,   // 0x5560 (21856) pixels
-0xD1E7, 0xD1E6, 0xD1E7, 0xD207, 0xC9E6, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD1E7, 0xC9E7,   // 0x5570 (21872) pixels
-0xC9E7, 0xD1E7, 0xD207, 0xC9E6, 0xD1E7, 0xC9E7, 0xD1E7, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x5580 (21888) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7,   // 0x5590 (21904) pixels
-0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9C7, 0xC9C7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xCA07, 0xC1C6, 0xC9E6, 0xC1E7,   // 0x55A0 (21920) pixels
-0xB207, 0xA268, 0xA3AE, 0x3964, 0x62CA, 0x840F, 0x9471, 0xA4F3, 0xAD34, 0xBDD6, 0xC5F7, 0xD679, 0xDEBA, 0xD6BA, 0xDEDA, 0xDEDB,   // 0x55B0 (21936) pixels
-0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xE71C, 0xE73C, 0xE71B, 0xE73C, 0xE71C, 0xDEFB, 0xE71C,   // 0x55C0 (21952) pixels
-0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE71C, 0xE71C,   // 0x55D0 (21968) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xDEDA, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB,   // 0x55E0 (21984) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x55F0 (22000) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5600 (22016) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5610 (22032) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5620 (22048) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5630 (22064) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFDF, 0xFF7D, 0xECF3, 0xC2AA, 0xC247, 0xCA06, 0xC9E6, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207,   // 0x5640 (22080) pixels
-0xC9E6, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xC9E6,   // 0x5650 (22096) pixels
-0xCA07, 0xC9E7, 0xC9E7, 0xD207, 0xCA07, 0xCA07, 0xCA07, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x5660 (22112) pixels
-0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7,   // 0x5670 (22128) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xCA07, 0xCA07, 0xC9E7, 0xCA27, 0xC1C6, 0xC207, 0xC248, 0xAA48, 0xA38C, 0x2060,   // 0x5680 (22144) pixels
-0x5AA9, 0x83EF, 0x9471, 0xA4F3, 0xA4F3, 0xB575, 0xBDB6, 0xCE38, 0xD69A, 0xDEDA, 0xE71B, 0xE71B, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B,   // 0x5690 (22160) pixels
-0xE71B, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xE71C, 0xE71B, 0xDEDB, 0xE6FB, 0xE71C, 0xE71C, 0xE71C, 0xE6FB,   // 0x56A0 (22176) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xEF3C, 0xEF5C,   // 0x56B0 (22192) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x56C0 (22208) pixels
-0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x56D0 (22224) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x56E0 (22240) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x56F0 (22256) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5700 (22272) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5710 (22288) pixels
-0xFFDF, 0xFF7D, 0xAACA, 0xBA28, 0xCA27, 0xCA06, 0xC9E6, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xC9E6, 0xD207, 0xD207, 0xC9E6,   // 0x5720 (22304) pixels
-0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xD207, 0xC9E7, 0xC9E6, 0xD207, 0xD207, 0xC9E6, 0xC9E7, 0xD207, 0xC9E7, 0xC9E6, 0xC9E7, 0xCA07,   // 0x5730 (22320) pixels
-0xCA07, 0xD207, 0xD207, 0xCA07, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7,   // 0x5740 (22336) pixels
-0xD207, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9E7,   // 0x5750 (22352) pixels
-0xC9E7, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xC1C6, 0xD227, 0xC1E6, 0xB9C6, 0xAA68, 0x9B4C, 0x1800, 0x5248, 0x738D, 0x8C50, 0xA4F3,   // 0x5760 (22368) pixels
-0x9CD2, 0xAD54, 0xBDD6, 0xCE58, 0xD69A, 0xD69A, 0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xEF5C, 0xE71C, 0xDEFB,   // 0x5770 (22384) pixels
-0xE71C, 0xE6FB, 0xDEFB, 0xE73C, 0xE71B, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDA, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B,   // 0x5780 (22400) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x5790 (22416) pixels
-0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B,   // 0x57A0 (22432) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x57B0 (22448) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x57C0 (22464) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x57D0 (22480) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x57E0 (22496) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF7D, 0xAA49, 0xCA28,   // 0x57F0 (22512) pixels
-0xCA27, 0xCA06, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E6, 0xC9E6, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207,   // 0x5800 (22528) pixels
-0xC9E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xC9E7, 0xD207, 0xD207, 0xCA07, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6,   // 0x5810 (22544) pixels
-0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7,   // 0x5820 (22560) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC1C6, 0xC1E6, 0xC1E6, 0xC9E6, 0xC9E6,   // 0x5830 (22576) pixels
-0xCA07, 0xC1C6, 0xC9E6, 0xC1C6, 0xCA48, 0xB248, 0xA34B, 0x1800, 0x5228, 0x6B4C, 0x83CE, 0x8C50, 0x9CB2, 0xA514, 0xBDD7, 0xCE79,   // 0x5840 (22592) pixels
-0xDEDA, 0xDEBA, 0xDEDB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71C, 0xDEBA, 0xE73C, 0xE71C, 0xE71B, 0xE73C, 0xE6FB, 0xDEDA, 0xE6FB,   // 0x5850 (22608) pixels
-0xE73C, 0xE73C, 0xE6FB, 0xE6FB, 0xE71C, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B,   // 0x5860 (22624) pixels
-0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x5870 (22640) pixels
-0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C,   // 0x5880 (22656) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5890 (22672) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x58A0 (22688) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x58B0 (22704) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x58C0 (22720) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFF3D, 0xBAAA, 0xC1E7, 0xCA06, 0xCA06, 0xD207, 0xD1E7,   // 0x58D0 (22736) pixels
-0xD1C7, 0xD1E7, 0xD1E7, 0xD1E6, 0xC9E6, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xD207,   // 0x58E0 (22752) pixels
-0xD207, 0xC9C6, 0xC9E7, 0xD1E7, 0xCA07, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xD207, 0xC9E7, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6,   // 0x58F0 (22768) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6,   // 0x5900 (22784) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xC9E6, 0xC1C6, 0xCA07, 0xC1C6, 0xCA07, 0xC1C6,   // 0x5910 (22800) pixels
-0xC1E7, 0xB248, 0x92EA, 0x2020, 0x49E7, 0x6B2C, 0x7BAE, 0x840F, 0xA4F3, 0xAD34, 0xBDF7, 0xCE59, 0xCE79, 0xD6BA, 0xDEFB, 0xDEFB,   // 0x5920 (22816) pixels
-0xE6FB, 0xE73C, 0xE73C, 0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xE6FB, 0xE73C, 0xDEDA, 0xDEFB, 0xDEFB, 0xE6FB,   // 0x5930 (22832) pixels
-0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB,   // 0x5940 (22848) pixels
-0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB,   // 0x5950 (22864) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B,   // 0x5960 (22880) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5970 (22896) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5980 (22912) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5990 (22928) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x59A0 (22944) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xB28A, 0xCA07, 0xCA07, 0xCA06, 0xD207, 0xD207, 0xD1E8, 0xD1E8, 0xD207, 0xD207,   // 0x59B0 (22960) pixels
-0xD207, 0xD207, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xD1E7, 0xD207, 0xC9E7, 0xC9E6, 0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xD207,   // 0x59C0 (22976) pixels
-0xCA07, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xD207, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E6,   // 0x59D0 (22992) pixels
-0xC9E7, 0xD207, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x59E0 (23008) pixels
-0xC9C6, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xCA07, 0xC1C6, 0xC9E6, 0xC9E6, 0xCA07, 0xB227, 0x8AA9, 0x30E2,   // 0x59F0 (23024) pixels
-0x62AA, 0x62EB, 0x736D, 0x83EF, 0x8C51, 0xA514, 0xBDD7, 0xC638, 0xD69A, 0xDEFB, 0xD6BA, 0xE71C, 0xE71B, 0xDEFB, 0xE73C, 0xE71B,   // 0x5A00 (23040) pixels
-0xE73C, 0xDEDA, 0xE73C, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xEF7D,   // 0x5A10 (23056) pixels
-0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71C,   // 0x5A20 (23072) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B,   // 0x5A30 (23088) pixels
-0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5A40 (23104) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5A50 (23120) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5A60 (23136) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5A70 (23152) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5A80 (23168) pixels
-0xFFFF, 0xFF5D, 0xAA49, 0xC228, 0xCA07, 0xCA06, 0xCA07, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E6, 0xD207, 0xD207, 0xC9E7, 0xC9E7,   // 0x5A90 (23184) pixels
-0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xCA07, 0xC9E7, 0xC9E6,   // 0x5AA0 (23200) pixels
-0xC9E6, 0xC9E6, 0xC9E7, 0xCA07, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E6, 0xC9C6,   // 0x5AB0 (23216) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9C6, 0xC9C7, 0xC9E7,   // 0x5AC0 (23232) pixels
-0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1C6, 0xC9E7, 0xC9E6, 0xC9E7, 0xC1E7, 0xAA07, 0x8A68, 0x2860, 0x5A48, 0x5ACA, 0x6B4C, 0x8C30,   // 0x5AD0 (23248) pixels
-0x9471, 0xAD54, 0xB5B6, 0xCE58, 0xD699, 0xD69A, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE73C, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C,   // 0x5AE0 (23264) pixels
-0xE6FB, 0xDEDB, 0xE71B, 0xE71B, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEFB, 0xE71C, 0xE73C,   // 0x5AF0 (23280) pixels
-0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x5B00 (23296) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE73C, 0xE71B, 0xDEFB, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C,   // 0x5B10 (23312) pixels
-0xEF3C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5B20 (23328) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5B30 (23344) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5B40 (23360) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5B50 (23376) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF7D, 0xBB4D, 0xBA28,   // 0x5B60 (23392) pixels
-0xCA27, 0xCA07, 0xCA07, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xD1E7, 0xD207, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7,   // 0x5B70 (23408) pixels
-0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x5B80 (23424) pixels
-0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7,   // 0x5B90 (23440) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C7, 0xC9C7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x5BA0 (23456) pixels
-0xC9E7, 0xC9E7, 0xC9C6, 0xC9E6, 0xB9C6, 0xAA28, 0x92EA, 0x51E6, 0x5A69, 0x62CA, 0x6B0B, 0x8C0F, 0x8C51, 0xAD34, 0xB596, 0xCE79,   // 0x5BB0 (23472) pixels
-0xDEDA, 0xD699, 0xE71B, 0xE71C, 0xE73C, 0xE6FB, 0xDEDA, 0xE73C, 0xE71B, 0xE71B, 0xDEDB, 0xE73C, 0xE71B, 0xE71B, 0xE71B, 0xDEDB,   // 0x5BC0 (23488) pixels
-0xDEFB, 0xDEFB, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C,   // 0x5BD0 (23504) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x5BE0 (23520) pixels
-0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB,   // 0x5BF0 (23536) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5C00 (23552) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5C10 (23568) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5C20 (23584) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5C30 (23600) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF7E, 0xF555, 0xB228, 0xCA48, 0xCA07, 0xCA07, 0xD1E7,   // 0x5C40 (23616) pixels
-0xD1E7, 0xD1E7, 0xD207, 0xD1E7, 0xD207, 0xC9E7, 0xD207, 0xC9E7, 0xC9E7, 0xD207, 0xC9E7, 0xD1E7, 0xC9E7, 0xD207, 0xD207, 0xC9E7,   // 0x5C50 (23632) pixels
-0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xD207, 0xD207, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6,   // 0x5C60 (23648) pixels
-0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x5C70 (23664) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E7, 0xC9E7, 0xC9C7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1E6, 0xC1C6, 0xC9E7, 0xC9E7, 0xC1C6,   // 0x5C80 (23680) pixels
-0xC207, 0xB289, 0x9B2B, 0x51C6, 0x5A89, 0x5269, 0x6B2C, 0x8C50, 0x8C50, 0xA513, 0xB5B6, 0xC638, 0xCE79, 0xDEDA, 0xDEDB, 0xE71B,   // 0x5C90 (23696) pixels
-0xE71B, 0xEF3C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xDEDB, 0xE73C, 0xDEFB, 0xE73C, 0xE71B, 0xE6FB, 0xE71C, 0xE73C,   // 0x5CA0 (23712) pixels
-0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71B,   // 0x5CB0 (23728) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE6FB,   // 0x5CC0 (23744) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71B,   // 0x5CD0 (23760) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5CE0 (23776) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5CF0 (23792) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5D00 (23808) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5D10 (23824) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFEBB, 0xAA49, 0xC248, 0xCA07, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7,   // 0x5D20 (23840) pixels
-0xD207, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xD207, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x5D30 (23856) pixels
-0xD207, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7,   // 0x5D40 (23872) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x5D50 (23888) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC1E6, 0xC1E6, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9E7, 0xBA07, 0xA227, 0x930B, 0x6248,   // 0x5D60 (23904) pixels
-0x5A68, 0x5AAA, 0x5ACA, 0x7BAE, 0x9471, 0xAD34, 0xAD75, 0xD699, 0xD6BA, 0xDEFB, 0xDEDA, 0xE73C, 0xE71C, 0xDEFB, 0xE6FB, 0xE6FB,   // 0x5D70 (23920) pixels
-0xE71B, 0xE73C, 0xD69A, 0xE6FB, 0xE73C, 0xDEFB, 0xEF5C, 0xDEFB, 0xE73C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xDEFB,   // 0x5D80 (23936) pixels
-0xE73C, 0xE71B, 0xDEDB, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE73C,   // 0x5D90 (23952) pixels
-0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C,   // 0x5DA0 (23968) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5DB0 (23984) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5DC0 (24000) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5DD0 (24016) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5DE0 (24032) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5DF0 (24048) pixels
-0xFFFF, 0xFFBE, 0xFF1C, 0xA28A, 0xBA48, 0xC207, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E6, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xD207, 0xD1E7,   // 0x5E00 (24064) pixels
-0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6,   // 0x5E10 (24080) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7,   // 0x5E20 (24096) pixels
-0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x5E30 (24112) pixels
-0xC9E6, 0xC9E6, 0xC1E6, 0xC1E6, 0xC9E6, 0xC9C6, 0xC9C6, 0xCA07, 0xBA48, 0x9A27, 0x9B4C, 0x49A6, 0x5A69, 0x5AAA, 0x630B, 0x8C30,   // 0x5E40 (24128) pixels
-0x9471, 0xB575, 0xB5B6, 0xCE59, 0xCE79, 0xDEDA, 0xE71B, 0xDEDB, 0xDEFB, 0xE71B, 0xEF3C, 0xE6FB, 0xDEFB, 0xE71B, 0xE73C, 0xE71B,   // 0x5E50 (24144) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xE73C, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x5E60 (24160) pixels
-0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x5E70 (24176) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xDEFB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x5E80 (24192) pixels
-0xDEFB, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5E90 (24208) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5EA0 (24224) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5EB0 (24240) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5EC0 (24256) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFF1C, 0xA2AA,   // 0x5ED0 (24272) pixels
-0xBA48, 0xCA07, 0xCA07, 0xD207, 0xD1E7, 0xD1E6, 0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E6,   // 0x5EE0 (24288) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xCA07, 0xC9E7, 0xC9E6,   // 0x5EF0 (24304) pixels
-0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6,   // 0x5F00 (24320) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E7, 0xC9C7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1E6, 0xC1E6,   // 0x5F10 (24336) pixels
-0xC1E6, 0xD207, 0xC9C6, 0xCA07, 0xB1E6, 0xAAA9, 0x5123, 0x5A28, 0x62AA, 0x62CB, 0x6B2C, 0x840F, 0x9491, 0xB575, 0xBDD7, 0xD679,   // 0x5F20 (24352) pixels
-0xDEDB, 0xDEDA, 0xE71B, 0xDEFB, 0xE71B, 0xDEFB, 0xDEDB, 0xE6FB, 0xE71B, 0xE6FB, 0xE73C, 0xE6FB, 0xE71C, 0xE71C, 0xDEFB, 0xE71B,   // 0x5F30 (24368) pixels
-0xE73C, 0xEF5C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71B,   // 0x5F40 (24384) pixels
-0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x5F50 (24400) pixels
-0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xE6FB,   // 0x5F60 (24416) pixels
-0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5F70 (24432) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5F80 (24448) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5F90 (24464) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x5FA0 (24480) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFF7D, 0x9AAA, 0xB248, 0xC207, 0xCA07, 0xD207,   // 0x5FB0 (24496) pixels
-0xD1E7, 0xD1E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9C6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x5FC0 (24512) pixels
-0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7,   // 0x5FD0 (24528) pixels
-0xC9E6, 0xC9E7, 0xCA07, 0xC9C6, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x5FE0 (24544) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E7, 0xC9C7, 0xC9C7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1E6, 0xC1E6, 0xC9E6, 0xC9C6, 0xC9E7, 0xC1E7,   // 0x5FF0 (24560) pixels
-0xB248, 0x9A89, 0x6A07, 0x6269, 0x5269, 0x5AAA, 0x6B2C, 0x7BCE, 0x9CB2, 0xB575, 0xBDF7, 0xD699, 0xDEFB, 0xDEFB, 0xDEDB, 0xE71B,   // 0x6000 (24576) pixels
-0xE71B, 0xE73C, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEDB, 0xDEFB, 0xE71C, 0xEF3C, 0xE71B, 0xDEFB,   // 0x6010 (24592) pixels
-0xDEFB, 0xDEFB, 0xE73C, 0xEF5D, 0xE73C, 0xE73C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE73C, 0xEF5C, 0xEF5C,   // 0x6020 (24608) pixels
-0xE71C, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xE71C, 0xE73C, 0xE71C, 0xE71B,   // 0x6030 (24624) pixels
-0xDEFB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xEF5C,   // 0x6040 (24640) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6050 (24656) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6060 (24672) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6070 (24688) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6080 (24704) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF7E, 0x92CB, 0xB268, 0xC227, 0xC9E7, 0xD227, 0xC9E7, 0xCA07, 0xCA07, 0xCA07,   // 0x6090 (24720) pixels
-0xCA07, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9C6, 0xC9C6, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7,   // 0x60A0 (24736) pixels
-0xD207, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xC9E7, 0xC9E6,   // 0x60B0 (24752) pixels
-0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xD207, 0xCA07, 0xC9E7,   // 0x60C0 (24768) pixels
-0xC9C7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E7, 0xC1E7, 0xB1E7, 0xAA48, 0x9289, 0x6207, 0x5A69,   // 0x60D0 (24784) pixels
-0x5AAA, 0x6B2C, 0x6B4C, 0x840F, 0xA4F3, 0xC5F7, 0xC5F7, 0xD699, 0xDEFB, 0xDEDB, 0xE71B, 0xDEFB, 0xE6FB, 0xE73C, 0xDEFB, 0xE71C,   // 0x60E0 (24800) pixels
-0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xDEFB, 0xDEDA, 0xEF5C, 0xE6FB, 0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xDEFB,   // 0x60F0 (24816) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEDA, 0xDEBA, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE71B,   // 0x6100 (24832) pixels
-0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE6FB,   // 0x6110 (24848) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6120 (24864) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6130 (24880) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6140 (24896) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6150 (24912) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6160 (24928) pixels
-0xFFFF, 0xF7BE, 0xFFDF, 0xFEFB, 0xB269, 0xCA27, 0xCA07, 0xD207, 0xC9E7, 0xCA07, 0xC9E7, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x6170 (24944) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7,   // 0x6180 (24960) pixels
-0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7,   // 0x6190 (24976) pixels
-0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6,   // 0x61A0 (24992) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C7, 0xCA07, 0xB9A6, 0xBA68, 0xA268, 0x6123, 0x6228, 0x62CA, 0x62EB, 0x6B2C, 0x83EF, 0x8C30,   // 0x61B0 (25008) pixels
-0xAD34, 0xB595, 0xCE38, 0xDEBA, 0xDEDA, 0xDEFB, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE73C, 0xEF3C, 0xDEDB, 0xE6FB, 0xE71B,   // 0x61C0 (25024) pixels
-0xDEDB, 0xE71B, 0xE71C, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB,   // 0x61D0 (25040) pixels
-0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xE73C,   // 0x61E0 (25056) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xDEFB,   // 0x61F0 (25072) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6200 (25088) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6210 (25104) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6220 (25120) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6230 (25136) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFBE, 0xFF7D,   // 0x6240 (25152) pixels
-0xB289, 0xCA07, 0xCA07, 0xD207, 0xD208, 0xD208, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7,   // 0x6250 (25168) pixels
-0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07,   // 0x6260 (25184) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x6270 (25200) pixels
-0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9C6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E6,   // 0x6280 (25216) pixels
-0xC9E6, 0xC1C6, 0xC207, 0xB227, 0x9207, 0x6185, 0x6248, 0x5AAA, 0x630B, 0x6B4C, 0x6B4D, 0x8C50, 0xA513, 0xC5F7, 0xC617, 0xDEDB,   // 0x6290 (25232) pixels
-0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xE71B, 0xEF5C, 0xE71B, 0xDEDA, 0xE71B, 0xE71B, 0xDEFB, 0xE73C,   // 0x62A0 (25248) pixels
-0xE73C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB,   // 0x62B0 (25264) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71B,   // 0x62C0 (25280) pixels
-0xE71B, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B,   // 0x62D0 (25296) pixels
-0xE73C, 0xE71B, 0xDEDB, 0xDEDA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x62E0 (25312) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x62F0 (25328) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6300 (25344) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6310 (25360) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFF3C, 0xB248, 0xCA08, 0xD207, 0xD1E7,   // 0x6320 (25376) pixels
-0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7,   // 0x6330 (25392) pixels
-0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6340 (25408) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x6350 (25424) pixels
-0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1E6, 0xC1E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC1A5, 0xCA07, 0xC1E6, 0xB228,   // 0x6360 (25440) pixels
-0x9268, 0x69E7, 0x6ACA, 0x62EB, 0x738D, 0x736D, 0x83EF, 0x9491, 0xAD54, 0xBDD6, 0xD679, 0xDEDA, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB,   // 0x6370 (25456) pixels
-0xE6FB, 0xE71B, 0xE71C, 0xE6FB, 0xEF5D, 0xDEDA, 0xDEFB, 0xE71B, 0xDEDB, 0xE6FB, 0xE71C, 0xDEDB, 0xE6FB, 0xDEFB, 0xE71C, 0xE71B,   // 0x6380 (25472) pixels
-0xE6FB, 0xE71B, 0xDEFB, 0xE71B, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE73C, 0xEF5D, 0xEF5D,   // 0x6390 (25488) pixels
-0xEF3C, 0xE71C, 0xE71B, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDA, 0xE73C, 0xE73C, 0xE71C, 0xE71B,   // 0x63A0 (25504) pixels
-0xE6FB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDA,   // 0x63B0 (25520) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x63C0 (25536) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x63D0 (25552) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x63E0 (25568) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x63F0 (25584) pixels
-0xFFFF, 0xFFFF, 0xFFDE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF5D, 0xAA49, 0xC207, 0xC9E7, 0xD207, 0xD1E7, 0xD1E7, 0xD1E6, 0xC9E6,   // 0x6400 (25600) pixels
-0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7,   // 0x6410 (25616) pixels
-0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6420 (25632) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x6430 (25648) pixels
-0xC1E6, 0xC1E6, 0xC9E6, 0xC1E6, 0xC1E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1C5, 0xBA07, 0xAA48, 0x58C3, 0x6248, 0x6ACA, 0x62EB,   // 0x6440 (25664) pixels
-0x630B, 0x736D, 0x7BAE, 0x9CB2, 0xB575, 0xCE38, 0xCE59, 0xDEDB, 0xDEFB, 0xE71C, 0xE73C, 0xE71B, 0xE6FB, 0xE71B, 0xDEFB, 0xE71B,   // 0x6450 (25680) pixels
-0xEF5C, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xE71B,   // 0x6460 (25696) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB,   // 0x6470 (25712) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C,   // 0x6480 (25728) pixels
-0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x6490 (25744) pixels
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x64A0 (25760) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x64B0 (25776) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x64C0 (25792) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x64D0 (25808) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFF7E, 0xA289, 0xBA48, 0xCA28, 0xC9E7, 0xD1E8, 0xD208, 0xC9E6, 0xCA06, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x64E0 (25824) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x64F0 (25840) pixels
-0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6,   // 0x6500 (25856) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC1E6, 0xC9E6, 0xC206, 0xC1E7,   // 0x6510 (25872) pixels
-0xC1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC206, 0xB227, 0xA268, 0x7207, 0x6269, 0x5AAA, 0x630B, 0x736D, 0x7BAE, 0x8C50, 0xAD34,   // 0x6520 (25888) pixels
-0xBDB6, 0xCE38, 0xDEBA, 0xDEBA, 0xDEFB, 0xE6FB, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C,   // 0x6530 (25904) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB,   // 0x6540 (25920) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xE71B, 0xE71B,   // 0x6550 (25936) pixels
-0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEDB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB,   // 0x6560 (25952) pixels
-0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6570 (25968) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6580 (25984) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6590 (26000) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x65A0 (26016) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF9E,   // 0x65B0 (26032) pixels
-0xFF3B, 0xA2A9, 0xB227, 0xD269, 0xC9E7, 0xC9E7, 0xDA27, 0xD1E6, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x65C0 (26048) pixels
-0xD207, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x65D0 (26064) pixels
-0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x65E0 (26080) pixels
-0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E6, 0xC207, 0xC207, 0xC1C7, 0xC9C7, 0xC9C7, 0xC9E7,   // 0x65F0 (26096) pixels
-0xC1C6, 0xB9E6, 0xAA68, 0x6944, 0x7ACA, 0x62AA, 0x7B8D, 0x6B2C, 0x6B4D, 0x83EF, 0x9CB2, 0xB575, 0xC5F7, 0xCE58, 0xDEFB, 0xE73C,   // 0x6600 (26112) pixels
-0xE73C, 0xE73C, 0xDEFB, 0xE71B, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE73C, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xE71B, 0xDEFB,   // 0x6610 (26128) pixels
-0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB,   // 0x6620 (26144) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB,   // 0x6630 (26160) pixels
-0xD6BA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xDEDB,   // 0x6640 (26176) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xFFDE, 0xFFDE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6650 (26192) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6660 (26208) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6670 (26224) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6680 (26240) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF9C, 0x92A9, 0xB248, 0xC207,   // 0x6690 (26256) pixels
-0xCA28, 0xD207, 0xD1E6, 0xD1E6, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7,   // 0x66A0 (26272) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x66B0 (26288) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9C6, 0xC9E6,   // 0x66C0 (26304) pixels
-0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9E6, 0xC207, 0xC207, 0xC1C7, 0xC9C7, 0xC9C6, 0xC9E7, 0xC1E6, 0xBA48, 0x9A69, 0x69C6,   // 0x66D0 (26320) pixels
-0x6A89, 0x734C, 0x6B0B, 0x736D, 0x736D, 0x83EF, 0x9492, 0xBDD6, 0xC618, 0xDEBA, 0xE6FB, 0xE71B, 0xE6FB, 0xE73C, 0xE71B, 0xEF5D,   // 0x66E0 (26336) pixels
-0xEF5D, 0xDEFB, 0xE71B, 0xDEFB, 0xE73C, 0xE71C, 0xDEFB, 0xDEDB, 0xE6FB, 0xE6FB, 0xDEDB, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xE71B,   // 0x66F0 (26352) pixels
-0xE71B, 0xDEFB, 0xE6FB, 0xDEDA, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B,   // 0x6700 (26368) pixels
-0xE71B, 0xE71C, 0xE73C, 0xEF3C, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x6710 (26384) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xEF3C, 0xEF5D, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB,   // 0x6720 (26400) pixels
-0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF,   // 0x6730 (26416) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6740 (26432) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6750 (26448) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6760 (26464) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFF3B, 0xB269, 0xC208, 0xCA28, 0xC1E6, 0xD1E7, 0xDA07,   // 0x6770 (26480) pixels
-0xD1E7, 0xD1E7, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xCA07, 0xCA07,   // 0x6780 (26496) pixels
-0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x6790 (26512) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x67A0 (26528) pixels
-0xC9E6, 0xC9E6, 0xC1C6, 0xC1E7, 0xC9E7, 0xC9E7, 0xC9C6, 0xC1E6, 0xBA08, 0xA228, 0x69C6, 0x6A68, 0x730B, 0x6B0B, 0x7BAD, 0x736D,   // 0x67B0 (26544) pixels
-0x7BCF, 0x94B2, 0xA514, 0xC5F7, 0xCE79, 0xDEDA, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE73C, 0xE71B, 0xDEDB, 0xE71B, 0xE71C,   // 0x67C0 (26560) pixels
-0xDEDA, 0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE73C, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xDEFB, 0xE6FB, 0xE73C,   // 0x67D0 (26576) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDB,   // 0x67E0 (26592) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x67F0 (26608) pixels
-0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x6800 (26624) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFBE, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6810 (26640) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6820 (26656) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6830 (26672) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6840 (26688) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFF9D, 0xAA6A, 0xC229, 0xC208, 0xCA27, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6850 (26704) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x6860 (26720) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9E6, 0xD207, 0xD207, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6870 (26736) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC1C6, 0xC1E7,   // 0x6880 (26752) pixels
-0xC9E7, 0xC9E6, 0xC1E6, 0xC207, 0xAA28, 0x9249, 0x7269, 0x72EB, 0x732C, 0x736D, 0x7BAD, 0x7BCE, 0x7BCE, 0x9CF3, 0xB5B6, 0xCE58,   // 0x6890 (26768) pixels
-0xDEDB, 0xDEFB, 0xDEFB, 0xDEBA, 0xDEFB, 0xE71C, 0xE71B, 0xE71C, 0xDEDB, 0xDEFB, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C,   // 0x68A0 (26784) pixels
-0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB,   // 0x68B0 (26800) pixels
-0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB,   // 0x68C0 (26816) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B,   // 0x68D0 (26832) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE,   // 0x68E0 (26848) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,   // 0x68F0 (26864) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6900 (26880) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6910 (26896) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6920 (26912) pixels
-0xFFFF, 0xFF7D, 0x9A6A, 0xB229, 0xCA29, 0xC1E7, 0xC9E7, 0xD207, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6930 (26928) pixels
-0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E6, 0xCA07, 0xCA07, 0xC9E7, 0xC9E6,   // 0x6940 (26944) pixels
-0xC9C6, 0xC9E7, 0xCA07, 0xC9E7, 0xC9C6, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9C6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x6950 (26960) pixels
-0xC9C6, 0xC9E7, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xCA07, 0xC9E7, 0xC9C7, 0xC9E7, 0xC1E6, 0xC1E6, 0xC206, 0xB227,   // 0x6960 (26976) pixels
-0x9A89, 0x6185, 0x72AA, 0x6ACB, 0x7B6D, 0x83CE, 0x738D, 0x73AE, 0x8430, 0xA534, 0xBDD6, 0xCE59, 0xDEDA, 0xDEDA, 0xE6FB, 0xE71C,   // 0x6970 (26992) pixels
-0xE6FB, 0xE73C, 0xE71C, 0xE71C, 0xDEDA, 0xE71B, 0xE71C, 0xE71C, 0xDEDB, 0xE71C, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEBA, 0xE71B, 0xE71B,   // 0x6980 (27008) pixels
-0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x6990 (27024) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB,   // 0x69A0 (27040) pixels
-0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C,   // 0x69B0 (27056) pixels
-0xE73C, 0xE71C, 0xDEFB, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x69C0 (27072) pixels
-0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x69D0 (27088) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x69E0 (27104) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x69F0 (27120) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFF1D, 0xA26A,   // 0x6A00 (27136) pixels
-0xC249, 0xCA08, 0xC9E7, 0xD228, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07,   // 0x6A10 (27152) pixels
-0xCA07, 0xCA07, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x6A20 (27168) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9C6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x6A30 (27184) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xCA07, 0xC9C6, 0xC9C7, 0xC9C7, 0xC1E6, 0xBA07, 0xB227, 0xA248, 0x79E7, 0x728A, 0x7B2C, 0x732C,   // 0x6A40 (27200) pixels
-0x736D, 0x7BAE, 0x7BEE, 0x8450, 0x8C71, 0xBDD6, 0xCE59, 0xD6BA, 0xD6BA, 0xE73C, 0xE73C, 0xE71B, 0xDEDB, 0xDEFB, 0xE6FB, 0xE73C,   // 0x6A50 (27216) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xE73C, 0xE71B, 0xE71B, 0xE71C,   // 0x6A60 (27232) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB,   // 0x6A70 (27248) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x6A80 (27264) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEDB, 0xDEBA, 0xD6BA, 0xDEDA, 0xDEDB, 0xE71C, 0xE6FB, 0xDEDB, 0xDEBA,   // 0x6A90 (27280) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF,   // 0x6AA0 (27296) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6AB0 (27312) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6AC0 (27328) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6AD0 (27344) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFF3C, 0xAA49, 0xCA69, 0xC1A6, 0xC9E7,   // 0x6AE0 (27360) pixels
-0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6AF0 (27376) pixels
-0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9C6,   // 0x6B00 (27392) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E6,   // 0x6B10 (27408) pixels
-0xC1E6, 0xC1C6, 0xC9E7, 0xC9E7, 0xC206, 0xBA47, 0xAA48, 0x9248, 0x7AAA, 0x72EB, 0x730C, 0x83AE, 0x7BAE, 0x7B8E, 0x840F, 0x8C71,   // 0x6B20 (27424) pixels
-0xA4F3, 0xC618, 0xD69A, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE73C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA, 0xE6FB, 0xE73C,   // 0x6B30 (27440) pixels
-0xDEDA, 0xDEFB, 0xD6BA, 0xDEFB, 0xE73C, 0xE71B, 0xEF3C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xE73C, 0xE71C, 0xDEFB,   // 0x6B40 (27456) pixels
-0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB,   // 0x6B50 (27472) pixels
-0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B,   // 0x6B60 (27488) pixels
-0xE71B, 0xE6FB, 0xE6FB, 0xE71C, 0xE73C, 0xEF5C, 0xE73C, 0xE71C, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF,   // 0x6B70 (27504) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF,   // 0x6B80 (27520) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6B90 (27536) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6BA0 (27552) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6BB0 (27568) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFF7D, 0x9A6A, 0xBA69, 0xC207, 0xD227, 0xC9E7, 0xC9E7, 0xCA07, 0xD207,   // 0x6BC0 (27584) pixels
-0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6BD0 (27600) pixels
-0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6BE0 (27616) pixels
-0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xCA06, 0xC9E6, 0xC9E6, 0xCA06, 0xC9E7, 0xC1C6, 0xCA07, 0xC1E6,   // 0x6BF0 (27632) pixels
-0xBA07, 0xB248, 0x9248, 0x8268, 0x7AEB, 0x732C, 0x7B6D, 0x734C, 0x7BCF, 0x7BCE, 0x83EF, 0x9CD3, 0xB575, 0xCE79, 0xDEDA, 0xDEBA,   // 0x6C00 (27648) pixels
-0xDEDB, 0xE71B, 0xE73C, 0xE71B, 0xE71B, 0xDEFB, 0xE73C, 0xE71B, 0xE73C, 0xE6FB, 0xE71B, 0xDEFB, 0xE73C, 0xE71C, 0xE71C, 0xE6FB,   // 0x6C10 (27664) pixels
-0xE6FB, 0xE71B, 0xE6FB, 0xE73C, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE71C,   // 0x6C20 (27680) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xE6FB, 0xE71B, 0xE71B, 0xE71B,   // 0x6C30 (27696) pixels
-0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB,   // 0x6C40 (27712) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x6C50 (27728) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6C60 (27744) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6C70 (27760) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6C80 (27776) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6C90 (27792) pixels
-0xFFFF, 0xFFFF, 0xFFBF, 0xFF9E, 0xFF5D, 0x9248, 0xB247, 0xB9E6, 0xCA06, 0xC9E6, 0xC9E6, 0xCA06, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7,   // 0x6CA0 (27808) pixels
-0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x6CB0 (27824) pixels
-0xC9E7, 0xC9E7, 0xC9E6, 0xC9C6, 0xC9C6, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x6CC0 (27840) pixels
-0xC9E6, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xCA06, 0xC9E7, 0xC1E6, 0xCA06, 0xC206, 0xBA07, 0xA248, 0x8A48, 0x7ACA,   // 0x6CD0 (27856) pixels
-0x7B2C, 0x7B6D, 0x736D, 0x7BCE, 0x7BEF, 0x8430, 0x9CB2, 0xB596, 0xCE38, 0xD6BA, 0xDEDA, 0xDEFB, 0xE71C, 0xDEFB, 0xE71C, 0xE73C,   // 0x6CE0 (27872) pixels
-0xE6FB, 0xDEFB, 0xE73C, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xDEFB, 0xE71B, 0xE73C, 0xE71C, 0xE71C, 0xDEFB,   // 0x6CF0 (27888) pixels
-0xE71B, 0xDEFB, 0xE6FB, 0xE71C, 0xE6FB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB,   // 0x6D00 (27904) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB,   // 0x6D10 (27920) pixels
-0xDEDA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEFB, 0xDEFB,   // 0x6D20 (27936) pixels
-0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,   // 0x6D30 (27952) pixels
-0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x6D40 (27968) pixels
-0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6D50 (27984) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6D60 (28000) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBF, 0xFFFF, 0xFFDF,   // 0x6D70 (28016) pixels
-0xFF7D, 0xFF1A, 0xAAA9, 0xBA47, 0xCA27, 0xC9E7, 0xC9E6, 0xC9E6, 0xCA07, 0xCA07, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6D80 (28032) pixels
-0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x6D90 (28048) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E6, 0xC9E6,   // 0x6DA0 (28064) pixels
-0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C6, 0xC1C6, 0xC206, 0xB226, 0xAA48, 0x9A89, 0x7AA9, 0x7B2C, 0x7B4C, 0x7B6D, 0x840F, 0x738D,   // 0x6DB0 (28080) pixels
-0x8410, 0x94B2, 0xAD55, 0xC5F7, 0xD699, 0xE71C, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xE71C, 0xDEFB, 0xE71C, 0xE71B,   // 0x6DC0 (28096) pixels
-0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE71B, 0xE73C, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB,   // 0x6DD0 (28112) pixels
-0xDEFB, 0xE6FB, 0xE6FB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C,   // 0x6DE0 (28128) pixels
-0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB,   // 0x6DF0 (28144) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B,   // 0x6E00 (28160) pixels
-0xFFDE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF,   // 0x6E10 (28176) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6E20 (28192) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6E30 (28208) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6E40 (28224) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFDE, 0xFF9D, 0x9A69, 0xB249,   // 0x6E50 (28240) pixels
-0xCA08, 0xC9E7, 0xD228, 0xC9E6, 0xCA07, 0xCA06, 0xC1C5, 0xCA06, 0xC9E6, 0xC9C6, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9C7, 0xD1E7,   // 0x6E60 (28256) pixels
-0xD1E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x6E70 (28272) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9C6, 0xC9C6, 0xC9E6, 0xC9C6, 0xD207, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9C6, 0xC1A6, 0xC9C7,   // 0x6E80 (28288) pixels
-0xC9C6, 0xC1E7, 0xB1E7, 0xAA68, 0x9AA9, 0x82CA, 0x7B6C, 0x7B8D, 0x73AD, 0x7BCE, 0x7BCE, 0x8C30, 0x9491, 0xA534, 0xBDF7, 0xCE38,   // 0x6E90 (28304) pixels
-0xDEBA, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xE71B, 0xE71C, 0xE73C, 0xE6FB, 0xE71B, 0xDEDB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C,   // 0x6EA0 (28320) pixels
-0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xDEFB, 0xE71C, 0xE73C, 0xDEFB, 0xE71B, 0xE6FB, 0xDEDB, 0xE71B, 0xDEFB, 0xDEDB, 0xE6FB,   // 0x6EB0 (28336) pixels
-0xDEFB, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB,   // 0x6EC0 (28352) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDA,   // 0x6ED0 (28368) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6EE0 (28384) pixels
-0xFFFF, 0xFFDE, 0xFFBE, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF79D, 0xF79D, 0xF7BE, 0xFFBE, 0xFFDF,   // 0x6EF0 (28400) pixels
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,   // 0x6F00 (28416) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6F10 (28432) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6F20 (28448) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFF9D, 0xFF1C, 0x9A4A, 0xB208, 0xC1E8, 0xC1C7, 0xCA27,   // 0x6F30 (28464) pixels
-0xCA07, 0xCA06, 0xCA06, 0xC9E6, 0xC9E6, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1C7, 0xD1E7, 0xD1E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6,   // 0x6F40 (28480) pixels
-0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xC1E7, 0xC9E7, 0xC9E6,   // 0x6F50 (28496) pixels
-0xC9C6, 0xC9C6, 0xC9C6, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9E6, 0xC1C6, 0xC9E7, 0xCA07, 0xC9E7, 0xCA07, 0xC207, 0xBA07, 0xB248, 0xA2AA,   // 0x6F60 (28512) pixels
-0x930B, 0x834C, 0x7BAD, 0x73CE, 0x7C0F, 0x7BEF, 0x840F, 0x8C50, 0xAD34, 0xBDD6, 0xCE38, 0xDEDA, 0xE6FB, 0xE73C, 0xE6FB, 0xDEFB,   // 0x6F70 (28528) pixels
-0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE73C, 0xE71C,   // 0x6F80 (28544) pixels
-0xE6FB, 0xDEDA, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xDEDA, 0xE71B, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C,   // 0x6F90 (28560) pixels
-0xE71C, 0xE6FB, 0xDEDB, 0xDEDA, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB,   // 0x6FA0 (28576) pixels
-0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x6FB0 (28592) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF7BE, 0xF7BE,   // 0x6FC0 (28608) pixels
-0xFFBE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xF7BE,   // 0x6FD0 (28624) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,   // 0x6FE0 (28640) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x6FF0 (28656) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7000 (28672) pixels
-0xFFFF, 0xFFFF, 0xF7DE, 0xFFFE, 0xFFFE, 0xFFDE, 0xFF9D, 0xFF3C, 0xA28A, 0xB269, 0xC248, 0xC1E7, 0xC9A6, 0xD1E6, 0xD206, 0xC9E6,   // 0x7010 (28688) pixels
-0xCA06, 0xCA07, 0xD207, 0xD1C7, 0xD1C7, 0xD207, 0xCA07, 0xC206, 0xC9E6, 0xC9E6, 0xC9E6, 0xCA06, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7,   // 0x7020 (28704) pixels
-0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xD1E6, 0xC9E6, 0xCA06, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9C6, 0xC9C6, 0xD1C6,   // 0x7030 (28720) pixels
-0xC9E7, 0xCA07, 0xC9E7, 0xC1E6, 0xC207, 0xC207, 0xC1E6, 0xBA07, 0xB227, 0xA228, 0xA2A9, 0x92EB, 0x8B2C, 0x838D, 0x7BCE, 0x7BCF,   // 0x7040 (28736) pixels
-0x7BCE, 0x83EF, 0x8C50, 0x9450, 0xB555, 0xD679, 0xDE9A, 0xDEBA, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB,   // 0x7050 (28752) pixels
-0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xE71C, 0xDEDB, 0xE71B, 0xE6FB, 0xE71B, 0xE6FB, 0xE71C, 0xDEDA,   // 0x7060 (28768) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B,   // 0x7070 (28784) pixels
-0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE73C,   // 0x7080 (28800) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA,   // 0x7090 (28816) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xF79D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF,   // 0x70A0 (28832) pixels
-0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE,   // 0x70B0 (28848) pixels
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x70C0 (28864) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x70D0 (28880) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x70E0 (28896) pixels
-0xFFFF, 0xFFFF, 0xFFFE, 0xFF9D, 0xFF1B, 0x9AAA, 0xAA49, 0xC208, 0xC9E7, 0xDA07, 0xC9C6, 0xD206, 0xCA06, 0xCA06, 0xD1E7, 0xD1C7,   // 0x70F0 (28912) pixels
-0xD1C7, 0xD1E7, 0xCA07, 0xC206, 0xC9E6, 0xC9E6, 0xC9E6, 0xCA06, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x7100 (28928) pixels
-0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9C6, 0xC9E7, 0xC9C7, 0xC9C7, 0xC9C7, 0xC9E7, 0xC1E7, 0xC1E7,   // 0x7110 (28944) pixels
-0xC207, 0xC207, 0xB9E6, 0xB227, 0xA268, 0x9AA9, 0x9B2B, 0x936C, 0x836D, 0x83CE, 0x840F, 0x8430, 0x7BEF, 0x8C50, 0x9451, 0xBD96,   // 0x7120 (28960) pixels
-0xCDF7, 0xDE9A, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xE71C, 0xE6FB, 0xE71B, 0xDEDB, 0xE6FB, 0xE6FB, 0xE71C, 0xE6FB, 0xE71C, 0xE6FB,   // 0x7130 (28976) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xDEFB, 0xE73C, 0xE71B, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB,   // 0x7140 (28992) pixels
-0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB,   // 0x7150 (29008) pixels
-0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x7160 (29024) pixels
-0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x7170 (29040) pixels
-0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFFF, 0xFFFF,   // 0x7180 (29056) pixels
-0xFFFF, 0xFFDF, 0xF7BE, 0xF79E, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7190 (29072) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x71A0 (29088) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x71B0 (29104) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xF7FE, 0xFFFF, 0xF7FE, 0xFFFE,   // 0x71C0 (29120) pixels
-0xFFFE, 0xFF3B, 0xA2CA, 0xA9E8, 0xC1E8, 0xC9E7, 0xC1C6, 0xC206, 0xC206, 0xCA06, 0xC9E6, 0xD1E6, 0xD1E6, 0xC9E6, 0xC9E6, 0xC207,   // 0x71D0 (29136) pixels
-0xC9E6, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x71E0 (29152) pixels
-0xD1C6, 0xD1C6, 0xC9C6, 0xC9E6, 0xC1E6, 0xC9E7, 0xC9C6, 0xC9C6, 0xC9C7, 0xC9C7, 0xC1C7, 0xC1E7, 0xBA07, 0xB207, 0xB207, 0xAA68,   // 0x71F0 (29168) pixels
-0xA30A, 0x934C, 0x8B8D, 0x8BCE, 0x83CF, 0x83EF, 0x8C30, 0x8C31, 0x8C71, 0x840F, 0xB595, 0xCDF7, 0xE6BA, 0xE6BA, 0xDEDB, 0xEF3C,   // 0x7200 (29184) pixels
-0xE73C, 0xDEFB, 0xEF5C, 0xE71C, 0xEF3C, 0xE71B, 0xE73C, 0xE73C, 0xE73C, 0xE6FB, 0xE71B, 0xDEDB, 0xE71B, 0xE71B, 0xE71B, 0xE71B,   // 0x7210 (29200) pixels
-0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEDA, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE73C, 0xE6FB, 0xDEFB, 0xDEFB,   // 0x7220 (29216) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x7230 (29232) pixels
-0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xD6BA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB,   // 0x7240 (29248) pixels
-0xDEDB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE,   // 0x7250 (29264) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF79D, 0xF79E, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,   // 0x7260 (29280) pixels
-0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7270 (29296) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7280 (29312) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7290 (29328) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xFFFE, 0xFFBD, 0xFF3C, 0xA2AA,   // 0x72A0 (29344) pixels
-0xB249, 0xC208, 0xC1E7, 0xCA27, 0xC206, 0xCA06, 0xC9E6, 0xD1E7, 0xD1E6, 0xC9E6, 0xCA06, 0xCA06, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x72B0 (29360) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1C6, 0xD1E6, 0xC9C6, 0xC9E6,   // 0x72C0 (29376) pixels
-0xC1E6, 0xCA06, 0xC1E6, 0xC9E7, 0xD1E7, 0xC9E7, 0xC1C7, 0xC1E7, 0xB207, 0xAA28, 0xAA68, 0xA2EA, 0x9B8D, 0x8BCD, 0x83CE, 0x83EF,   // 0x72D0 (29392) pixels
-0x840F, 0x840F, 0x8C30, 0x8C31, 0x8C50, 0xAD75, 0xBDD6, 0xD658, 0xDE9A, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0xDEDB, 0xE71B, 0xDEDB,   // 0x72E0 (29408) pixels
-0xE71B, 0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xDEFB, 0xE6FB, 0xDEDB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xDEFB, 0xDEFB,   // 0x72F0 (29424) pixels
-0xE71C, 0xE73C, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE73C, 0xEF5C,   // 0x7300 (29440) pixels
-0xEF5C, 0xE71C, 0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xEF5C, 0xEF5C, 0xEF3C, 0xE73C,   // 0x7310 (29456) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB,   // 0x7320 (29472) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFBE,   // 0x7330 (29488) pixels
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7340 (29504) pixels
-0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7350 (29520) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7360 (29536) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7370 (29552) pixels
-0xFFFF, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFDF, 0xFF7D, 0xFF1B, 0xA2AA, 0xAA28, 0xC229, 0xC1E7,   // 0x7380 (29568) pixels
-0xC9C7, 0xD1E7, 0xD1C7, 0xD1E7, 0xD1E6, 0xC9E6, 0xCA06, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6,   // 0x7390 (29584) pixels
-0xC9E6, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9C6, 0xD1E6, 0xC9C6, 0xCA06, 0xC9E6, 0xC9E6,   // 0x73A0 (29600) pixels
-0xC9E7, 0xC9C7, 0xC1E7, 0xBA08, 0xAA29, 0xA2AA, 0xA32B, 0x9BAD, 0x93EE, 0x8C0F, 0x840F, 0x840F, 0x8C30, 0x8C31, 0x8C51, 0x9CB2,   // 0x73B0 (29616) pixels
-0xA534, 0xC638, 0xCE58, 0xDEDA, 0xEF3C, 0xE6FB, 0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0xE73C,   // 0x73C0 (29632) pixels
-0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xDEFB, 0xE71C, 0xDEFB, 0xE71B, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEFB, 0xD6BA, 0xDEDB, 0xE6FB,   // 0x73D0 (29648) pixels
-0xE71C, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB,   // 0x73E0 (29664) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,   // 0x73F0 (29680) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B,   // 0x7400 (29696) pixels
-0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xF79D, 0xF79E, 0xFFDE, 0xFFDF, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF,   // 0x7410 (29712) pixels
-0xFFDF, 0xFFDF, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE,   // 0x7420 (29728) pixels
-0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x7430 (29744) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7440 (29760) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x7450 (29776) pixels
-0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFF7D, 0xFEFB, 0x9ACA, 0xAA69, 0xB208, 0xB9E7, 0xC9E8, 0xC9C7, 0xC9C7,   // 0x7460 (29792) pixels
-0xD1C6, 0xD1E6, 0xD207, 0xC9C6, 0xC9E6, 0xC9C6, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E7, 0xC9E7,   // 0x7470 (29808) pixels
-0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E6, 0xCA07, 0xC1C6, 0xC9E6, 0xC1E6, 0xC1E6, 0xC207, 0xC208, 0xBA28, 0xAA49,   // 0x7480 (29824) pixels
-0x9A89, 0x9B0C, 0x93AD, 0x8BEE, 0x8C0F, 0x840F, 0x8C50, 0x840F, 0x8C30, 0x8C71, 0x9471, 0xAD55, 0xBDF7, 0xCE78, 0xD6BA, 0xE73C,   // 0x7490 (29840) pixels
-0xEF7D, 0xE6FB, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF5D, 0xE71B, 0xE73C, 0xE71C, 0xDEFB, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xEF5C,   // 0x74A0 (29856) pixels
-0xDEFB, 0xEF3C, 0xDEFB, 0xE71C, 0xE71C, 0xDEFB, 0xE6FB, 0xDEDB, 0xE71C, 0xD6BA, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x74B0 (29872) pixels
-0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE6FB,   // 0x74C0 (29888) pixels
-0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEBA, 0xDEBA, 0xDEDB,   // 0x74D0 (29904) pixels
-0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xDEDA, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB,   // 0x74E0 (29920) pixels
-0xF79E, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF77D, 0xF77D,   // 0x74F0 (29936) pixels
-0xF77D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xF79E, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7500 (29952) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7510 (29968) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7520 (29984) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x7530 (30000) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFBD, 0xFF5C, 0xFEB9, 0x9ACA, 0xA269, 0xBA49, 0xC208, 0xC1E7, 0xCA07, 0xC9E7, 0xC9C6, 0xC9E6,   // 0x7540 (30016) pixels
-0xC1A5, 0xD227, 0xC9C6, 0xC9C6, 0xC9E7, 0xC9E7, 0xC1A6, 0xC9E7, 0xC9E7, 0xC9C7, 0xC1C6, 0xC9E6, 0xC1E6, 0xC1E6, 0xC1E6, 0xC206,   // 0x7550 (30032) pixels
-0xC1E6, 0xC1E7, 0xC207, 0xB9E6, 0xC207, 0xC207, 0xC227, 0xC227, 0xBA28, 0xAA28, 0x9A69, 0xAB8D, 0x9BAE, 0x9BEF, 0x940F, 0x8C0F,   // 0x7560 (30048) pixels
-0x840F, 0x8C50, 0x8C51, 0x8C50, 0x9471, 0xA513, 0xAD75, 0xC617, 0xCE58, 0xDEFA, 0xDEFB, 0xDF1B, 0xE71C, 0xE71B, 0xE71C, 0xDEFB,   // 0x7570 (30064) pixels
-0xE71B, 0xE73C, 0xDEFB, 0xE71B, 0xEF5C, 0xE6FB, 0xE71C, 0xDEFB, 0xE71C, 0xDEFB, 0xE6FB, 0xEF5C, 0xE71B, 0xE73C, 0xE71C, 0xDEFB,   // 0x7580 (30080) pixels
-0xE71B, 0xE71B, 0xE71B, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE73C, 0xDEFB, 0xE73C, 0xE71C, 0xDEFB,   // 0x7590 (30096) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,   // 0x75A0 (30112) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB,   // 0x75B0 (30128) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xF79E, 0xF79E, 0xF79E, 0xF79E,   // 0x75C0 (30144) pixels
-0xF79E, 0xF79E, 0xF79E, 0xF79D, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF7BE,   // 0x75D0 (30160) pixels
-0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF,   // 0x75E0 (30176) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x75F0 (30192) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7600 (30208) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7DE, 0xFFFF, 0xFFFF,   // 0x7610 (30224) pixels
-0xFFFF, 0xFFDE, 0xFF9D, 0xFF3B, 0xFEBA, 0xA2AA, 0xB269, 0xBA49, 0xB9E7, 0xC1C7, 0xD228, 0xC9E6, 0xD207, 0xC1A5, 0xD207, 0xC9E6,   // 0x7620 (30240) pixels
-0xCA07, 0xC9E7, 0xD207, 0xC9C7, 0xC9E7, 0xC9E7, 0xC1E6, 0xC1E6, 0xC206, 0xC206, 0xC226, 0xC206, 0xC207, 0xC1E7, 0xBA07, 0xC228,   // 0x7630 (30256) pixels
-0xBA27, 0xBA28, 0xB228, 0xAA28, 0xA269, 0xBBCE, 0xB42F, 0x9BEE, 0x942F, 0x9450, 0x9471, 0x8C50, 0x9491, 0x94B1, 0x8C50, 0x9CB2,   // 0x7640 (30272) pixels
-0xB575, 0xBDF7, 0xC638, 0xCE78, 0xE73C, 0xE71B, 0xDF1B, 0xE73C, 0xE73C, 0xDEFB, 0xE71C, 0xEF5D, 0xE6FB, 0xE71C, 0xE71B, 0xE73C,   // 0x7650 (30288) pixels
-0xE71B, 0xE71B, 0xE71B, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEDA, 0xE6FB, 0xDEFB, 0xE6FB,   // 0x7660 (30304) pixels
-0xEF5C, 0xE6FB, 0xDEDA, 0xDEFB, 0xE71C, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71B,   // 0x7670 (30320) pixels
-0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB,   // 0x7680 (30336) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB,   // 0x7690 (30352) pixels
-0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE,   // 0x76A0 (30368) pixels
-0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x76B0 (30384) pixels
-0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x76C0 (30400) pixels
-0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x76D0 (30416) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x76E0 (30432) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFFF, 0xFF9D, 0xFF9D,   // 0x76F0 (30448) pixels
-0xFF5C, 0xFEFB, 0x8A89, 0xA2AA, 0xB269, 0xBA28, 0xC1E8, 0xCA08, 0xC1E7, 0xCA07, 0xC1E6, 0xCA07, 0xC9E6, 0xC1C5, 0xC9E6, 0xC1E6,   // 0x7700 (30464) pixels
-0xC9E6, 0xCA06, 0xCA07, 0xC1E6, 0xC1E6, 0xC207, 0xC207, 0xB9C6, 0xC1E7, 0xC1E8, 0xB9E7, 0xBA28, 0xA9E7, 0xAA49, 0x9A48, 0x9269,   // 0x7710 (30480) pixels
-0xB3CE, 0xAC2F, 0x9C0F, 0x9C30, 0x9C71, 0x8C30, 0x8C50, 0x9471, 0x8C70, 0x9491, 0x9CB2, 0xAD54, 0xB595, 0xC617, 0xD6BA, 0xDF1B,   // 0x7720 (30496) pixels
-0xEF5C, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xEF1C, 0xE6FC, 0xE71C, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xEF5C, 0xDEFB, 0xE71B,   // 0x7730 (30512) pixels
-0xE73C, 0xE73C, 0xDEDB, 0xE71B, 0xDEFB, 0xE73C, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xE6FB, 0xDEDB, 0xDEFB, 0xE71C, 0xDEFB,   // 0x7740 (30528) pixels
-0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA,   // 0x7750 (30544) pixels
-0xDEBA, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x7760 (30560) pixels
-0xD6BA, 0xDEDA, 0xDEFB, 0xDEDB, 0xDEBA, 0xDEBA, 0xDEDB, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB,   // 0x7770 (30576) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF,   // 0x7780 (30592) pixels
-0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,   // 0x7790 (30608) pixels
-0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x77A0 (30624) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x77B0 (30640) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x77C0 (30656) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFFDE, 0xFF7D, 0xFF5C, 0xFEDA,   // 0x77D0 (30672) pixels
-0xFDD6, 0xA28A, 0xAA29, 0xBA69, 0xB228, 0xB228, 0xB227, 0xC248, 0xB9E6, 0xCA47, 0xC1E6, 0xC206, 0xC206, 0xC1C6, 0xC1E6, 0xC207,   // 0x77E0 (30688) pixels
-0xC207, 0xB9E7, 0xBA08, 0xBA28, 0xBA28, 0xBA49, 0xAA08, 0xAA69, 0xB2CB, 0xC3EF, 0xBC30, 0xB450, 0xAC71, 0x9C50, 0x9C50, 0x9C91,   // 0x77F0 (30704) pixels
-0x8C30, 0x9491, 0x9492, 0x8C71, 0xA554, 0xAD74, 0xB595, 0xC5F7, 0xD699, 0xDEFB, 0xDEFA, 0xE73B, 0xDEFB, 0xE71B, 0xEF5D, 0xE71C,   // 0x7800 (30720) pixels
-0xDEFB, 0xE71C, 0xEF1C, 0xEEFC, 0xEF5D, 0xE6FB, 0xE73C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE73C, 0xE71B, 0xE6FB, 0xE73C, 0xE73C,   // 0x7810 (30736) pixels
-0xDEFB, 0xE6FB, 0xE73C, 0xE71C, 0xDEFB, 0xEF3C, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71C, 0xDEDB,   // 0x7820 (30752) pixels
-0xE71C, 0xDEBA, 0xDEDA, 0xDEBA, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xE6FB,   // 0x7830 (30768) pixels
-0xE71B, 0xE6FB, 0xDEFB, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB,   // 0x7840 (30784) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xE6FB,   // 0x7850 (30800) pixels
-0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE,   // 0x7860 (30816) pixels
-0xF79D, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE,   // 0x7870 (30832) pixels
-0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xF79D, 0xF79D, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7880 (30848) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7890 (30864) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x78A0 (30880) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFF9D, 0xFFDE, 0xFF9D, 0xFF5C, 0xFF3B, 0xFEFA, 0xFE99, 0xFE79,   // 0x78B0 (30896) pixels
-0xFE79, 0x9269, 0xA2AA, 0xA268, 0xB248, 0xBA28, 0xB9C6, 0xCA28, 0xC207, 0xCA07, 0xC228, 0xBA08, 0xB208, 0xB249, 0xB24A, 0xA249,   // 0x78C0 (30912) pixels
-0xBBAE, 0xC470, 0xC491, 0xBC70, 0xB470, 0xB491, 0xAC91, 0xA4B2, 0x9C51, 0xA4D2, 0x9C92, 0x9C92, 0xA4F3, 0xA4F3, 0x9CB2, 0xBDF7,   // 0x78D0 (30928) pixels
-0xBDF7, 0xC637, 0xD6BA, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xEF5C, 0xE71C, 0xE6FB, 0xE6FB, 0xEF3C, 0xEF5C, 0xE6FB, 0xE71C,   // 0x78E0 (30944) pixels
-0xF77D, 0xE71B, 0xDEFB, 0xDEDB, 0xE71B, 0xE73C, 0xE73C, 0xDEFB, 0xE71C, 0xDEFB, 0xE71B, 0xE71C, 0xE6FB, 0xE71C, 0xE71C, 0xDEDA,   // 0x78F0 (30960) pixels
-0xE73C, 0xEF5C, 0xDEDB, 0xE71B, 0xE6FB, 0xE71C, 0xE71B, 0xEF5C, 0xE71C, 0xE71C, 0xD6BA, 0xDEDB, 0xDEDA, 0xE71B, 0xD6BA, 0xD6BA,   // 0x7900 (30976) pixels
-0xD69A, 0xD6BA, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xDEDB, 0xDEDA, 0xDEDA,   // 0x7910 (30992) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDA, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C,   // 0x7920 (31008) pixels
-0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xEF3C, 0xE73C, 0xE71C, 0xDEFB, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E,   // 0x7930 (31024) pixels
-0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79D, 0xF7BE, 0xF79E, 0xF79D, 0xF79D,   // 0x7940 (31040) pixels
-0xF7BE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,   // 0x7950 (31056) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7960 (31072) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7970 (31088) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,   // 0x7980 (31104) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xF79D, 0xFF9D, 0xF77C, 0xF75C, 0xF73B, 0xEEDA, 0xF679, 0xF658, 0xFE38, 0xED54,   // 0x7990 (31120) pixels
-0xA2CA, 0xA269, 0xB269, 0xAA28, 0xB228, 0xB249, 0xAA49, 0xA208, 0xAA8A, 0xC3AE, 0xD431, 0xC451, 0xBCB2, 0xB4F2, 0xACD2, 0xACB1,   // 0x79A0 (31136) pixels
-0xACD2, 0xA4D2, 0x9CB2, 0x9CD2, 0xA4F3, 0x9CB2, 0xA4D3, 0x9CD3, 0xA4D3, 0xAD34, 0xAD54, 0xBDF7, 0xBDD6, 0xD679, 0xD69A, 0xE71B,   // 0x79B0 (31152) pixels
-0xE73C, 0xE73C, 0xEF5C, 0xE71B, 0xE71C, 0xEF3C, 0xEF3C, 0xE71C, 0xE71C, 0xE6FB, 0xDEFB, 0xEF5C, 0xDEFB, 0xE73C, 0xE71C, 0xEF5C,   // 0x79C0 (31168) pixels
-0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEDB, 0xE73C, 0xE71C, 0xE73C, 0xDEFB, 0xE71B, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xE71C,   // 0x79D0 (31184) pixels
-0xDEDA, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xE71B, 0xE71B, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEFB, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEDB,   // 0x79E0 (31200) pixels
-0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEFB,   // 0x79F0 (31216) pixels
-0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB,   // 0x7A00 (31232) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF79E,   // 0x7A10 (31248) pixels
-0xF79D, 0xF79D, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE,   // 0x7A20 (31264) pixels
-0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE,   // 0x7A30 (31280) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7A40 (31296) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7A50 (31312) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,   // 0x7A60 (31328) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFF9E, 0xF75D, 0xF73D, 0xFF5D, 0xEEDA, 0xEEBA, 0xF6BA, 0xEE79, 0xF679, 0xEE18, 0xE5B6, 0xE596,   // 0x7A70 (31344) pixels
-0xEDB6, 0xDD75, 0xD534, 0xD534, 0xCD33, 0xC513, 0xBD13, 0xBD13, 0xACF3, 0xA4D3, 0xA4F3, 0xA4F3, 0xA4F3, 0xA4F3, 0xA513, 0xAD34,   // 0x7A80 (31360) pixels
-0xAD34, 0xA513, 0xB595, 0xBDF6, 0xBDF7, 0xC638, 0xD69A, 0xDEBA, 0xE6FB, 0xEF3C, 0xE73C, 0xEF5D, 0xE71B, 0xE6FB, 0xEF5D, 0xE6FB,   // 0x7A90 (31376) pixels
-0xE6FB, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73B, 0xE73B, 0xE71B, 0xE71B, 0xE73C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB,   // 0x7AA0 (31392) pixels
-0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xE73C, 0xE71C, 0xE71C, 0xE6FB, 0xDEFB, 0xEF5C, 0xDEFB, 0xDEDA, 0xDEFB, 0xE71C, 0xE6FB, 0xE71C,   // 0x7AB0 (31408) pixels
-0xE6FB, 0xE71C, 0xE6FB, 0xE71B, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEFB,   // 0x7AC0 (31424) pixels
-0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF5C, 0xEF5C,   // 0x7AD0 (31440) pixels
-0xDEFB, 0xDEDA, 0xD6BA, 0xDEDA, 0xE71B, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB,   // 0x7AE0 (31456) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xF79E, 0xF79E, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE,   // 0x7AF0 (31472) pixels
-0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE,   // 0x7B00 (31488) pixels
-0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF,   // 0x7B10 (31504) pixels
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7B20 (31520) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7B30 (31536) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE,   // 0x7B40 (31552) pixels
-0xFFBE, 0xFF9E, 0xFF9E, 0xF77D, 0xFF7D, 0xF73B, 0xF71C, 0xEF1B, 0xE69A, 0xE679, 0xE679, 0xDE38, 0xD617, 0xD617, 0xD617, 0xCDF7,   // 0x7B50 (31568) pixels
-0xC5D6, 0xBDB5, 0xBDB5, 0xB595, 0xB595, 0xAD55, 0xAD75, 0xB596, 0xAD55, 0xB595, 0xBDB6, 0xB595, 0xB596, 0xC617, 0xBE17, 0xCE58,   // 0x7B60 (31584) pixels
-0xCE79, 0xDEDA, 0xE6FB, 0xEF3C, 0xEF3C, 0xEF3C, 0xE71C, 0xE73C, 0xE71C, 0xEF5D, 0xEF5D, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xEF5C,   // 0x7B70 (31600) pixels
-0xE71C, 0xDF1B, 0xE73B, 0xDEFB, 0xE71C, 0xE73C, 0xEF3C, 0xE71B, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71C,   // 0x7B80 (31616) pixels
-0xDEDA, 0xE71C, 0xE71C, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB,   // 0x7B90 (31632) pixels
-0xE71B, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB,   // 0x7BA0 (31648) pixels
-0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEFB,   // 0x7BB0 (31664) pixels
-0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xD6BA, 0xD6BA, 0xD6BA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB,   // 0x7BC0 (31680) pixels
-0xF77D, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xF77D, 0xF77D, 0xF77D, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E,   // 0x7BD0 (31696) pixels
-0xF79E, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFBE, 0xF7BE,   // 0x7BE0 (31712) pixels
-0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF,   // 0x7BF0 (31728) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7C00 (31744) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7C10 (31760) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE,   // 0x7C20 (31776) pixels
-0xF79D, 0xEF5C, 0xEF3C, 0xEF5C, 0xEF3C, 0xEF1B, 0xE6DA, 0xDEBA, 0xDE99, 0xD679, 0xCE38, 0xC617, 0xC5F7, 0xC617, 0xC617, 0xC617,   // 0x7C30 (31792) pixels
-0xC618, 0xBDD7, 0xBDB6, 0xBDD7, 0xC5F7, 0xC5F7, 0xC5F7, 0xC617, 0xCE58, 0xD679, 0xD699, 0xDEDA, 0xDEFB, 0xDEFB, 0xE73C, 0xEF3C,   // 0x7C40 (31808) pixels
-0xEF3C, 0xEF5C, 0xEF5C, 0xEF7D, 0xEF5C, 0xE73C, 0xEF5D, 0xEF5C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xDEFB, 0xE71C, 0xE73C, 0xE71B,   // 0x7C50 (31824) pixels
-0xE73C, 0xE71B, 0xE71B, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE71B, 0xE73C, 0xDEFB, 0xDEFB, 0xE73C, 0xDEFB, 0xE71C,   // 0x7C60 (31840) pixels
-0xE71B, 0xDEDB, 0xDEFB, 0xE6FB, 0xE73C, 0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xDEDA, 0xDEDB, 0xDEFB, 0xE73C, 0xDEDA, 0xDEDB, 0xDEFB,   // 0x7C70 (31856) pixels
-0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDA, 0xD6BA, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,   // 0x7C80 (31872) pixels
-0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB,   // 0x7C90 (31888) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xF79D, 0xF79E, 0xF79E, 0xF79E,   // 0x7CA0 (31904) pixels
-0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF79E, 0xF77D, 0xEF7D, 0xEF5D, 0xEF7D, 0xF79D, 0xF79E,   // 0x7CB0 (31920) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE,   // 0x7CC0 (31936) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7CD0 (31952) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7CE0 (31968) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7CF0 (31984) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF79E, 0xEF7D, 0xEF5C,   // 0x7D00 (32000) pixels
-0xEF5C, 0xEF5C, 0xE73C, 0xE71B, 0xDEDA, 0xDEFB, 0xDEFB, 0xDEDA, 0xD6B9, 0xD699, 0xD679, 0xD699, 0xCE59, 0xCE59, 0xCE59, 0xD679,   // 0x7D10 (32016) pixels
-0xD679, 0xD699, 0xDEBA, 0xDEBA, 0xDEDA, 0xE71B, 0xE6FB, 0xE6FB, 0xE71C, 0xEF3C, 0xEF3D, 0xEF5D, 0xE73C, 0xE73C, 0xE71B, 0xE71C,   // 0x7D20 (32032) pixels
-0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xEF5D, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xDEDB, 0xE71C,   // 0x7D30 (32048) pixels
-0xE71C, 0xE73C, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xE73C, 0xE71B, 0xE71B, 0xE73C, 0xDEDB, 0xDEDB, 0xE73C, 0xE71C, 0xDEDB, 0xE73C,   // 0x7D40 (32064) pixels
-0xDEDB, 0xDEFB, 0xDEBA, 0xE6FB, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEDB, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x7D50 (32080) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB,   // 0x7D60 (32096) pixels
-0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDA,   // 0x7D70 (32112) pixels
-0xD6BA, 0xD6BA, 0xD6BA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xF79D, 0xF79D, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79D,   // 0x7D80 (32128) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE,   // 0x7D90 (32144) pixels
-0xFFBE, 0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7DA0 (32160) pixels
-0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7DB0 (32176) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7DC0 (32192) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7DD0 (32208) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFDF, 0xFFDF, 0xF7BE, 0xF79D, 0xF79D, 0xF79D, 0xF77D, 0xEF5C,   // 0x7DE0 (32224) pixels
-0xEF7C, 0xE73C, 0xE6FB, 0xDEDA, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDB, 0xE6FB, 0xE6FB, 0xDEDB, 0xE6FB, 0xE6FB, 0xE6FB,   // 0x7DF0 (32240) pixels
-0xE73C, 0xEF5C, 0xEF5D, 0xEF5C, 0xE73C, 0xEF5D, 0xF77E, 0xEF3C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xE73C, 0xE71C, 0xEF5C, 0xEF5D,   // 0x7E00 (32256) pixels
-0xE73C, 0xEF3C, 0xDEFB, 0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xE73C, 0xE73C, 0xDEFB, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xE71B,   // 0x7E10 (32272) pixels
-0xE71B, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71B, 0xEF5D, 0xE6FB, 0xE71B, 0xDEDA, 0xEF3C, 0xDEFB, 0xE71B, 0xDEFB,   // 0x7E20 (32288) pixels
-0xE71B, 0xE71B, 0xDEDB, 0xE71C, 0xDEFB, 0xE71B, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB,   // 0x7E30 (32304) pixels
-0xDEDA, 0xDEBA, 0xD6BA, 0xD6BA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEBA, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71C,   // 0x7E40 (32320) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB,   // 0x7E50 (32336) pixels
-0xDEFB, 0xDEFB, 0xDEDA, 0xD6BA, 0xF79E, 0xF79E, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF7BE, 0xF7BE, 0xF79D, 0xF79D, 0xF79D, 0xF79D,   // 0x7E60 (32352) pixels
-0xF79D, 0xF79E, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE,   // 0x7E70 (32368) pixels
-0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,   // 0x7E80 (32384) pixels
-0xFFFF, 0xFFDF, 0xFFDF, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7E90 (32400) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7EA0 (32416) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7EB0 (32432) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF77D, 0xEF7C, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5C,   // 0x7EC0 (32448) pixels
-0xEF3C, 0xE73C, 0xE73C, 0xEF3C, 0xE71C, 0xE71C, 0xEF3C, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF3C, 0xEF5D, 0xEF3C, 0xF79D, 0xEF5D, 0xEF3C,   // 0x7ED0 (32464) pixels
-0xEF5D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF7D, 0xE73C, 0xE71C, 0xEF3C, 0xEF5C, 0xEF5D, 0xE6FB, 0xE73C, 0xE73C,   // 0x7EE0 (32480) pixels
-0xE71B, 0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0xE73C, 0xE73C, 0xDEFB, 0xE73C, 0xDEFB, 0xE71B, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x7EF0 (32496) pixels
-0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE71C, 0xE6FB, 0xE73C, 0xDEDB, 0xE71B, 0xDEFB, 0xE71C, 0xDEDB, 0xDEFB, 0xE6FB, 0xDEDB,   // 0x7F00 (32512) pixels
-0xDEFB, 0xE71B, 0xE71C, 0xE6FB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB,   // 0x7F10 (32528) pixels
-0xDEDB, 0xDEDB, 0xDEDB, 0xDEDA, 0xE71C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEDA, 0xD6BA, 0xDEFB,   // 0x7F20 (32544) pixels
-0xEF5C, 0xEF7D, 0xEF5C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB,   // 0x7F30 (32560) pixels
-0xEF5D, 0xF77D, 0xF7BE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF79D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE,   // 0x7F40 (32576) pixels
-0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xEF7D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF79E,   // 0x7F50 (32592) pixels
-0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFDF,   // 0x7F60 (32608) pixels
-0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7F70 (32624) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7F80 (32640) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x7F90 (32656) pixels
-0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xEF7D, 0xF79D, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xEF7D, 0xEF7D,   // 0x7FA0 (32672) pixels
-0xF77D, 0xEF7D, 0xF77D, 0xF79D, 0xF79D, 0xEF7D, 0xEF7D, 0xF79D, 0xF77E, 0xEF7D, 0xEF7D, 0xF77D, 0xEF5D, 0xEF7D, 0xF77D, 0xE73C,   // 0x7FB0 (32688) pixels
-0xEF5D, 0xEF5C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF5C, 0xE73C, 0xEF5C, 0xE6FB, 0xEF3C, 0xE73C, 0xDEFB, 0xE73C, 0xE6FB, 0xE71B,   // 0x7FC0 (32704) pixels
-0xE71B, 0xE71C, 0xE71C, 0xEF5C, 0xDEDB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xE73C, 0xE73C, 0xDEFB, 0xDEFB, 0xDEDB,   // 0x7FD0 (32720) pixels
-0xDEFB, 0xE71B, 0xE73C, 0xE71B, 0xE71B, 0xDEFB, 0xE6FB, 0xE6FB, 0xEF5C, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xDEBA, 0xDEDB, 0xE71B,   // 0x7FE0 (32736) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEBA, 0xDEDA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C,   // 0x7FF0 (32752) pixels
-0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEBA, 0xD6BA, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEFB,   // 0x8000 (32768) pixels
-0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEBA, 0xDEBA, 0xDEDA, 0xD6BA, 0xDEBA, 0xDEDB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x8010 (32784) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x8020 (32800) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x8030 (32816) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x8040 (32832) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x8050 (32848) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x8060 (32864) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x8070 (32880) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x8080 (32896) pixels
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,   // 0x8090 (32912) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x80A0 (32928) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x80B0 (32944) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x80C0 (32960) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x80D0 (32976) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x80E0 (32992) pixels
+static const unsigned short pong_data[24444] = {
+0x0007, 0xDEBA, 0xD6BA, 0xDEDA, 0xDEDA, 0xDEDB, 0xE6FB, 0xE71B, 0x8003, 0xE71C, 0x0001, 0xE73C, 0x8003, 0xEF5C, 0x0001, 0xE73C,
+0x8004, 0xE71C, 0x0012, 0xE6FB, 0xE71B, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF3C, 0xEF5D, 0xEF5C, 0xEF7D, 0xEF5D, 0xEF5D, 0xE73C, 0xE6FB,
+0xE6FB, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5C, 0x8003, 0xEF7D, 0x0012, 0xEF5C, 0xEF7D, 0xEF5C, 0xEF5D, 0xF79E, 0xF79D, 0xEF5C, 0xEF5D,
+0xF7BE, 0xF79E, 0xF77D, 0xF79D, 0xFFBE, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDF, 0xFFDF, 0x8053, 0xFFFF, 0x001D, 0xFFDF, 0xFFDF, 0xFFFF,
+0xFFFF, 0xFFDE, 0xFFBE, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0xF79D, 0xFFBE, 0xF79D, 0xF79D, 0xF7BE, 0xF7BE, 0xF77D, 0xF79D, 0xEF7D,
+0xF79D, 0xEF7D, 0xE71C, 0xEF7D, 0xEF5D, 0xEF3C, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF5C, 0x8003, 0xE73C, 0x0001, 0xEF5C, 0x8003, 0xE73C,
+0x0006, 0xEF3C, 0xEF5C, 0xEF5D, 0xEF5C, 0xE73C, 0xE71C, 0x8003, 0xE71B, 0x0006, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xDEFB,
+0x8003, 0xE71B, 0x0006, 0xE71C, 0xEF3C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C, 0x8003, 0xEF5C, 0x0003, 0xEF3C, 0xEF5C, 0xEF5C, 0x8003,
+0xEF5D, 0x0002, 0xEF5C, 0xE73C, 0x8004, 0xE71B, 0x000C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE6FB, 0xE71B, 0xE73C, 0xEF3C, 0xE73C,
+0xE73C, 0xE71C, 0xE71C, 0x8004, 0xDEFB, 0x0009, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0x8003,
+0xE73C, 0x0013, 0xEF7D, 0xEF7D, 0xEF5C, 0xEF5C, 0xE73C, 0xEF5C, 0xEF3C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5C, 0xE73C, 0xEF3C, 0xEF5D,
+0xEF7D, 0xEF5D, 0xEF3C, 0xEF7D, 0xEF5C, 0x8003, 0xEF7D, 0x000B, 0xEF5C, 0xF79D, 0xFFDE, 0xFFFF, 0xFFDE, 0xEF7D, 0xF79D, 0xF77D,
+0xFFDE, 0xFFFF, 0xFFDF, 0x8055, 0xFFFF, 0x0001, 0xFFDF, 0x8005, 0xFFFF, 0x0020, 0xFFBE, 0xF7BE, 0xF79E, 0xFFBE, 0xFFDF, 0xF7BE,
+0xF79D, 0xF79E, 0xF79E, 0xEF7D, 0xF79D, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF3C, 0xEF7D, 0xEF5D, 0xEF5C, 0xE73C, 0xE71B, 0xE73C, 0xE71C,
+0xE73C, 0xEF3C, 0xEF5D, 0xF79D, 0xEF7D, 0xEF7D, 0xF77D, 0xEF5D, 0xE73C, 0xE71C, 0x8006, 0xE73C, 0x0003, 0xE71C, 0xE71B, 0xE71C,
+0x8003, 0xE73C, 0x0005, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0x8003, 0xE73C, 0x8004, 0xE71B, 0x0001, 0xE71C, 0x8003, 0xE73C,
+0x0003, 0xE71C, 0xE73C, 0xE73C, 0x8003, 0xE71C, 0x0002, 0xE73C, 0xE73C, 0x8004, 0xE71B, 0x0002, 0xDEDB, 0xDEFB, 0x8003, 0xE71B,
+0x000A, 0xE71C, 0xE71B, 0xE71C, 0xEF5C, 0xEF3C, 0xE73C, 0xE71C, 0xE6FB, 0xE71B, 0xE71C, 0x8003, 0xE73C, 0x0003, 0xEF3C, 0xEF5D,
+0xEF3C, 0x8003, 0xE71C, 0x0020, 0xEF5C, 0xEF5C, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xE71B, 0xEF5C, 0xF79E, 0xF79E,
+0xF79D, 0xEF7D, 0xEF5D, 0xEF3C, 0xEF7D, 0xEF5C, 0xF79D, 0xEF5C, 0xEF7D, 0xE71C, 0xEF5D, 0xEF7D, 0xF79E, 0xF79D, 0xF7BE, 0xF79D,
+0xF79E, 0xF79E, 0xFFFF, 0xF7BE, 0x8057, 0xFFFF, 0x000B, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xFFDF, 0xFFDF, 0xF79D, 0xF7BE,
+0xF79D, 0xF79D, 0x8003, 0xF79E, 0x0014, 0xEF5D, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF3C, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF5D,
+0xEF5C, 0xEF3C, 0xEF5C, 0xEF3C, 0xE73C, 0xEF5C, 0xE73C, 0xE73C, 0xEF3C, 0x8005, 0xE73C, 0x000A, 0xE71B, 0xE6FB, 0xE71C, 0xE73C,
+0xEF5C, 0xEF5C, 0xEF3C, 0xE73C, 0xE71C, 0xE71B, 0x8004, 0xE71C, 0x8004, 0xE73C, 0x0007, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C,
+0xEF5C, 0xEF3C, 0x8005, 0xE73C, 0x0006, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0x8003, 0xE71C, 0x000C, 0xE71B, 0xE73C,
+0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0x8004, 0xE73C, 0x0004, 0xE71C, 0xEF3C, 0xEF5D,
+0xEF5C, 0x8003, 0xE73C, 0x0013, 0xE71C, 0xE73C, 0xE73C, 0xEF7D, 0xEF7D, 0xF79D, 0xF77D, 0xF79D, 0xF7BE, 0xF79D, 0xEF5D, 0xEF3C,
+0xEF5D, 0xF77D, 0xF77D, 0xEF5D, 0xEF5C, 0xE73C, 0xEF3C, 0x8003, 0xEF7D, 0x0009, 0xF79D, 0xF79E, 0xEF7D, 0xFFBE, 0xFFBE, 0xF79E,
+0xFFDE, 0xF7BE, 0xFFDF, 0x8058, 0xFFFF, 0x0018, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xFFDF, 0xFFDE, 0xF79E, 0xFFBE, 0xF7BE,
+0xF79D, 0xF7BE, 0xEF7D, 0xF79D, 0xF77D, 0xF79D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5D, 0xF79E, 0xF79D, 0xE73C, 0xE73C, 0x8005, 0xEF5C,
+0x000D, 0xE73C, 0xEF5C, 0xE71C, 0xE71C, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0x8006, 0xE73C,
+0x8004, 0xEF3C, 0x8005, 0xE73C, 0x0002, 0xEF7D, 0xEF5D, 0x8004, 0xEF5C, 0x0002, 0xE73C, 0xE71C, 0x8004, 0xDEFB, 0x0005, 0xE6FB,
+0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0x8003, 0xE71C, 0x0002, 0xDEFB, 0xDEFB, 0x8003, 0xE73C, 0x000B, 0xE71C, 0xDEFB, 0xDEDA, 0xE6FB,
+0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xEF3C, 0x8004, 0xEF5C, 0x8003, 0xE73C, 0x0001, 0xE71B, 0x8003, 0xE71C, 0x0006,
+0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xEF3C, 0xE6FB, 0x8003, 0xE71C, 0x0009, 0xE73C, 0xEF5C, 0xF79D, 0xF7BE, 0xEF7D, 0xEF5D, 0xEF5D,
+0xF79D, 0xEF5D, 0x8003, 0xEF7D, 0x0008, 0xF7BE, 0xF79D, 0xEF7D, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xF7BE, 0x8057, 0xFFFF, 0x0010,
+0xFFDF, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFBE, 0xFFBE, 0xF79E, 0xF7BE, 0xF79E, 0xF7BE, 0xEF7D, 0xF7BE, 0xEF5C, 0xEF7D, 0xF79E, 0xEF5D,
+0x8003, 0xEF7D, 0x000C, 0xF77D, 0xF79E, 0xF77D, 0xE73C, 0xE73C, 0xEF5C, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xE73C, 0xEF7D, 0x8003,
+0xE71C, 0x000B, 0xEF5C, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0x8003, 0xE71B, 0x000C,
+0xE71C, 0xEF3C, 0xEF5C, 0xEF3C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71B, 0x8005, 0xE71C, 0x0008, 0xE73C,
+0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE73C, 0x8003, 0xEF3C, 0x001C, 0xEF5C, 0xE71C, 0xE6FB, 0xE71B, 0xE6FB, 0xE73C,
+0xEF5D, 0xEF7D, 0xF79E, 0xE71C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF5C, 0xE71B, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE73C,
+0xEF5D, 0xF77D, 0xEF7D, 0xE73C, 0xE73C, 0xE71C, 0x8005, 0xE73C, 0x000B, 0xEF3C, 0xE73C, 0xE71B, 0xE71B, 0xE73C, 0xEF5D, 0xEF5D,
+0xEF5C, 0xE73C, 0xE71C, 0xEF5D, 0x8003, 0xEF7D, 0x0009, 0xF79E, 0xF7BE, 0xEF7D, 0xFFDE, 0xF79E, 0xFFDE, 0xF7BE, 0xFFDE, 0xF7BE,
+0x8059, 0xFFFF, 0x001F, 0xFFDE, 0xFFDE, 0xF79D, 0xFFBE, 0xF7BE, 0xF77D, 0xFFBE, 0xEF7D, 0xF79E, 0xEF7D, 0xF7BE, 0xEF7D, 0xEF7D,
+0xF7BE, 0xE73C, 0xEF5C, 0xEF7D, 0xEF7D, 0xF77D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF5D, 0xEF5D, 0xEF3C, 0xEF5C, 0xE73C, 0xEF5C, 0xE71B,
+0xEF5D, 0xE71C, 0x8003, 0xE73C, 0x8004, 0xEF3C, 0x8004, 0xE73C, 0x8003, 0xE71C, 0x0003, 0xDEFB, 0xDEDB, 0xDEDB, 0x8003, 0xEF5C,
+0x0002, 0xEF3C, 0xE73C, 0x8003, 0xE71C, 0x8004, 0xE73C, 0x0001, 0xE71C, 0x8003, 0xE71B, 0x8003, 0xDEFB, 0x0001, 0xE71C, 0x8004,
+0xE73C, 0x0016, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xE71B, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xEF7D, 0xEF5D,
+0xEF3C, 0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF5C, 0x8003, 0xE73C, 0x0010, 0xEF5C, 0xEF7D, 0xEF5C, 0xEF7D, 0xEF5D,
+0xEF3C, 0xEF3C, 0xE71C, 0xE73C, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF7D, 0xF77D, 0xF77D, 0x8003, 0xF79D, 0x000E, 0xEF5D, 0xF77D,
+0xEF7D, 0xF79D, 0xEF3C, 0xEF7D, 0xF77D, 0xF79E, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDF, 0xF7BE, 0xFFDF, 0x805A, 0xFFFF, 0x0029, 0xF79E,
+0xFFBE, 0xF7BE, 0xFFDE, 0xF79D, 0xEF5D, 0xF79E, 0xF79D, 0xF7BE, 0xF7BE, 0xF79D, 0xF77D, 0xEF7D, 0xF7BE, 0xEF5D, 0xF79D, 0xE73C,
+0xEF5C, 0xEF7D, 0xEF3C, 0xEF5C, 0xE73C, 0xE71C, 0xDEFB, 0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF7D,
+0xEF5C, 0xE73C, 0xE71B, 0xE73C, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF5C, 0x8007, 0xE73C, 0x8003, 0xEF5C, 0x0001, 0xEF3C, 0x8004, 0xE73C,
+0x8003, 0xE71B, 0x0001, 0xE71C, 0x8004, 0xE73C, 0x0008, 0xEF3C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0x8004,
+0xE73C, 0x0008, 0xEF5D, 0xEF3C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xEF3C, 0xEF5D, 0x8004, 0xE73C, 0x0005, 0xE71C, 0xEF3C, 0xEF5D,
+0xEF7D, 0xEF7D, 0x8004, 0xEF5D, 0x001A, 0xEF7D, 0xF79D, 0xF77D, 0xE6FB, 0xE71C, 0xE73C, 0xF77D, 0xF77D, 0xF79D, 0xF79D, 0xF79E,
+0xF77D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xF77D, 0xEF7D, 0xFFDF, 0xFFBE, 0xFFDE, 0xEF7D, 0xF79E, 0xF79D, 0xFFBE, 0x8004,
+0xF7BE, 0x0003, 0xFFDF, 0xFFFF, 0xFFDF, 0x805A, 0xFFFF, 0x0021, 0xFFBE, 0xF7BE, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF77D,
+0xEF5D, 0xF79E, 0xEF5D, 0xF79E, 0xF77D, 0xF79E, 0xEF7D, 0xEF7D, 0xEF5C, 0xE73C, 0xEF5C, 0xE73C, 0xEF5D, 0xEF5C, 0xEF5C, 0xE73C,
+0xE73C, 0xE71C, 0xEF5C, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0x8003, 0xE71C, 0x0004, 0xE73C, 0xEF3C, 0xEF3C, 0xE73C,
+0x8003, 0xEF5D, 0x0005, 0xEF7D, 0xEF5C, 0xE73C, 0xE6FB, 0xDEFB, 0x8008, 0xE71C, 0x000B, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xEF5D,
+0xEF7D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF3C, 0x8005, 0xEF5C, 0x0003, 0xEF3C, 0xE73C, 0xE71B, 0x8005, 0xDEFB, 0x0007, 0xE71B,
+0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0x8003, 0xE73C, 0x000E, 0xEF3C, 0xEF5C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF5C, 0xEF5D,
+0xF77D, 0xF79E, 0xF7BE, 0xEF7D, 0xEF5D, 0xEF5D, 0xF77D, 0x8004, 0xF79E, 0x0004, 0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0x8004, 0xF79E,
+0x000E, 0xEF5D, 0xE71C, 0xF79E, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xEF7D, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0x8056,
+0xFFFF, 0x0001, 0xFFDF, 0x8003, 0xFFDE, 0x0020, 0xF79E, 0xF79E, 0xEF7D, 0xF79E, 0xFFDE, 0xF77D, 0xE73C, 0xF79D, 0xEF7D, 0xFFDE,
+0xEF5D, 0xF79D, 0xEF7D, 0xEF5D, 0xF79D, 0xEF5C, 0xEF5C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF7D, 0xE73C, 0xE71C, 0xE71C, 0xF79E, 0xE73C,
+0xE73C, 0xEF3C, 0xE71C, 0xDEDB, 0xE71B, 0xE6FB, 0x8005, 0xE71C, 0x0001, 0xE6FB, 0x8003, 0xDEFB, 0x000C, 0xE71B, 0xE73C, 0xEF5C,
+0xE73C, 0xE71B, 0xE6FB, 0xE71B, 0xEF3C, 0xEF5C, 0xEF5C, 0xE73C, 0xE71B, 0x8003, 0xE6FB, 0x8004, 0xE73C, 0x0005, 0xE71C, 0xE71B,
+0xE71B, 0xE71C, 0xE71B, 0x8004, 0xE73C, 0x0003, 0xEF5C, 0xEF5C, 0xE73C, 0x8004, 0xE71C, 0x0005, 0xE71B, 0xE73C, 0xEF5C, 0xE73C,
+0xE71C, 0x8003, 0xE71B, 0x000A, 0xE71C, 0xE71B, 0xE73C, 0xEF3C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF3C, 0xEF3C, 0xEF5D, 0x8003, 0xEF7D,
+0x001C, 0xEF5D, 0xE73C, 0xE71B, 0xEF5D, 0xEF7D, 0xEF5D, 0xE73C, 0xE71B, 0xE71C, 0xEF3C, 0xEF5C, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF7D,
+0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xEF7D, 0xFFDE, 0xF79E, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFDF, 0x8004, 0xFFFF, 0x0001,
+0xFFDF, 0x800C, 0xFFFF, 0x0001, 0xFFDF, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x800A, 0xFFFF, 0x0004, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF,
+0x8036, 0xFFFF, 0x0019, 0xFFDE, 0xF79D, 0xFFFF, 0xEF5D, 0xFFDE, 0xF79D, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79D, 0xEF7D, 0xF77D,
+0xFFBE, 0xF79E, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF5C, 0xEF7D, 0xEF5D, 0xEF5C, 0xE73C, 0xE71C, 0x8003, 0xE73C, 0x0004, 0xEF7D,
+0xEF7D, 0xEF3C, 0xE71B, 0x8003, 0xEF5C, 0x0005, 0xE71C, 0xE71C, 0xDEFB, 0xE71B, 0xE71C, 0x8005, 0xE73C, 0x000A, 0xE71C, 0xE73C,
+0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xEF5C, 0xE73C, 0xE73C, 0x8004, 0xEF3C, 0x0002, 0xEF5C, 0xEF5C, 0x8003, 0xE71B, 0x0020,
+0xE6FB, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xEF5C, 0xE73C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xEF7D, 0xEF5C, 0xE73C,
+0xE71B, 0xF77D, 0xEF3C, 0xE6FB, 0xDEFB, 0xE71C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF5C, 0xE73C, 0xEF3C, 0xEF5C,
+0x8009, 0xE73C, 0x000C, 0xEF7D, 0xF79D, 0xF79D, 0xEF5D, 0xE73C, 0xEF5C, 0xEF7D, 0xF79D, 0xF77D, 0xEF7D, 0xEF5D, 0xEF5D, 0x8003,
+0xEF7D, 0x000C, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79D, 0xEF7D, 0xFFFF, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFDF, 0x8012, 0xFFFF,
+0x0001, 0xFFDF, 0x800C, 0xFFFF, 0x0001, 0xFFDF, 0x8037, 0xFFFF, 0x0008, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79D, 0xF79E, 0xF7BE, 0xF79E,
+0xEF5C, 0x8003, 0xF79E, 0x0015, 0xEF7D, 0xF77D, 0xF7BE, 0xF79D, 0xE73C, 0xF77D, 0xF79E, 0xEF7D, 0xEF5D, 0xEF3C, 0xE73C, 0xF77D,
+0xEF5D, 0xEF5D, 0xEF7D, 0xE73C, 0xE73C, 0xEF5D, 0xEF7D, 0xE71C, 0xEF5C, 0x8003, 0xE73C, 0x0009, 0xE71C, 0xDEFB, 0xE73C, 0xE71C,
+0xE73C, 0xEF5C, 0xEF5D, 0xEF5C, 0xE73C, 0x8003, 0xE71C, 0x0006, 0xEF5D, 0xEF5C, 0xEF5C, 0xEF7D, 0xEF3C, 0xE71B, 0x8008, 0xE73C,
+0x000D, 0xE71C, 0xE73C, 0xEF3C, 0xEF3C, 0xE71C, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0x8003, 0xE71B,
+0x0004, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0x8004, 0xE73C, 0x0005, 0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0x8005, 0xE73C, 0x000D,
+0xEF5D, 0xEF7D, 0xEF7D, 0xF77D, 0xEF7D, 0xEF5C, 0xEF5C, 0xEF3C, 0xEF3C, 0xEF5C, 0xEF7D, 0xF79E, 0xF79E, 0x8005, 0xF79D, 0x0006,
+0xF79E, 0xF79D, 0xF77D, 0xEF7D, 0xEF5D, 0xEF5D, 0x8003, 0xEF7D, 0x000C, 0xF79D, 0xF77D, 0xF79D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFDE,
+0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDF, 0x800D, 0xFFFF, 0x0001, 0xFFDF, 0x800F, 0xFFFF, 0x0001, 0xFFDF, 0x8004, 0xFFFF, 0x0001,
+0xF7BE, 0x8031, 0xFFFF, 0x002A, 0xF7BE, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFBE, 0xF79D, 0xFFDE, 0xEF7D,
+0xF79D, 0xF77D, 0xF79D, 0xEF7D, 0xF79D, 0xF79D, 0xF77D, 0xE73C, 0xEF7D, 0xEF5D, 0xEF5C, 0xF79E, 0xEF5C, 0xE71C, 0xEF5D, 0xF7BE,
+0xE73C, 0xEF5C, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF5D, 0xE73C, 0xE6FB, 0xEF5C, 0xE71C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0x8003, 0xE73C,
+0x000B, 0xE71C, 0xE71C, 0xE71B, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xEF3C, 0xEF3C, 0xE73C, 0xEF5C, 0x8004, 0xE71B, 0x0001, 0xE71C,
+0x8003, 0xE73C, 0x0013, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEDA, 0xDEDB, 0xE73C, 0xE73C,
+0xE71C, 0xEF3C, 0xF79D, 0xF79D, 0xEF7D, 0xEF5C, 0x8003, 0xE73C, 0x0009, 0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF5C, 0xE73C,
+0xE71C, 0xE71C, 0x8003, 0xE73C, 0x000E, 0xEF3C, 0xEF3C, 0xEF5C, 0xEF5C, 0xEF7D, 0xF77D, 0xEF7D, 0xEF3C, 0xE71C, 0xE71C, 0xF79D,
+0xEF7D, 0xEF5D, 0xEF5D, 0x8003, 0xEF7D, 0x0002, 0xF77D, 0xF79D, 0x8003, 0xF79E, 0x0009, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xFFBE,
+0xFFDE, 0xF79E, 0xF7BE, 0xF79D, 0x8016, 0xFFFF, 0x0001, 0xFFDF, 0x8046, 0xFFFF, 0x002B, 0xF79E, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDF,
+0xFFBE, 0xF7BE, 0xF79E, 0xFFDE, 0xEF5C, 0xF79E, 0xEF7D, 0xF77D, 0xEF5D, 0xF77D, 0xF77D, 0xF79E, 0xF79D, 0xEF7D, 0xEF5C, 0xEF7D,
+0xEF5D, 0xEF5C, 0xE73C, 0xEF5C, 0xEF7D, 0xE71C, 0xE73C, 0xEF5C, 0xEF3C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xEF5D, 0xEF3C, 0xE73C,
+0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0x8003, 0xE73C, 0x001B, 0xE71B, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xE73C, 0xEF5C,
+0xE73C, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE73C, 0xE73C, 0xE71B,
+0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0x8004, 0xE71C, 0x0001, 0xE6FB, 0x8004, 0xE71B, 0x000D, 0xDEFB, 0xE73C, 0xEF7D, 0xF77D, 0xEF7D,
+0xEF7D, 0xF79D, 0xF79E, 0xE71B, 0xE6FB, 0xE71C, 0xEF5D, 0xEF7D, 0x8003, 0xEF5D, 0x0020, 0xE73C, 0xEF5D, 0xF79D, 0xF7BE, 0xF79E,
+0xF77D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0xF79E, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF7D, 0xF79E, 0xF7BE, 0xFFBE, 0xF7BE,
+0xF79D, 0xEF7D, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF5D, 0xEF7D, 0xFFDF, 0xF79E, 0xF7BE, 0xFFDE, 0x8057, 0xFFFF, 0x0001, 0xFFDF, 0x8003,
+0xFFFF, 0x002E, 0xFFDE, 0xFFDF, 0xF79D, 0xFFFF, 0xEF3C, 0xEF7D, 0xEF7D, 0xF79E, 0xEF7D, 0xFFBE, 0xEF5D, 0xF77D, 0xF79D, 0xF79D,
+0xEF7D, 0xEF7D, 0xF79E, 0xEF5C, 0xE71C, 0xEF7D, 0xEF5C, 0xEF5C, 0xEF7D, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xE71B, 0xEF5C, 0xEF5D,
+0xEF3C, 0xE73C, 0xE73C, 0xDEFB, 0xE73C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xEF3C, 0xEF3C, 0xEF5D,
+0x8003, 0xE71B, 0x0005, 0xE6FB, 0xEF5C, 0xF79E, 0xEF7D, 0xEF3C, 0x8003, 0xEF5C, 0x0034, 0xEF3C, 0xE73C, 0xEF3C, 0xEF3C, 0xF79D,
+0xF79E, 0xF79D, 0xEF7D, 0xEF3C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB, 0xE71C, 0xE71C, 0xDEFB, 0xE71B, 0xEF3C, 0xE71C,
+0xE71C, 0xE71B, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xEF5D, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF5D,
+0xEF5C, 0xEF5C, 0xEF3C, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0xFFDE, 0xFFBE, 0xF77D, 0x8003,
+0xEF5D, 0x0015, 0xEF3C, 0xEF5D, 0xEF7D, 0xF79E, 0xF7BE, 0xF79E, 0xF79D, 0xF77D, 0xF77D, 0xF79D, 0xF79D, 0xEF7D, 0xF7BE, 0xFFDF,
+0xF7BE, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0x800D, 0xFFFF, 0x0006, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF,
+0x800A, 0xFFFF, 0x0001, 0xFFDF, 0x8035, 0xFFFF, 0x0001, 0xFFDF, 0x8003, 0xF7BE, 0x002A, 0xFFDE, 0xF7BE, 0xF7BE, 0xF77D, 0xF79D,
+0xF79E, 0xF7BE, 0xF7BE, 0xEF7D, 0xF79D, 0xEF5D, 0xF7BE, 0xEF5D, 0xEF5C, 0xF79E, 0xE73C, 0xEF3C, 0xF79D, 0xEF5C, 0xE71C, 0xEF7D,
+0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xEF5C, 0xEF3C, 0xE73C, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF3C, 0xE71B,
+0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0x8003, 0xE73C, 0x0008, 0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE71C, 0xE73C, 0xE6FB,
+0x8005, 0xE73C, 0x8003, 0xE71C, 0x0004, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0x8003, 0xE73C, 0x0004, 0xE71C, 0xE71B, 0xE73C, 0xE73C,
+0x8003, 0xE71C, 0x000B, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xEF5C, 0xEF7D, 0xF79D, 0xEF7D, 0xEF5D, 0x8003, 0xEF5C,
+0x0009, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C, 0xE73C, 0xEF3C, 0xEF5D, 0xEF5D, 0xEF5C, 0x8004, 0xEF5D, 0x0003, 0xEF7D, 0xF79D, 0xF79D,
+0x8003, 0xEF7D, 0x0004, 0xEF5C, 0xEF5C, 0xEF7D, 0xF79D, 0x8005, 0xF79E, 0x8003, 0xF79D, 0x000A, 0xF79E, 0xF77D, 0xEF5D, 0xF77D,
+0xFFDE, 0xF7BE, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFDF, 0x8014, 0xFFFF, 0x0003, 0x2945, 0x2104, 0x2104, 0x8008, 0x18E3, 0x0003, 0x2104,
+0x18C3, 0x2104, 0x8038, 0xFFFF, 0x0017, 0xF79D, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF5D, 0xE73C,
+0xF79E, 0xEF5C, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF7D, 0xEF5C, 0xF77D, 0xEF7D, 0xE71C, 0xEF7D, 0xE71B, 0x8004, 0xE73C, 0x0007, 0xEF5D,
+0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xEF5C, 0x8004, 0xE71C, 0x0002, 0xE73C, 0xE73C, 0x8003, 0xE71C, 0x0003, 0xE71B, 0xE6FB,
+0xE71C, 0x800C, 0xE73C, 0x0005, 0xEF3C, 0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0x8003, 0xEF3C, 0x0006, 0xE73C, 0xE71C, 0xE6FB, 0xE71C,
+0xE71C, 0xE71B, 0x8003, 0xDEFB, 0x0026, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xDEDA, 0xE71B, 0xEF5C, 0xEF7D, 0xEF7D,
+0xEF5C, 0xEF5C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF5C, 0xEF5D, 0xF77D, 0xF79D, 0xF79E, 0xF77D, 0xEF5C, 0xEF5C, 0xEF5D,
+0xF79E, 0xF79E, 0xF79D, 0xFFFF, 0xFFDE, 0xFFBE, 0xF79D, 0xF77D, 0xEF7D, 0xF79E, 0xF7BE, 0x8003, 0xF79E, 0x0009, 0xF7BE, 0xF7BE,
+0xF79D, 0xEF7D, 0xEF7D, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFDE, 0x8003, 0xFFDF, 0x0003, 0xFFFF, 0xFFFF, 0xFFDF, 0x8009, 0xFFFF, 0x0001,
+0xFFDF, 0x8005, 0xFFFF, 0x0007, 0xFFDF, 0xFFFF, 0x9492, 0x2104, 0x18E3, 0x2104, 0x2104, 0x8008, 0x18E3, 0x000A, 0x18E4, 0x18E4,
+0x18C3, 0x18C3, 0x8410, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0x802B, 0xFFFF, 0x8003, 0xFFDF, 0x0030, 0xFFDE, 0xFFFF, 0xFFFF,
+0xF79E, 0xFFDF, 0xFFBE, 0xF79D, 0xEF7D, 0xF79D, 0xF79D, 0xF7BE, 0xEF5D, 0xEF7D, 0xF79E, 0xEF7D, 0xE73C, 0xE73C, 0xEF7D, 0xEF5D,
+0xEF5C, 0xEF5D, 0xEF5D, 0xEF5C, 0xEF3C, 0xEF5D, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xE71B, 0xE73C, 0xE71B, 0xEF7D,
+0xEF7D, 0xEF5C, 0xE73C, 0xEF5D, 0xEF3C, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xEF3C, 0xEF5C, 0x8003, 0xE73C, 0x0005,
+0xEF3C, 0xE73C, 0xE71C, 0xE73C, 0xEF3C, 0x8003, 0xE73C, 0x0002, 0xE71C, 0xE71B, 0x8003, 0xE6FB, 0x0004, 0xE71B, 0xE71B, 0xE71C,
+0xE71C, 0x8003, 0xE73C, 0x0004, 0xEF3C, 0xE71C, 0xE73C, 0xE73C, 0x8003, 0xE71C, 0x000C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B,
+0xE71B, 0xEF5C, 0xE73C, 0xE71B, 0xE6FB, 0xE71C, 0xEF3C, 0x8003, 0xEF5D, 0x8004, 0xEF7D, 0x0006, 0xF79D, 0xF79E, 0xF7BE, 0xFFDE,
+0xF7BE, 0xF79E, 0x8003, 0xEF7D, 0x0001, 0xF77D, 0x8004, 0xEF7D, 0x0014, 0xEF5C, 0xEF7D, 0xEF7D, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDF,
+0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xEF7D, 0xEF7D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79D, 0xFFDE, 0xFFFF, 0xFFBE, 0x8004, 0xFFFF, 0x0001,
+0xFFDF, 0x8006, 0xFFFF, 0x0001, 0xFFDF, 0x8005, 0xFFFF, 0x0007, 0x6B4D, 0x2104, 0x18C3, 0x2124, 0x18C3, 0x18E3, 0x18C3, 0x8009,
+0x18E3, 0x0010, 0x2104, 0x18C3, 0x2104, 0x20E4, 0x20E3, 0x18C3, 0x20E3, 0x52AA, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE,
+0xFFFF, 0xFFDE, 0x8023, 0xFFFF, 0x0025, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFBE, 0xF77D, 0xF79E, 0xEF5D, 0xEF7D, 0xF79D,
+0xFFDE, 0xF7BE, 0xEF5C, 0xFFBE, 0xEF7D, 0xEF5C, 0xEF7D, 0xEF5C, 0xF79E, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF5C, 0xE73C,
+0xEF5C, 0xEF5C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF5C, 0xEF7D, 0xE71C, 0xE71C, 0xEF5D, 0x8004, 0xE73C, 0x0004, 0xE71B, 0xE73C, 0xE71C,
+0xEF5C, 0x8008, 0xE71C, 0x0008, 0xE73C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0x8005, 0xE71C, 0x0005, 0xE71B,
+0xE71B, 0xE71C, 0xE71B, 0xE71B, 0x8004, 0xDEFB, 0x0003, 0xE71B, 0xE71C, 0xE71B, 0x8004, 0xE71C, 0x000C, 0xE73C, 0xE73C, 0xE71C,
+0xE73C, 0xE73C, 0xEF3C, 0xEF5C, 0xF79D, 0xEF7D, 0xEF3C, 0xE73C, 0xEF5C, 0x8003, 0xEF7D, 0x000F, 0xF77D, 0xEF7D, 0xEF7D, 0xEF5C,
+0xE73C, 0xEF3C, 0xEF5C, 0xEF5C, 0xE71B, 0xE73C, 0xEF7D, 0xEF7D, 0xF79D, 0xEF7D, 0xF77D, 0x8003, 0xEF7D, 0x0015, 0xF79E, 0xF79E,
+0xF7BE, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFDF, 0xF7BE,
+0xFFFF, 0xFFFF, 0xF79E, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8006, 0xFFFF, 0x0001, 0xFFDF, 0x8004, 0xFFFF, 0x000A, 0x2104, 0x18E3,
+0x2104, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x2104, 0x2104, 0x8008, 0x18E3, 0x000F, 0x18C3, 0x18E3, 0x2104, 0x18C3, 0x18C3,
+0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x39C7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFDE, 0x8024, 0xFFFF, 0x0003, 0xFFDF, 0xFFFF, 0xFFFF,
+0x8003, 0xFFDF, 0x0031, 0xF79E, 0xFFDF, 0xFFBE, 0xFFDE, 0xF7BE, 0xFFBE, 0xF77D, 0xF7BE, 0xE73C, 0xFFFF, 0xFFDE, 0xE73C, 0xE73C,
+0xEF5C, 0xEF7D, 0xF79E, 0xE73C, 0xE71C, 0xEF5C, 0xEF5D, 0xEF5C, 0xEF5C, 0xE71C, 0xE73C, 0xEF7D, 0xE73C, 0xE71B, 0xEF7D, 0xEF5D,
+0xE71C, 0xE71C, 0xE71B, 0xEF7D, 0xE71B, 0xF79D, 0xE71C, 0xF79D, 0xDEDB, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF5D,
+0xEF5D, 0xEF7D, 0xEF5C, 0xE71C, 0x8009, 0xDEFB, 0x8005, 0xE6FB, 0x000F, 0xEF3C, 0xEF3C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE6FB,
+0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0x8003, 0xE71B, 0x0002, 0xE71C, 0xE73C, 0x8003, 0xEF5D, 0x0032,
+0xEF3C, 0xEF3C, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79E, 0xF79E, 0xF79D, 0xF77D, 0xEF7D, 0xF77D, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xE73C,
+0xEF7D, 0xEF5D, 0xFFFF, 0xFFDF, 0xFFFF, 0xF79E, 0xF79D, 0xF79D, 0xEF7D, 0xF77D, 0xF77D, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF,
+0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFFF, 0xF79D, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF,
+0xFFFF, 0xFFDF, 0x8003, 0xFFFF, 0x0010, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0x31A6, 0x2104, 0x18E3, 0x18E3, 0x10A2, 0x2124, 0x2104,
+0x18E3, 0x2104, 0x2104, 0x18E3, 0x10A2, 0x8008, 0x18E3, 0x0001, 0x2104, 0x8003, 0x18E3, 0x0008, 0x2103, 0x18C3, 0x2104, 0x18E3,
+0x2124, 0x18E3, 0xB575, 0xDEBA, 0x8004, 0xFFDE, 0x8026, 0xFFFF, 0x000C, 0xFFDE, 0xFFBE, 0xF79E, 0xF79D, 0xF79E, 0xF77D, 0xF7BE,
+0xF79E, 0xF79D, 0xF77D, 0xEF5C, 0xF79D, 0x8003, 0xEF7D, 0x0006, 0xEF5D, 0xF79E, 0xE71B, 0xEF5D, 0xE73C, 0xE73C, 0x8003, 0xEF3C,
+0x0006, 0xEF5C, 0xE73C, 0xE71C, 0xEF7D, 0xEF5D, 0xDEFB, 0x8004, 0xE73C, 0x0007, 0xE71B, 0xE71B, 0xEF5C, 0xDEDB, 0xEF7D, 0xE6FB,
+0xE71B, 0x8003, 0xDEFB, 0x0003, 0xE71B, 0xE71B, 0xE71C, 0x8005, 0xE73C, 0x0003, 0xEF3C, 0xEF3C, 0xE73C, 0x8003, 0xE71C, 0x0002,
+0xE6FB, 0xE6FB, 0x8003, 0xE71B, 0x8003, 0xE71C, 0x0004, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0x8003, 0xE71C, 0x0002, 0xE71B, 0xE71C,
+0x8006, 0xE71B, 0x0023, 0xE6FB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xEF3C, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D,
+0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79D, 0xEF7D, 0xEF5D, 0xEF3C, 0xEF7D, 0xFFFF, 0xFFBE, 0xFFFF, 0xF77D, 0xF7BE, 0xF79D,
+0xEF5D, 0xEF7D, 0xF79E, 0xF79E, 0xFFBE, 0xF7BE, 0x8003, 0xFFDE, 0x0004, 0xF7BE, 0xF79D, 0xF79E, 0xFFDE, 0x8003, 0xFFFF, 0x0008,
+0xF7BE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFDF, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8006, 0xFFFF, 0x000C, 0xF7BE,
+0x6B4D, 0x2104, 0x18E3, 0x18C3, 0x18E3, 0x2104, 0x18C3, 0x18C3, 0x2104, 0x18E3, 0x18C3, 0x8010, 0x18E3, 0x000B, 0x2104, 0x18E3,
+0x18E3, 0x20E4, 0x20E3, 0x83CE, 0x62CB, 0xEEFB, 0xFF9D, 0xFFDE, 0xFFDF, 0x8023, 0xFFFF, 0x000D, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE,
+0xFFDF, 0xFFDE, 0xFFDE, 0xF79D, 0xF7BE, 0xF79E, 0xF7BE, 0xF77D, 0xFFBE, 0x8003, 0xEF5C, 0x001A, 0xF79D, 0xEF5C, 0xE71C, 0xEF5C,
+0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF5C, 0xEF5D, 0xEF5D, 0xE73C, 0xE73C, 0xE71B, 0xE73C, 0xEF5C,
+0xF79D, 0xF79D, 0xEF7D, 0xEF5D, 0xE73C, 0xEF5C, 0x8004, 0xE71C, 0x000B, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B,
+0xE71B, 0xE71C, 0xE73C, 0xE73C, 0x8003, 0xE71C, 0x8003, 0xDEFB, 0x0002, 0xE6FB, 0xE71B, 0x8003, 0xE71C, 0x8004, 0xDEFB, 0x0006,
+0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xEF5C, 0xEF3C, 0x8003, 0xE73C, 0x0003, 0xE71C, 0xE71B, 0xE71B, 0x8006, 0xE73C, 0x8005, 0xEF5C,
+0x8003, 0xE73C, 0x0002, 0xEF5C, 0xEF7D, 0x8004, 0xF79D, 0x000B, 0xF79E, 0xF79D, 0xEF5C, 0xEF5D, 0xEF5C, 0xF79D, 0xF77D, 0xF77D,
+0xFFFF, 0xFFDE, 0xF7BE, 0x8003, 0xEF5D, 0x0003, 0xF79E, 0xFFDE, 0xFFDE, 0x8009, 0xFFFF, 0x0006, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE,
+0xFFFF, 0xFFDF, 0x800A, 0xFFFF, 0x000D, 0x2104, 0x18E3, 0x18C3, 0x18C3, 0x2124, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x10A2,
+0x18E3, 0x2104, 0x800A, 0x18E3, 0x0003, 0x1904, 0x1903, 0x1903, 0x8005, 0x18E3, 0x0007, 0x2104, 0x18C3, 0x28E3, 0xB534, 0x62AA,
+0xE699, 0xFF7C, 0x8024, 0xFFFF, 0x000E, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF, 0xF79E, 0xF77D, 0xF7BE, 0xF79E, 0xF79D, 0xF79E, 0xFFDF,
+0xEF5C, 0xEF3C, 0xE71B, 0x8004, 0xEF5C, 0x000B, 0xF79D, 0xF79E, 0xEF5D, 0xEF5D, 0xE71C, 0xE73C, 0xEF5D, 0xE73C, 0xE71C, 0xEF5C,
+0xEF7D, 0x8003, 0xE73C, 0x000E, 0xEF3C, 0xEF5C, 0xEF3C, 0xDEFB, 0xDEFB, 0xDEDA, 0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE71B,
+0xE71C, 0xE71C, 0x8003, 0xE71B, 0x000B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C,
+0x8009, 0xE73C, 0x0002, 0xE71C, 0xE71C, 0x800D, 0xE73C, 0x000F, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xF79D, 0xEF7D, 0xEF5C, 0xE73C,
+0xE73C, 0xEF5C, 0xEF5D, 0xEF7D, 0xF79D, 0xF79D, 0xF77D, 0x8003, 0xF79D, 0x0004, 0xF7BE, 0xFFBE, 0xF7BE, 0xF7BE, 0x8003, 0xF79D,
+0x000B, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0x8004, 0xFFDE, 0x000D, 0xFFDF,
+0xFFFF, 0xFFDF, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0x8005, 0xFFFF, 0x000A, 0xFFDF,
+0xFFFF, 0xFFFF, 0x10A2, 0x18E3, 0x18C3, 0x2104, 0x2104, 0x10A2, 0x2104, 0x8004, 0x18E3, 0x0004, 0x2104, 0x2104, 0x18C3, 0x2104,
+0x8008, 0x18E3, 0x0003, 0x1904, 0x18E3, 0x18C3, 0x8004, 0x18E3, 0x000C, 0x2104, 0x18C3, 0x18A3, 0x2904, 0x20A2, 0x1841, 0xA4B1,
+0x6AA9, 0xC595, 0xF71B, 0xF77D, 0xFFBE, 0x801F, 0xFFFF, 0x0003, 0xFFDF, 0xFFFF, 0xF7BE, 0x8003, 0xFFDE, 0x0011, 0xFFDF, 0xF77D,
+0xF79E, 0xF77D, 0xEF5D, 0xEF5C, 0xF79E, 0xE71C, 0xEF5C, 0xEF5C, 0xE71B, 0xE73C, 0xF77D, 0xE73C, 0xE73C, 0xEF5C, 0xEF5C, 0x8003,
+0xEF7D, 0x0007, 0xEF5D, 0xE73C, 0xEF3C, 0xEF5D, 0xE71C, 0xE73C, 0xEF5C, 0x8003, 0xE73C, 0x000B, 0xEF3C, 0xE6FB, 0xEF5C, 0xE6FB,
+0xEF3C, 0xE71B, 0xEF3C, 0xDEFB, 0xE71C, 0xE6FB, 0xE71C, 0x8003, 0xE71B, 0x000C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0xE71C, 0xE71B,
+0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0x8008, 0xE71C, 0x0003, 0xE6FB, 0xE71B, 0xE71C, 0x8003, 0xE73C, 0x0005, 0xE71C,
+0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0x8003, 0xE71C, 0x000E, 0xE73C, 0xEF3C, 0xEF5C, 0xEF5C, 0xE73C, 0xE73C, 0xF79D, 0xF77D, 0xEF7D,
+0xEF5D, 0xEF5C, 0xEF5C, 0xEF3C, 0xEF3C, 0x8006, 0xEF7D, 0x0018, 0xF79D, 0xF7BE, 0xF79E, 0xF77D, 0xEF5D, 0xEF3C, 0xEF7D, 0xF7BE,
+0xFFFF, 0xFFFF, 0xF7BE, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFBE, 0xF7BE, 0xF79E, 0xFFBE, 0xF7BE, 0xF79D, 0xF79D, 0xF7BE, 0xFFDF,
+0x8003, 0xFFFF, 0x0004, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFDF, 0x8009, 0xFFFF, 0x0009, 0xFFDF, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x18E3,
+0x18C3, 0x18C3, 0x2104, 0x8003, 0x18E3, 0x0001, 0x2104, 0x800E, 0x18E3, 0x0001, 0x2104, 0x8004, 0x18E3, 0x000E, 0x2104, 0x18E3,
+0x20E4, 0x2104, 0x20C3, 0x20C3, 0x3124, 0x20A1, 0xACF2, 0xACB1, 0xC595, 0xDE59, 0xF75C, 0xFFDF, 0x801C, 0xFFFF, 0x8003, 0xFFDF,
+0x0019, 0xFFFF, 0xF7BE, 0xFFDE, 0xF7BE, 0xF79D, 0xFFDF, 0xF79E, 0xF79D, 0xF77D, 0xF79E, 0xEF7D, 0xF7BE, 0xF79D, 0xF79D, 0xEF5C,
+0xEF7D, 0xE71B, 0xE71B, 0xEF5C, 0xF79D, 0xE71B, 0xE71C, 0xE73C, 0xEF5C, 0xEF7D, 0x8003, 0xEF5D, 0x0013, 0xE71B, 0xE71C, 0xE71C,
+0xEF5D, 0xEF5D, 0xEF5C, 0xE71B, 0xE73C, 0xEF5D, 0xEF5C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xE71C,
+0x8003, 0xE73C, 0x0003, 0xE71B, 0xDEFB, 0xDEDB, 0x8003, 0xE71C, 0x8005, 0xE71B, 0x0005, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C,
+0x8003, 0xE73C, 0x8003, 0xEF7D, 0x0002, 0xEF5C, 0xE73C, 0x8003, 0xE71B, 0x8005, 0xE71C, 0x0002, 0xE71B, 0xE71C, 0x8003, 0xE73C,
+0x001A, 0xEF3C, 0xEF5C, 0xF77D, 0xEF7D, 0xF79D, 0xF7BE, 0xF7BE, 0xEF7D, 0xEF5C, 0xEF5D, 0xF79E, 0xF79D, 0xEF7D, 0xF79D, 0xF79E,
+0xF79E, 0xF79D, 0xEF7D, 0xEF7D, 0xF79E, 0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79E, 0xF79D, 0x8004, 0xF7BE, 0x0001, 0xFFBE, 0x8004,
+0xFFDE, 0x000B, 0xF7BE, 0xF79E, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0x800A, 0xFFFF, 0x0001,
+0xDEDB, 0x8004, 0x18E3, 0x0001, 0x2104, 0x801A, 0x18E3, 0x000F, 0x18E4, 0x18E4, 0x18C3, 0x20E4, 0x18A2, 0x2904, 0x20A2, 0x28E2,
+0xA491, 0x9C70, 0xACD2, 0xDE37, 0xEEFB, 0xF75C, 0xFFDE, 0x801B, 0xFFFF, 0x0030, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79D, 0xF77D, 0xFFDE,
+0xF7BE, 0xF7BE, 0xEF7D, 0xFFBE, 0xEF5C, 0xF7BE, 0xE73C, 0xEF7D, 0xE73C, 0xEF7D, 0xEF7D, 0xEF3C, 0xE73C, 0xEF7D, 0xEF5C, 0xDEFB,
+0xEF5C, 0xDEFB, 0xEF5D, 0xE71C, 0xEF5D, 0xEF5D, 0xEF7D, 0xE73C, 0xE73C, 0xEF5D, 0xE73C, 0xEF5D, 0xE71C, 0xE73C, 0xEF3C, 0xEF3C,
+0xEF5D, 0xDEDB, 0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xDEDA, 0xE73C, 0xE71C, 0xDEFB, 0x8003, 0xE6FB, 0x0002, 0xDEFB, 0xDEFB, 0x8003,
+0xE6FB, 0x0008, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71B, 0x8003, 0xEF5C, 0x0009, 0xEF3C, 0xE73C, 0xE73C,
+0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0x8003, 0xE71C, 0x0005, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0x8003, 0xDEFB,
+0x0005, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0x8004, 0xEF7D, 0x0022, 0xF77D, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E,
+0xF79D, 0xEF7D, 0xEF7D, 0xF77D, 0xF79D, 0xF79E, 0xF79D, 0xF77D, 0xEF7D, 0xF77D, 0xF79D, 0xF79D, 0xF77D, 0xFFDE, 0xF7BE, 0xF79E,
+0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xF7BE, 0xF79E, 0xF79D, 0xF79E, 0xF7BE, 0xFFDF, 0x800F, 0xFFFF, 0x0002, 0x18E3, 0x2104,
+0x8003, 0x18E3, 0x0004, 0x2104, 0x18E3, 0x2104, 0x18C3, 0x8012, 0x18E3, 0x8004, 0x20E3, 0x0002, 0x18E3, 0x18E3, 0x8003, 0x18E4,
+0x000C, 0x2104, 0x20E4, 0x20E3, 0x20C2, 0x20C2, 0x1860, 0x9C70, 0x5A27, 0xA470, 0xB513, 0xDE78, 0xE6FB, 0x8014, 0xFFFF, 0x0001,
+0xFFDF, 0x8004, 0xFFFF, 0x0016, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79D, 0xF79D, 0xFFDE, 0xF7BE, 0xF79D, 0xFFDE, 0xF79D,
+0xEF7D, 0xEF5C, 0xF77D, 0xF79D, 0xEF7D, 0xE73C, 0xEF5C, 0xEF5C, 0xE71B, 0xE71B, 0x8005, 0xE73C, 0x0020, 0xEF5C, 0xEF5D, 0xE71C,
+0xE73C, 0xE71B, 0xEF5C, 0xE73C, 0xE73C, 0xE71B, 0xEF3C, 0xEF7D, 0xEF5C, 0xE71B, 0xE71B, 0xEF5D, 0xDEDB, 0xE71C, 0xE6FB, 0xE73C,
+0xDEFB, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0x8004, 0xE71C, 0x0003,
+0xE71B, 0xE71B, 0xE6FB, 0x8004, 0xE73C, 0x8004, 0xE71C, 0x000C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xEF3C, 0xEF5D, 0xEF3C, 0xE71C,
+0xE71B, 0xE71C, 0xE71B, 0xE71B, 0x8003, 0xE73C, 0x0001, 0xEF5C, 0x8004, 0xE73C, 0x0007, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF5C, 0xEF5D,
+0xEF7D, 0xF77D, 0x8003, 0xEF7D, 0x000B, 0xEF5D, 0xEF7D, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xF77D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E,
+0x8003, 0xF79D, 0x0003, 0xFFDE, 0xFFDE, 0xFFDF, 0x8007, 0xFFFF, 0x0002, 0xFFDF, 0xFFDE, 0x8004, 0xFFDF, 0x800C, 0xFFFF, 0x0003,
+0x52AA, 0x18E3, 0x18C3, 0x8019, 0x18E3, 0x0002, 0x20E4, 0x20E4, 0x8003, 0x20E3, 0x8003, 0x18E3, 0x000F, 0x18E4, 0x10A2, 0x18E3,
+0x18A2, 0x2103, 0x20E2, 0x28E2, 0x1860, 0xA470, 0x5A27, 0xA450, 0xBD54, 0xCDF7, 0xE6FB, 0xF79E, 0x8013, 0xFFFF, 0x0026, 0xFFDE,
+0xFFDE, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFFF, 0xF77D, 0xFFBE, 0xFFDE, 0xF79D, 0xF79D, 0xF7BE, 0xEF5C, 0xEF7D, 0xF7BE, 0xEF3C,
+0xEF5C, 0xE71B, 0xE73C, 0xDEFB, 0xF77D, 0xE73C, 0xDEDA, 0xE6FB, 0xDEBA, 0xE71B, 0xE71B, 0xE73C, 0xDEDA, 0xE73C, 0xEF5C, 0xE71C,
+0xEF5D, 0xEF3C, 0xE73C, 0xF77D, 0xF77D, 0x8003, 0xE73C, 0x001D, 0xE6FB, 0xE6FB, 0xEF5C, 0xEF5D, 0xE73C, 0xE71C, 0xE71B, 0xDEDB,
+0xE71B, 0xDEBA, 0xE71C, 0xEF3C, 0xEF7D, 0xEF5D, 0xE73C, 0xE6FB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB,
+0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0x8003, 0xE73C, 0x0002, 0xE71C, 0xE71B, 0x8003, 0xDEFB, 0x000E, 0xE71C, 0xE71B, 0xE6FB,
+0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xEF5C, 0xEF3C, 0x8003, 0xE71C, 0x000A, 0xE73C, 0xEF5C,
+0xEF5C, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF7D, 0xF79E, 0xF79E, 0x8004, 0xF79D, 0x0011, 0xEF7D, 0xEF5C, 0xEF5D, 0xF79E, 0xFFDF,
+0xFFDE, 0xF7BE, 0xF77D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF, 0x8003, 0xFFFF, 0x0001, 0xFFDF,
+0x8006, 0xFFFF, 0x8006, 0xFFDF, 0x8007, 0xFFFF, 0x0004, 0xFFDF, 0x18E3, 0x2124, 0x10A2, 0x8004, 0x18E3, 0x0001, 0x2104, 0x8014,
+0x18E3, 0x0002, 0x18E4, 0x18E4, 0x8003, 0x20E3, 0x8003, 0x18E3, 0x000F, 0x2104, 0x2104, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20C2,
+0x1860, 0xA46F, 0x5A06, 0x8BCD, 0xACF2, 0xBD95, 0xDE99, 0xFF9E, 0x8014, 0xFFFF, 0x0045, 0xFFBE, 0xFFFF, 0xFFDE, 0xFFBE, 0xFFBE,
+0xF77D, 0xF79E, 0xF79E, 0xF77D, 0xF79D, 0xEF5C, 0xEF7D, 0xFFDE, 0xF7BE, 0xF77D, 0xEF5C, 0xEF5C, 0xE71B, 0xEF5C, 0xDEFB, 0xE71B,
+0xE71B, 0xE6FB, 0xDEDA, 0xEF7D, 0xE71B, 0xDEBA, 0xE73C, 0xE73C, 0xE71B, 0xEF7D, 0xE73C, 0xE71B, 0xE71B, 0xEF3C, 0xEF7D, 0xE71B,
+0xEF7D, 0xE71C, 0xDEFB, 0xEF5C, 0xEF5D, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xEF5D, 0xE71B, 0xDEDB, 0xE71B, 0xE71C, 0xDEDA, 0xDEFB,
+0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF5D, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71B, 0xDEDB, 0xDEDA, 0xDEDB,
+0x8008, 0xE71B, 0x0007, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0x8003, 0xE73C, 0x0001, 0xE71B, 0x8004, 0xDEFB,
+0x0017, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xF79D, 0xF77D, 0xEF5D, 0xEF5C, 0xEF5D, 0xF79D, 0xFFBE, 0xFFDE, 0xF79E, 0xF77D,
+0xEF7D, 0xF77D, 0xF79E, 0xF79E, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0x8003, 0xF79D, 0x0003, 0xF79E, 0xFFBE, 0xFFDF, 0x8003, 0xFFFF,
+0x0008, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0x8005, 0xFFDF, 0x800B, 0xFFFF, 0x000A, 0x18E3, 0x2104,
+0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x2104, 0x8013, 0x18E3, 0x0002, 0x18E4, 0x18E4, 0x8006, 0x18E3, 0x0010,
+0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x1040, 0xA44F, 0xBCF1, 0x5A47, 0xA4B1, 0xB533, 0xC5F6, 0xDEBA, 0xFFBE,
+0x8010, 0xFFFF, 0x0026, 0xFFDE, 0xFFFF, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFFE, 0xF7BD, 0xFFDE, 0xF77D, 0xFFFF, 0xF79E, 0xEF3C, 0xFFBE,
+0xF79D, 0xEF7D, 0xEF7D, 0xEF5C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xDEDA, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xF79D, 0xD699, 0xDEBA,
+0xE6FB, 0xDEFB, 0xEF5C, 0xEF3C, 0xE71B, 0xE73C, 0xE71B, 0xEF5D, 0xE71B, 0x8003, 0xE73C, 0x001C, 0xEF5D, 0xEF3C, 0xE71C, 0xDEFB,
+0xDEFB, 0xE71C, 0xDEFB, 0xE71B, 0xDEDB, 0xDEDB, 0xDEBA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEBA, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB,
+0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0x8003, 0xDEDA, 0x8003, 0xE71C, 0x0002, 0xE71B, 0xDEFB, 0x8003,
+0xDEDB, 0x0010, 0xEF3C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xEF3C, 0xEF3C, 0xE73C, 0xE6FB, 0xDEFB, 0xDEFB,
+0xE6FB, 0xE71C, 0x8003, 0xE71B, 0x0001, 0xE6FB, 0x8008, 0xEF7D, 0x0004, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0x8007, 0xEF7D, 0x000B,
+0xF77D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDF, 0x8014, 0xFFFF, 0x0006, 0x18C3, 0x2124,
+0x18C3, 0x18C3, 0x2104, 0x10A2, 0x8018, 0x18E3, 0x0002, 0x18E4, 0x18E4, 0x8006, 0x18E3, 0x0011, 0x1903, 0x1903, 0x18E3, 0x2104,
+0x18C3, 0x2124, 0x18E3, 0x1860, 0xC573, 0xAC8F, 0xA48F, 0x8BCD, 0xA4D1, 0xAD33, 0xD679, 0xEF5C, 0xFFBE, 0x8011, 0xFFFF, 0x8004,
+0xFFBE, 0x0015, 0xF7BD, 0xFFBE, 0xF79D, 0xF79D, 0xEF5C, 0xF77D, 0xF79E, 0xEF3C, 0xEF7D, 0xF79D, 0xEF7D, 0xEF5C, 0xEF7D, 0xEF3C,
+0xDEDA, 0xDEFB, 0xDEDA, 0xDEDA, 0xE6FB, 0xDEFB, 0xDEDA, 0x8004, 0xDEFB, 0x0002, 0xE71B, 0xDEDA, 0x8003, 0xE71B, 0x001A, 0xDEFB,
+0xE73C, 0xEF3C, 0xEF3C, 0xEF5C, 0xE71C, 0xEF3C, 0xE6FB, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xE73C,
+0xDEDA, 0xD69A, 0xD6BA, 0xD699, 0xD6BA, 0xE6FB, 0xE73C, 0xE71C, 0xDEFB, 0x8003, 0xDEDA, 0x0004, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB,
+0x800A, 0xDEFB, 0x0001, 0xE6FB, 0x8003, 0xE71B, 0x0006, 0xE71C, 0xE71B, 0xE71B, 0xE73C, 0xEF5C, 0xE71B, 0x8004, 0xE73C, 0x001D,
+0xE71C, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xE73C, 0xEF5C, 0xEF7D, 0xF79E, 0xF7BE, 0xF79E, 0xF79D, 0xEF7D, 0xF79E,
+0xF79D, 0xF79D, 0xF79E, 0xF7BE, 0xF79E, 0xEF7D, 0xEF5C, 0xEF5D, 0xF79D, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF, 0x8003, 0xFFDE, 0x0001,
+0xFFDF, 0x8004, 0xFFFF, 0x0001, 0xFFDE, 0x8006, 0xF7BE, 0x0003, 0xFFDE, 0xFFDF, 0xFFFF, 0x8005, 0xFFDF, 0x8004, 0xFFFF, 0x0007,
+0x4208, 0x2104, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x2104, 0x8003, 0x18E3, 0x0003, 0x2104, 0x18E3, 0x2104, 0x8012, 0x18E3, 0x0002,
+0x18E4, 0x18E4, 0x8006, 0x18E3, 0x0012, 0x18C3, 0x1904, 0x18C3, 0x2104, 0x2104, 0x18E3, 0x18C2, 0x1060, 0xC5B4, 0xACD0, 0xACF1,
+0x7B4B, 0x9C90, 0xAD12, 0xCE38, 0xEF1C, 0xFFBE, 0xFFDF, 0x800E, 0xFFFF, 0x001A, 0xFFFE, 0xFFDE, 0xFFFF, 0xF7BD, 0xFFFF, 0xEF7C,
+0xFF9D, 0xEF5C, 0xEF5C, 0xFFBE, 0xF77D, 0xF77D, 0xEF5D, 0xF77D, 0xF79D, 0xE71B, 0x10A2, 0x0020, 0x0840, 0xB595, 0xD6BA, 0xE6FB,
+0xD69A, 0xE6FB, 0xD6BA, 0xD699, 0x8003, 0xDEDA, 0x0020, 0xD699, 0xDEFB, 0xDEDA, 0xE6FB, 0xEF5C, 0xDEFB, 0xF79D, 0xE73C, 0xEF5C,
+0xE73C, 0xEF5C, 0xEF5C, 0xDEFB, 0xE73C, 0xE73C, 0xEF3C, 0xEF5D, 0xDEFB, 0xDEDA, 0xDEFB, 0xD6BA, 0xD6BA, 0xDEDB, 0xDEDA, 0xDEDA,
+0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0x8003, 0xD6BA, 0x0004, 0xDEDB, 0xDEFB, 0xE6FB, 0xDEFB, 0x8003, 0xDEDB,
+0x0008, 0xDEDA, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0x8003, 0xDEFB, 0x0009, 0xE71B, 0xE6FB, 0xDEDB, 0xDEBA,
+0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0x8004, 0xDEFB, 0x0016, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE73C, 0xEF5D, 0xEF7D,
+0xEF7D, 0xF79D, 0xF7BE, 0xFFDF, 0xFFDF, 0xE73C, 0xEF3C, 0xEF5C, 0xEF5D, 0xEF7D, 0xF79D, 0xF79E, 0xF7BE, 0xF79E, 0x8003, 0xF7BE,
+0x0004, 0xF79E, 0xF7BE, 0xF79E, 0xF79E, 0x8004, 0xFFDF, 0x0004, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0x8004, 0xFFDF, 0x800C, 0xFFFF,
+0x0006, 0x8430, 0x2124, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x8006, 0x18E3, 0x0001, 0x2104, 0x8013, 0x18E3, 0x0002, 0x18E4, 0x18E4,
+0x8006, 0x18E3, 0x0012, 0x2104, 0x18C3, 0x1904, 0x2104, 0x18C3, 0x2104, 0x18E3, 0x1060, 0xC593, 0xEED8, 0xACD0, 0x8BCD, 0x83AC,
+0xA4D1, 0xC5F6, 0xE6FA, 0xFFDE, 0xFFDF, 0x8005, 0xFFFF, 0x0001, 0xFFDF, 0x8005, 0xFFFF, 0x0019, 0xFFDF, 0xFFDE, 0xFFDE, 0xF7BE,
+0xFFDE, 0xF79D, 0xFFFF, 0xF79D, 0xFFDE, 0xFFBE, 0xF7BD, 0xF79E, 0xEF3C, 0xF79E, 0xF79E, 0x83EF, 0x10A2, 0x0840, 0x0861, 0x18A2,
+0x1081, 0x1061, 0x0000, 0x8C70, 0xD6BA, 0x8004, 0xDEDA, 0x002E, 0xDEBA, 0xD699, 0xDEDA, 0xDEFB, 0xDEDA, 0xDEFB, 0xDEBA, 0xE71B,
+0xDEFB, 0xE73C, 0xEF7D, 0xE73C, 0xF77D, 0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEDA, 0xD6BA, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB,
+0xD6BA, 0xDEDB, 0xD6BA, 0xDEDB, 0xD6BA, 0xD699, 0xDEDA, 0xD6BA, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEDA,
+0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0x8007, 0xDEFB, 0x0001, 0xE6FB, 0x8004, 0xE71B, 0x0011, 0xE6FB, 0xDEFB, 0xDEFB,
+0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xF79D, 0x8003, 0xEF7D,
+0x0006, 0xF79D, 0xFFBE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0x8004, 0xF79E, 0x0004, 0xF7BE, 0xFFBE, 0xFFDF, 0xF7BE, 0x8003, 0xFFDE,
+0x0006, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79D, 0xF79E, 0xFFBE, 0x8004, 0xFFFF, 0x0001, 0xFFDE, 0x8004, 0xFFDF, 0x800B, 0xFFFF, 0x0003,
+0xFFDF, 0x2104, 0x18C3, 0x8004, 0x18E3, 0x0002, 0x2104, 0x18C3, 0x8008, 0x18E3, 0x0001, 0x2104, 0x800F, 0x18E3, 0x0002, 0x1903,
+0x1903, 0x8004, 0x18E3, 0x8004, 0x18E4, 0x000F, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x20E3, 0x1060, 0xACF0, 0xDE35, 0xE676, 0xB511,
+0x7B6A, 0x9C8F, 0xB573, 0xD699, 0xEF7C, 0x8003, 0xFFFF, 0x0001, 0xF7DE, 0x8009, 0xFFFF, 0x0012, 0xF7BE, 0xFFFF, 0xF7BE, 0xEF5C,
+0xFFFF, 0xEF7D, 0xF79E, 0xF79D, 0xF77D, 0xEF7D, 0xEF7D, 0xB5B6, 0x0840, 0x10A2, 0x1082, 0x1081, 0x10A1, 0x18C2, 0x8003, 0x0861,
+0x0029, 0x0000, 0x8C70, 0xD698, 0xBDD6, 0xD699, 0xC617, 0xD699, 0xD679, 0xCE38, 0xD699, 0xDEBA, 0xDEDA, 0xE71B, 0xE6FB, 0xE6FB,
+0xEF3C, 0xE71B, 0xE71B, 0xEF5C, 0xE71B, 0xEF3C, 0xDEFB, 0xE73C, 0xD6BA, 0xEF3C, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEBA, 0xD679, 0xDEDA,
+0xDEDB, 0xDEDA, 0xDEDB, 0xDEBA, 0xD6BA, 0xDEDA, 0xD6BA, 0xD6BA, 0xDEFB, 0xE6FB, 0x8004, 0xDEFB, 0x0002, 0xDEDB, 0xDEFB, 0x8003,
+0xDEDB, 0x0007, 0xDEFB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0x8003, 0xE6FB, 0x0002, 0xDEFB, 0xE71B, 0x8006, 0xDEFB,
+0x8004, 0xDEDB, 0x8005, 0xDEFB, 0x0006, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xEF5D, 0xEF5D, 0x8003, 0xEF7D, 0x0003, 0xF79D, 0xF79D,
+0xF77D, 0x8006, 0xF79D, 0x0005, 0xF77D, 0xF77D, 0xF79D, 0xF79D, 0xFFDF, 0x8003, 0xFFFF, 0x0002, 0xFFDE, 0xFFDE, 0x8008, 0xFFFF,
+0x0001, 0xFFDF, 0x8003, 0xFFFF, 0x0004, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0x8003, 0xFFFF, 0x0007, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFFF,
+0xFFDF, 0x18C3, 0x2104, 0x8004, 0x18E3, 0x0002, 0x18C3, 0x2104, 0x801C, 0x18E3, 0x8005, 0x18E4, 0x8005, 0x18E3, 0x0027, 0x18C3,
+0x1060, 0xB511, 0xDE55, 0xD614, 0xDE55, 0xB510, 0x942D, 0xAD32, 0xCE36, 0xE71B, 0xF79D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7DE,
+0xFFDE, 0xFFFF, 0xFFBE, 0xFFDE, 0xF79D, 0xF79D, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFDE, 0xEF5C, 0xEF5C, 0xF79E, 0xF7BE, 0xEF5D, 0x18E3,
+0x1082, 0x1081, 0x1081, 0x10A2, 0x10A2, 0x0841, 0x8003, 0x10A2, 0x0018, 0x1081, 0x1082, 0x0841, 0x1061, 0x9470, 0x39C5, 0x9CD2,
+0xB575, 0xB575, 0xBDD6, 0xC617, 0xCE38, 0xD69A, 0xDEBA, 0xD6BA, 0xDEBA, 0xE71B, 0xE6FB, 0xDEDA, 0xEF3C, 0xEF7C, 0xE6FB, 0xEF3C,
+0xEF3C, 0x8004, 0xE71B, 0x0009, 0xD6BA, 0xCE79, 0xD6BA, 0xDEDA, 0xDEDA, 0xD6BA, 0xD679, 0xCE79, 0xDEDB, 0x8003, 0xD6BA, 0x000D,
+0xDEDA, 0xD6BA, 0xDEDA, 0xDEBA, 0xD6BA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDB, 0x8003, 0xDEFB, 0x0001,
+0xDEBA, 0x8003, 0xD6BA, 0x0004, 0xDEBA, 0xDEDA, 0xDEDA, 0xDEBA, 0x8003, 0xDEDA, 0x0002, 0xDEDB, 0xE6FB, 0x8003, 0xE71B, 0x8007,
+0xDEFB, 0x0027, 0xDEDB, 0xDEBA, 0xDEDB, 0xDEFB, 0xE71B, 0xEF7D, 0xF77D, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE, 0xEF7D,
+0xEF7D, 0xF77D, 0xF79E, 0xF7BE, 0xF79E, 0xF79D, 0xF77D, 0xF79D, 0xF79D, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDF, 0xFFFF,
+0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0x8006, 0xFFFF, 0x0001, 0xFFDF, 0x8006, 0xFFFF, 0x0008,
+0x18E3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x801D, 0x18E3, 0x8004, 0x18E4, 0x8006, 0x18E3, 0x0011, 0x18C2,
+0x1060, 0xACAF, 0xE675, 0xDE55, 0xD5F3, 0xC5B3, 0xCDF4, 0x9C8F, 0xBD93, 0xD678, 0xE71B, 0xEF5C, 0xFFDE, 0xFFFF, 0xFFBE, 0xFFDE,
+0x8003, 0xFFFF, 0x003B, 0xF79E, 0xFFDE, 0xFFFF, 0xF77D, 0xF79D, 0xEF7D, 0x5ACB, 0x0841, 0x18C3, 0x0861, 0x1061, 0x10A2, 0x18C3,
+0x1062, 0x10A2, 0x0821, 0x18A3, 0x1082, 0x0861, 0x1082, 0x0861, 0x1081, 0x18C2, 0x18A3, 0x18C3, 0x0020, 0x9470, 0x1060, 0x6B0B,
+0x8C30, 0xAD54, 0xB575, 0xBDB6, 0xC5F7, 0xC618, 0xCE58, 0xD679, 0xD6BA, 0xDEBA, 0xE71B, 0xEF3C, 0xDEDA, 0xE6FB, 0xEF5C, 0xDEBA,
+0xE6FB, 0xE71B, 0xD679, 0xDEDA, 0xD699, 0xD6BA, 0xD6BA, 0xD699, 0xD6BA, 0xD6BA, 0xD69A, 0xD699, 0xCE79, 0xD6BA, 0x8005, 0xD699,
+0x8003, 0xD6BA, 0x8003, 0xDEFB, 0x0008, 0xDEDB, 0xDEDA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDA, 0xD6BA, 0x8003, 0xDEDB, 0x8009,
+0xDEDA, 0x0004, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEBA, 0x8004, 0xDEFB, 0x8003, 0xE71B, 0x0013, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xE71B,
+0xEF5D, 0xEF7D, 0xF7BE, 0xFFDE, 0xF7BE, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xF7BE, 0x8004, 0xF79E,
+0x000B, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDF, 0xEF7D, 0xF77D, 0xF79E, 0xF7BE, 0xFFBE, 0x8003, 0xFFDE, 0x8003, 0xFFFF,
+0x0001, 0xFFDF, 0x8008, 0xFFFF, 0x0003, 0xFFDF, 0xFFFF, 0xFFDF, 0x8004, 0x18E3, 0x0002, 0x2104, 0x18C3, 0x801F, 0x18E3, 0x8004,
+0x18E4, 0x0002, 0x18E3, 0x18E4, 0x8004, 0x18E3, 0x0020, 0x18C3, 0x1881, 0xACCF, 0xC551, 0xD5F3, 0xD5F3, 0xCDD3, 0xDE56, 0xBD73,
+0xB573, 0xBD95, 0xE6DA, 0xF75C, 0xF77D, 0xF79D, 0xFFDE, 0xFFFF, 0xFFBE, 0xF79D, 0xF7BE, 0xF79E, 0xEF7D, 0xEF3C, 0xE71B, 0x2965,
+0x10A2, 0x1081, 0x1081, 0x18C3, 0x0861, 0x18A2, 0x18C3, 0x8003, 0x1082, 0x003F, 0x18A3, 0x0841, 0x1082, 0x1083, 0x1082, 0x0881,
+0x0881, 0x0841, 0x18E3, 0x1082, 0x0000, 0x8C2F, 0x2102, 0x5AA9, 0x9450, 0x9CB2, 0xA513, 0xAD54, 0xB595, 0xBDD6, 0xC617, 0xCE58,
+0xD6BA, 0xDEFB, 0xE71B, 0xEF3C, 0xEF3C, 0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xD6BA, 0xDEDA, 0xD699, 0xDEFB, 0xD6BA, 0xD679,
+0xD699, 0xD679, 0xD6BA, 0xDEDA, 0xD699, 0xD69A, 0xD699, 0xD679, 0xCE79, 0xD699, 0xCE79, 0xCE79, 0xCE59, 0xCE79, 0xDEDA, 0xDEFB,
+0xDEFB, 0xDEDB, 0xD6BA, 0xD69A, 0xD69A, 0xD6BA, 0xDEBA, 0xDEDA, 0xDEDB, 0x8003, 0xD69A, 0x0005, 0xD6BA, 0xDEBA, 0xDEDA, 0xDEDB,
+0xDEDB, 0x800B, 0xDEFB, 0x000D, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xF79D, 0xF77D, 0xF7BE,
+0xF7BE, 0x8003, 0xF79E, 0x0011, 0xF7BE, 0xF7BE, 0xF79D, 0xF77D, 0xF79D, 0xF77D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xF7BE,
+0xFFDE, 0xFFBE, 0xFFDE, 0xF7BE, 0xF7BE, 0x8004, 0xFFFF, 0x8003, 0xFFDF, 0x0006, 0xFFFF, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF,
+0x8007, 0xFFFF, 0x0007, 0xFFDF, 0xFFFF, 0x2104, 0x2104, 0x18E3, 0x18C3, 0x2104, 0x8003, 0x18E3, 0x0001, 0x2104, 0x8019, 0x18E3,
+0x0004, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x8006, 0x18E4, 0x0001, 0x18C3, 0x8004, 0x18E3, 0x0053, 0x18C1, 0x942D, 0xD5F3, 0xDE34,
+0xD614, 0xDE76, 0xD656, 0xC5B4, 0xC5F5, 0xC5F6, 0x9471, 0x6B0B, 0x738D, 0x20E3, 0x1041, 0x0840, 0x0840, 0x0861, 0x18C3, 0x0861,
+0x18C3, 0x10A2, 0x0861, 0x10A2, 0x18C3, 0x0861, 0x1082, 0x0841, 0x10A2, 0x10A2, 0x0841, 0x0861, 0x18C3, 0x1082, 0x10A3, 0x18A3,
+0x1062, 0x1082, 0x0841, 0x1081, 0x1061, 0x18A2, 0x0841, 0x0820, 0x0820, 0x9470, 0x734B, 0x6AEA, 0x7B8D, 0x9450, 0xA4F3, 0xA513,
+0xB575, 0xC5F7, 0xCE58, 0xCE58, 0xD6BA, 0xDEFB, 0xE6FB, 0xD6BA, 0xE71B, 0x1081, 0x1081, 0xE73C, 0xDEFB, 0xDEDA, 0xD699, 0xCE79,
+0xDEDA, 0xD6BA, 0xD6BA, 0xD699, 0xD6BA, 0xD6BA, 0xDEDA, 0xD6BA, 0xD699, 0xD679, 0xDEBA, 0xD679, 0xCE79, 0xCE59, 0xCE79, 0x8003,
+0xD699, 0x0006, 0xD6BA, 0xD6BA, 0xD69A, 0xDEBA, 0xD6BA, 0xD69A, 0x8004, 0xD6BA, 0x0001, 0xDEDA, 0x8003, 0xD6BA, 0x000C, 0xDEBA,
+0xDEDA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEFB, 0x8008, 0xE71B, 0x0017, 0xE6FB, 0xE71B,
+0xE6FB, 0xDEFB, 0xDEFB, 0xF77D, 0xEF7D, 0xF79D, 0xF79E, 0xF79D, 0xF79D, 0xF77D, 0xF79E, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE,
+0xF79E, 0xF79D, 0xF79E, 0xF7BE, 0xF79D, 0x8003, 0xF7BE, 0x0002, 0xFFDF, 0xFFDF, 0x8003, 0xFFFF, 0x0004, 0xFFDF, 0xFFDE, 0xFFDE,
+0xFFDF, 0x8008, 0xFFFF, 0x0002, 0xFFDF, 0xFFBE, 0x8006, 0xFFFF, 0x8005, 0x18E3, 0x0003, 0x18C3, 0x2124, 0x2104, 0x801E, 0x18E3,
+0x8004, 0x18E4, 0x0004, 0x18E3, 0x18E4, 0x18C3, 0x18C3, 0x8003, 0x18E3, 0x0011, 0x20C2, 0x942D, 0xCDF4, 0xD635, 0xD635, 0xCE15,
+0xB552, 0x1040, 0x20C1, 0x18A1, 0x1881, 0x0820, 0x1061, 0x0841, 0x1061, 0x18A2, 0x1082, 0x8003, 0x10A2, 0x002F, 0x0841, 0x1082,
+0x18C3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x1082, 0x0841, 0x1082, 0x1082, 0x0861, 0x0861, 0x1082, 0x0000, 0x0841, 0x0821, 0x1062,
+0x0841, 0x0861, 0x0861, 0x1061, 0x1081, 0x1882, 0x0820, 0x7B8C, 0x736C, 0x62CA, 0x6B2C, 0x83EF, 0x9CB2, 0xA4F3, 0xAD34, 0xB595,
+0xC5F7, 0xC617, 0xD699, 0xDEDA, 0xE71B, 0xDEDA, 0x18E3, 0x1061, 0x1081, 0x0020, 0x2124, 0xD699, 0xD699, 0x8005, 0xCE79, 0x0008,
+0xCE58, 0xD6BA, 0xD699, 0xD679, 0xD699, 0xCE79, 0xD6BA, 0xCE59, 0x8003, 0xCE79, 0x000E, 0xD699, 0xD679, 0xD679, 0xD6BA, 0xDEDA,
+0xDEDA, 0xD6BA, 0xD6BA, 0xDEDA, 0xDEDB, 0xDEDA, 0xD6BA, 0xD69A, 0xD69A, 0x8005, 0xD6BA, 0x8003, 0xDEBA, 0x0009, 0xDEFB, 0xE6FB,
+0xE6FB, 0xDEFB, 0xDEDA, 0xD6BA, 0xDEDB, 0xE6FB, 0xE6FB, 0x8003, 0xE71B, 0x8003, 0xE6FB, 0x8005, 0xDEFB, 0x000C, 0xF77D, 0xEF7D,
+0xF7BE, 0xFFDE, 0xF7BE, 0xF79E, 0xF77D, 0xF79D, 0xEF7D, 0xEF5D, 0xEF7D, 0xF79E, 0x8005, 0xF7BE, 0x0001, 0xF79E, 0x8003, 0xF7BE,
+0x8003, 0xFFDE, 0x8006, 0xFFFF, 0x0008, 0xFFDF, 0xFFDF, 0xF7BE, 0xF79D, 0xEF7D, 0xEF7D, 0xF79E, 0xFFDF, 0x8003, 0xFFFF, 0x000A,
+0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x2104, 0x18E3, 0x18C3, 0x2104, 0x2104, 0x8004, 0x18E3, 0x0001, 0x2104, 0x801B, 0x18E3,
+0x0053, 0x20E3, 0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x18E3, 0x18E4, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x20E2, 0x8BEE, 0xC5B4,
+0xCE15, 0x734B, 0x20E1, 0x1060, 0x18A1, 0x0840, 0x0840, 0x1061, 0x0841, 0x0861, 0x10A2, 0x1082, 0x1082, 0x18A2, 0x0861, 0x1082,
+0x1082, 0x18C3, 0x1082, 0x0861, 0x1082, 0x0861, 0x1082, 0x0841, 0x0862, 0x0862, 0x0861, 0x0861, 0x0862, 0x0841, 0x0841, 0x1082,
+0x1062, 0x0862, 0x0862, 0x0841, 0x0861, 0x0861, 0x1061, 0x1061, 0x0841, 0x0840, 0x8C0E, 0x8C2E, 0x5A89, 0x6B0B, 0x7B8D, 0x9490,
+0xA513, 0xB574, 0xB595, 0xC5F7, 0xCE38, 0xDEDA, 0xDEDA, 0xE73C, 0x18C2, 0x10A2, 0x0020, 0x0841, 0x0861, 0x10A2, 0x0841, 0xBDD6,
+0xB5B6, 0xC617, 0xCE58, 0xCE38, 0x8003, 0xCE79, 0x000C, 0xCE58, 0xCE58, 0xD679, 0xCE79, 0xD699, 0xCE58, 0xCE59, 0xCE58, 0xCE58,
+0xD699, 0xD69A, 0xD69A, 0x8004, 0xD6BA, 0x0002, 0xDEDA, 0xDEDA, 0x8009, 0xD6BA, 0x0001, 0xDEBA, 0x8007, 0xDEDA, 0x0004, 0xDEBA,
+0xD6BA, 0xDEDA, 0xDEFB, 0x8004, 0xE6FB, 0x8003, 0xE71B, 0x001A, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xF79D, 0xF79D, 0xFFDE,
+0xFFFF, 0xF7BE, 0xEF7D, 0xEF3C, 0xE73C, 0xF79E, 0xF79D, 0xF79E, 0xFFBE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFDE,
+0xFFBE, 0xF7BE, 0x8003, 0xFFDE, 0x0008, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0x8004, 0xFFFF, 0x0004,
+0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0x8005, 0xFFFF, 0x0002, 0x5AEB, 0x10A2, 0x8004, 0x18E3, 0x0005, 0x2104, 0x18C3, 0x2104, 0x2104,
+0x18C3, 0x8018, 0x18E3, 0x8003, 0x20E3, 0x0007, 0x20E4, 0x2104, 0x18E3, 0x18E4, 0x18E4, 0x18E3, 0x18E4, 0x8003, 0x18E3, 0x001D,
+0x18C3, 0x18E3, 0x20E3, 0x41E6, 0x1880, 0x1040, 0x18A1, 0x1081, 0x10A1, 0x0860, 0x0861, 0x1061, 0x1082, 0x1082, 0x10A3, 0x1082,
+0x18A3, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1082, 0x0861, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x1082, 0x10A2, 0x8003, 0x1082, 0x0037,
+0x0841, 0x0862, 0x0861, 0x0862, 0x0861, 0x0862, 0x0841, 0x0842, 0x0841, 0x0861, 0x0840, 0x0861, 0x1061, 0x1041, 0x0000, 0x8C0E,
+0x8C2E, 0x5A88, 0x6AEB, 0x736C, 0x8C2F, 0x9CB2, 0xAD54, 0xAD54, 0xBDD6, 0xC638, 0xD6BA, 0xE6FB, 0x4207, 0x0861, 0x0861, 0x1082,
+0x0861, 0x0861, 0x0020, 0x0840, 0x0861, 0xA514, 0xB595, 0xB5B6, 0xBDF7, 0xBDF7, 0xBDD6, 0xCE79, 0xC638, 0xCE58, 0xCE38, 0xCE59,
+0xD69A, 0xCE79, 0xCE59, 0xCE79, 0xCE59, 0xCE79, 0xCE79, 0x8005, 0xCE59, 0x0002, 0xCE79, 0xD679, 0x8005, 0xCE79, 0x0002, 0xDEDA,
+0xDEDA, 0x8003, 0xD6BA, 0x0003, 0xD69A, 0xD69A, 0xD699, 0x8003, 0xDEDB, 0x8003, 0xDEFB, 0x0001, 0xE6FB, 0x8003, 0xE73C, 0x0001,
+0xE71C, 0x8003, 0xE71B, 0x0020, 0xE6FB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xFFDF, 0xFFBE, 0xFFBE, 0xF79E, 0xF7BE, 0xF79E,
+0xF7BE, 0xF7BE, 0xEF7D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xF77D, 0xEF7D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDE, 0xF7BE,
+0xF79E, 0xF79E, 0xFFDF, 0xFFDF, 0x8006, 0xFFFF, 0x8004, 0xFFDF, 0x0004, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0x8005, 0xFFFF, 0x0003,
+0x18C3, 0x2104, 0x18C3, 0x8019, 0x18E3, 0x000D, 0x2104, 0x18C3, 0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x20E3, 0x18C3, 0x2104,
+0x20E3, 0x18E3, 0x18C3, 0x8006, 0x18E3, 0x8003, 0x18C3, 0x000D, 0x18E3, 0x18A2, 0x1061, 0x18A2, 0x1061, 0x1081, 0x1081, 0x1082,
+0x1082, 0x0862, 0x1082, 0x1082, 0x0882, 0x8005, 0x0862, 0x8005, 0x1082, 0x0009, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0861,
+0x0841, 0x0020, 0x0861, 0x8004, 0x0841, 0x0035, 0x0861, 0x0862, 0x0861, 0x0861, 0x0860, 0x0861, 0x0861, 0x0840, 0x0820, 0x7BAC,
+0x83ED, 0x5A88, 0x5AA9, 0x6B2B, 0x83EE, 0xA4F2, 0xAD54, 0xAD54, 0xC617, 0xCE58, 0xCE79, 0xA514, 0x1081, 0x0861, 0x0841, 0x0841,
+0x10A2, 0x0020, 0x0861, 0x0861, 0x1062, 0x0841, 0xA534, 0xB5B6, 0xB596, 0xBDB6, 0xCE58, 0xC617, 0xBDF7, 0xBDF7, 0xC638, 0xC638,
+0xC5F7, 0xCE79, 0xCE59, 0xCE79, 0xCE59, 0xCE79, 0xD699, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0x8004, 0xCE79, 0x0001, 0xD699, 0x8003,
+0xD69A, 0x0005, 0xCE79, 0xCE79, 0xD699, 0xD69A, 0xDEBA, 0x8003, 0xDEDB, 0x8004, 0xDEDA, 0x8004, 0xDEFB, 0x0013, 0xE71B, 0xE71B,
+0xE6FB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xEF5D, 0xF79D, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDE,
+0xFFBE, 0x8004, 0xF7BE, 0x000E, 0xFFDF, 0xFFFF, 0xFFDE, 0xF79E, 0xEF7D, 0xF7BE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF,
+0xFFFF, 0xFFDF, 0x8003, 0xFFDE, 0x0004, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0x8008, 0xFFFF, 0x0007, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF,
+0xEF5D, 0x10A2, 0x2104, 0x801A, 0x18E3, 0x000D, 0x18C3, 0x2104, 0x18E3, 0x2124, 0x18E3, 0x18C3, 0x2104, 0x20E4, 0x18E3, 0x2104,
+0x18C3, 0x10A2, 0x2104, 0x8006, 0x18E3, 0x8004, 0x18C3, 0x0006, 0x1061, 0x18A2, 0x1081, 0x0861, 0x10A2, 0x0861, 0x8003, 0x0862,
+0x0004, 0x10A2, 0x1082, 0x0861, 0x0841, 0x8003, 0x0861, 0x8008, 0x1082, 0x000B, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x0861,
+0x0861, 0x0841, 0x0861, 0x0881, 0x0882, 0x8003, 0x1082, 0x002E, 0x1081, 0x1081, 0x10A2, 0x1081, 0x1061, 0x1060, 0x5AA9, 0x8C0E,
+0x5A89, 0x630B, 0x630B, 0x7BCE, 0x9470, 0xA4F3, 0xAD54, 0xC5F7, 0xC638, 0xC617, 0x10A2, 0x1081, 0x0861, 0x0840, 0x1082, 0x0861,
+0x1082, 0x10A2, 0x0861, 0x0020, 0x1082, 0x9492, 0x9CF3, 0xAD54, 0xB595, 0xB595, 0xB5B6, 0xC617, 0xC638, 0xCE58, 0xC617, 0xC618,
+0xCE59, 0xC638, 0xCE59, 0xCE38, 0xCE59, 0xCE79, 0x8003, 0xCE59, 0x0003, 0xCE79, 0xD69A, 0xDEDA, 0x8003, 0xDEDB, 0x0003, 0xD6BA,
+0xD679, 0xCE79, 0x8008, 0xD6BA, 0x8003, 0xDEDA, 0x0003, 0xDEDB, 0xDEFB, 0xE6FB, 0x8003, 0xDEFB, 0x0002, 0xDEDB, 0xDEDB, 0x8005,
+0xDEFB, 0x0015, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xEF3C, 0xEF5D, 0xF79E, 0xF79E, 0xFFBE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF,
+0xFFDF, 0xF7BE, 0xF79D, 0xF79D, 0xF7BE, 0xFFFF, 0xFFBE, 0x8006, 0xF7BE, 0x0003, 0xF79E, 0xFFDF, 0xFFDE, 0x8003, 0xFFDF, 0x8003,
+0xFFFF, 0x0001, 0xFFDE, 0x8003, 0xFFFF, 0x0002, 0xFFDF, 0xFFDE, 0x8003, 0xFFFF, 0x0005, 0xFFDF, 0xFFFF, 0xFFDF, 0x18E3, 0x2104,
+0x801A, 0x18E3, 0x000E, 0x2124, 0x18C3, 0x2104, 0x2104, 0x18E3, 0x18C3, 0x2104, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x2924, 0x20E4,
+0x18C3, 0x8004, 0x18E3, 0x0003, 0x18C3, 0x18E3, 0x18E3, 0x8003, 0x18C3, 0x0020, 0x1061, 0x1082, 0x0841, 0x0862, 0x1082, 0x0841,
+0x1082, 0x0841, 0x1082, 0x1082, 0x1081, 0x0861, 0x1081, 0x1081, 0x0861, 0x1061, 0x1082, 0x0861, 0x0861, 0x1082, 0x1082, 0x0861,
+0x0861, 0x0841, 0x0841, 0x1082, 0x0861, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x8006, 0x1082, 0x0034, 0x1081, 0x1081, 0x10A2,
+0x0840, 0x1081, 0x0000, 0x18A1, 0x8C0E, 0x734C, 0x62EA, 0x6B4C, 0x83EE, 0x9491, 0xA513, 0xAD74, 0xC5F7, 0xBDF7, 0x10A2, 0x0861,
+0x0861, 0x0841, 0x1082, 0x1082, 0x0841, 0x1082, 0x0020, 0x1062, 0x0861, 0x0841, 0x1082, 0x1082, 0x94B2, 0xAD75, 0xA513, 0xB595,
+0xB595, 0xB5B6, 0xBDD6, 0xC617, 0xC617, 0xC618, 0xC638, 0xC638, 0xC618, 0xCE58, 0xCE59, 0xCE58, 0xCE59, 0xCE79, 0xCE79, 0xC638,
+0xCE59, 0x8003, 0xCE79, 0x0003, 0xD679, 0xD699, 0xD6BA, 0x8003, 0xDEDB, 0x000B, 0xDEDA, 0xDEDA, 0xDEBA, 0xD6BA, 0xD6BA, 0xE71B,
+0xE71B, 0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0x8005, 0xE71B, 0x0005, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDB, 0xE6FB, 0x8004, 0xDEFB, 0x0008,
+0xFFBE, 0xF7BE, 0xF79E, 0xF77D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDE, 0x8004, 0xEF7D, 0x0003, 0xF77D, 0xF79D, 0xF79E, 0x8005, 0xF7BE,
+0x000A, 0xF79E, 0xF79D, 0xEF7D, 0xEF7D, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFDF, 0x800C, 0xFFFF, 0x0006, 0xFFDF, 0xFFDF,
+0x18C3, 0x2124, 0x18E3, 0x2104, 0x8018, 0x18E3, 0x0015, 0x18C3, 0x2104, 0x2104, 0x18C3, 0x18E3, 0x2945, 0x18C3, 0x18E3, 0x18C3,
+0x18C3, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x8003, 0x18C3, 0x0004, 0x0841,
+0x0841, 0x1082, 0x10A2, 0x8003, 0x1082, 0x0002, 0x0841, 0x0841, 0x8003, 0x0840, 0x0007, 0x1081, 0x0860, 0x0820, 0x0841, 0x0861,
+0x0861, 0x0841, 0x8005, 0x0861, 0x0001, 0x1082, 0x8005, 0x10A2, 0x0002, 0x1082, 0x1082, 0x8003, 0x1081, 0x8003, 0x0861, 0x0029,
+0x0881, 0x0881, 0x1081, 0x1081, 0x1061, 0x0820, 0x18C1, 0x7BCD, 0x5268, 0x6B2B, 0x62EA, 0x840F, 0x8C50, 0xA513, 0xBDB6, 0xBDF7,
+0xC617, 0x1061, 0x0841, 0x0841, 0x0861, 0x1082, 0x0861, 0x1082, 0x0861, 0x1082, 0x0841, 0x0821, 0x1061, 0x1062, 0x0020, 0x9491,
+0xAD34, 0xA513, 0xB5B6, 0xAD54, 0xBDD6, 0xBDD6, 0xC617, 0xC617, 0xC5F7, 0x8003, 0xC618, 0x0008, 0xCE59, 0xCE79, 0xCE59, 0xCE58,
+0xC638, 0xC618, 0xCE79, 0xD69A, 0x8003, 0xD6BA, 0x000F, 0xD69A, 0xD69A, 0xD6BA, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA,
+0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEBA, 0x8003, 0xDEDA, 0x0008, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71C, 0xEF3C, 0xE73C,
+0xE71B, 0x8005, 0xDEFB, 0x0019, 0xF79D, 0xF77D, 0xF79D, 0xF79D, 0xF79E, 0xF79D, 0xF79D, 0xEF7D, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDF,
+0xFFDF, 0xF7BE, 0xF79D, 0xEF7D, 0xF77D, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0x8004, 0xF7BE, 0x0005,
+0xFFDE, 0xFFFF, 0xFFDF, 0xF7BE, 0xFFDF, 0x800A, 0xFFFF, 0x0004, 0x18E3, 0x2104, 0x18C3, 0x18C3, 0x8018, 0x18E3, 0x0006, 0x2104,
+0x18E3, 0x10A2, 0x18E3, 0x2104, 0x18E3, 0x8003, 0x2104, 0x0008, 0x2103, 0x18C3, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x2104, 0x18E3,
+0x8006, 0x18C3, 0x000D, 0x18E3, 0x0841, 0x1062, 0x0862, 0x0841, 0x0842, 0x0862, 0x1082, 0x18E3, 0x18C2, 0x18A2, 0x1081, 0x1081,
+0x8004, 0x18A2, 0x000F, 0x1082, 0x1061, 0x0861, 0x0841, 0x0861, 0x1081, 0x10A2, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x1081, 0x0841,
+0x0861, 0x0861, 0x8005, 0x0840, 0x003C, 0x0841, 0x0840, 0x0860, 0x0860, 0x1081, 0x0820, 0x1061, 0x0000, 0x18C1, 0x7BAD, 0x5248,
+0x6B4C, 0x6B4C, 0x7BCE, 0x9CB2, 0xA513, 0xAD54, 0x10A2, 0x0861, 0x0861, 0x0841, 0x1082, 0x0841, 0x0841, 0x0862, 0x1082, 0x0841,
+0x0841, 0x0861, 0x1062, 0x0861, 0x0861, 0x1061, 0x18C2, 0x1081, 0x9491, 0x9CD2, 0xAD75, 0xAD75, 0xB595, 0xB575, 0xB575, 0xC618,
+0xC617, 0xC5F7, 0xBDF7, 0xC617, 0xC617, 0xC618, 0xCE79, 0xD699, 0xD699, 0xD679, 0xD69A, 0xD6BA, 0xD6BA, 0xD69A, 0xD699, 0xCE79,
+0xCE59, 0x8009, 0xD6BA, 0x0002, 0xDEDA, 0xDEBA, 0x8003, 0xD6BA, 0x0005, 0xDEBA, 0xDEDB, 0xDEBA, 0xDEDA, 0xDEDB, 0x8003, 0xDEFB,
+0x0002, 0xE71C, 0xEF5C, 0x8004, 0xE71C, 0x000B, 0xF79E, 0xF79E, 0xF7BE, 0xF79E, 0xF7BE, 0xF79D, 0xF79E, 0xF79D, 0xF77D, 0xF79D,
+0xF79E, 0x8003, 0xF7BE, 0x0001, 0xFFDE, 0x8003, 0xFFDF, 0x0005, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFBE, 0x8003, 0xF7BE, 0x000C,
+0xFFBE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xEF7D, 0xEF7D, 0xF79E, 0xFFDF, 0x8004, 0xFFFF, 0x0003, 0xFFDF,
+0xFFFF, 0x18C3, 0x8003, 0x2104, 0x8019, 0x18E3, 0x8003, 0x2104, 0x000D, 0x18C3, 0x18E3, 0xD69A, 0xFFFF, 0xFFBE, 0xD679, 0x20E3,
+0x18C3, 0x2104, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x8007, 0x18C3, 0x000F, 0x0020, 0x0861, 0x0841, 0x0862, 0x1082, 0x1082, 0x10A3,
+0x10A2, 0x1081, 0x1081, 0x0861, 0x0840, 0x0840, 0x0861, 0x0861, 0x8007, 0x0841, 0x8003, 0x0861, 0x0005, 0x0840, 0x0861, 0x0861,
+0x0841, 0x0841, 0x800B, 0x0840, 0x002F, 0x1061, 0x1061, 0x0800, 0x20E2, 0x8C0E, 0x5A69, 0x6AEB, 0x7B8D, 0x8C50, 0xA4F3, 0xAD34,
+0x2944, 0x0840, 0x1082, 0x0840, 0x1082, 0x0861, 0x0862, 0x1082, 0x0841, 0x0841, 0x0861, 0x1082, 0x0861, 0x1062, 0x0861, 0x1082,
+0x18E3, 0x0841, 0x0840, 0x1081, 0x8C50, 0x9CF3, 0x9CD2, 0xAD75, 0xBDB6, 0xBDD6, 0xC617, 0xC638, 0xCE38, 0xC618, 0xC618, 0xC617,
+0xC618, 0xCE59, 0xCE79, 0xCE79, 0x8003, 0xCE59, 0x0005, 0xCE58, 0xCE79, 0xD679, 0xD699, 0xD699, 0x8003, 0xD6BA, 0x8003, 0xD69A,
+0x0005, 0xD699, 0xD699, 0xDEDB, 0xDEFB, 0xDEDB, 0x8003, 0xDEDA, 0x000A, 0xDEDB, 0xDEFB, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xEF3C,
+0xEF3C, 0xE73C, 0xE71B, 0x8003, 0xE73C, 0x0004, 0xEF3C, 0xFFDE, 0xF7BE, 0xF7BE, 0x8003, 0xEF7D, 0x000D, 0xF79D, 0xF79D, 0xF7BE,
+0xF79E, 0xF79D, 0xF79E, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xFFBE, 0xFFDF, 0x8005, 0xFFFF, 0x0002, 0xF7BE, 0xFFBE, 0x8003,
+0xFFDE, 0x0006, 0xFFBE, 0xF7BE, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF, 0x8008, 0xFFFF, 0x0005, 0xFFDF, 0x2104, 0x18C3, 0x18C3, 0x2104,
+0x8019, 0x18E3, 0x0004, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x8003, 0xFFFF, 0x0021, 0xFFBE, 0xFFBE, 0xE71B, 0x5289, 0x18C3, 0x10A2,
+0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x0881, 0x0041, 0x0041, 0x0882, 0x0862, 0x10A3,
+0x10A3, 0x0862, 0x0862, 0x0861, 0x0881, 0x0861, 0x0841, 0x0841, 0x0842, 0x0841, 0x0841, 0x8005, 0x0861, 0x0002, 0x0841, 0x0841,
+0x8003, 0x0861, 0x0006, 0x0840, 0x1061, 0x0861, 0x0820, 0x1061, 0x0820, 0x8003, 0x0840, 0x8007, 0x0820, 0x000C, 0x0800, 0x6B2B,
+0x734B, 0x62CA, 0x7B6D, 0x7BAE, 0x8C50, 0x9CB2, 0xAD54, 0x18A2, 0x1061, 0x0020, 0x8003, 0x0861, 0x0022, 0x1082, 0x0841, 0x0841,
+0x1082, 0x0841, 0x0841, 0x0862, 0x0841, 0x1082, 0x1061, 0x10A2, 0x0861, 0x1081, 0x0861, 0x2124, 0x9491, 0xA534, 0xA513, 0xB5B6,
+0xB595, 0xBDF7, 0xBDD7, 0xBDD6, 0xBDF7, 0xC618, 0xC638, 0xCE38, 0xCE79, 0xCE59, 0xCE38, 0xCE59, 0xCE79, 0xCE79, 0xCE59, 0x8004,
+0xCE79, 0x8005, 0xD6BA, 0x8003, 0xDEBA, 0x0004, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0x8004, 0xE71C, 0x8003, 0xE71B, 0x0004, 0xE6FB,
+0xDEFB, 0xDEFB, 0xE71B, 0x8003, 0xE73C, 0x0011, 0xE71C, 0xE71C, 0xF79E, 0xF77D, 0xF77D, 0xEF7D, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFBE,
+0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79D, 0xF79D, 0xF79E, 0x8003, 0xF7BE, 0x0005, 0xF79E, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF, 0x8003,
+0xFFFF, 0x0004, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0x8006, 0xFFFF, 0x0004, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFBE, 0x8003, 0xFFFF, 0x0005,
+0xFFDF, 0x10A2, 0x2104, 0x2104, 0x18C3, 0x8017, 0x18E3, 0x0004, 0x2104, 0x18E3, 0x2124, 0x8C51, 0x8003, 0xFFFF, 0x0028, 0xFFDF,
+0xFFDF, 0xF79E, 0xEF5D, 0xEF5C, 0xDEBA, 0xCE58, 0xAD34, 0x18A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,
+0x18C3, 0x0882, 0x0861, 0x10A3, 0x0862, 0x0861, 0x10A3, 0x0021, 0x1082, 0x1082, 0x0021, 0x0841, 0x1082, 0x0841, 0x0020, 0x0861,
+0x1082, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0020, 0x8005, 0x0820, 0x0008, 0x0840, 0x2944, 0x41E7, 0x5269, 0x736D, 0x7BAD,
+0x7BCE, 0x83EE, 0x8003, 0x83EF, 0x0030, 0x840F, 0x8C0F, 0x8C30, 0x8C0F, 0x9491, 0x8C30, 0x5268, 0x2923, 0x83EE, 0x9450, 0x9491,
+0x94B1, 0x9471, 0x10A2, 0x0840, 0x0840, 0x1081, 0x0861, 0x1082, 0x0841, 0x0861, 0x1082, 0x0841, 0x0841, 0x0862, 0x0841, 0x1062,
+0x1062, 0x0841, 0x1082, 0x0840, 0x1082, 0x0000, 0x1081, 0x0861, 0x0820, 0x9CD2, 0xAD54, 0xA514, 0xBDD6, 0xB5B6, 0xBDB6, 0xBDB6,
+0xB5B6, 0xBDD6, 0xB5B6, 0xBDD6, 0xC618, 0x8003, 0xCE58, 0x8004, 0xCE79, 0x0008, 0xD679, 0xD699, 0xD6BA, 0xD699, 0xD699, 0xD69A,
+0xD6BA, 0xDEDA, 0x8003, 0xDEFB, 0x8003, 0xD6BA, 0x0008, 0xDEBA, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEFB, 0x8005,
+0xE71B, 0x0001, 0xDEFB, 0x8003, 0xDEDB, 0x8003, 0xF7BE, 0x000F, 0xF79D, 0xF79D, 0xF7BE, 0xFFDE, 0xFFBE, 0xF79E, 0xF7BE, 0xF7BE,
+0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFDE, 0x8003, 0xFFDF, 0x8003, 0xFFFF, 0x8003, 0xFFDF, 0x8003, 0xFFDE, 0x8003,
+0xFFFF, 0x0001, 0xFFDF, 0x8006, 0xFFFF, 0x0008, 0xFFDE, 0xFFFF, 0xF7BE, 0xD6BA, 0x2104, 0x18E3, 0x1082, 0x2124, 0x8010, 0x18E3,
+0x0076, 0x2104, 0x18C3, 0x2104, 0x2124, 0x18E3, 0x18C3, 0x2104, 0x18C3, 0x18E4, 0x31A7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE,
+0xFFDE, 0xFFDE, 0xE73B, 0xD6BA, 0xD6BA, 0xC618, 0xBDD7, 0xB596, 0x18A3, 0x18A2, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x10C2, 0x10C3,
+0x10C2, 0x0020, 0x0841, 0x0020, 0x18A2, 0x1061, 0x0841, 0x1062, 0x0862, 0x1082, 0x0861, 0x1061, 0x0000, 0x0000, 0x0840, 0x0000,
+0x0020, 0x0020, 0x0820, 0x1061, 0x736D, 0x7BCE, 0x7BAE, 0x630B, 0x2903, 0x1061, 0x5248, 0x736D, 0x630B, 0x738D, 0x734C, 0x738D,
+0x736C, 0x7BCE, 0x738D, 0x7BCE, 0x736D, 0x840F, 0x83EF, 0x7B8D, 0x83EE, 0x7BAE, 0x83EE, 0x840F, 0x83EE, 0x840F, 0x8C2F, 0x9471,
+0x9471, 0x9CB2, 0x83EF, 0x18C2, 0x0841, 0x0841, 0x0861, 0x1082, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x1082, 0x0841, 0x0841,
+0x1082, 0x1062, 0x1082, 0x0841, 0x1082, 0x1082, 0x0841, 0x10A2, 0x0840, 0x0820, 0x2103, 0x8C71, 0xAD54, 0xAD75, 0xB595, 0xBDF7,
+0xBDD7, 0xBDD7, 0xBDB6, 0xBDF7, 0xBDF7, 0xBDD7, 0xBDF7, 0x8003, 0xC5F7, 0x000F, 0xC618, 0xC617, 0xC617, 0xC618, 0xCE38, 0xCE58,
+0xCE59, 0xD699, 0xD699, 0xCE79, 0xCE79, 0xD69A, 0xD69A, 0xD699, 0xD699, 0x8004, 0xD6BA, 0x0001, 0xDEDB, 0x8005, 0xDEFB, 0x0004,
+0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0x8006, 0xDEFB, 0x0001, 0xF79E, 0x8005, 0xF7BE, 0x0004, 0xF79E, 0xF77D, 0xF79D, 0xF79D, 0x8003,
+0xEF7D, 0x000E, 0xF77D, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF,
+0x8004, 0xFFDE, 0x0001, 0xFFDF, 0x8003, 0xFFFF, 0x0004, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0x8004, 0xFFFF, 0x0004, 0xA534, 0x18E3,
+0x18E3, 0x2104, 0x8013, 0x18E3, 0x000B, 0x1904, 0x18E3, 0x18E3, 0x2104, 0x18E3, 0x2104, 0x18E4, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF,
+0x8003, 0xFFFF, 0x0048, 0xF7BE, 0xDEFB, 0xD699, 0xC618, 0xCE59, 0xBDB6, 0xAD55, 0x7BAE, 0x1082, 0x1082, 0x18C2, 0x18A2, 0x18C2,
+0x10C2, 0x10C2, 0x18E3, 0x0000, 0x1081, 0x1061, 0x1060, 0x1020, 0x1060, 0x1882, 0x1061, 0x0840, 0x0841, 0x0800, 0x0820, 0x0800,
+0x0820, 0x4227, 0x73AD, 0x738D, 0x630B, 0x0840, 0x5A89, 0x62EB, 0x62EA, 0x6B4C, 0x630B, 0x6B2C, 0x734C, 0x7B8D, 0x736D, 0x7BAD,
+0x7BAD, 0x736C, 0x7BCE, 0x7BCE, 0x7BAE, 0x8C30, 0x8C30, 0x83EE, 0x83EE, 0x83EF, 0x840F, 0x8C0F, 0x8C50, 0x8C2F, 0x9491, 0x8C70,
+0x8C50, 0x9491, 0x9491, 0x8C71, 0x18A2, 0x0861, 0x1081, 0x0861, 0x0841, 0x0841, 0x1082, 0x8003, 0x0841, 0x0019, 0x0861, 0x0861,
+0x0841, 0x0841, 0x0861, 0x0841, 0x1082, 0x0861, 0x1082, 0x10A2, 0x0841, 0x0861, 0x0000, 0x5289, 0x52AA, 0x7BCE, 0x9CD2, 0xA4F3,
+0xB575, 0xAD75, 0xAD55, 0xB575, 0xB595, 0xBDF7, 0xC5F7, 0x8005, 0xBDD7, 0x0008, 0xC618, 0xC638, 0xCE58, 0xCE38, 0xCE58, 0xC638,
+0xC638, 0xCE58, 0x8003, 0xCE79, 0x0008, 0xD699, 0xD69A, 0xD69A, 0xD6BA, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEDA, 0x8003, 0xDEDB, 0x8003,
+0xDEFB, 0x0004, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0x8006, 0xE71B, 0x000C, 0xF7BE, 0xF79E, 0xF77D, 0xF77D, 0xF79E, 0xF7BE, 0xFFDE,
+0xFFDF, 0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0x8003, 0xFFBE, 0x0013, 0xF7BE, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF,
+0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF79E, 0xEF7D, 0xFFDF, 0x8003, 0xFFFF, 0x0007, 0xFFDE, 0xF7BE,
+0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0x7BEF, 0x8014, 0x18E3, 0x0003, 0x2104, 0x1904, 0x18C3, 0x8003, 0x2104, 0x0005, 0x18C3, 0x18C3,
+0xFFFF, 0xFFFF, 0xFFDF, 0x8003, 0xFFFF, 0x0047, 0xF7BE, 0xEF7D, 0xE73C, 0xDEFB, 0xE73C, 0xC638, 0xC638, 0xBDD6, 0xAD75, 0x94B2,
+0x10A2, 0x1082, 0x1081, 0x10A2, 0x1062, 0x18C3, 0x18C3, 0x10A2, 0x0820, 0x0800, 0x1020, 0x1020, 0x1860, 0x1020, 0x0800, 0x1040,
+0x0820, 0x0820, 0x3143, 0x6AEA, 0x734B, 0x734C, 0x39A5, 0x5268, 0x5AA9, 0x5AC9, 0x62EA, 0x630B, 0x6B2C, 0x6B4B, 0x6B2B, 0x734C,
+0x6B4C, 0x83EE, 0x736D, 0x7BAD, 0x7BAD, 0x738D, 0x8C30, 0x7BCE, 0x83EF, 0x8C30, 0x8C30, 0x9491, 0x9491, 0x9CB1, 0x9471, 0x9491,
+0x9CB2, 0x9CB2, 0x9CD2, 0x9CB1, 0xA4F3, 0x9CD2, 0xA4F3, 0x9CB2, 0x9CD3, 0x0861, 0x0861, 0x0841, 0x10A2, 0x8004, 0x0861, 0x0002,
+0x0841, 0x0841, 0x8005, 0x0861, 0x0023, 0x1062, 0x0821, 0x10A2, 0x0000, 0x0841, 0x0820, 0x0000, 0x5289, 0x5AEB, 0x632C, 0x738D,
+0x8430, 0xA513, 0xAD54, 0xB575, 0xB595, 0xAD55, 0xAD75, 0xBDB6, 0xBDD7, 0xB5B6, 0xBDD6, 0xBDD7, 0xBDD7, 0xBDF7, 0xC638, 0xC618,
+0xC617, 0xC5F7, 0xC638, 0xCE58, 0xCE59, 0xD699, 0xD699, 0xD679, 0x8003, 0xCE79, 0x0016, 0xCE59, 0xCE59, 0xD6BA, 0xDEDB, 0xDEDB,
+0xDEBA, 0xD699, 0xCE79, 0xD679, 0xD6BA, 0xDEBA, 0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB,
+0xE6FB, 0x8003, 0xF79D, 0x0010, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xF7BE, 0xF79E,
+0xF79D, 0xF7BE, 0xF7BE, 0xFFDE, 0x8005, 0xFFDF, 0x0009, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF,
+0x8003, 0xFFDE, 0x000C, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFFF, 0x8C71, 0x18E3, 0x2104, 0x18E3, 0x18C3, 0x8011,
+0x18E3, 0x0008, 0x1903, 0x18C3, 0x2104, 0x18C3, 0x18C3, 0x2124, 0x2104, 0xFFDF, 0x8006, 0xFFFF, 0x0049, 0xF7BE, 0xE71B, 0xDEFB,
+0xCE59, 0xC618, 0xBDF7, 0x9CF3, 0xA534, 0xA534, 0x8430, 0x0841, 0x18A2, 0x1082, 0x18C3, 0x1082, 0x1082, 0x18C3, 0x1040, 0x7B8C,
+0xB532, 0xBD73, 0xB532, 0xC593, 0xACF1, 0xA4D0, 0x9C90, 0x8C2E, 0x6AE9, 0x6AE9, 0x4A06, 0x5207, 0x5AA9, 0x62CA, 0x630B, 0x62EA,
+0x6B0B, 0x734C, 0x630B, 0x6B4B, 0x736C, 0x6B2B, 0x7BCE, 0x736D, 0x83EE, 0x83EF, 0x8C50, 0x8C50, 0x9471, 0x94B1, 0x9491, 0xAD34,
+0x9491, 0xA513, 0xA513, 0xAD33, 0x9CD2, 0xAD33, 0xA513, 0xA4F3, 0xAD33, 0xAD54, 0x9CD2, 0xBDB6, 0xAD34, 0xAD34, 0x18E3, 0x10A2,
+0x1061, 0x1081, 0x0861, 0x10A2, 0x1082, 0x0841, 0x8004, 0x0861, 0x0001, 0x0841, 0x8003, 0x0861, 0x0019, 0x0841, 0x0862, 0x1082,
+0x0020, 0x0861, 0x0020, 0x6B4C, 0x4A48, 0x630B, 0x6B6D, 0x73AE, 0x73AE, 0x9CD3, 0x9CD3, 0xAD54, 0xA534, 0xAD75, 0xAD55, 0xB595,
+0xB595, 0xB575, 0xB596, 0xB596, 0xB595, 0xB575, 0x8004, 0xBDD7, 0x0005, 0xC618, 0xC638, 0xC638, 0xD699, 0xD69A, 0x8004, 0xD699,
+0x0012, 0xD679, 0xD699, 0xDEDA, 0xDEBA, 0xD6BA, 0xDEDA, 0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB,
+0xE71B, 0xE71B, 0xE71C, 0x8003, 0xE71B, 0x0001, 0xE6FB, 0x8003, 0xF79D, 0x0005, 0xF79E, 0xF79D, 0xEF7D, 0xEF7D, 0xF79D, 0x8003,
+0xF7BE, 0x000F, 0xFFBE, 0xFFBE, 0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDF,
+0xFFDF, 0x8007, 0xFFFF, 0x0004, 0xF79E, 0xF77D, 0xF79D, 0xF7BE, 0x8006, 0xFFFF, 0x0005, 0x9471, 0x18E3, 0x10A2, 0x2104, 0x20E3,
+0x8010, 0x18E3, 0x0004, 0x2104, 0x2104, 0x18E3, 0x2104, 0x8004, 0x18E4, 0x8004, 0xFFFF, 0x004C, 0xFFDF, 0xF7BE, 0xF79E, 0xE71B,
+0xDEDB, 0xD699, 0xC617, 0xB595, 0xAD54, 0xAD74, 0x9CD2, 0x8C71, 0x94B2, 0x1081, 0x0820, 0x18A2, 0x1082, 0x1062, 0x20C3, 0x1862,
+0x1040, 0x942F, 0xCDF5, 0xD5F5, 0xCDD4, 0xC5B3, 0xC5D3, 0xD676, 0xA4F1, 0x6B2A, 0x5AA8, 0x3984, 0x5A88, 0x62AA, 0x62CA, 0x62CA,
+0x62EA, 0x6B0B, 0x6B0B, 0x734C, 0x6B0B, 0x83EE, 0x83EE, 0x8C4F, 0x9491, 0x9491, 0x9CD2, 0x9CF2, 0xA513, 0x9CD2, 0xA4F3, 0xAD54,
+0xAD54, 0xB5B5, 0xAD34, 0xBDB6, 0xAD34, 0xB575, 0xB595, 0xB575, 0xBDB6, 0xB575, 0xB575, 0xB595, 0xBDF7, 0xAD34, 0xAD54, 0x18C2,
+0x0861, 0x1082, 0x1082, 0x0861, 0x10A2, 0x0020, 0x0861, 0x0841, 0x8007, 0x0861, 0x0010, 0x1081, 0x1082, 0x10A2, 0x0020, 0x0000,
+0x0840, 0x4A49, 0x52AA, 0x6B2C, 0x6B4C, 0x738D, 0x73AE, 0x7BAE, 0x8C51, 0x94B2, 0xA4F3, 0x8003, 0x9CF3, 0x0016, 0xA534, 0xAD55,
+0xAD75, 0xB5B6, 0xBDD6, 0xB5B6, 0xBDD7, 0xC638, 0xCE58, 0xC638, 0xC638, 0xCE58, 0xC638, 0xC618, 0xCE79, 0xD699, 0xD69A, 0xD699,
+0xD699, 0xCE79, 0xD679, 0xD69A, 0x8004, 0xD6BA, 0x8003, 0xDEDA, 0x0001, 0xDEFB, 0x8005, 0xE6FB, 0x0003, 0xE71B, 0xE71B, 0xE71C,
+0x8004, 0xE71B, 0x000B, 0xF79E, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF79D, 0xF79D, 0xF7BE, 0xF79E, 0xF79E, 0x8006, 0xF7BE,
+0x8003, 0xF79E, 0x001C, 0xF79D, 0xF77D, 0xF77D, 0xF79D, 0xFFBE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFBF,
+0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xEF7D, 0xF79E, 0xFFFF, 0xFFFF, 0xFFBE, 0xD699, 0x10A2, 0x2124, 0x2104, 0x18C3, 0x8012,
+0x18E3, 0x0006, 0x2124, 0x18E3, 0x18E3, 0x18C3, 0x2104, 0x7BEF, 0x8005, 0xFFFF, 0x0080, 0xFFDF, 0xEF5D, 0xDEFB, 0xCE59, 0xCE59,
+0xB596, 0xBDB6, 0x9CD2, 0x9CB2, 0xAD34, 0x9CD2, 0x8C50, 0x8C50, 0x1061, 0x0841, 0x1062, 0x1082, 0x1862, 0x1882, 0x0820, 0x83AD,
+0xB511, 0xC573, 0xCDB3, 0xD5F4, 0xC5B3, 0x62A7, 0x62A7, 0x3983, 0x49E5, 0x5247, 0x5AA9, 0x5269, 0x62CB, 0x62EB, 0x6B2B, 0x7B8D,
+0x8C2F, 0x9470, 0x9CB1, 0xA512, 0xA4F2, 0xAD53, 0xAD33, 0xB574, 0xB595, 0xAD74, 0xB595, 0xBDF7, 0xB596, 0xB5B6, 0xCE38, 0xC5F7,
+0xBDB6, 0xCE38, 0xBDD6, 0xCE37, 0xCE58, 0xC5F6, 0xCE38, 0xBDD6, 0xCE38, 0xC637, 0xC5F7, 0xBDF7, 0x10A2, 0x0840, 0x0841, 0x1082,
+0x1062, 0x1082, 0x0861, 0x0861, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x1082, 0x1082, 0x0861, 0x0841, 0x1082, 0x0821, 0x0000,
+0x0020, 0x39A6, 0x4A69, 0x52AA, 0x6B4C, 0x6B2C, 0x738D, 0x738D, 0x7BCE, 0x7BEF, 0x8410, 0x8C51, 0x9CD2, 0x9CF3, 0x9CD2, 0x9CD3,
+0xA514, 0xA514, 0xA513, 0xAD54, 0xAD75, 0xAD55, 0xAD55, 0xB5B6, 0xBDB6, 0xBDB6, 0xBDD6, 0xC618, 0xC618, 0xC638, 0xD679, 0xCE79,
+0xCE59, 0xCE59, 0xD699, 0xD69A, 0xD679, 0xCE79, 0xDEDB, 0xDEDA, 0xD6BA, 0xDEDB, 0xE71B, 0x8003, 0xE71C, 0x0002, 0xE71B, 0xE71B,
+0x8004, 0xE71C, 0x0007, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xF79E, 0x8005, 0xF7BE, 0x0004, 0xFFBE, 0xFFDE, 0xFFFF,
+0xFFDF, 0x8003, 0xFFDE, 0x0001, 0xFFDF, 0x8006, 0xFFFF, 0x0007, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0x8005,
+0xFFFF, 0x000D, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDE, 0xF79E, 0xFFBE, 0xFFDF, 0xFFDE, 0xFFBE, 0xEF3C, 0x20E3, 0x8013,
+0x18E3, 0x0076, 0x20E4, 0x18C3, 0x2104, 0x18E3, 0x2124, 0x18E3, 0x18E3, 0xC638, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE,
+0xE73C, 0xD6BA, 0xD67A, 0xCE38, 0xAD34, 0xAD34, 0xA4F3, 0x9CD2, 0x9CB2, 0x9491, 0x9471, 0x8C30, 0x0820, 0x0820, 0x1061, 0x1061,
+0x1062, 0x18A2, 0x0820, 0x83AD, 0xBD52, 0xC572, 0xC552, 0xBD52, 0x838B, 0x6287, 0x5246, 0x49E5, 0x4184, 0x4A06, 0x5248, 0x62EB,
+0x528A, 0x630C, 0x6B2C, 0x8C2F, 0xA4D2, 0x9CD2, 0x9CB1, 0xAD53, 0xAD33, 0xAD53, 0xB595, 0xAD54, 0xB595, 0xBDF6, 0xBDD6, 0xBDD6,
+0xBDB6, 0xD679, 0xCE38, 0xC617, 0xC617, 0xC637, 0xC637, 0xC617, 0xCE38, 0xCE38, 0xCE78, 0xCE58, 0xC618, 0xCE38, 0xCE38, 0x18C2,
+0x0861, 0x0841, 0x1082, 0x1082, 0x1062, 0x1062, 0x1082, 0x0861, 0x0861, 0x0021, 0x0861, 0x0841, 0x0841, 0x1082, 0x1081, 0x0861,
+0x0841, 0x0861, 0x0861, 0x0000, 0x0840, 0x4A49, 0x5ACB, 0x632C, 0x632C, 0x736D, 0x73AE, 0x6B6D, 0x73AE, 0x7BCE, 0x8430, 0x8C30,
+0x9CF3, 0x9CF3, 0x9CD2, 0x9CF3, 0xAD34, 0xAD54, 0xAD34, 0xB595, 0x8003, 0xB5B6, 0x0010, 0xC617, 0xC618, 0xC617, 0xC5F7, 0xC638,
+0xC618, 0xC618, 0xCE59, 0xCE58, 0xCE38, 0xCE79, 0xDEDA, 0xE71B, 0xDEFB, 0xDEDB, 0xDEBA, 0x8004, 0xDEDA, 0x0008, 0xD6BA, 0xDEBA,
+0xDEFB, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE6FB, 0x8003, 0xE71B, 0x000E, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xF79E, 0xF79E, 0xF7BE,
+0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0x8003, 0xFFFF, 0x0008, 0xFFDE, 0xF79E, 0xEF7D, 0xF77D, 0xF79D, 0xF7BE,
+0xFFDF, 0xFFFF, 0x8004, 0xFFDE, 0x0002, 0xFFBE, 0xFFDE, 0x8006, 0xFFFF, 0x0004, 0xFFBF, 0xFFBE, 0xFFDF, 0xFFDF, 0x8003, 0xFFFF,
+0x0006, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0x20E3, 0x2103, 0x8013, 0x18E3, 0x0001, 0x20E4, 0x8004, 0x18E3, 0x0002, 0x2104, 0xE71C,
+0x8004, 0xFFFF, 0x0047, 0xF79D, 0xF7BE, 0xDEBA, 0xDEDB, 0xCE59, 0xB575, 0xAD34, 0xA4D2, 0x8C30, 0x9C91, 0x9470, 0x9450, 0x9471,
+0x840F, 0x0820, 0x0841, 0x0820, 0x1062, 0x1882, 0x1061, 0x1060, 0x7B6B, 0xACF1, 0xC572, 0xC572, 0x72E8, 0x6266, 0x49C4, 0x49C5,
+0x41A4, 0x5247, 0x5A48, 0x62AA, 0x5A89, 0x6B2C, 0x9492, 0x9CD3, 0xAD34, 0xAD34, 0xB5B5, 0xBDD6, 0xB594, 0xB595, 0xC5F6, 0xC5F6,
+0xC617, 0xC637, 0xC617, 0xCE58, 0xD679, 0xD699, 0xCE38, 0xD679, 0xCE58, 0xD699, 0xCE78, 0xDEBA, 0xD699, 0xDEBA, 0xE6FB, 0xDEBA,
+0xDEBA, 0xD699, 0xD6BA, 0x1082, 0x0861, 0x1061, 0x1082, 0x18C3, 0x1082, 0x1082, 0x8003, 0x0841, 0x002B, 0x1082, 0x0862, 0x0861,
+0x0841, 0x0861, 0x1082, 0x0841, 0x0861, 0x0861, 0x0000, 0x0020, 0x3165, 0x5289, 0x5AEB, 0x5AEB, 0x632C, 0x6B6D, 0x6B6D, 0x73AE,
+0x7BCE, 0x7BEF, 0x840F, 0x8430, 0x8410, 0x94B2, 0x9471, 0x9491, 0x9CD2, 0xAD34, 0xAD75, 0xB575, 0xBDD6, 0xBDD6, 0xB5B6, 0xBDB6,
+0xC618, 0xC638, 0xCE38, 0xC638, 0xCE59, 0xCE59, 0xCE79, 0xD69A, 0x8003, 0xD6BA, 0x0003, 0xDEBA, 0xDEBA, 0xDEDA, 0x8003, 0xDEDB,
+0x0002, 0xDEDA, 0xDEDB, 0x8003, 0xDEFB, 0x0009, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0x8003,
+0xDEFB, 0x0001, 0xE6FB, 0x8004, 0xEF7D, 0x0005, 0xF79D, 0xF7BE, 0xFFDE, 0xFFBE, 0xF79E, 0x8003, 0xF79D, 0x0004, 0xF79E, 0xF7BE,
+0xFFBE, 0xFFBE, 0x8003, 0xFFDE, 0x000E, 0xF7BE, 0xF7BE, 0xF79D, 0xF77D, 0xF77D, 0xEF7D, 0xEF7D, 0xF79E, 0xFFBE, 0xFFDF, 0xFFDF,
+0xFFFF, 0xFFFF, 0xFFDF, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8004, 0xFFDE, 0x0008, 0xFFFF, 0xFFDE, 0xFFDF, 0x18A2, 0x2104, 0x18C3,
+0x2103, 0x2104, 0x800F, 0x18E3, 0x0003, 0x20E3, 0x20E3, 0x2104, 0x8004, 0x18E3, 0x0039, 0x4A69, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFF,
+0xFFDE, 0xE71B, 0xD699, 0xD679, 0xBDB6, 0xB555, 0x9CB2, 0x9451, 0x9430, 0x9430, 0x8BEF, 0x9430, 0x9430, 0x7BAE, 0x0820, 0x0820,
+0x0841, 0x0861, 0x1082, 0x1081, 0x1040, 0x6AE8, 0xA4AF, 0xC572, 0xBD31, 0x6266, 0x49C4, 0x3983, 0x41E5, 0x4A26, 0x41C5, 0x5247,
+0x5AA9, 0x62EB, 0x9CD2, 0xAD34, 0xB575, 0xBDB6, 0xBDB6, 0xC617, 0xC638, 0xCE58, 0xCE58, 0xD699, 0xC617, 0xD6B9, 0xD679, 0xCE58,
+0xCE58, 0xD658, 0xDEBA, 0xD679, 0x8003, 0xDEBA, 0x000E, 0xD679, 0xDEBA, 0xDEDA, 0xDEBA, 0xD6B9, 0xDEDA, 0xDEDA, 0xDEFB, 0x10A2,
+0x1061, 0x0841, 0x1082, 0x18C3, 0x0841, 0x8004, 0x0861, 0x0020, 0x0841, 0x0862, 0x0841, 0x1082, 0x0841, 0x0861, 0x0861, 0x1081,
+0x1081, 0x0000, 0x20E3, 0x3185, 0x4A69, 0x5AAA, 0x6B4C, 0x632C, 0x6B4D, 0x6B6D, 0x736D, 0x7BEF, 0x73AE, 0x7BEF, 0x7BEF, 0x8430,
+0x840F, 0x9491, 0x9491, 0x94B2, 0x94B2, 0xAD55, 0xAD75, 0xAD75, 0x8004, 0xBDF7, 0x0008, 0xC638, 0xCE38, 0xCE58, 0xCE58, 0xD699,
+0xD6BA, 0xD6BA, 0xDEDA, 0x8003, 0xDEDB, 0x000C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEDB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB,
+0xDEFB, 0xE71B, 0x8003, 0xE71C, 0x0016, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xFFFF, 0xFFDF,
+0xF7BE, 0xF79D, 0xEF7D, 0xF77D, 0xF79D, 0xF79D, 0xEF5C, 0xEF5D, 0xEF7D, 0xF77D, 0xF79D, 0x8004, 0xF79E, 0x0003, 0xF7BE, 0xFFDE,
+0xFFDF, 0x8004, 0xFFFF, 0x001A, 0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFBE, 0xFFDE,
+0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF7BE, 0xFFFF, 0xFFDE, 0xFFDE, 0x2103, 0x18C2, 0x2104, 0x18C3, 0x2104, 0x2104, 0x800E, 0x18E3,
+0x0047, 0x2104, 0x18E3, 0x18C3, 0x18E3, 0x2104, 0x2104, 0x18E3, 0x2104, 0xFFFF, 0xF7BE, 0xFFFF, 0xF7BE, 0xF7BE, 0xE71B, 0xD699,
+0xCE38, 0xB575, 0xB554, 0xA4B2, 0x8BEF, 0x8BCE, 0x93EF, 0x940F, 0x8BCE, 0x83CE, 0x62CA, 0x0841, 0x0820, 0x0841, 0x0861, 0x10A2,
+0x0860, 0x1060, 0x7329, 0xA48F, 0xB511, 0x6AC8, 0x6AC8, 0x3963, 0x4A26, 0x41E6, 0x4A27, 0x4A47, 0x5268, 0x62EA, 0x83EE, 0xAD74,
+0xAD75, 0xBDB7, 0xCE38, 0xC638, 0xCE59, 0xCE59, 0xCE79, 0xCE58, 0xCE58, 0xD699, 0xCE58, 0xD699, 0xCE38, 0xD679, 0xDEBA, 0xD679,
+0xD699, 0xD699, 0xDEDA, 0xDEDA, 0xE6FB, 0xDEDA, 0xDEDA, 0xE71B, 0x8003, 0xDEBA, 0x0028, 0x4A69, 0x0820, 0x10A2, 0x0861, 0x10A2,
+0x0861, 0x1082, 0x1062, 0x0861, 0x0841, 0x0841, 0x1082, 0x0861, 0x0862, 0x10A2, 0x0861, 0x0841, 0x10A2, 0x1081, 0x0020, 0x52AA,
+0x4A28, 0x528A, 0x5AEB, 0x5AEB, 0x6B2C, 0x632C, 0x738E, 0x738D, 0x73AE, 0x7BEF, 0x7BCF, 0x7BEF, 0x840F, 0x8430, 0x8C51, 0x9CF3,
+0xA534, 0xA4F3, 0xA534, 0x8003, 0xBDF7, 0x0019, 0xCE59, 0xD699, 0xD6BA, 0xD69A, 0xD699, 0xCE58, 0xCE59, 0xCE79, 0xDEDA, 0xDEBA,
+0xD69A, 0xDEDA, 0xDEBA, 0xD6BA, 0xDEDA, 0xE71C, 0xEF5C, 0xE73C, 0xE71C, 0xDEFB, 0xE71B, 0xE6FB, 0xE6FB, 0xE71C, 0xE73C, 0x8003,
+0xE71C, 0x0006, 0xE6FB, 0xDEDB, 0xDEDB, 0xE6FB, 0xE71C, 0xE71B, 0x8005, 0xDEFB, 0x000F, 0xEF5C, 0xEF7D, 0xF79D, 0xF7BE, 0xF7BE,
+0xF79E, 0xF79D, 0xF77D, 0xFFFF, 0xFFDF, 0xFFBE, 0xF7BE, 0xF79D, 0xF79D, 0xF79E, 0x8005, 0xF7BE, 0x0004, 0xF79E, 0xF79D, 0xF79D,
+0xF79E, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8005, 0xFFBE, 0x8003, 0xF7BE, 0x000E, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFFF,
+0xEF7D, 0xFFFF, 0x18E3, 0x2103, 0x18E3, 0x2103, 0x2104, 0x2104, 0x800F, 0x18E3, 0x0038, 0x18C3, 0x2124, 0x18C3, 0x18E3, 0x2104,
+0x10A2, 0x18E3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFBE, 0xEF3C, 0xDEDA, 0xC617, 0xC5F7, 0xAD34, 0x9450, 0x8BEF, 0x9430, 0x8BCE, 0x838D,
+0x8BAE, 0x8BCF, 0x6AEB, 0x1020, 0x0000, 0x0841, 0x0841, 0x0861, 0x0881, 0x1081, 0x1020, 0x6AE9, 0x9C4E, 0xBD52, 0x6287, 0x6287,
+0x3984, 0x39C5, 0x41E6, 0x4207, 0x4A47, 0x4A07, 0x9450, 0xB554, 0xBDB6, 0xC617, 0xC618, 0xCE59, 0xCE39, 0xCE59, 0xD679, 0xCE79,
+0xD679, 0xD6B9, 0xD6BA, 0x8003, 0xD699, 0x002C, 0xDEB9, 0xDEBA, 0xDE99, 0xDEBA, 0xE6FB, 0xDEFA, 0xD6B9, 0xDEDA, 0xDEBA, 0xE6FB,
+0xE71B, 0xE71B, 0xDEDA, 0xB595, 0x0861, 0x10A2, 0x0841, 0x10A2, 0x0861, 0x1082, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x0861,
+0x0861, 0x1082, 0x0000, 0x0841, 0x10A2, 0x0861, 0x0000, 0x5AEB, 0x4A69, 0x5289, 0x5ACA, 0x632C, 0x6B2C, 0x738D, 0x738D, 0x6B6D,
+0x7BAE, 0x73AE, 0x8003, 0x7BEF, 0x0032, 0x8C71, 0x9CD2, 0xAD55, 0xB596, 0xB596, 0xB575, 0xB595, 0xC618, 0xCE38, 0xCE38, 0xD699,
+0xD679, 0xCE79, 0xD679, 0xDEBA, 0xDEDB, 0xDEFB, 0xDEDB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB,
+0xDEFB, 0xE71C, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C,
+0xE71B, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xF79E, 0x8003, 0xF79D, 0x0006, 0xF77D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0xF79E,
+0x8005, 0xF7BE, 0x0003, 0xFFBE, 0xF7BE, 0xFFDE, 0x8003, 0xFFFF, 0x0005, 0xFFDF, 0xFFBE, 0xF7BE, 0xF79E, 0xFFBE, 0x8004, 0xFFFF,
+0x0002, 0xFFDF, 0xFFDE, 0x8008, 0xFFFF, 0x0009, 0xF7BE, 0xF79D, 0xFFDF, 0xFFFF, 0x18E3, 0x2104, 0x18E3, 0x2103, 0x2104, 0x800F,
+0x18E3, 0x0075, 0x2104, 0x18C3, 0x18E3, 0x2104, 0x18C3, 0x18E3, 0x2124, 0x18E3, 0xFFFF, 0xFFFF, 0xF7BE, 0xE73C, 0xEF3C, 0xD699,
+0xC5D7, 0xBDB6, 0xA4D3, 0x9430, 0x9C50, 0x8BCE, 0x940F, 0x9C2F, 0x7B2C, 0x838D, 0x7B4D, 0x0800, 0x0821, 0x0821, 0x0020, 0x0861,
+0x0861, 0x1081, 0x1860, 0x51E5, 0x9C2D, 0x6267, 0x5A26, 0x3942, 0x49E5, 0x3984, 0x4A47, 0x4A27, 0x4A07, 0x62CA, 0xA4F2, 0xC5D6,
+0xBD95, 0xCE38, 0xC5F7, 0xCE18, 0xCE38, 0xD679, 0xD69A, 0xD69A, 0xD699, 0xCE58, 0xD699, 0xDEDA, 0xD699, 0xDEDA, 0xDEDA, 0xD699,
+0xDEB9, 0xD699, 0xE71B, 0xD6B9, 0xDEDA, 0xE6FB, 0xDEBA, 0xDEFA, 0xD699, 0xDEBA, 0xDEDA, 0x10A2, 0x0841, 0x0841, 0x0862, 0x0000,
+0x1082, 0x0841, 0x1082, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0861, 0x1082, 0x1082, 0x0861, 0x0000, 0x2944, 0x4A69,
+0x5289, 0x5ACA, 0x632C, 0x630C, 0x6B4D, 0x6B4D, 0x738D, 0x7BCE, 0x73AE, 0x7BCE, 0x7BAE, 0x840F, 0x8C51, 0x9CD3, 0xA534, 0xB595,
+0xBDB6, 0xB5B6, 0xBDB6, 0xBDD7, 0xCE79, 0xD699, 0xCE79, 0x8004, 0xD6BA, 0x0004, 0xDEDA, 0xDEBA, 0xDEDA, 0xD6BA, 0x8003, 0xDEFB,
+0x0017, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71B,
+0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71C, 0xEF3C, 0xEF3C, 0xE71C, 0x8003, 0xDEFB, 0x0015, 0xE6FB, 0xE71B, 0xF7BE, 0xF7BE, 0xFFDE,
+0xFFDF, 0xFFBE, 0xF79D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xF77D, 0xF79E, 0xF7BE,
+0x8006, 0xFFDE, 0x0008, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFBE, 0x8003, 0xF7BE, 0x000C, 0xFFBE, 0xFFDE,
+0xFFDE, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFDE, 0x7BCE, 0x18E3, 0x20E3, 0x18C3, 0x8010, 0x18E3, 0x0039, 0x18C3, 0x2104, 0x10A2,
+0x18E3, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x8C50, 0xFFDE, 0xFFDE, 0xE71C, 0xDEBA, 0xD659, 0xB575, 0xA4B2, 0x9CB2, 0x9410, 0x940F,
+0x8BAE, 0x8BAE, 0x838D, 0x8BCE, 0x732C, 0x0800, 0x0000, 0x1061, 0x0841, 0x0861, 0x0840, 0x1061, 0x1060, 0x1860, 0x5A47, 0x942E,
+0x5A26, 0x5A46, 0x4163, 0x49C5, 0x49E6, 0x5228, 0x4A07, 0x5AA9, 0x8C0E, 0xBD94, 0xC5D6, 0xD678, 0xCE38, 0xD658, 0xD659, 0xD658,
+0xD679, 0xD679, 0xDEBA, 0xDEDA, 0xD679, 0xDEDA, 0x8003, 0xD6BA, 0x003E, 0xDEDA, 0xDEDA, 0xD6B9, 0xDEBA, 0xDEDA, 0xDEDA, 0xDEBA,
+0xD699, 0xE6FB, 0xD699, 0xDEBA, 0xD679, 0x1081, 0x10A2, 0x0861, 0x0841, 0x1082, 0x18C3, 0x0021, 0x0882, 0x1082, 0x0861, 0x10A2,
+0x1082, 0x0861, 0x1082, 0x0861, 0x10A2, 0x1082, 0x0841, 0x0840, 0x31A6, 0x4A69, 0x52AA, 0x630B, 0x5AEA, 0x6B4C, 0x738D, 0x6B4C,
+0x738D, 0x738D, 0x7BCE, 0x7BCF, 0x7BEF, 0x83EF, 0x8C30, 0x94B2, 0xA514, 0xBDF7, 0xC638, 0xD69A, 0xCE59, 0xCE59, 0xCE79, 0xD6BA,
+0xDEBA, 0xDEDA, 0xE71B, 0xE73C, 0xEF5C, 0xE73C, 0xE71C, 0x8003, 0xDEFB, 0x000D, 0xE71C, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB,
+0xDEFB, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0x8003, 0xE6FB, 0x0008, 0xE71B, 0xE71C, 0xE71B, 0xEF3C, 0xE73C, 0xE71C,
+0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x0008, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xEF7D, 0xEF7D, 0xF79D, 0xF79E, 0x8004, 0xF7BE, 0x0008,
+0xEF5C, 0xEF5C, 0xEF7D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0x8004, 0xF7BE, 0x0009, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFFF,
+0xFFFF, 0xFFDE, 0xF7BE, 0xF79E, 0x8003, 0xF7BE, 0x0002, 0xFFDE, 0xFFDF, 0x8003, 0xFFDE, 0x8003, 0xFFFF, 0x0008, 0xFFDE, 0xF79D,
+0xF79E, 0xFFDF, 0xFFDF, 0x18E3, 0x18C3, 0x20E4, 0x8010, 0x18E3, 0x0040, 0x18C3, 0x18E3, 0x2104, 0x2104, 0x18C3, 0x2104, 0x18C3,
+0x18E3, 0x2103, 0x18E3, 0xEF3C, 0xDEBA, 0xD699, 0xB595, 0xB575, 0xA4D2, 0x9450, 0x9C50, 0x8BCE, 0x940F, 0x836C, 0x7B4C, 0x732B,
+0x1040, 0x1041, 0x1882, 0x0841, 0x0020, 0x0841, 0x1041, 0x1041, 0x1861, 0x2060, 0x6247, 0x93CD, 0x7267, 0x6206, 0x5184, 0x51A5,
+0x51A5, 0x51A6, 0x51A5, 0x9C0F, 0xA470, 0xCDB5, 0xCDD5, 0xCDF7, 0xCDD6, 0xD658, 0xD658, 0xD638, 0xDE99, 0xD679, 0xD699, 0xD679,
+0xCE59, 0xD6BA, 0xCE79, 0xD699, 0xCE79, 0xD699, 0xD699, 0xD698, 0xDEDA, 0x8003, 0xD699, 0x000E, 0xDEBA, 0xDEBA, 0xD699, 0x1082,
+0x1081, 0x0861, 0x0840, 0x0861, 0x1082, 0x0841, 0x0862, 0x1082, 0x0841, 0x0021, 0x8003, 0x1082, 0x0021, 0x0861, 0x0841, 0x10A2,
+0x0841, 0x0020, 0x0020, 0x4207, 0x52AA, 0x5AAA, 0x5ACA, 0x6B4C, 0x6B4C, 0x632C, 0x6B4C, 0x7BCE, 0x738D, 0x7BCF, 0x7BCE, 0x7BCE,
+0x8430, 0x9491, 0xA513, 0xBDB6, 0xBDD7, 0xCE59, 0xCE58, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEFB, 0xDEFB, 0xE71B, 0x8004, 0xE73C,
+0x0008, 0xEF5C, 0xEF5D, 0xEF7D, 0xEF5C, 0xEF5C, 0xEF3C, 0xEF5C, 0xDEFB, 0x8003, 0xE71B, 0x8003, 0xE71C, 0x0001, 0xE73C, 0x8004,
+0xE71C, 0x000D, 0xE6FB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71C, 0xE6FB, 0x8003,
+0xDEFB, 0x0028, 0xF79E, 0xF79D, 0xF79D, 0xEF7D, 0xF77D, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0xFFBE, 0xFFDE, 0xF7BE,
+0xEF7D, 0xEF5D, 0xEF7D, 0xF79D, 0xF79E, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFBE, 0xF7BE, 0xEF7D, 0xF77D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFDF,
+0xF7BE, 0xF79E, 0xF77D, 0xF7BE, 0xFFBE, 0xF7BE, 0xF79D, 0xF7BE, 0xFFDE, 0xFFFF, 0x8003, 0xFFDE, 0x0005, 0xFFBE, 0xF79E, 0x2104,
+0x18C3, 0x20E3, 0x8011, 0x18E3, 0x0002, 0x2124, 0x18C3, 0x8006, 0x18E3, 0x0009, 0x2103, 0xE71B, 0xDEBA, 0xC617, 0xBDB6, 0xA4D3,
+0xA4B2, 0x9450, 0x9410, 0x8003, 0x8BCE, 0x0033, 0x838D, 0x4A07, 0x1061, 0x1061, 0x0820, 0x0841, 0x1062, 0x1041, 0x1041, 0x1020,
+0x2040, 0x2820, 0x61C5, 0x8AA8, 0x71C5, 0x58E2, 0x79A5, 0x6923, 0x7165, 0xAB6D, 0xCC71, 0xAB8D, 0xABAE, 0xDD54, 0xD554, 0xD595,
+0xDDF7, 0xD617, 0xDE99, 0xD638, 0xDE99, 0xD679, 0xD699, 0xCE59, 0xDEBA, 0xD6BA, 0xDEDA, 0xDEDA, 0xD699, 0xDEDA, 0xD699, 0xDEFA,
+0xDEFA, 0xD679, 0xDEBA, 0xDEBA, 0xD699, 0xD699, 0x10A1, 0x1061, 0x0820, 0x8003, 0x0861, 0x0039, 0x1082, 0x1082, 0x0021, 0x0841,
+0x0862, 0x0861, 0x10A2, 0x0841, 0x0861, 0x10A2, 0x0841, 0x1081, 0x0840, 0x0020, 0x5AEB, 0x4A48, 0x4A69, 0x62EB, 0x632B, 0x6B4C,
+0x632C, 0x6B4C, 0x6B4C, 0x73AE, 0x6B6D, 0x8C30, 0x7BCE, 0x8430, 0x9491, 0x9CF3, 0xAD55, 0xBDD7, 0xC618, 0xD69A, 0xD6BA, 0xDEDB,
+0xDEDB, 0xDEDA, 0xDEFB, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71B,
+0xE71C, 0xDEFB, 0xE6FB, 0xDEFB, 0xE6FB, 0x8004, 0xE73C, 0x0004, 0xEF5D, 0xEF5C, 0xEF5D, 0xEF5C, 0x8003, 0xE71C, 0x0019, 0xE6FB,
+0xE71C, 0xE6FB, 0xE6FB, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE73C, 0xEF3C, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E,
+0xF79E, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xF79E, 0xF79D, 0xF79E, 0x8003, 0xF7BE, 0x000C, 0xFFBE, 0xF7BE, 0xF79D, 0xEF7D, 0xEF5D,
+0xEF5D, 0xEF7D, 0xF77D, 0xF79D, 0xFFDE, 0xF7BE, 0xF79E, 0x8003, 0xF7BE, 0x0003, 0xF79E, 0xF79E, 0xFFBE, 0x8003, 0xFFDE, 0x8003,
+0xFFFF, 0x0008, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFBF, 0xFFBF, 0x2104, 0x8011, 0x18E3, 0x0008, 0x2104, 0x18C3, 0x20E4,
+0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x8003, 0x2103, 0x003F, 0x20E3, 0xC617, 0xBDB6, 0xA4F3, 0x9C92, 0x9C91, 0x940F, 0x940F,
+0x8BAE, 0x62AA, 0x1040, 0x1061, 0x1040, 0x1041, 0x1082, 0x1041, 0x1841, 0x1000, 0x2020, 0x2800, 0x3000, 0x58A1, 0x9A89, 0xA289,
+0xAA88, 0xB268, 0xAA28, 0xAA28, 0xBAAA, 0xB269, 0xAA89, 0xAA49, 0xAAAA, 0x9A28, 0x9A89, 0xCC2F, 0xBC2F, 0xAC2F, 0xD5D5, 0xD5F6,
+0xD637, 0xD658, 0xE6DA, 0xD658, 0xD699, 0xD699, 0xDEBA, 0xDEFA, 0xCE78, 0xDEDA, 0xDED9, 0xDEDA, 0xCE78, 0xDEDA, 0xD679, 0xCE78,
+0xDEBA, 0x18C2, 0x1081, 0x0841, 0x1081, 0x0820, 0x0841, 0x8004, 0x0862, 0x0033, 0x1082, 0x0862, 0x0861, 0x0861, 0x1082, 0x0841,
+0x0861, 0x0861, 0x0840, 0x3185, 0x4208, 0x4A69, 0x5ACA, 0x5B0B, 0x62EB, 0x6B6C, 0x6B2C, 0x736D, 0x736D, 0x738D, 0x73AE, 0x7BCE,
+0x8430, 0x8430, 0x8C50, 0xA534, 0xB595, 0xBDF7, 0xC5F8, 0xD67A, 0xDEDB, 0xE71C, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C, 0xE73C,
+0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xE71B, 0xE71C, 0xE6FB, 0x8003, 0xE71B, 0x8003,
+0xE73C, 0x0005, 0xEF3C, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0x8003, 0xE6FB, 0x001F, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xE6FB, 0xE71C,
+0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5D, 0xEF7D, 0xF79D, 0xF77D, 0xEF7D,
+0xEF7D, 0xF79E, 0xF7BE, 0xF7BE, 0xF79D, 0xEF7D, 0xF77D, 0xEF7D, 0xF7BE, 0x8003, 0xFFFF, 0x0019, 0xFFBE, 0xFFBE, 0xFFDE, 0xF79E,
+0xFFBE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDE,
+0xF7BE, 0xFFDE, 0xFFBE, 0xFFDF, 0xF79E, 0x8005, 0x18E3, 0x0001, 0x2104, 0x8003, 0x18E3, 0x0001, 0x2104, 0x8008, 0x18E3, 0x0006,
+0x1903, 0x18E3, 0x20E3, 0x20E3, 0x20E4, 0x20E4, 0x8004, 0x18E3, 0x001E, 0x2103, 0x18E3, 0x18C2, 0x2103, 0x18C2, 0x2103, 0x20C2,
+0x1881, 0x28E3, 0x20A2, 0x1061, 0x1882, 0x1041, 0x1882, 0x1861, 0x1020, 0x1841, 0x1800, 0x3000, 0x4840, 0xA269, 0xBA8A, 0xBA48,
+0xC248, 0xBA27, 0xC268, 0xB9E6, 0xC228, 0xCA68, 0xC207, 0x8003, 0xC228, 0x0024, 0xBA27, 0xBA48, 0xBA48, 0xB227, 0xAA68, 0x9A88,
+0xCCB0, 0xBCD1, 0xBD32, 0xC5D5, 0xC5F6, 0xC5F6, 0xCE37, 0xD658, 0xDE79, 0xDE78, 0xDEB9, 0xDEB9, 0xD698, 0xD699, 0xD698, 0xD699,
+0xCE58, 0x52A9, 0x0840, 0x1081, 0x0840, 0x1081, 0x0841, 0x0861, 0x1062, 0x1062, 0x0862, 0x1062, 0x10A2, 0x1082, 0x8005, 0x0861,
+0x0021, 0x0841, 0x0840, 0x4207, 0x4A48, 0x5289, 0x5ACA, 0x5ACA, 0x6B2C, 0x632B, 0x6B4C, 0x7BCE, 0x73AE, 0x73AE, 0x738D, 0x7BEF,
+0x8430, 0x8410, 0xA513, 0xB596, 0xB575, 0xC617, 0xD679, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xEF7D, 0xEF5D, 0xEF5C, 0xE73C,
+0xE73C, 0xE71C, 0x8003, 0xE71B, 0x0001, 0xE6FB, 0x8004, 0xDEFB, 0x0007, 0xE6FB, 0xE71B, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB,
+0x8008, 0xDEFB, 0x0010, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEDA, 0xDEDB, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE71C,
+0xE71C, 0xE73C, 0xE73C, 0x8004, 0xF79E, 0x000B, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E,
+0xF79E, 0x8003, 0xF7BE, 0x0024, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFBE, 0xF79E, 0xF77D, 0xF7BE, 0xFFDE, 0xFFBE, 0xF7BE, 0xFFDF, 0xFFDF,
+0xF7BE, 0xF79E, 0xF77D, 0xF79D, 0xF77D, 0xEF7D, 0xF77D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF,
+0x20E3, 0x18E3, 0x18E3, 0x2124, 0x18C3, 0x2104, 0x18C3, 0x18C3, 0x800A, 0x18E3, 0x0076, 0x1903, 0x18E3, 0x20E3, 0x20C3, 0x20E4,
+0x20E4, 0x18E3, 0x18E3, 0x18C3, 0x2103, 0x18E3, 0x18E3, 0x2103, 0x18E3, 0x18C3, 0x20E3, 0x2103, 0x20E3, 0x1081, 0x1882, 0x1082,
+0x1041, 0x1882, 0x1021, 0x1820, 0x2821, 0x2800, 0x3800, 0x8A07, 0xB289, 0xBA28, 0xC207, 0xC1E7, 0xCA07, 0xCA27, 0xC9E7, 0xC9C6,
+0xD228, 0xC1C6, 0xD207, 0xCA07, 0xC9E7, 0xC9E7, 0xCA27, 0xC207, 0xC207, 0xCA28, 0xBA07, 0xB267, 0x8163, 0xDCF1, 0xBC6F, 0xB4F1,
+0xCDD4, 0xD636, 0xC5B5, 0xD616, 0xDE57, 0xD637, 0xDE98, 0xDE98, 0xD678, 0xDE98, 0xDEB9, 0xD678, 0xBDB6, 0x10A2, 0x0840, 0x1081,
+0x0840, 0x0861, 0x0841, 0x10A3, 0x0862, 0x0021, 0x0041, 0x1082, 0x10A2, 0x1081, 0x0861, 0x1082, 0x0861, 0x0840, 0x0861, 0x0861,
+0x0020, 0x2924, 0x5289, 0x5ACA, 0x52AA, 0x62EB, 0x630B, 0x6B4C, 0x73AE, 0x6B6C, 0x7BCE, 0x73AE, 0x83EF, 0x7BEF, 0x9491, 0x94B2,
+0xB575, 0xBDF7, 0xBDB6, 0xD699, 0xD699, 0xDEDB, 0xE6FB, 0xE71C, 0xEF5C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C,
+0xE71C, 0x8003, 0xE71B, 0x8003, 0xDEFB, 0x0011, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xDEFB,
+0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x0004, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0x8003, 0xE71C,
+0x0005, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0x8005, 0xF79D, 0x8003, 0xF79E, 0x0006, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE,
+0xFFDE, 0x8003, 0xFFBE, 0x8003, 0xF7BE, 0x8003, 0xF79E, 0x000D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xFFBE, 0xF7BE, 0xF79D,
+0xEF7D, 0xF79D, 0xF7BE, 0xFFBE, 0xF7BE, 0x8003, 0xFFDE, 0x0008, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFFF,
+0x8004, 0x18E3, 0x0005, 0x18C3, 0x2104, 0x18E3, 0x18C3, 0x2104, 0x8008, 0x18E3, 0x0006, 0x1903, 0x18E3, 0x20E3, 0x20E3, 0x20E4,
+0x18E4, 0x8006, 0x18E3, 0x001F, 0x20E3, 0x18C2, 0x2104, 0x18C2, 0x18C2, 0x20E3, 0x10A2, 0x18E3, 0x0882, 0x18C3, 0x1041, 0x2081,
+0x2820, 0x3800, 0xA2AA, 0xA208, 0xBA49, 0xC208, 0xC1C7, 0xD228, 0xCA07, 0xD248, 0xCA07, 0xC9E6, 0xD227, 0xD227, 0xC9E7, 0xD207,
+0xCA07, 0xD207, 0xC9E6, 0x8004, 0xCA07, 0x001A, 0xC206, 0xC227, 0xB227, 0xB288, 0xDC8F, 0xCCB0, 0xCD52, 0xC572, 0xCDF4, 0xB511,
+0xCDB3, 0xCD93, 0xD5F4, 0xC572, 0xC593, 0xDE36, 0xC5D5, 0xB574, 0x1081, 0x0840, 0x0861, 0x0861, 0x1082, 0x0861, 0x10A2, 0x0841,
+0x8004, 0x0861, 0x0024, 0x0841, 0x0861, 0x10A2, 0x0020, 0x1081, 0x1081, 0x0020, 0x39C6, 0x41E7, 0x4A69, 0x5289, 0x5ACA, 0x6B2C,
+0x632C, 0x6B4C, 0x6B4C, 0x6B6D, 0x7BEF, 0x73AE, 0x7BAE, 0x8410, 0x8430, 0xA534, 0xB595, 0xC617, 0xCE58, 0xCE79, 0xD69A, 0xDEDB,
+0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71C, 0x8004, 0xE71B, 0x8003, 0xDEFB, 0x8003, 0xE6FB, 0x8005, 0xE71B, 0x8006,
+0xE73C, 0x000B, 0xEF3C, 0xEF5C, 0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEDB, 0x8005, 0xDEFB, 0x0009,
+0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xFFDE, 0xFFBE, 0xF79E, 0x8005, 0xF79D, 0x0003, 0xF79E, 0xF7BE, 0xFFBE, 0x8003,
+0xFFFF, 0x0004, 0xFFDF, 0xFFDE, 0xF7BE, 0xFFDE, 0x8006, 0xFFFF, 0x0004, 0xF7BE, 0xFFDE, 0xF7BE, 0xF79E, 0x8004, 0xF7BE, 0x0001,
+0xFFBE, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8003, 0xFFDE, 0x000A, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xF79D, 0xEF7D, 0x2104,
+0x18C3, 0x2104, 0x8003, 0x18E3, 0x0002, 0x18C3, 0x2104, 0x800B, 0x18E3, 0x0004, 0x20E3, 0x20E3, 0x20E4, 0x18E4, 0x8003, 0x18E3,
+0x001B, 0x2103, 0x18E3, 0x18C2, 0x2104, 0x20C3, 0x18C3, 0x20E3, 0x20C3, 0x18A2, 0x1903, 0x10C3, 0x10C2, 0x1882, 0x2061, 0x2820,
+0x4040, 0x9A48, 0xAA28, 0xBA07, 0xC9E7, 0xD208, 0xD1E7, 0xD207, 0xD227, 0xC9E7, 0xC9E7, 0xC9E6, 0x8003, 0xD207, 0x0025, 0xC9E6,
+0xD207, 0xC9E7, 0xD227, 0xC9C6, 0xC9E7, 0xD227, 0xC1C6, 0xCA07, 0xCA07, 0xC1E6, 0xC247, 0x8922, 0xCBED, 0xD4F0, 0xCD51, 0xC591,
+0xD5F3, 0xCDD3, 0xDE14, 0xC551, 0xE655, 0xCDD4, 0xCDB3, 0x8BCD, 0x18C2, 0x1061, 0x1081, 0x1081, 0x0841, 0x1082, 0x10A2, 0x0861,
+0x0020, 0x0861, 0x0861, 0x0840, 0x8003, 0x0861, 0x0023, 0x1081, 0x1081, 0x0861, 0x0000, 0x5AEB, 0x39E7, 0x4A48, 0x5289, 0x630B,
+0x6B2C, 0x632C, 0x632C, 0x738D, 0x738D, 0x6B8D, 0x7BEE, 0x7BCE, 0x83EF, 0x8430, 0x9CF3, 0xBDF7, 0xBDD7, 0xD679, 0xD6BA, 0xDEDA,
+0xE73C, 0xDEFB, 0xE71C, 0xE73C, 0xDEFB, 0xE6FB, 0xE73C, 0xDEFB, 0xE71B, 0xE71B, 0x8003, 0xE6FB, 0x0002, 0xE71B, 0xE71B, 0x8006,
+0xE71C, 0x0003, 0xE71B, 0xE71B, 0xE6FB, 0x8008, 0xE73C, 0x0028, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B,
+0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xF7BE, 0xF79E, 0xF79D, 0xF77D,
+0xF79D, 0xF79E, 0xF7BE, 0xFFBE, 0xEF5D, 0xEF7D, 0xF79D, 0xF7BE, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E,
+0x8004, 0xF7BE, 0x0006, 0xF77D, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0x8003, 0xF7BE, 0x0010, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDF,
+0xFFBE, 0xF7BE, 0xF7BE, 0xFFFF, 0xF79E, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xF79E, 0x2104, 0x8003, 0x18E3, 0x0004, 0x2104,
+0x2104, 0x18E3, 0x18C3, 0x800A, 0x18E3, 0x0002, 0x20E3, 0x20C3, 0x8004, 0x18E3, 0x0064, 0x1903, 0x18E3, 0x18E3, 0x20E3, 0x20C3,
+0x20C3, 0x20E4, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x1882, 0x30A2, 0x3020, 0x7986, 0xA228, 0xBA68, 0xB9E7, 0xD207, 0xDA07,
+0xD1C6, 0xDA27, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xC9E7, 0xC1A6, 0xDA28, 0xC9C6, 0xD1E7, 0xD207, 0xC9C6, 0xD207, 0xC9E7,
+0xC9C6, 0xD248, 0xC9E7, 0xD1E7, 0xC9C6, 0xC9E7, 0xC227, 0x9163, 0xCBEC, 0xCCCF, 0xD591, 0xCDB1, 0xDE33, 0xCD92, 0xE635, 0xC572,
+0xDE15, 0xD615, 0x20C1, 0x1081, 0x0861, 0x0841, 0x0821, 0x0841, 0x1083, 0x0841, 0x0862, 0x0861, 0x0861, 0x0040, 0x0040, 0x0881,
+0x1082, 0x1081, 0x0861, 0x10A2, 0x0000, 0x1081, 0x39C6, 0x4228, 0x52AA, 0x5ACA, 0x62EB, 0x632C, 0x6B4C, 0x738D, 0x6B4C, 0x738D,
+0x7BEE, 0x7BCE, 0x7BEF, 0x840F, 0xA534, 0xAD75, 0xBDD6, 0xC638, 0xD6BA, 0xD679, 0xDEDB, 0xE71C, 0xE71C, 0xDEFB, 0xDEDB, 0x8003,
+0xDEFB, 0x0002, 0xE71C, 0xE6FB, 0x8006, 0xE71B, 0x0001, 0xE6FB, 0x8003, 0xDEFB, 0x8003, 0xDEDB, 0x0003, 0xDEFB, 0xDEFB, 0xE71B,
+0x8003, 0xE6FB, 0x8012, 0xDEFB, 0x0001, 0xE6FB, 0x8005, 0xE71B, 0x0003, 0xFFFF, 0xFFDF, 0xFFDE, 0x8003, 0xF7BE, 0x0004, 0xF79E,
+0xF79E, 0xF7BE, 0xF7BE, 0x8003, 0xF79E, 0x0004, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF, 0x8004, 0xFFFF, 0x0005, 0xFFDE, 0xF7BE, 0xF79E,
+0xFFFF, 0xFFFF, 0x8003, 0xFFDE, 0x0005, 0xFFBE, 0xF79D, 0xEF7D, 0xF7BE, 0xFFDF, 0x8006, 0xFFFF, 0x0008, 0xEF7D, 0xFFBE, 0xF7BE,
+0xFFDE, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFDF, 0x8007, 0x18E3, 0x0001, 0x2104, 0x800A, 0x18E3, 0x0002, 0x20E3, 0x20E3, 0x8004, 0x18E3,
+0x006C, 0x18C3, 0x2124, 0x18E3, 0x18C3, 0x20E4, 0x20C3, 0x18E4, 0x1904, 0x18C3, 0x20E3, 0x18C3, 0x2082, 0x3082, 0x3841, 0x9A49,
+0xAA29, 0xBA28, 0xC207, 0xC9E6, 0xC9C5, 0xDA06, 0xD1E6, 0xC9E6, 0xD207, 0xD207, 0xC9C6, 0xD228, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7,
+0xD207, 0xD1E7, 0xC9C6, 0xD207, 0xC9E7, 0xC9E7, 0xD207, 0xCA07, 0xD207, 0xD1E7, 0xD207, 0xD1E7, 0xCA07, 0xC248, 0x91A4, 0xCC0D,
+0xC48E, 0xCD50, 0xCD70, 0xDE13, 0xCD92, 0xDE15, 0xDE36, 0xCDF5, 0x1860, 0x1060, 0x1061, 0x0841, 0x1083, 0x0841, 0x18C3, 0x1082,
+0x0021, 0x0861, 0x0840, 0x0861, 0x0881, 0x1081, 0x0861, 0x0861, 0x1081, 0x0840, 0x4228, 0x31A6, 0x41E7, 0x5289, 0x630B, 0x5ACA,
+0x630B, 0x632C, 0x6B6D, 0x6B6D, 0x73AE, 0x73AE, 0x738D, 0x8430, 0x8C71, 0x9CD3, 0xB5B6, 0xBDD7, 0xCE79, 0xD679, 0xDEDA, 0xE73C,
+0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xE73C, 0xDEFB, 0xDEFB, 0xE73C, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0x8004, 0xDEFB, 0x0002,
+0xE71B, 0xE71B, 0x8006, 0xE71C, 0x0002, 0xE6FB, 0xE6FB, 0x8006, 0xE71B, 0x0001, 0xDEFB, 0x8003, 0xDEDB, 0x8003, 0xDEFB, 0x0008,
+0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0x8005, 0xE71C, 0x8004, 0xF7BE, 0x0002, 0xFFDE, 0xFFBE, 0x8004,
+0xF7BE, 0x0006, 0xF79E, 0xF79D, 0xEF7D, 0xF77D, 0xF79E, 0xFFBE, 0x8004, 0xF7BE, 0x000E, 0xF79D, 0xF77D, 0xF79D, 0xF7BE, 0xFFDF,
+0xFFDF, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0x8003, 0xF79E, 0x0003, 0xF79D, 0xF79D, 0xF7BE, 0x8003,
+0xFFFF, 0x000D, 0xFFDE, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x10A2, 0x2103, 0x2124, 0x18C3, 0x2103, 0x18E3, 0x18C3, 0x8008,
+0x18E3, 0x0004, 0x18E4, 0x18E4, 0x20E3, 0x20E3, 0x8004, 0x18E3, 0x001E, 0x18E4, 0x18E3, 0x18E4, 0x18E3, 0x20E4, 0x18C3, 0x1904,
+0x18E3, 0x18E2, 0x20E3, 0x28C3, 0x3061, 0x4841, 0xA24A, 0xB209, 0xC228, 0xCA27, 0xC9E6, 0xD226, 0xD206, 0xC9C5, 0xD206, 0xD227,
+0xCA07, 0xCA07, 0xD207, 0xC9E7, 0xC9C6, 0xD1E7, 0xD207, 0x8003, 0xD1E7, 0x0047, 0xD207, 0xD1E7, 0xC9C6, 0xD1E7, 0xD207, 0xC9C6,
+0xD207, 0xC1C6, 0xCA08, 0xC9E7, 0xC1C6, 0xCA28, 0xBA27, 0x91C5, 0xC40D, 0xD530, 0xD5B2, 0xCDD3, 0xDE55, 0xDE77, 0xC5B5, 0x2081,
+0x1861, 0x1061, 0x0861, 0x0861, 0x10A2, 0x10A3, 0x0862, 0x0021, 0x1082, 0x0861, 0x0040, 0x0861, 0x10A1, 0x1081, 0x0861, 0x0861,
+0x0841, 0x0000, 0x2124, 0x39E7, 0x4A48, 0x5289, 0x5ACA, 0x5AEB, 0x632C, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x840F, 0x9CD2,
+0x94D2, 0xAD75, 0xBDD7, 0xBDF7, 0xD69A, 0xDEDB, 0xDEBA, 0xE73C, 0xE71B, 0xDEDA, 0xDEFB, 0xDEDB, 0xDEFB, 0xE73C, 0xE71B, 0xDEFB,
+0xDEDB, 0x8003, 0xDEFB, 0x000A, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0x8003, 0xE71B,
+0x0005, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xE71C, 0x8003, 0xE71B, 0x0001, 0xE71C, 0x8003, 0xE71B, 0x0007, 0xE71C, 0xE71C, 0xE71B,
+0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0x8007, 0xE73C, 0x0007, 0xE71B, 0xDEFB, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDE, 0x8003, 0xF7BE,
+0x0005, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDE, 0x8004, 0xF7BE, 0x0003, 0xF79E, 0xF79E, 0xF7BE, 0x8004, 0xFFDE, 0x0009, 0xEF7D,
+0xF79E, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDF, 0x8003, 0xFFFF, 0x0009, 0xFFDF, 0xF7BE, 0xF79D, 0xF77D, 0xF7BE,
+0xFFDE, 0xF7BE, 0xFFFF, 0xFFDE, 0x8003, 0xFFFF, 0x0007, 0xFFDF, 0xFFFF, 0x2124, 0x18C2, 0x18E3, 0x18E3, 0x2104, 0x8009, 0x18E3,
+0x0027, 0x18E4, 0x18E4, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E4, 0x18C3, 0x2125, 0x10A3, 0x2104, 0x20E4, 0x18E3,
+0x1903, 0x2103, 0x20C2, 0x3061, 0x5062, 0xAA4A, 0xBA09, 0xCA29, 0xCA07, 0xC9E6, 0xCA06, 0xD206, 0xD206, 0xD207, 0xD206, 0xCA06,
+0xCA27, 0xC9E7, 0xD207, 0xD1E7, 0xC9E7, 0xD1E7, 0xC9C6, 0xD207, 0x8004, 0xD1E7, 0x004B, 0xD207, 0xD1E7, 0xD1E7, 0xD207, 0xC9E7,
+0xCA07, 0xC1C6, 0xD228, 0xD208, 0xC9E7, 0xCA48, 0xA9E6, 0x8983, 0xCC8E, 0xCD30, 0xD5D3, 0xE696, 0xC5B4, 0x20A1, 0x1041, 0x1061,
+0x1082, 0x0861, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x0841, 0x0882, 0x0882, 0x0861, 0x1082, 0x1082, 0x0840, 0x0841, 0x0861, 0x0840,
+0x738D, 0x39A6, 0x4228, 0x4A69, 0x5AEB, 0x632C, 0x6B4D, 0x6B2C, 0x738D, 0x73AE, 0x7BCE, 0x73AE, 0x7BEF, 0x8430, 0x9CF3, 0xAD75,
+0xBDF7, 0xCE58, 0xD699, 0xDEDA, 0xE71C, 0xE6FB, 0xE71C, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xE71C, 0xE6FB, 0xDEDB, 0xE71B, 0xE73C,
+0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0x8003, 0xE71C, 0x000F, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C,
+0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0x8004, 0xDEFB, 0x8003, 0xDEDB, 0x0002, 0xDEDA, 0xDEDB, 0x8003,
+0xDEFB, 0x0002, 0xE6FB, 0xE6FB, 0x8003, 0xDEFB, 0x0003, 0xDEDB, 0xDEDB, 0xDEDA, 0x8004, 0xF7BE, 0x0001, 0xFFDE, 0x8003, 0xFFDF,
+0x8004, 0xF7BE, 0x0006, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFBE, 0x800A, 0xF7BE, 0x0002, 0xFFBE, 0xFFDE, 0x8003, 0xFFFF,
+0x0001, 0xFFDF, 0x8003, 0xFFDE, 0x0018, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xF79E, 0xFFFF, 0xFFDE, 0xF7BE, 0xFFFF, 0xFFDF,
+0xFFDE, 0xFFFF, 0xF77D, 0x2103, 0x18C3, 0x18C3, 0x2103, 0x18C2, 0x18E3, 0x2104, 0x18E3, 0x18C3, 0x20E3, 0x8003, 0x18E3, 0x000D,
+0x18E4, 0x18E4, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x20E4, 0x20E4, 0x20C4, 0x2104, 0x18C3, 0x2104, 0x18C3, 0x8003, 0x18E3, 0x0018,
+0x20A1, 0x38E2, 0x4020, 0xB26A, 0xB9E8, 0xD228, 0xCA07, 0xC9E6, 0xCA06, 0xCA06, 0xD207, 0xD207, 0xD1E7, 0xD1E6, 0xC9E6, 0xD207,
+0xC9E7, 0xC9E6, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0x8005, 0xD1E7, 0x0003, 0xC9E7, 0xC9E7, 0xCA07, 0x8004, 0xC9E7,
+0x0018, 0xC9E6, 0xC1E6, 0xC227, 0xB267, 0x7983, 0xD4F0, 0xCD92, 0xBD52, 0x1880, 0x1881, 0x1041, 0x1041, 0x10A2, 0x0861, 0x18C3,
+0x0861, 0x1082, 0x1082, 0x0020, 0x1082, 0x1082, 0x0861, 0x0862, 0x1082, 0x8003, 0x0821, 0x0021, 0x1082, 0x3165, 0x41E7, 0x4A69,
+0x5289, 0x5ACA, 0x630B, 0x632C, 0x6B4D, 0x738D, 0x7BCE, 0x7BEF, 0x8C30, 0x9CF3, 0xAD54, 0xBDD6, 0xC617, 0xCE58, 0xCE79, 0xDEFB,
+0xE71B, 0xE71B, 0xDEDB, 0xE71C, 0xDEDA, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0x8003, 0xE71B, 0x0001,
+0xE6FB, 0x8003, 0xDEFB, 0x0025, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xE71C, 0xE73C, 0xE71C,
+0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71C,
+0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0x8004, 0xF79E, 0x8004, 0xF7BE, 0x0003, 0xFFFF, 0xFFFF,
+0xFFDF, 0x8004, 0xF7BE, 0x0009, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0x8005, 0xF79E, 0x0006,
+0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE, 0x8003, 0xFFDE, 0x001C, 0xFFBE, 0xF7BE, 0xF79E, 0xFFDE, 0xFFBE, 0xFFDF, 0xFFDF,
+0xFFFF, 0xFFDE, 0xFFDF, 0xF7BE, 0xFFDE, 0xFFFF, 0x31A6, 0x2103, 0x18C3, 0x18E3, 0x2104, 0x20E3, 0x18C3, 0x20E3, 0x20E4, 0x18E3,
+0x18E3, 0x2104, 0x18E3, 0x18E4, 0x18E4, 0x8004, 0x18E3, 0x0011, 0x20E4, 0x20C4, 0x20E4, 0x20E4, 0x18E4, 0x18E4, 0x10A2, 0x2104,
+0x20C2, 0x28C2, 0x30A1, 0x4881, 0xA249, 0xC249, 0xD208, 0xDA28, 0xCA07, 0x8003, 0xCA27, 0x000B, 0xD207, 0xD1E7, 0xD1E7, 0xD1C7,
+0xD1E7, 0xD1E7, 0xD207, 0xCA07, 0xD1E7, 0xD207, 0xD1E7, 0x8003, 0xC9E7, 0x8004, 0xD1E7, 0x8003, 0xC9E7, 0x003B, 0xD1E7, 0xD207,
+0xCA07, 0xCA07, 0xC9E6, 0xD227, 0xCA07, 0xCA06, 0xC227, 0xAA66, 0xD46E, 0xC4AF, 0xCD93, 0x1840, 0x1060, 0x1061, 0x1882, 0x1061,
+0x18C3, 0x0840, 0x1081, 0x1081, 0x0840, 0x10A1, 0x0861, 0x0861, 0x1082, 0x0862, 0x0021, 0x0841, 0x0820, 0x630C, 0x2944, 0x31A5,
+0x4A68, 0x4A28, 0x52AA, 0x5AEB, 0x62EB, 0x6B6D, 0x738E, 0x7BCE, 0x73AE, 0x73AE, 0x840F, 0x9CF3, 0xAD54, 0xBDF7, 0xC638, 0xD6BA,
+0xDEBA, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xE71C, 0xE71C, 0x8006, 0xE71B, 0x000D, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C,
+0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0x8003, 0xE73C, 0x000C, 0xDEDA, 0xDEDB, 0xDEDA, 0xDEDB,
+0xE71B, 0xE71C, 0xE71B, 0xE71C, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB, 0x8008, 0xDEFB, 0x0005, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C,
+0x8003, 0xE71B, 0x0004, 0xFFDF, 0xFFDE, 0xFFDE, 0xF7BE, 0x8004, 0xF79E, 0x0003, 0xFFBE, 0xFFBE, 0xFFDE, 0x8003, 0xFFFF, 0x0005,
+0xFFDF, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0x8003, 0xFFDE, 0x0002, 0xFFBE, 0xFFBE, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8003, 0xFFDE,
+0x0003, 0xFFDF, 0xFFDF, 0xFFDE, 0x8003, 0xF7BE, 0x0003, 0xFFDE, 0xFFDF, 0xFFDF, 0x8003, 0xFFFF, 0x0017, 0xFFDE, 0xFFBE, 0xFFFF,
+0xF7BE, 0xFFDE, 0xF79D, 0xFFDE, 0xFFDE, 0xF7BE, 0xFFDE, 0x2103, 0x18E3, 0x18C3, 0x18E3, 0x20E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3,
+0x18E3, 0x18E3, 0x18E4, 0x18E4, 0x8004, 0x18E3, 0x0015, 0x20E4, 0x20E4, 0x20C4, 0x20E4, 0x18E3, 0x18E3, 0x2124, 0x20C2, 0x28C2,
+0x38A1, 0x4861, 0xAA8A, 0xBA08, 0xCA08, 0xD207, 0xD1E6, 0xC9E6, 0xC1E5, 0xCA27, 0xCA07, 0xD1E7, 0x8003, 0xD1C7, 0x000B, 0xD1E7,
+0xD207, 0xD207, 0xCA07, 0xCA07, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD207, 0xD1E7, 0x8007, 0xC9E7, 0x0036, 0xD207, 0xC9C6, 0xCA07,
+0xC9E6, 0xD207, 0xC9E6, 0xD227, 0xC1E6, 0xBA27, 0xAA47, 0xC3ED, 0x4902, 0x2080, 0x1060, 0x1061, 0x0861, 0x0862, 0x0861, 0x1081,
+0x0861, 0x0840, 0x10A1, 0x0860, 0x1081, 0x0861, 0x0841, 0x0821, 0x1062, 0x0841, 0x6B2C, 0x2945, 0x39A6, 0x39C6, 0x4227, 0x5269,
+0x630B, 0x5AEB, 0x6B4C, 0x6B6D, 0x7BAE, 0x736D, 0x7BEF, 0x8C51, 0xA514, 0xB596, 0xC618, 0xCE79, 0xD699, 0xDEDA, 0xE71B, 0xE6FB,
+0xE71C, 0xE71B, 0xE71C, 0x8003, 0xDEFB, 0x0006, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xE6FB, 0xE6FB, 0x8005, 0xE71B, 0x0005, 0xE6FB,
+0xE6FB, 0xE71C, 0xE73C, 0xE71C, 0x8003, 0xE73C, 0x0004, 0xE71C, 0xDEFB, 0xDEDB, 0xDEBA, 0x8003, 0xDEDB, 0x0002, 0xDEFB, 0xE71C,
+0x8007, 0xE73C, 0x0004, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0x8003, 0xE6FB, 0x8003, 0xDEFB, 0x000E, 0xE71B, 0xE73C, 0xE71C, 0xE71B,
+0xDEFB, 0xDEFB, 0xEF7D, 0xF79D, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0x8003, 0xFFFF, 0x0010, 0xFFDE, 0xF79E, 0xF79E,
+0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFBE, 0x8003, 0xF7BE, 0x8004,
+0xFFBE, 0x001F, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFDE, 0xF79D, 0xFFFF, 0xFFFF, 0xFFDE,
+0xF7BE, 0xF7BE, 0xFFDE, 0xF79D, 0xFFDE, 0x6B4C, 0x18C3, 0x2104, 0x18C3, 0x20E3, 0x18E3, 0x18E3, 0x2104, 0x20E3, 0x18C3, 0x20E3,
+0x18E4, 0x8005, 0x18E3, 0x001A, 0x20E4, 0x20E4, 0x20A3, 0x20E4, 0x18E4, 0x2124, 0x10A1, 0x28C2, 0x3881, 0x4861, 0xAA8A, 0xB228,
+0xCA28, 0xD1E7, 0xD9E7, 0xC9C5, 0xD206, 0xD247, 0xCA07, 0xD1E7, 0xD1C7, 0xD1C7, 0xD1E7, 0xD1E8, 0xD1E7, 0xD207, 0x8003, 0xC9E7,
+0x0006, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0x8005, 0xD1E7, 0x0038, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9E6, 0xC9E6, 0xC9C6,
+0xD207, 0xC9E6, 0xC9E6, 0xD207, 0xC9E7, 0xC248, 0x8984, 0x3800, 0x1800, 0x1860, 0x1081, 0x0861, 0x0021, 0x1082, 0x0861, 0x0881,
+0x1081, 0x0860, 0x10A1, 0x0860, 0x0841, 0x0841, 0x0861, 0x0000, 0x4207, 0x3165, 0x39E6, 0x4207, 0x4A48, 0x5ACA, 0x5AAA, 0x630B,
+0x6B4C, 0x6B6D, 0x738D, 0x840F, 0x7BEF, 0x9471, 0xAD55, 0xB596, 0xC638, 0xC638, 0xD6BA, 0xDEDA, 0xE73C, 0xE71C, 0xDEDA, 0xDEFB,
+0xDEFB, 0xE73C, 0x8003, 0xDEFB, 0x0005, 0xE71B, 0xE73C, 0xEF3C, 0xE73C, 0xE71B, 0x8004, 0xDEFB, 0x0006, 0xE71B, 0xE71C, 0xE71C,
+0xE71B, 0xE6FB, 0xDEFB, 0x8004, 0xE71B, 0x0001, 0xE71C, 0x8003, 0xE73C, 0x0004, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0x8004, 0xE71C,
+0x8003, 0xE73C, 0x0001, 0xE71C, 0x8003, 0xE71B, 0x8004, 0xE71C, 0x0009, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xEF5C, 0xE73C,
+0xE71B, 0xDEFB, 0x8003, 0xFFDE, 0x0002, 0xFFDF, 0xFFDF, 0x8003, 0xFFDE, 0x0004, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0x8003, 0xFFFF,
+0x0005, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0x8003, 0xF7BE, 0x0001, 0xFFBE, 0x8003, 0xF7BE, 0x0002, 0xFFDE, 0xFFDF, 0x8006,
+0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x8003, 0xFFFF, 0x0019, 0xF7BE, 0xF79E, 0xFFBE, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE,
+0xFFDE, 0xF7BE, 0xFFFF, 0xF79D, 0xFFDE, 0xDEDB, 0x18E3, 0x2103, 0x2103, 0x18C3, 0x2104, 0x18C3, 0x18E3, 0x2104, 0x18E3, 0x20E3,
+0x8005, 0x18E3, 0x0013, 0x18E4, 0x18E4, 0x20E4, 0x18C3, 0x20E3, 0x18E3, 0x2102, 0x30E2, 0x4040, 0x99E7, 0xBA28, 0xCA28, 0xCA07,
+0xD207, 0xD207, 0xD1E6, 0xDA27, 0xC9C5, 0xD207, 0x8005, 0xD1E7, 0x0001, 0xCA07, 0x8004, 0xC9E7, 0x0002, 0xD207, 0xD207, 0x8004,
+0xC9E7, 0x0003, 0xD1E7, 0xD207, 0xD1E7, 0x8005, 0xC9E7, 0x0014, 0xC9C6, 0xC9E7, 0xCA07, 0xC1C6, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7,
+0xB9C7, 0xBA69, 0x7924, 0x3000, 0x2861, 0x1881, 0x0820, 0x0841, 0x0841, 0x10A2, 0x1081, 0x1081, 0x8003, 0x0861, 0x0021, 0x1061,
+0x0841, 0x0820, 0x0840, 0x630B, 0x3185, 0x39A6, 0x4A27, 0x4A48, 0x4227, 0x62EB, 0x5ACA, 0x632C, 0x738D, 0x7BCE, 0x8410, 0x94B2,
+0x9CF3, 0xAD75, 0xC617, 0xCE58, 0xD6BA, 0xE6FB, 0xEF3C, 0xDEFB, 0xDEFB, 0xE73C, 0xE73C, 0xE71B, 0xE71C, 0xE71B, 0xE6FB, 0xE73C,
+0x8003, 0xE71C, 0x000D, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB,
+0x8005, 0xDEFB, 0x000E, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB,
+0xE6FB, 0x8004, 0xE71B, 0x0014, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB,
+0xFFDE, 0xFFBE, 0xF7BE, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0x8005, 0xFFFF, 0x0001, 0xFFDF, 0x8005, 0xFFFF, 0x0002, 0xFFDF,
+0xFFDF, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8006, 0xFFDE, 0x0003, 0xFFBE, 0xFFDE, 0xFFDF, 0x8004, 0xFFFF, 0x8003, 0xFFDF, 0x0002,
+0xFFFF, 0xFFDF, 0x8004, 0xFFFF, 0x0005, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xF79D, 0x8003, 0xFFFF, 0x000B, 0xEF7D, 0x2103, 0x18C2,
+0x20E4, 0x18C3, 0x20E4, 0x18E3, 0x18C3, 0x18C3, 0x20E3, 0x20E3, 0x8004, 0x18E3, 0x0014, 0x18E4, 0x18E4, 0x18C4, 0x20E4, 0x20E3,
+0x20E3, 0x2902, 0x30A1, 0xA289, 0xBA49, 0xCA28, 0xC9E7, 0xD228, 0xC9C6, 0xD207, 0xD207, 0xD1E6, 0xDA47, 0xC9E6, 0xC9E7, 0x8003,
+0xD1E7, 0x0054, 0xD207, 0xC9E7, 0xC9E6, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E6, 0xD1E7, 0xD1E7,
+0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xD207, 0xC1C6, 0xC9E7, 0xC9E7, 0xD207, 0xC9C6, 0xD1E7, 0xD1E7, 0xC9E7, 0xBA08,
+0xAA28, 0x6103, 0x2800, 0x1800, 0x1061, 0x1061, 0x1082, 0x0861, 0x1082, 0x0861, 0x0841, 0x0861, 0x0861, 0x0840, 0x0840, 0x0820,
+0x5AEA, 0x3185, 0x4207, 0x4206, 0x4A27, 0x4207, 0x630B, 0x5289, 0x736D, 0x632C, 0x7BAE, 0x738E, 0x8430, 0xA534, 0xAD75, 0xC638,
+0xC638, 0xD6BA, 0xDEFB, 0xE71B, 0xDEDA, 0xEF5D, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE73C, 0xE73C, 0xE71B, 0xE73C, 0xE71C, 0xE73C,
+0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x0006, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0x8004,
+0xE71C, 0x8004, 0xE71B, 0x0004, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0x8005, 0xDEFB, 0x0004, 0xE6FB, 0xE71C, 0xE73C, 0xE71C, 0x8005,
+0xE71B, 0x0001, 0xE71C, 0x8004, 0xE71B, 0x0003, 0xE6FB, 0xDEFB, 0xDEFB, 0x8005, 0xFFFF, 0x000F, 0xFFDF, 0xFFBE, 0xF7BE, 0xFFFF,
+0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0x8007, 0xFFFF, 0x0006, 0xFFDF, 0xFFDE,
+0xF7BE, 0xF7BE, 0xF79E, 0xFFBE, 0x8003, 0xFFDE, 0x0007, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDF, 0x8003, 0xFFFF,
+0x000E, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFFF, 0xF7BE, 0xFFBE, 0xF7BE, 0xA513, 0x20E3, 0x20E3, 0x8003,
+0x18C3, 0x0003, 0x2104, 0x20E3, 0x20C3, 0x8004, 0x18E3, 0x0017, 0x18E4, 0x18E4, 0x20E4, 0x20C4, 0x20E3, 0x20E3, 0x20C1, 0x40C1,
+0xB28A, 0xC228, 0xCA07, 0xD227, 0xC9E6, 0xC9E6, 0xD227, 0xC9E6, 0xC9C6, 0xD227, 0xCA06, 0xCA06, 0xC9E7, 0xD1E7, 0xD1E7, 0x8003,
+0xD207, 0x8008, 0xD1E7, 0x003E, 0xC9C7, 0xD1E7, 0xD1E7, 0xC9C7, 0xC9C7, 0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xC9E7, 0xC9C6, 0xD1E7,
+0xC9C6, 0xD1E7, 0xC9E7, 0xC9C6, 0xC9E6, 0xCA07, 0xC1E7, 0xBA28, 0xB26A, 0x68E4, 0x2800, 0x1820, 0x1061, 0x1082, 0x0841, 0x1082,
+0x0841, 0x0841, 0x1062, 0x0840, 0x0820, 0x0000, 0x62EA, 0x6B4B, 0x3184, 0x41E6, 0x5248, 0x5268, 0x4A48, 0x5289, 0x5ACA, 0x630B,
+0x632C, 0x738D, 0x8410, 0x9CD2, 0xAD34, 0xBDB7, 0xCE59, 0xCE79, 0xD69A, 0xE71C, 0xE71B, 0xDEDB, 0xE71C, 0xDEFB, 0xE73C, 0xE71B,
+0xE6FB, 0xE71B, 0x8004, 0xDEFB, 0x0008, 0xE73C, 0xE71C, 0xE6FB, 0xE71B, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0x8003, 0xDEFB, 0x0006,
+0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0x8005, 0xDEFB, 0x0008, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE71C,
+0xE71B, 0x8003, 0xDEFB, 0x0001, 0xE6FB, 0x8003, 0xE71B, 0x8004, 0xDEFB, 0x8004, 0xE71B, 0x0001, 0xE6FB, 0x8004, 0xDEFB, 0x8008,
+0xFFFF, 0x0002, 0xFFDE, 0xFFDE, 0x8004, 0xFFDF, 0x0007, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFDE, 0x800F, 0xFFFF,
+0x8004, 0xFFDF, 0x0005, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFBE, 0x8003, 0xFFFF, 0x0003, 0xFFDE, 0xFFDE, 0xFFFF, 0x8003, 0xFFDE,
+0x000C, 0xFFBE, 0xF7BE, 0xF79D, 0xF79D, 0xEF3D, 0x5AEB, 0x20E4, 0x2104, 0x2104, 0x18A3, 0x20E3, 0x20E3, 0x8004, 0x18E3, 0x000E,
+0x1904, 0x18E4, 0x20E4, 0x20E4, 0x20C2, 0x20A1, 0x38E1, 0x5081, 0xBA49, 0xCA08, 0xD207, 0xCA06, 0xCA07, 0xCA07, 0x8003, 0xD207,
+0x0006, 0xCA07, 0xCA27, 0xCA27, 0xD207, 0xD207, 0xD1E7, 0x8003, 0xD207, 0x8003, 0xD1E7, 0x0006, 0xD207, 0xD1E7, 0xD1E7, 0xC9C7,
+0xD1E7, 0xC9C7, 0x8008, 0xD1E7, 0x001D, 0xD207, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xC9E6, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0xC208,
+0xB228, 0xAA49, 0x68E3, 0x3000, 0x1841, 0x0821, 0x1882, 0x0841, 0x0841, 0x1082, 0x0840, 0x0820, 0x1881, 0x736B, 0x736B, 0x7B8C,
+0x39A5, 0x41E6, 0x8003, 0x5248, 0x001E, 0x5AA9, 0x62EB, 0x6B4C, 0x6B4C, 0x7BEF, 0x8C50, 0xAD75, 0xC618, 0xC618, 0xDEBA, 0xDEFB,
+0xE71C, 0xE71B, 0xE6FB, 0xE6FB, 0xE71C, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xDEDB, 0xE6FB, 0xE71B, 0xDEDB, 0xE6FB, 0xDEFB,
+0xE71B, 0xEF3C, 0xE71B, 0x8004, 0xE71C, 0x8005, 0xE71B, 0x0003, 0xDEFB, 0xDEFB, 0xE71B, 0x8003, 0xE71C, 0x0009, 0xE71B, 0xE6FB,
+0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB, 0xE71B, 0xE71C, 0x8005, 0xE71B, 0x8003, 0xE6FB, 0x0006, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB,
+0xE71C, 0xE73C, 0x8003, 0xE71C, 0x8004, 0xE73C, 0x0002, 0xFFDF, 0xFFDF, 0x8003, 0xFFFF, 0x0003, 0xFFDF, 0xFFDE, 0xFFBE, 0x8009,
+0xFFFF, 0x8003, 0xFFDF, 0x800A, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x8010, 0xFFFF, 0x0011, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE,
+0xFFFF, 0xFFFF, 0xFFDE, 0xFFDF, 0xFFDE, 0xF79D, 0xF79E, 0xE71C, 0xE73C, 0x18C3, 0x2104, 0x18C3, 0x8003, 0x18E3, 0x000C, 0x1903,
+0x2103, 0x1904, 0x18E3, 0x20C3, 0x20C3, 0x28E2, 0x30C1, 0x60E2, 0xAA28, 0xC228, 0xD1E7, 0x8009, 0xD207, 0x8003, 0xD1E7, 0x0009,
+0xC9C6, 0xC9E6, 0xD1E7, 0xD1E7, 0xC9E6, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0x8004, 0xC9E7, 0x000E, 0xD207, 0xD1E7, 0xC9E6, 0xC9E6,
+0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E6, 0xC9E6, 0x8003, 0xC9E7, 0x002E, 0xCA07, 0xCA28, 0xB9E7,
+0xBA48, 0xAA28, 0x6081, 0x2000, 0x1841, 0x0800, 0x1062, 0x0841, 0x0820, 0x0820, 0x732A, 0xACF1, 0xCDD4, 0xBD52, 0x7B6B, 0x41C5,
+0x5227, 0x5A89, 0x5249, 0x4A07, 0x5AEA, 0x5ACA, 0x630B, 0x83EF, 0x9CD3, 0xA4F3, 0xC5F7, 0xC617, 0xD6BA, 0xDEBA, 0xDEDB, 0xEF5C,
+0xE73C, 0xDEDB, 0xE71C, 0xEF3C, 0xE71B, 0xE71B, 0xE71C, 0xEF3C, 0xE73C, 0xDEFB, 0xE71B, 0x8004, 0xDEFB, 0x0014, 0xEF5C, 0xE71C,
+0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71C,
+0xE73C, 0xEF3C, 0x8004, 0xE73C, 0x0001, 0xE71C, 0x8003, 0xE71B, 0x0001, 0xE6FB, 0x8003, 0xE71B, 0x8003, 0xE6FB, 0x0002, 0xDEFB,
+0xE71B, 0x800A, 0xDEFB, 0x0003, 0xE6FB, 0xF79E, 0xF7BE, 0x8004, 0xFFDE, 0x8003, 0xFFDF, 0x8009, 0xFFFF, 0x0009, 0xFFDF, 0xF7BE,
+0xF7BE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDF, 0x8003, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x8013, 0xFFFF, 0x000E, 0xFFDF,
+0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xF7BE, 0xF7BE, 0xEF3C, 0xE6FB, 0xDEBA, 0x840F, 0x20E3, 0x8003, 0x18E3, 0x000D,
+0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20C3, 0x28C2, 0x30E2, 0x3860, 0xAA69, 0xC248, 0xC1C7, 0xD208, 0xD1E7, 0x8004, 0xD207, 0x8003,
+0xD1E7, 0x000F, 0xD207, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xD1E7, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xD1E7, 0xD207,
+0xD207, 0x8003, 0xD1E7, 0x0005, 0xC9E7, 0xC9E6, 0xC9E7, 0xD207, 0xD207, 0x8006, 0xC9E7, 0x8003, 0xC9E6, 0x0038, 0xD207, 0xD207,
+0xC1A6, 0xCA07, 0xCA28, 0xB9E7, 0xC248, 0x8103, 0x3800, 0x2820, 0x2020, 0x1020, 0x0820, 0x0820, 0x730A, 0xBD72, 0xC592, 0xC592,
+0xD615, 0x6AE9, 0x5A88, 0x4A07, 0x5228, 0x5A69, 0x5AAA, 0x5AEA, 0x62EB, 0x736D, 0x7BAE, 0x9CB2, 0xB575, 0xCE38, 0xCE58, 0xDEBA,
+0xDEFB, 0xDEDB, 0xDEFB, 0xE73C, 0xE71B, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xE6FB, 0xE71C, 0xE71C,
+0xE6FB, 0xE73C, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0x8003, 0xE71B, 0x0002, 0xE71C, 0xE71C, 0x8003, 0xE71B, 0x0006, 0xDEFB, 0xDEFB,
+0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0x8004, 0xDEDB, 0x0004, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0x8004, 0xE71C, 0x0001, 0xE73C, 0x8004,
+0xE71C, 0x0005, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0x8003, 0xE71C, 0x0007, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xF7BE,
+0xFFDF, 0x8006, 0xFFFF, 0x8009, 0xFFDF, 0x8007, 0xFFFF, 0x0003, 0xFFDE, 0xFFDE, 0xFFDF, 0x8014, 0xFFFF, 0x0001, 0xFFDF, 0x8005,
+0xFFFF, 0x001C, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDF, 0xF7BE, 0xF7BE, 0xEF7D, 0xEF7D, 0xE73C, 0xDEDB, 0xD69A, 0xD679,
+0xD658, 0xCE17, 0xBD96, 0xAD55, 0xAD34, 0x9C91, 0xBD13, 0xBCD1, 0xD470, 0xAA28, 0xC208, 0xD208, 0xD1C7, 0xD1E7, 0x8003, 0xD207,
+0x0004, 0xD1E7, 0xD1E6, 0xD1E7, 0xD207, 0x8008, 0xD1E7, 0x0002, 0xD207, 0xD1E7, 0x8003, 0xC9E7, 0x0004, 0xD207, 0xD1E7, 0xC9E7,
+0xD1E7, 0x8003, 0xC9E7, 0x0003, 0xD1E7, 0xD207, 0xD1E7, 0x8005, 0xC9E7, 0x8004, 0xC9E6, 0x002B, 0xC9C6, 0xC9C6, 0xCA07, 0xC9E7,
+0xC1C6, 0xCA28, 0xB9E6, 0xBA48, 0xA269, 0x4000, 0x2000, 0x1800, 0x942E, 0xD615, 0xCDD4, 0xCD92, 0xD5D3, 0xD614, 0xC5B3, 0x41E5,
+0x4A27, 0x5268, 0x5248, 0x5AAA, 0x5289, 0x62EB, 0x6B2C, 0x840F, 0x9492, 0xB595, 0xC618, 0xD69A, 0xE73C, 0xDEFB, 0xE73C, 0xEF5D,
+0xE6FB, 0xDEFB, 0xE71C, 0xDEDB, 0xDEFB, 0xE71C, 0xE71B, 0x8003, 0xDEFB, 0x0010, 0xE71B, 0xE71B, 0xE71C, 0xEF3C, 0xE71B, 0xEF3C,
+0xE71B, 0xE6FB, 0xEF3C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x0013, 0xE71B, 0xE71C, 0xE71C,
+0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB,
+0x8003, 0xE71B, 0x8003, 0xDEFB, 0x000A, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xEF5C, 0xEF3C, 0xE73C, 0xE71B, 0xDEFB, 0x800E,
+0xFFFF, 0x0003, 0xFFDF, 0xFFDF, 0xFFDE, 0x8003, 0xFFDF, 0x8022, 0xFFFF, 0x0008, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFFF, 0xFFDF,
+0xFFDE, 0xF7BE, 0x8003, 0xF79E, 0x0010, 0xEF3C, 0xDEDA, 0xDEBA, 0xDE79, 0xD638, 0xCE18, 0xD638, 0xC5B6, 0xCD74, 0xDD13, 0xA289,
+0xBA48, 0xCA28, 0xC9E7, 0xD207, 0xD1E7, 0x8003, 0xD207, 0x000E, 0xD1E7, 0xD1E6, 0xD1E7, 0xD207, 0xD207, 0xD1E7, 0xD207, 0xD207,
+0xD1E7, 0xD1E7, 0xD207, 0xD1E7, 0xD207, 0xD1E7, 0x8003, 0xC9E7, 0x0006, 0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xC9E7, 0xC9E7, 0x8003,
+0xD207, 0x0008, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0x8004, 0xC9E7, 0x0034, 0xD228, 0xC1C6, 0xC9E7,
+0xC207, 0xC1E7, 0xC248, 0xBA48, 0xA227, 0x7184, 0xB44E, 0xC531, 0xC572, 0xCDB2, 0xDDF3, 0xD5F3, 0xBD51, 0x83CB, 0x4A05, 0x5268,
+0x4A07, 0x5ACA, 0x5289, 0x4A48, 0x62EB, 0x83EF, 0xA4F3, 0xA513, 0xC5F7, 0xD69A, 0xDEDB, 0xDEDB, 0xEF5D, 0xE73C, 0xE6FB, 0xE73C,
+0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0xE73C, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71C, 0xE71B, 0xDEDB, 0xE73C, 0xE71B, 0xDEFB, 0xE73C,
+0xE6FB, 0x8003, 0xE71C, 0x0002, 0xE73C, 0xE73C, 0x8005, 0xE71B, 0x0010, 0xE73C, 0xEF5C, 0xEF7D, 0xEF7D, 0xEF5D, 0xE73C, 0xE71C,
+0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xEF3C, 0xEF5C, 0xEF3C, 0x8003, 0xDEFB, 0x0013, 0xE6FB, 0xE71B, 0xE71C, 0xE71B,
+0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xFFBF, 0xFFDF, 0x8004,
+0xFFFF, 0x0002, 0xFFDF, 0xFFDE, 0x8003, 0xFFFF, 0x8005, 0xFFDF, 0x0006, 0xFFFF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xFFDF, 0x8024,
+0xFFFF, 0x0016, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79E, 0xF79D, 0xF79E, 0xF77D, 0xEF5C, 0xE71B, 0xE6FA, 0xDEDA, 0xDE99, 0xD658, 0xD638,
+0xCE17, 0xD595, 0xD470, 0xB289, 0xCA69, 0xC1E6, 0xC9E7, 0xD227, 0x8004, 0xD207, 0x8004, 0xC9E6, 0x0001, 0xD1E7, 0x8003, 0xC9E7,
+0x0004, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0x8004, 0xC9E7, 0x8005, 0xD1E7, 0x0034, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0xD1E7, 0xC9E7,
+0xD1E7, 0xC9E7, 0xD207, 0xCA07, 0xCA07, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xD207, 0xC9C6, 0xC9E7, 0xD207, 0xC9C7, 0xCA08,
+0xC1E7, 0xC207, 0xBA47, 0xAA67, 0xBBCC, 0xCCCF, 0xCD51, 0xE634, 0xCD71, 0xCD91, 0xD5F3, 0x8BEC, 0x5287, 0x4A27, 0x5ACA, 0x4A48,
+0x62CA, 0x5AAA, 0x5ACA, 0x7BCE, 0xA513, 0xB575, 0xC617, 0xCE38, 0xDEDB, 0xDEDA, 0xE71B, 0xE71C, 0xDEFB, 0xE71B, 0x8004, 0xE71C,
+0x0010, 0xE73C, 0xE6FB, 0xE71B, 0xE71C, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE71B, 0xE71C, 0xDEDB, 0xE71C, 0xE71B, 0xDEDB, 0xDEFB,
+0xDEDB, 0x8003, 0xDEFB, 0x000B, 0xE6FB, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0x8003,
+0xE73C, 0x0002, 0xE71C, 0xE71C, 0x8003, 0xE71B, 0x0001, 0xE6FB, 0x8004, 0xE71C, 0x0006, 0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xE71B,
+0xE6FB, 0x8004, 0xDEFB, 0x0002, 0xE6FB, 0xE71B, 0x8004, 0xE71C, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8008, 0xFFFF, 0x0002, 0xFFDF,
+0xFFDF, 0x8009, 0xFFFF, 0x0001, 0xFFDF, 0x8007, 0xFFFF, 0x0001, 0xFFDF, 0x8018, 0xFFFF, 0x0018, 0xFFDE, 0xFFFF, 0xFFDE, 0xFFFF,
+0xF7BE, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFBE, 0xEF7D, 0xEF5C, 0xEF3B, 0xEF1B, 0xEEFB, 0xEEDA, 0xE678, 0xF637, 0xAAAA, 0xB248,
+0xB9E7, 0xD248, 0xD207, 0xD227, 0x8006, 0xD207, 0x0004, 0xC9E6, 0xC9E6, 0xD207, 0xD1E7, 0x8005, 0xD207, 0x0009, 0xD1E7, 0xC9E7,
+0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0x8003, 0xC9E7, 0x000B, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9E7,
+0xD207, 0xD207, 0xCA07, 0xC9E6, 0xC9E7, 0x8003, 0xC9E6, 0x0038, 0xC9C6, 0xC9C6, 0xD207, 0xC9C6, 0xC9E7, 0xC9E7, 0xD207, 0xC9C6,
+0xC1E6, 0xBA47, 0xA246, 0xAB49, 0xC4AE, 0xC4EF, 0xC530, 0xE614, 0xD5F4, 0x83AB, 0x4205, 0x4A47, 0x4A88, 0x5AAA, 0x5289, 0x5AAA,
+0x7BCE, 0x9CB2, 0xAD54, 0xBDD6, 0xD699, 0xD699, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDB, 0xE71C, 0xE73C,
+0xE71C, 0xE6FB, 0xE71C, 0xE73C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xDEFB, 0xE71C, 0xE71C, 0xE6FB, 0xE73C, 0xDEFB, 0xDEFB, 0xDEDB,
+0x8003, 0xDEFB, 0x0006, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE73C, 0xE73C, 0x8003, 0xE71C, 0x0003, 0xE71B, 0xDEFB, 0xDEFB, 0x8003,
+0xE71C, 0x8005, 0xE71B, 0x8006, 0xE71C, 0x0006, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0x8003, 0xE71C, 0x0002, 0xE71B,
+0xE6FB, 0x8003, 0xE71B, 0x0001, 0xFFDF, 0x8006, 0xFFFF, 0x8007, 0xFFDF, 0x8029, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x8005, 0xFFFF,
+0x0012, 0xFFDF, 0xFFFF, 0xFFBE, 0xF79D, 0xF79D, 0xEF9D, 0xEF7C, 0xEF5C, 0xEF1B, 0xF6FB, 0xFEB9, 0xFE37, 0xAA68, 0xC248, 0xCA47,
+0xCA06, 0xD206, 0xD1E6, 0x8007, 0xD207, 0x0001, 0xC9E6, 0x8003, 0xC9E7, 0x000A, 0xD1E7, 0xC9E7, 0xD207, 0xD207, 0xC9E6, 0xC9E7,
+0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0x8008, 0xC9E7, 0x0001, 0xD1E7, 0x8003, 0xC9E7, 0x003F, 0xD207, 0xD207, 0xC9E7, 0xC9E6, 0xC9E7,
+0xC9E6, 0xC9E6, 0xD207, 0xC9E6, 0xD1E7, 0xD1E7, 0xD207, 0xC9A6, 0xD1E7, 0xC9C7, 0xC9C7, 0xC9E7, 0xC207, 0xBA47, 0xA267, 0xB36A,
+0xD4F0, 0xDD92, 0xDDD3, 0xCDB3, 0x8BAC, 0x41E5, 0x4A47, 0x52A9, 0x5ACA, 0x62EA, 0x734C, 0x7BEE, 0x9492, 0xC5F7, 0xCE38, 0xD679,
+0xD69A, 0xDEBA, 0xDEDB, 0xDEDB, 0xE71B, 0xE6FB, 0xDEBA, 0xE71B, 0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71B,
+0xDEFB, 0xE71C, 0xE71C, 0xDEFB, 0xE71C, 0xE73C, 0xE71B, 0xE73C, 0xE71B, 0xE71C, 0x8004, 0xE73C, 0x0002, 0xE71C, 0xE71B, 0x8009,
+0xDEFB, 0x0001, 0xE6FB, 0x8004, 0xE71B, 0x8004, 0xDEFB, 0x8007, 0xE71C, 0x000D, 0xE71B, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C,
+0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0x8018, 0xFFFF, 0x0001, 0xFFDF, 0x8021, 0xFFFF, 0x0001, 0xFFDF, 0x8006,
+0xFFFF, 0x000F, 0xFFDF, 0xF7DE, 0xF7DE, 0xF7BD, 0xF79D, 0xF77C, 0xFF5C, 0xFEDA, 0xA2AA, 0xBA69, 0xC207, 0xCA07, 0xC9E6, 0xD207,
+0xD1E7, 0x8006, 0xD207, 0x0009, 0xC9E6, 0xC9E6, 0xD207, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0x8004, 0xC9E7, 0x0006,
+0xD1E7, 0xD1E7, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0x8004, 0xC9E7, 0x0009, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7, 0xCA07, 0xC9E7,
+0xC9E6, 0xC9E7, 0x8004, 0xC9E6, 0x0001, 0xC9E7, 0x8003, 0xD1E7, 0x001D, 0xD1C6, 0xD1E7, 0xC9C7, 0xC9C7, 0xC1C7, 0xC207, 0xB247,
+0x89A4, 0xD46E, 0xCCAF, 0xE5B3, 0xC532, 0x9C4E, 0x5267, 0x4206, 0x5288, 0x62CA, 0x62AA, 0x6B2C, 0x9471, 0x9CB2, 0xBDD6, 0xCE38,
+0xD699, 0xE6FB, 0xE6FB, 0xDEDA, 0xDEFB, 0xE6FB, 0x8004, 0xE71C, 0x0003, 0xE73C, 0xE6FB, 0xDEFB, 0x8004, 0xE71B, 0x000B, 0xDEFB,
+0xE73C, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xE73C, 0xE6FB, 0xE71B, 0xE73C, 0xE71C, 0x8003, 0xE71B, 0x0011, 0xDEFB, 0xDEDB, 0xDEDA,
+0xDEDB, 0xE6FB, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0x8004, 0xDEFB,
+0x0001, 0xE6FB, 0x8003, 0xE71B, 0x000F, 0xE71C, 0xE71C, 0xE71B, 0xEF3C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C,
+0xEF3C, 0xE73C, 0xE71B, 0xE6FB, 0x8041, 0xFFFF, 0x0011, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFF3C, 0xFE9A, 0xAA89,
+0xC228, 0xCA27, 0xCA06, 0xD227, 0xD1E6, 0xDA07, 0xD207, 0xD207, 0x8004, 0xC9E6, 0x8003, 0xD207, 0x8007, 0xC9E7, 0x8003, 0xD1E7,
+0x8004, 0xC9E7, 0x0001, 0xD1E7, 0x8003, 0xC9E7, 0x0003, 0xCA07, 0xD207, 0xCA07, 0x8003, 0xC9E7, 0x0003, 0xC9E6, 0xC9E6, 0xC9E7,
+0x800A, 0xC9E6, 0x0018, 0xC9C6, 0xC9C7, 0xD208, 0xC1C6, 0xD208, 0xC1E7, 0xC207, 0xB247, 0x8143, 0xD44F, 0xCC90, 0xD593, 0xDE56,
+0x7B8B, 0x5AA8, 0x62C9, 0x62AA, 0x62EB, 0x738D, 0x9491, 0xA514, 0xBDB6, 0xCE38, 0xD699, 0x8003, 0xDEDB, 0x0018, 0xE73C, 0xDEDA,
+0xDEDB, 0xE6FB, 0xDEDB, 0xE71B, 0xE6FB, 0xDEFB, 0xE73C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,
+0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0x8003, 0xE71B, 0x0009, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C,
+0xE73C, 0xE71B, 0x8007, 0xDEFB, 0x0001, 0xE6FB, 0x8004, 0xE71B, 0x8003, 0xE6FB, 0x0003, 0xDEFB, 0xDEDB, 0xDEFB, 0x8005, 0xE71C,
+0x0008, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0x8006, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x8038, 0xFFFF,
+0x0010, 0xFFDF, 0xFFFF, 0xF79E, 0xFFDE, 0xF79D, 0xFFBE, 0xFF9D, 0xFF5C, 0xAAEB, 0xBA6A, 0xCA08, 0xD207, 0xD227, 0xD1E6, 0xD1C6,
+0xDA07, 0x8008, 0xD207, 0x8004, 0xD1E7, 0x8004, 0xC9E7, 0x0001, 0xD1E7, 0x8007, 0xC9E7, 0x0001, 0xD1E7, 0x8008, 0xC9E7, 0x0004,
+0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0x8009, 0xC9E6, 0x0042, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9E7, 0xC1E6, 0xC227, 0xBA88,
+0x8143, 0xC3ED, 0xDD73, 0xC532, 0x942E, 0x4A26, 0x5247, 0x6B0B, 0x6B0C, 0x738D, 0x9CB2, 0xBDB6, 0xC617, 0xC617, 0xCE58, 0xDEDB,
+0xE6FB, 0xDEDB, 0xE73C, 0xE71C, 0xE71B, 0xE73C, 0xE71C, 0xDEFB, 0xE71B, 0xDEDB, 0xEF5C, 0xDEDB, 0xDEFB, 0xE73C, 0xDEFB, 0xE71C,
+0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B,
+0xE71C, 0xE71C, 0xE73C, 0xEF5C, 0xEF5C, 0xE73C, 0xE71C, 0xE71B, 0xE71C, 0x8003, 0xE73C, 0x8005, 0xE71C, 0x0008, 0xE71B, 0xE71C,
+0xE71C, 0xE71B, 0xDEDB, 0xDEBA, 0xDEDB, 0xE71B, 0x8003, 0xE73C, 0x0005, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0x8003, 0xDEFB,
+0x0001, 0xE6FB, 0x8003, 0xFFDF, 0x8040, 0xFFFF, 0x000D, 0xFFDE, 0xFFDF, 0xFFBE, 0xFFFE, 0xFF7C, 0xA26A, 0xC249, 0xCA07, 0xD207,
+0xD207, 0xC9C6, 0xDA48, 0xC9C6, 0x8008, 0xD207, 0x0002, 0xC9E7, 0xD1E7, 0x8003, 0xD207, 0x0003, 0xD1E7, 0xD1E7, 0xD207, 0x8003,
+0xD1E7, 0x8005, 0xC9E7, 0x0001, 0xCA07, 0x8004, 0xC9E7, 0x0001, 0xC9E6, 0x8003, 0xC9E7, 0x8003, 0xC9E6, 0x0007, 0xC9E7, 0xC9E7,
+0xC9E6, 0xC9E7, 0xC9E6, 0xCA06, 0xCA06, 0x8005, 0xC9E6, 0x001F, 0xCA07, 0xC1E6, 0xC9E6, 0xC9C6, 0xC9E6, 0xCA27, 0xB9E6, 0xBA68,
+0x91E6, 0xCC6F, 0xDD93, 0x838B, 0x5AC8, 0x5AA9, 0x62EA, 0x6B2C, 0x7BCE, 0x9CB2, 0xBDD6, 0xC5F7, 0xCE38, 0xD679, 0xD69A, 0xDEBA,
+0xDEFB, 0xD6BA, 0xE71B, 0xDEFB, 0xDEDA, 0xE71B, 0xE71B, 0x8003, 0xE71C, 0x000F, 0xE73C, 0xDEFB, 0xE71B, 0xE71C, 0xDEDA, 0xE71B,
+0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0x8003, 0xE71B, 0x0006, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB,
+0xDEFB, 0xE6FB, 0x8003, 0xE71C, 0x8007, 0xE71B, 0x0001, 0xE6FB, 0x8004, 0xDEFB, 0x000A, 0xE6FB, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB,
+0xE6FB, 0xE73C, 0xE71B, 0xE71B, 0xE6FB, 0x8005, 0xDEFB, 0x8003, 0xE71B, 0x0001, 0xE6FB, 0x8041, 0xFFFF, 0x0003, 0xF7DF, 0xFFDE,
+0xFFDF, 0x8003, 0xFFDE, 0x0009, 0xFF5C, 0xAA8A, 0xC228, 0xC1A6, 0xDA27, 0xC9C5, 0xC9C6, 0xC9E7, 0xC9E7, 0x8006, 0xD207, 0x0006,
+0xC9E6, 0xC9E6, 0xC9E7, 0xD1E7, 0xD207, 0xD207, 0x8003, 0xD1E7, 0x0002, 0xD207, 0xD207, 0x8006, 0xD1E7, 0x8003, 0xC9E7, 0x0001,
+0xC9E6, 0x8004, 0xC9E7, 0x0004, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0x8005, 0xC9E7, 0x0006, 0xC9E6, 0xCA06, 0xCA06, 0xC9E6, 0xC9E6,
+0xCA06, 0x8003, 0xC9E6, 0x0038, 0xC1E6, 0xD1E6, 0xD1C6, 0xD1E6, 0xC9C6, 0xCA27, 0xB1C6, 0xB227, 0x91C5, 0xCC8F, 0x93AB, 0x5A87,
+0x4A46, 0x5AA9, 0x734D, 0x7BAE, 0xAD34, 0xAD54, 0xBDD7, 0xCE58, 0xCE38, 0xDEBA, 0xD69A, 0xD6BA, 0xDEDA, 0xE71B, 0xDEFB, 0xDEFB,
+0xE71B, 0xDEFB, 0xEF5C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xDEDB, 0xDEDB, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE6FB,
+0xDEFB, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xE6FB, 0x8003, 0xDEFB, 0x0001, 0xE6FB,
+0x8003, 0xE71B, 0x8004, 0xE71C, 0x8004, 0xE71B, 0x0001, 0xEF5C, 0x8007, 0xE73C, 0x0002, 0xEF5C, 0xEF3C, 0x8003, 0xE73C, 0x0009,
+0xE71C, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xFFDF, 0xFFDF, 0x8041, 0xFFFF, 0x000F, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE,
+0xFF5C, 0xAA69, 0xC208, 0xD227, 0xD206, 0xD206, 0xD207, 0xCA07, 0xD228, 0xD207, 0xD207, 0x8006, 0xC9E6, 0x0001, 0xD1E7, 0x8004,
+0xC9E7, 0x8004, 0xD1E7, 0x800F, 0xC9E7, 0x0003, 0xCA07, 0xC9E7, 0xC9E6, 0x8005, 0xC9E7, 0x8003, 0xCA07, 0x002D, 0xC9E7, 0xCA07,
+0xCA07, 0xD1E7, 0xC9E6, 0xC1E6, 0xCA06, 0xD1C6, 0xD1E6, 0xC9C6, 0xCA07, 0xCA07, 0xC207, 0xC227, 0xAA07, 0xCBED, 0xC48F, 0x8BCC,
+0x5287, 0x62EB, 0x6B0C, 0x83EF, 0xA4F3, 0xA514, 0xB595, 0xC617, 0xD679, 0xD679, 0xD69A, 0xDEFB, 0xDEDA, 0xE71C, 0xE73C, 0xDEDB,
+0xDEFB, 0xE73C, 0xE71C, 0xE71C, 0xDEFB, 0xE73C, 0xE73C, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0x8003, 0xE71B, 0x0007, 0xE71C, 0xE73C,
+0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0x8003, 0xDEFB, 0x0005, 0xE71B, 0xE73C, 0xE73C, 0xDEFB, 0xDEFB, 0x8003, 0xDEDB, 0x0003,
+0xDEFB, 0xDEFB, 0xE6FB, 0x8003, 0xE71C, 0x0002, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x0004, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0x8003,
+0xE71B, 0x0002, 0xDEFB, 0xDEDB, 0x8005, 0xDEFB, 0x0001, 0xE6FB, 0x8003, 0xE71B, 0x0002, 0xE71C, 0xE71B, 0x8005, 0xFFFF, 0x0003,
+0xFFDF, 0xFFDE, 0xFFDE, 0x803D, 0xFFFF, 0x000C, 0xFFBE, 0xFFBD, 0xFF3B, 0xBA8A, 0xCA08, 0xC9E6, 0xD226, 0xC9C5, 0xDA27, 0xCA07,
+0xC9E7, 0xCA07, 0x8007, 0xD207, 0x0001, 0xD1E7, 0x8007, 0xC9E7, 0x0006, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0x8005,
+0xC9E7, 0x0006, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E7, 0xCA07, 0x8009, 0xC9E7, 0x0002, 0xC9E6, 0xC9E6, 0x8004, 0xC9E7, 0x0019,
+0xC9E6, 0xC9E6, 0xD207, 0xC9A5, 0xD207, 0xC1C6, 0xCA27, 0xB9A6, 0xC9E7, 0xBA07, 0xAA47, 0x9AC8, 0x9BCC, 0x1840, 0x5AA9, 0x736D,
+0x840F, 0x9CD2, 0xAD34, 0xBDD6, 0xBDB6, 0xCE38, 0xD679, 0xDEBA, 0xDEDB, 0x8004, 0xDEFB, 0x0019, 0xDEDA, 0xE6FB, 0xE73C, 0xEF5D,
+0xE71C, 0xEF5C, 0xE71B, 0xE71B, 0xE73C, 0xDEDB, 0xE71B, 0xE73C, 0xE71C, 0xE6FB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B,
+0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0x8003, 0xE71C, 0x8004, 0xE71B, 0x0003, 0xE71C, 0xE73C, 0xE71C, 0x8008, 0xE73C, 0x0001,
+0xDEDB, 0x8004, 0xDEFB, 0x0003, 0xE6FB, 0xE71B, 0xE6FB, 0x8004, 0xE71B, 0x0001, 0xE6FB, 0x8003, 0xDEFB, 0x0006, 0xDEDB, 0xDEFB,
+0xDEFB, 0xE6FB, 0xFFFF, 0xFFDF, 0x803F, 0xFFFF, 0x000D, 0xF7BE, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFE, 0xFF9D, 0x92AA, 0xBA49, 0xCA08,
+0xD206, 0xD206, 0xDA26, 0xD1E6, 0x8003, 0xC9E7, 0x8007, 0xD207, 0x0001, 0xD1E7, 0x8007, 0xC9E7, 0x0001, 0xD207, 0x8003, 0xD1E7,
+0x0003, 0xD207, 0xD207, 0xD1E7, 0x8005, 0xC9E7, 0x0006, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xCA07, 0xCA07, 0x8003, 0xC9E7, 0x0003,
+0xC9C6, 0xD1E7, 0xD1E7, 0x8003, 0xC9E6, 0x0031, 0xC9C6, 0xC9E6, 0xC9E7, 0xD1E7, 0xC9E6, 0xC9E7, 0xC9E6, 0xD1E7, 0xC9C6, 0xC9E7,
+0xC1C6, 0xC9E7, 0xCA07, 0xC9E7, 0xCA27, 0xBA47, 0xAA88, 0xA36B, 0x93AD, 0x5228, 0x630B, 0x8C50, 0x9491, 0xAD34, 0xB596, 0xBDB6,
+0xD679, 0xCE58, 0xD69A, 0xDEDA, 0xDEBA, 0xDEFB, 0xE73C, 0xE71B, 0xDEFB, 0xE71C, 0xE6FB, 0xE71B, 0xE73C, 0xDEFB, 0xDEFB, 0xE71B,
+0xE71B, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0x8003, 0xE71B, 0x0008, 0xE71C, 0xE6FB, 0xE71B, 0xE71C, 0xE73C, 0xE73C,
+0xE71C, 0xE6FB, 0x8005, 0xDEFB, 0x0003, 0xE6FB, 0xE71B, 0xE71C, 0x8005, 0xE71B, 0x0001, 0xE71C, 0x8003, 0xE73C, 0x8007, 0xDEFB,
+0x0006, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0x8003, 0xE6FB, 0x0001, 0xE71B, 0x8003, 0xE6FB, 0x8040, 0xFFFF, 0x0011,
+0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFBE, 0xFF5D, 0xA2EB, 0xBA49, 0xC9E7, 0xD207, 0xD226, 0xD1E5, 0xD206, 0xD207, 0xC9E7,
+0xC9E7, 0x8004, 0xD207, 0x8003, 0xC9E6, 0x0005, 0xC9E7, 0xD1E7, 0xD207, 0xD1E7, 0xD1E7, 0x8003, 0xC9E7, 0x0001, 0xD1E7, 0x8003,
+0xC9E7, 0x0002, 0xD1E7, 0xD1E7, 0x8003, 0xC9E7, 0x0001, 0xC9E6, 0x8003, 0xC9E7, 0x000C, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E7,
+0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0xD1E7, 0xD1E7, 0xC9E7, 0x8004, 0xC9E6, 0x0002, 0xC9E7, 0xD1E7, 0x8003, 0xC9E7, 0x001A, 0xC9C7,
+0xC9C7, 0xC9E7, 0xCA07, 0xC1E7, 0xC1E6, 0xC9E7, 0xC9E7, 0xB9C5, 0xB227, 0x89E6, 0xA3AD, 0x5227, 0x6B4C, 0x840F, 0x9CB2, 0xAD34,
+0xBDB6, 0xBDD6, 0xC5F7, 0xCE38, 0xDEBA, 0xDEFB, 0xDEDA, 0xDEDA, 0xDEFB, 0x8003, 0xE71B, 0x0017, 0xE73C, 0xE73C, 0xE71B, 0xE73C,
+0xE73C, 0xDEFB, 0xE71C, 0xE73C, 0xE71B, 0xE71C, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xE6FB,
+0xDEFB, 0xDEDB, 0xDEDB, 0x8007, 0xDEFB, 0x000B, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB,
+0xDEFB, 0x8004, 0xE71C, 0x0010, 0xE73C, 0xEF5D, 0xEF3C, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEBA, 0xDEDA, 0xE71B, 0xEF5C,
+0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0x8044, 0xFFFF, 0x001C, 0xFFDE, 0xFFBE, 0xFF5C, 0x9AAA, 0xBA48, 0xCA07, 0xCA07, 0xD206, 0xD1E6,
+0xD206, 0xD207, 0xCA07, 0xD207, 0xD207, 0xC9E6, 0xC9E6, 0xD207, 0xC9E6, 0xC9E6, 0xC9E7, 0xD207, 0xD1E7, 0xC9E6, 0xD207, 0xD1E7,
+0xC9C6, 0xC9E7, 0xD1E7, 0x8003, 0xC9E7, 0x0009, 0xD1E7, 0xC9E7, 0xC9E7, 0xD207, 0xD1E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xD1E7, 0x8003,
+0xC9E6, 0x0004, 0xCA07, 0xC9E7, 0xCA07, 0xCA07, 0x8004, 0xC9E7, 0x0001, 0xD207, 0x8003, 0xC9E6, 0x8005, 0xC9E7, 0x0001, 0xCA07,
+0x8004, 0xC9E7, 0x0016, 0xC9E6, 0xCA06, 0xCA06, 0xC9E6, 0xC9E7, 0xC9E7, 0xBA07, 0x91C6, 0xAB6C, 0x2040, 0x62CA, 0x738D, 0x9471,
+0xA513, 0xBDD6, 0xBDB6, 0xC617, 0xC618, 0xD679, 0xE71B, 0xDEDB, 0xDEDB, 0x8003, 0xDEFB, 0x0010, 0xE71B, 0xE71C, 0xE73C, 0xDEFB,
+0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xEF3C, 0xE71C, 0xDEFB, 0x8003, 0xE71C, 0x0001, 0xE71B,
+0x8004, 0xDEFB, 0x0003, 0xE6FB, 0xE71B, 0xDEFB, 0x8003, 0xDEDB, 0x0004, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0x8003, 0xE71B, 0x0001,
+0xE6FB, 0x8004, 0xDEFB, 0x000C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xEF3C, 0xEF5D, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,
+0x8003, 0xDEFB, 0x0005, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0x8040, 0xFFFF, 0x0001, 0xFFDF, 0x8004, 0xFFFF, 0x0008, 0xFFBE,
+0xFF1B, 0xA289, 0xBA48, 0xCA07, 0xD207, 0xD207, 0xD1E6, 0x8005, 0xD207, 0x000E, 0xC9E6, 0xC9E6, 0xD207, 0xD207, 0xD1E7, 0xD207,
+0xC9E6, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xC9E7, 0x8003, 0xD207, 0x0002, 0xD1E7, 0xC9E6, 0x8003, 0xC9E7, 0x0002,
+0xC9E6, 0xC9E6, 0x8003, 0xC9E7, 0x000C, 0xC9E6, 0xC9E6, 0xC9E7, 0xCA07, 0xCA07, 0xC9E6, 0xC9E6, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7,
+0xC9E6, 0x8004, 0xC9E7, 0x0021, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9C6, 0xC9C6, 0xC9E6, 0xC9E6, 0xCA06, 0xCA06, 0xCA07,
+0xC1A6, 0xC9E7, 0xCA28, 0xAA07, 0xB32C, 0x2840, 0x6AEA, 0x734C, 0x8C50, 0x9CD2, 0xAD34, 0xB575, 0xC617, 0xC618, 0xD69A, 0xCE79,
+0xDEDA, 0xE71C, 0xE6FB, 0xDEDB, 0xE6FB, 0x8003, 0xE73C, 0x000F, 0xE71C, 0xDEFB, 0xDEDB, 0xE71B, 0xE71C, 0xE71C, 0xE73C, 0xDEFB,
+0xDEDB, 0xDEDB, 0xE71B, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0x8003, 0xE71C, 0x0005, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0x8004,
+0xE71C, 0x8003, 0xE71B, 0x0010, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xEF5C, 0xEF5D, 0xEF7D, 0xE71C, 0xE71C, 0xE71B,
+0xE71C, 0xE73C, 0xE73C, 0xE71C, 0x8006, 0xDEFB, 0x0007, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0x8042, 0xFFFF,
+0x000C, 0xFFFE, 0xFFDE, 0xFFFF, 0xFFBD, 0xFF1B, 0xB2CA, 0xC248, 0xCA07, 0xD207, 0xD207, 0xD1E6, 0xD1E6, 0x8004, 0xD207, 0x000E,
+0xC9E6, 0xC9E6, 0xD207, 0xD207, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9C6, 0xD207, 0xD207, 0xC9E6, 0xC9E7, 0xD207, 0x8005, 0xC9E7,
+0x0006, 0xD1E7, 0xD207, 0xD207, 0xC9E7, 0xC9E6, 0xC9E6, 0x8005, 0xC9E7, 0x0009, 0xCA07, 0xCA07, 0xC9E6, 0xC9E6, 0xCA07, 0xCA07,
+0xC9E7, 0xC9E7, 0xC9E6, 0x8003, 0xC9E7, 0x8003, 0xC9E6, 0x0019, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1E6,
+0xC1C6, 0xC1E6, 0xC9E7, 0xC9E7, 0xC1E6, 0xB227, 0x8185, 0x934C, 0x5207, 0x736C, 0x9471, 0x9CD2, 0xA533, 0xB595, 0xC5F7, 0xC5F7,
+0xCE38, 0x8004, 0xDEDB, 0x001D, 0xDEFB, 0xE71B, 0xE71B, 0xDEDB, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xEF5C, 0xEF3C, 0xE71B, 0xE71B,
+0xE6FB, 0xE6FB, 0xE71B, 0xE73C, 0xE71B, 0xDEDB, 0xE71B, 0xE71C, 0xE73C, 0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C,
+0xE6FB, 0x8004, 0xDEFB, 0x0001, 0xE71B, 0x8004, 0xE73C, 0x8005, 0xE71C, 0x0005, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0x8004,
+0xDEFB, 0x0008, 0xDEDB, 0xDEDB, 0xDEFB, 0xE73C, 0xE73C, 0xEF5C, 0xE73C, 0xE6FB, 0x8004, 0xE71B, 0x8043, 0xFFFF, 0x000E, 0xFFDE,
+0xFFFF, 0xFF5C, 0xFE38, 0xAA28, 0xC247, 0xCA06, 0xCA06, 0xD207, 0xD1E7, 0xD1E6, 0xD1E7, 0xD207, 0xC9E6, 0x8005, 0xD207, 0x8003,
+0xC9E7, 0x000B, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xC9E6, 0xD1E7, 0xC9E7, 0xD1E7, 0xD207, 0x8003, 0xC9E7, 0x0001,
+0xC9E6, 0x8008, 0xC9E7, 0x0003, 0xC9E6, 0xCA07, 0xCA07, 0x8003, 0xC9E7, 0x0008, 0xC9E6, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7,
+0xC9E6, 0xC9E6, 0x8003, 0xC9E7, 0x0003, 0xC9E6, 0xC9C7, 0xC9C7, 0x8004, 0xC9E6, 0x002D, 0xCA07, 0xC1C6, 0xC9E6, 0xC1E7, 0xB207,
+0xA268, 0xA3AE, 0x3964, 0x62CA, 0x840F, 0x9471, 0xA4F3, 0xAD34, 0xBDD6, 0xC5F7, 0xD679, 0xDEBA, 0xD6BA, 0xDEDA, 0xDEDB, 0xDEDB,
+0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xE71C, 0xE73C, 0xE71B, 0xE73C, 0xE71C, 0xDEFB, 0xE71C, 0xE73C,
+0xE73C, 0xE71C, 0xE6FB, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0x8003, 0xE71B, 0x0008, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71B,
+0xDEFB, 0xDEFB, 0xDEDA, 0x8003, 0xE6FB, 0x0001, 0xE71B, 0x8004, 0xE71C, 0x0003, 0xDEFB, 0xDEFB, 0xE6FB, 0x8004, 0xDEFB, 0x0002,
+0xE6FB, 0xE71C, 0x8003, 0xE71B, 0x8003, 0xE71C, 0x0005, 0xE6FB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0x8043, 0xFFFF, 0x0009, 0xFFFE,
+0xFFDF, 0xFF7D, 0xECF3, 0xC2AA, 0xC247, 0xCA06, 0xC9E6, 0xD207, 0x8003, 0xD1E7, 0x0002, 0xD207, 0xC9E6, 0x8004, 0xD207, 0x8004,
+0xC9E7, 0x000B, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E7, 0xD207, 0x8003, 0xCA07, 0x0001,
+0xC9E6, 0x8008, 0xC9E7, 0x000E, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9E7,
+0xC9E6, 0xC9E6, 0x8006, 0xC9E7, 0x001A, 0xC9E6, 0xC9E7, 0xCA07, 0xCA07, 0xC9E7, 0xCA27, 0xC1C6, 0xC207, 0xC248, 0xAA48, 0xA38C,
+0x2060, 0x5AA9, 0x83EF, 0x9471, 0xA4F3, 0xA4F3, 0xB575, 0xBDB6, 0xCE38, 0xD69A, 0xDEDA, 0xE71B, 0xE71B, 0xDEDB, 0xDEFB, 0x8003,
+0xE71B, 0x0003, 0xE6FB, 0xE71C, 0xE71C, 0x8003, 0xE71B, 0x0005, 0xDEFB, 0xE71C, 0xE71B, 0xDEDB, 0xE6FB, 0x8003, 0xE71C, 0x0001,
+0xE6FB, 0x8004, 0xE71C, 0x0001, 0xE71B, 0x8004, 0xDEFB, 0x0009, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xEF3C, 0xEF5C, 0xE71B,
+0xE71B, 0x8004, 0xE6FB, 0x0005, 0xDEFB, 0xDEFB, 0xE73C, 0xE71C, 0xE71C, 0x8005, 0xE71B, 0x0002, 0xE6FB, 0xE6FB, 0x8005, 0xDEFB,
+0x0002, 0xE6FB, 0xE71B, 0x8003, 0xE71C, 0x8044, 0xFFFF, 0x0008, 0xFFDF, 0xFF7D, 0xAACA, 0xBA28, 0xCA27, 0xCA06, 0xC9E6, 0xD207,
+0x8003, 0xD1E7, 0x001F, 0xD207, 0xC9E6, 0xD207, 0xD207, 0xC9E6, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xD207, 0xC9E7, 0xC9E6, 0xD207,
+0xD207, 0xC9E6, 0xC9E7, 0xD207, 0xC9E7, 0xC9E6, 0xC9E7, 0xCA07, 0xCA07, 0xD207, 0xD207, 0xCA07, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7,
+0xC9E6, 0xC9E6, 0x8004, 0xC9E7, 0x0004, 0xC9E6, 0xC9E7, 0xD207, 0xCA07, 0x8003, 0xC9E6, 0x8003, 0xC9E7, 0x8003, 0xC9E6, 0x0003,
+0xC9E7, 0xC9C6, 0xC9E6, 0x8003, 0xC9E7, 0x0032, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xC1C6, 0xD227, 0xC1E6, 0xB9C6, 0xAA68, 0x9B4C,
+0x1800, 0x5248, 0x738D, 0x8C50, 0xA4F3, 0x9CD2, 0xAD54, 0xBDD6, 0xCE58, 0xD69A, 0xD69A, 0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE73C,
+0xE73C, 0xE71B, 0xEF5C, 0xE71C, 0xDEFB, 0xE71C, 0xE6FB, 0xDEFB, 0xE73C, 0xE71B, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDA, 0xDEFB,
+0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0x8003, 0xE71B, 0x0001, 0xE71C, 0x8003, 0xE73C, 0x0002, 0xEF3C,
+0xE73C, 0x8005, 0xDEFB, 0x0008, 0xE6FB, 0xE6FB, 0xDEFB, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0x8004, 0xDEFB, 0x0001, 0xE6FB,
+0x8003, 0xE71B, 0x0002, 0xDEFB, 0xDEFB, 0x8003, 0xE71C, 0x0002, 0xE71B, 0xE6FB, 0x8044, 0xFFFF, 0x0007, 0xFFDF, 0xFF7D, 0xAA49,
+0xCA28, 0xCA27, 0xCA06, 0xD207, 0x8004, 0xD1E7, 0x0004, 0xD1E6, 0xC9E6, 0xD207, 0xD207, 0x8003, 0xC9E7, 0x000E, 0xD1E7, 0xD207,
+0xC9E7, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xC9E7, 0xD207, 0xD207, 0xCA07, 0xD207, 0x8003, 0xC9E7, 0x0010, 0xC9E6,
+0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0x8005,
+0xC9E7, 0x8006, 0xC9E6, 0x003E, 0xC9C6, 0xC1C6, 0xC1E6, 0xC1E6, 0xC9E6, 0xC9E6, 0xCA07, 0xC1C6, 0xC9E6, 0xC1C6, 0xCA48, 0xB248,
+0xA34B, 0x1800, 0x5228, 0x6B4C, 0x83CE, 0x8C50, 0x9CB2, 0xA514, 0xBDD7, 0xCE79, 0xDEDA, 0xDEBA, 0xDEDB, 0xE71B, 0xDEFB, 0xDEDB,
+0xDEFB, 0xE71C, 0xDEBA, 0xE73C, 0xE71C, 0xE71B, 0xE73C, 0xE6FB, 0xDEDA, 0xE6FB, 0xE73C, 0xE73C, 0xE6FB, 0xE6FB, 0xE71C, 0xE6FB,
+0xDEFB, 0xDEDB, 0xDEDA, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB,
+0xE6FB, 0xE6FB, 0x8004, 0xE71B, 0x0001, 0xE6FB, 0x8004, 0xDEFB, 0x0003, 0xDEDB, 0xDEFB, 0xDEFB, 0x8003, 0xDEDB, 0x0004, 0xDEFB,
+0xE73C, 0xE73C, 0xE71B, 0x8004, 0xDEFB, 0x0005, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0x8043, 0xFFFF, 0x000E, 0xFFDE, 0xFFFF,
+0xFF3D, 0xBAAA, 0xC1E7, 0xCA06, 0xCA06, 0xD207, 0xD1E7, 0xD1C7, 0xD1E7, 0xD1E7, 0xD1E6, 0xC9E6, 0x8005, 0xD207, 0x000D, 0xC9E7,
+0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xD207, 0xD207, 0xC9C6, 0xC9E7, 0xD1E7, 0xCA07, 0xC9E7, 0xC9E7, 0x8003, 0xD207, 0x0005, 0xC9E7,
+0xC9C6, 0xC9E6, 0xC9E7, 0xC9E7, 0x8005, 0xC9E6, 0x0003, 0xC9E7, 0xCA07, 0xC9E7, 0x8004, 0xC9E6, 0x0001, 0xD207, 0x8003, 0xC9E7,
+0x8007, 0xC9E6, 0x0030, 0xC9E7, 0xC9E7, 0xCA07, 0xCA07, 0xC9E6, 0xC1C6, 0xCA07, 0xC1C6, 0xCA07, 0xC1C6, 0xC1E7, 0xB248, 0x92EA,
+0x2020, 0x49E7, 0x6B2C, 0x7BAE, 0x840F, 0xA4F3, 0xAD34, 0xBDF7, 0xCE59, 0xCE79, 0xD6BA, 0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xE73C,
+0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xE6FB, 0xE73C, 0xDEDA, 0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xE73C, 0xE71B,
+0xDEFB, 0xE71B, 0xE6FB, 0x8005, 0xDEFB, 0x0006, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEDB, 0x8005, 0xDEFB, 0x0001, 0xE6FB,
+0x8005, 0xDEFB, 0x0004, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0x8003, 0xDEFB, 0x0005, 0xE71B, 0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0x8003,
+0xDEFB, 0x0005, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0x8045, 0xFFFF, 0x0009, 0xFF5D, 0xB28A, 0xCA07, 0xCA07, 0xCA06, 0xD207,
+0xD207, 0xD1E8, 0xD1E8, 0x8004, 0xD207, 0x000E, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xD1E7, 0xD207, 0xC9E7, 0xC9E6, 0xD207,
+0xD207, 0xC9E6, 0xC9E6, 0xD207, 0x8003, 0xCA07, 0x8004, 0xC9E7, 0x0011, 0xCA07, 0xD207, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E6, 0xC9E7,
+0xCA07, 0xC9E6, 0xC9E7, 0xD207, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xCA07, 0x8008, 0xC9E7, 0x0024, 0xC9C6, 0xC9E6, 0xC9E7,
+0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xCA07, 0xC1C6, 0xC9E6, 0xC9E6, 0xCA07, 0xB227, 0x8AA9, 0x30E2, 0x62AA, 0x62EB, 0x736D,
+0x83EF, 0x8C51, 0xA514, 0xBDD7, 0xC638, 0xD69A, 0xDEFB, 0xD6BA, 0xE71C, 0xE71B, 0xDEFB, 0xE73C, 0xE71B, 0xE73C, 0xDEDA, 0xE73C,
+0xDEFB, 0x8004, 0xE71C, 0x8003, 0xE71B, 0x000A, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xEF7D, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xE6FB,
+0x8004, 0xE71C, 0x0004, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0x8003, 0xE71C, 0x8003, 0xE73C, 0x0002, 0xE71C, 0xE71B, 0x8004, 0xDEFB,
+0x0003, 0xE6FB, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x0007, 0xE71B, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0x8006, 0xE71B,
+0x8045, 0xFFFF, 0x0006, 0xFF5D, 0xAA49, 0xC228, 0xCA07, 0xCA06, 0xCA07, 0x8004, 0xD1E7, 0x0003, 0xD1E6, 0xD207, 0xD207, 0x8004,
+0xC9E7, 0x8003, 0xD1E7, 0x000A, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD207, 0xCA07, 0xC9E7, 0x8003, 0xC9E6,
+0x0003, 0xC9E7, 0xCA07, 0xD207, 0x8006, 0xC9E7, 0x0005, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E6, 0xC9C6, 0x8003, 0xC9E6, 0x0001, 0xC9E7,
+0x8004, 0xC9E6, 0x8004, 0xC9E7, 0x0003, 0xC9C6, 0xC9C6, 0xC9C7, 0x8003, 0xC9E7, 0x0028, 0xC9E6, 0xC9E6, 0xC1C6, 0xC9E7, 0xC9E6,
+0xC9E7, 0xC1E7, 0xAA07, 0x8A68, 0x2860, 0x5A48, 0x5ACA, 0x6B4C, 0x8C30, 0x9471, 0xAD54, 0xB5B6, 0xCE58, 0xD699, 0xD69A, 0xE71B,
+0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE73C, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xE6FB, 0xDEDB, 0xE71B, 0xE71B, 0xE73C, 0xE71B, 0xDEFB,
+0xDEFB, 0xE6FB, 0xE6FB, 0x8003, 0xDEDA, 0x0008, 0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xE6FB, 0x8003, 0xDEFB,
+0x0004, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0x8008, 0xDEFB, 0x0004, 0xE73C, 0xE71B, 0xDEFB, 0xE6FB, 0x8003, 0xE73C, 0x0009, 0xE71B,
+0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xE6FB, 0x8004, 0xDEFB, 0x8044, 0xFFFF, 0x0007, 0xFFDF, 0xFF7D, 0xBB4D,
+0xBA28, 0xCA27, 0xCA07, 0xCA07, 0x8003, 0xD1E7, 0x0008, 0xD207, 0xD1E7, 0xD207, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0x8003,
+0xC9E7, 0x0006, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0x8003, 0xC9E7, 0x8003, 0xCA07, 0x8003, 0xC9E7, 0x0005, 0xCA07,
+0xCA07, 0xC9E7, 0xC9E7, 0xCA07, 0x8005, 0xC9E7, 0x8005, 0xC9E6, 0x0001, 0xC9E7, 0x800A, 0xC9E6, 0x0003, 0xC9C7, 0xC9C7, 0xC9E7,
+0x8003, 0xC9E6, 0x001C, 0xC9E7, 0xC9E7, 0xC9C6, 0xC9E6, 0xB9C6, 0xAA28, 0x92EA, 0x51E6, 0x5A69, 0x62CA, 0x6B0B, 0x8C0F, 0x8C51,
+0xAD34, 0xB596, 0xCE79, 0xDEDA, 0xD699, 0xE71B, 0xE71C, 0xE73C, 0xE6FB, 0xDEDA, 0xE73C, 0xE71B, 0xE71B, 0xDEDB, 0xE73C, 0x8003,
+0xE71B, 0x0011, 0xDEDB, 0xDEFB, 0xDEFB, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB,
+0xDEFB, 0xE71B, 0xE73C, 0x8008, 0xDEFB, 0x8008, 0xE71B, 0x0007, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0x8003,
+0xDEDB, 0x0002, 0xDEFB, 0xDEFB, 0x8003, 0xE71B, 0x0002, 0xE6FB, 0xE6FB, 0x8003, 0xDEFB, 0x8044, 0xFFFF, 0x0007, 0xFFDF, 0xFF7E,
+0xF555, 0xB228, 0xCA48, 0xCA07, 0xCA07, 0x8003, 0xD1E7, 0x0011, 0xD207, 0xD1E7, 0xD207, 0xC9E7, 0xD207, 0xC9E7, 0xC9E7, 0xD207,
+0xC9E7, 0xD1E7, 0xC9E7, 0xD207, 0xD207, 0xC9E7, 0xC9E7, 0xD207, 0xD207, 0x8003, 0xC9E7, 0x000D, 0xCA07, 0xD207, 0xD207, 0xCA07,
+0xC9E7, 0xC9E6, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E6, 0x8004, 0xC9E7, 0x0001, 0xC9E6, 0x8004, 0xC9E7, 0x8007,
+0xC9E6, 0x0033, 0xC9C6, 0xC9E7, 0xC9E7, 0xC9C7, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1E6, 0xC1C6, 0xC9E7, 0xC9E7, 0xC1C6, 0xC207,
+0xB289, 0x9B2B, 0x51C6, 0x5A89, 0x5269, 0x6B2C, 0x8C50, 0x8C50, 0xA513, 0xB5B6, 0xC638, 0xCE79, 0xDEDA, 0xDEDB, 0xE71B, 0xE71B,
+0xEF3C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xDEDB, 0xE73C, 0xDEFB, 0xE73C, 0xE71B, 0xE6FB, 0xE71C, 0xE73C, 0xE71B,
+0xE71C, 0xE73C, 0xE71C, 0xDEFB, 0xE71B, 0x8003, 0xE71C, 0x0003, 0xE71B, 0xDEFB, 0xDEFB, 0x8003, 0xE71C, 0x0002, 0xE71B, 0xE71B,
+0x800B, 0xDEFB, 0x000B, 0xE71B, 0xE71C, 0xE71C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0x8003, 0xDEFB,
+0x0003, 0xE6FB, 0xE71B, 0xE71C, 0x8003, 0xE71B, 0x8045, 0xFFFF, 0x0007, 0xFF9E, 0xFEBB, 0xAA49, 0xC248, 0xCA07, 0xC9E7, 0xC9E7,
+0x8004, 0xD1E7, 0x0008, 0xD207, 0xD1E7, 0xD207, 0xD1E7, 0xC9E7, 0xD207, 0xC9E7, 0xD1E7, 0x8004, 0xC9E7, 0x0001, 0xD1E7, 0x8003,
+0xC9E7, 0x0002, 0xD207, 0xC9E7, 0x8003, 0xC9E6, 0x8003, 0xC9E7, 0x0007, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6,
+0x8005, 0xC9E7, 0x0001, 0xC9E6, 0x8004, 0xC9E7, 0x8007, 0xC9E6, 0x8005, 0xC9E7, 0x0038, 0xC9E6, 0xC1E6, 0xC1E6, 0xC9E7, 0xC9E7,
+0xC9C6, 0xC9E7, 0xBA07, 0xA227, 0x930B, 0x6248, 0x5A68, 0x5AAA, 0x5ACA, 0x7BAE, 0x9471, 0xAD34, 0xAD75, 0xD699, 0xD6BA, 0xDEFB,
+0xDEDA, 0xE73C, 0xE71C, 0xDEFB, 0xE6FB, 0xE6FB, 0xE71B, 0xE73C, 0xD69A, 0xE6FB, 0xE73C, 0xDEFB, 0xEF5C, 0xDEFB, 0xE73C, 0xDEFB,
+0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xDEFB, 0xE73C, 0xE71B, 0xDEDB, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB,
+0xDEDB, 0xDEFB, 0xE71B, 0x8003, 0xE73C, 0x0002, 0xDEDB, 0xDEDB, 0x8006, 0xDEFB, 0x0001, 0xE71B, 0x8004, 0xDEFB, 0x0002, 0xE71B,
+0xE71B, 0x8004, 0xE71C, 0x0009, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0x8045, 0xFFFF, 0x0009,
+0xFFBE, 0xFF1C, 0xA28A, 0xBA48, 0xC207, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E6, 0x8003, 0xD1E7, 0x0013, 0xD207, 0xD207, 0xD1E7, 0xD1E7,
+0xD207, 0xD1E7, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xCA07, 0xC9E7, 0xC9E7, 0xC9E6, 0x8005,
+0xC9E7, 0x0001, 0xCA07, 0x8004, 0xC9E7, 0x0002, 0xC9E6, 0xC9E7, 0x8003, 0xC9E6, 0x0004, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0x8006,
+0xC9E6, 0x0004, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C6, 0x8003, 0xC9E7, 0x0025, 0xC9E6, 0xC9E6, 0xC1E6, 0xC1E6, 0xC9E6, 0xC9C6, 0xC9C6,
+0xCA07, 0xBA48, 0x9A27, 0x9B4C, 0x49A6, 0x5A69, 0x5AAA, 0x630B, 0x8C30, 0x9471, 0xB575, 0xB5B6, 0xCE59, 0xCE79, 0xDEDA, 0xE71B,
+0xDEDB, 0xDEFB, 0xE71B, 0xEF3C, 0xE6FB, 0xDEFB, 0xE71B, 0xE73C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE73C, 0xE6FB, 0x8003, 0xE71B,
+0x0004, 0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0x8004, 0xDEFB, 0x0001, 0xE6FB, 0x8003, 0xE71B, 0x0005, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB,
+0xDEDB, 0x800B, 0xDEFB, 0x000A, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xEF3C, 0xE73C, 0xE71C, 0xDEFB, 0xDEDA, 0xDEDB, 0x8003, 0xDEFB,
+0x0004, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x8045, 0xFFFF, 0x000E, 0xFFBE, 0xFF1C, 0xA2AA, 0xBA48, 0xCA07, 0xCA07,
+0xD207, 0xD1E7, 0xD1E6, 0xD1E7, 0xD1E7, 0xC9E7, 0xD207, 0xD207, 0x8004, 0xD1E7, 0x0004, 0xC9E6, 0xD1E7, 0xC9E7, 0xC9E7, 0x8004,
+0xD1E7, 0x0001, 0xD207, 0x8003, 0xC9E7, 0x8003, 0xCA07, 0x0003, 0xC9E7, 0xC9E6, 0xCA07, 0x8006, 0xC9E7, 0x0008, 0xC9E6, 0xC9E6,
+0xC9C6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0x8009, 0xC9E6, 0x0006, 0xC9C6, 0xC9E7, 0xC9C7, 0xC9E7, 0xC9E6, 0xC9E6, 0x8003,
+0xC1E6, 0x0024, 0xD207, 0xC9C6, 0xCA07, 0xB1E6, 0xAAA9, 0x5123, 0x5A28, 0x62AA, 0x62CB, 0x6B2C, 0x840F, 0x9491, 0xB575, 0xBDD7,
+0xD679, 0xDEDB, 0xDEDA, 0xE71B, 0xDEFB, 0xE71B, 0xDEFB, 0xDEDB, 0xE6FB, 0xE71B, 0xE6FB, 0xE73C, 0xE6FB, 0xE71C, 0xE71C, 0xDEFB,
+0xE71B, 0xE73C, 0xEF5C, 0xE71C, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x0001, 0xE6FB, 0x8004, 0xE71B, 0x0005, 0xE6FB, 0xE71B, 0xE71B,
+0xDEFB, 0xE6FB, 0x8005, 0xE71B, 0x0001, 0xE71C, 0x8003, 0xE73C, 0x0001, 0xE71C, 0x8004, 0xE71B, 0x000A, 0xE71C, 0xE73C, 0xE73C,
+0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0x8003, 0xE6FB, 0x0007, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B,
+0xE71C, 0x8045, 0xFFFF, 0x0009, 0xFFBE, 0xFF7D, 0x9AAA, 0xB248, 0xC207, 0xCA07, 0xD207, 0xD1E7, 0xD1E6, 0x8003, 0xC9E7, 0x0007,
+0xD207, 0xC9E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xC9C6, 0x8006, 0xC9E7, 0x0004, 0xD1E7, 0xD1E7, 0xCA07, 0xC9E7, 0x8003, 0xC9E6,
+0x8003, 0xC9E7, 0x0011, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E7, 0xCA07, 0xC9C6, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6,
+0xC9E6, 0xC9E7, 0xC9E6, 0xC9E7, 0x8006, 0xC9E6, 0x002C, 0xC9C6, 0xC9E7, 0xC9C7, 0xC9C7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1E6, 0xC1E6,
+0xC9E6, 0xC9C6, 0xC9E7, 0xC1E7, 0xB248, 0x9A89, 0x6A07, 0x6269, 0x5269, 0x5AAA, 0x6B2C, 0x7BCE, 0x9CB2, 0xB575, 0xBDF7, 0xD699,
+0xDEFB, 0xDEFB, 0xDEDB, 0xE71B, 0xE71B, 0xE73C, 0xE6FB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEDB, 0xDEFB,
+0xE71C, 0xEF3C, 0xE71B, 0x8003, 0xDEFB, 0x0006, 0xE73C, 0xEF5D, 0xE73C, 0xE73C, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x0007, 0xE6FB,
+0xE6FB, 0xE73C, 0xEF5C, 0xEF5C, 0xE71C, 0xDEFB, 0x800A, 0xDEDB, 0x0014, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDA, 0xDEDA,
+0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xEF5C, 0x8042, 0xFFFF, 0x000B,
+0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF7E, 0x92CB, 0xB268, 0xC227, 0xC9E7, 0xD227, 0xC9E7, 0x8004, 0xCA07, 0x8005, 0xD207, 0x8003,
+0xD1E7, 0x0003, 0xC9E7, 0xC9C6, 0xC9C6, 0x8004, 0xD1E7, 0x0002, 0xD207, 0xCA07, 0x8004, 0xC9E7, 0x0002, 0xCA07, 0xD207, 0x8004,
+0xC9E7, 0x000D, 0xCA07, 0xCA07, 0xC9E7, 0xC9E6, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0x8003,
+0xC9E6, 0x0007, 0xC9E7, 0xD207, 0xCA07, 0xC9E7, 0xC9C7, 0xC9E7, 0xC9E7, 0x8005, 0xC9E6, 0x0019, 0xC9C6, 0xC9E7, 0xC1E7, 0xB1E7,
+0xAA48, 0x9289, 0x6207, 0x5A69, 0x5AAA, 0x6B2C, 0x6B4C, 0x840F, 0xA4F3, 0xC5F7, 0xC5F7, 0xD699, 0xDEFB, 0xDEDB, 0xE71B, 0xDEFB,
+0xE6FB, 0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0x8003, 0xE71C, 0x000C, 0xE73C, 0xDEFB, 0xDEDA, 0xEF5C, 0xE6FB, 0xE71B, 0xDEFB, 0xE71B,
+0xE71C, 0xE6FB, 0xE71B, 0xDEFB, 0x8004, 0xE71B, 0x000D, 0xE6FB, 0xDEFB, 0xDEDA, 0xDEBA, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71B,
+0xE6FB, 0xE71B, 0xE71B, 0xDEFB, 0x8003, 0xDEDB, 0x8004, 0xDEDA, 0x000D, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE71B,
+0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x8004, 0xDEDA, 0x8045, 0xFFFF, 0x000B, 0xF7BE, 0xFFDF, 0xFEFB,
+0xB269, 0xCA27, 0xCA07, 0xD207, 0xC9E7, 0xCA07, 0xC9E7, 0xCA07, 0x8004, 0xC9E6, 0x8004, 0xC9E7, 0x0002, 0xD1E7, 0xC9E7, 0x8005,
+0xD1E7, 0x0001, 0xC9E7, 0x8003, 0xC9E6, 0x8003, 0xC9E7, 0x0002, 0xCA07, 0xCA07, 0x8009, 0xC9E7, 0x0004, 0xC9E6, 0xC9E6, 0xC9E7,
+0xC9E7, 0x8005, 0xC9E6, 0x0002, 0xC9C6, 0xC9E6, 0x8007, 0xC9E7, 0x8005, 0xC9E6, 0x0021, 0xC9C7, 0xCA07, 0xB9A6, 0xBA68, 0xA268,
+0x6123, 0x6228, 0x62CA, 0x62EB, 0x6B2C, 0x83EF, 0x8C30, 0xAD34, 0xB595, 0xCE38, 0xDEBA, 0xDEDA, 0xDEFB, 0xE71B, 0xDEFB, 0xE6FB,
+0xE71B, 0xE71B, 0xE73C, 0xEF3C, 0xDEDB, 0xE6FB, 0xE71B, 0xDEDB, 0xE71B, 0xE71C, 0xDEFB, 0xE71B, 0x8003, 0xE71C, 0x0001, 0xE6FB,
+0x8004, 0xDEFB, 0x0009, 0xDEDB, 0xDEDB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0x8003, 0xDEDB, 0x0007, 0xDEFB,
+0xE71B, 0xE71B, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0x8003, 0xE71C, 0x000C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C,
+0xE71C, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0x8004, 0xDEFB, 0x0005, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDA, 0x8043, 0xFFFF, 0x000B,
+0xFFDE, 0xFFFF, 0xFFFF, 0xFFBE, 0xFF7D, 0xB289, 0xCA07, 0xCA07, 0xD207, 0xD208, 0xD208, 0x8006, 0xD1E7, 0x0008, 0xC9E7, 0xC9E7,
+0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0x8004, 0xC9E7, 0x8003, 0xC9E6, 0x8003, 0xC9E7, 0x0002, 0xCA07, 0xCA07, 0x8009,
+0xC9E7, 0x0003, 0xC9E6, 0xC9E6, 0xC9E7, 0x8004, 0xC9E6, 0x0002, 0xC9E7, 0xC9E7, 0x8004, 0xC9E6, 0x0002, 0xC9E7, 0xC9C6, 0x8003,
+0xC9E7, 0x0019, 0xC9E6, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1C6, 0xC207, 0xB227, 0x9207, 0x6185, 0x6248, 0x5AAA, 0x630B,
+0x6B4C, 0x6B4D, 0x8C50, 0xA513, 0xC5F7, 0xC617, 0xDEDB, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0x8003, 0xE71C, 0x0010, 0xDEFB, 0xE71B,
+0xEF5C, 0xE71B, 0xDEDA, 0xE71B, 0xE71B, 0xDEFB, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xDEFB, 0x8003, 0xDEDB,
+0x0007, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0x8004, 0xDEFB, 0x0007, 0xE6FB, 0xDEFB, 0xDEFB, 0xE73C, 0xE71C,
+0xE73C, 0xE73C, 0x8003, 0xE71C, 0x8003, 0xE71B, 0x0003, 0xDEFB, 0xE6FB, 0xE71B, 0x8003, 0xE71C, 0x8003, 0xDEFB, 0x0009, 0xDEDB,
+0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xE71B, 0xDEDB, 0xDEDA, 0x8044, 0xFFFF, 0x0009, 0xFFDF, 0xFFFF, 0xFFDF, 0xFF3C, 0xB248,
+0xCA08, 0xD207, 0xD1E7, 0xC9E7, 0x8003, 0xD1E7, 0x0002, 0xD207, 0xD207, 0x8005, 0xD1E7, 0x0001, 0xD207, 0x8003, 0xC9E7, 0x0002,
+0xD1E7, 0xD1E7, 0x8014, 0xC9E7, 0x0003, 0xC9E6, 0xC9E6, 0xC9E7, 0x8004, 0xC9E6, 0x0002, 0xC9E7, 0xC9E7, 0x8004, 0xC9E6, 0x8003,
+0xC9E7, 0x0032, 0xC9E6, 0xC9E6, 0xC1E6, 0xC1E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC1A5, 0xCA07, 0xC1E6, 0xB228, 0x9268, 0x69E7, 0x6ACA,
+0x62EB, 0x738D, 0x736D, 0x83EF, 0x9491, 0xAD54, 0xBDD6, 0xD679, 0xDEDA, 0xE73C, 0xE73C, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C,
+0xE6FB, 0xEF5D, 0xDEDA, 0xDEFB, 0xE71B, 0xDEDB, 0xE6FB, 0xE71C, 0xDEDB, 0xE6FB, 0xDEFB, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0xDEFB,
+0xE71B, 0xE73C, 0xE71C, 0xE6FB, 0x8004, 0xDEFB, 0x0009, 0xE71B, 0xE71B, 0xE73C, 0xEF5D, 0xEF5D, 0xEF3C, 0xE71C, 0xE71B, 0xE6FB,
+0x8004, 0xDEDB, 0x0008, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDA, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0x8004, 0xE6FB, 0x0005, 0xE71B, 0xE71B,
+0xE71C, 0xE71B, 0xE71B, 0x8003, 0xE6FB, 0x0004, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDA, 0x8042, 0xFFFF, 0x0010, 0xFFDE, 0xFFFE, 0xFFFF,
+0xFFFF, 0xFFDF, 0xFF5D, 0xAA49, 0xC207, 0xC9E7, 0xD207, 0xD1E7, 0xD1E7, 0xD1E6, 0xC9E6, 0xD207, 0xD1E7, 0x800A, 0xC9E7, 0x0002,
+0xD1E7, 0xD1E7, 0x8003, 0xC9E7, 0x8008, 0xC9E6, 0x800A, 0xC9E7, 0x800D, 0xC9E6, 0x003D, 0xC1E6, 0xC1E6, 0xC9E6, 0xC1E6, 0xC1E7,
+0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC1C5, 0xBA07, 0xAA48, 0x58C3, 0x6248, 0x6ACA, 0x62EB, 0x630B, 0x736D, 0x7BAE, 0x9CB2, 0xB575,
+0xCE38, 0xCE59, 0xDEDB, 0xDEFB, 0xE71C, 0xE73C, 0xE71B, 0xE6FB, 0xE71B, 0xDEFB, 0xE71B, 0xEF5C, 0xE71B, 0xE71C, 0xE73C, 0xE73C,
+0xE71C, 0xE71B, 0xE71C, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C,
+0xE6FB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0x8003, 0xDEDB, 0x8004, 0xE71B, 0x0006, 0xE6FB, 0xE6FB, 0xE71B,
+0xE6FB, 0xDEDB, 0xDEDB, 0x8004, 0xDEFB, 0x0004, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0x8003, 0xDEFB, 0x8003, 0xDEDB, 0x8004, 0xDEFB,
+0x8003, 0xFFFF, 0x8004, 0xFFDF, 0x803F, 0xFFFF, 0x000B, 0xFFDF, 0xFF7E, 0xA289, 0xBA48, 0xCA28, 0xC9E7, 0xD1E8, 0xD208, 0xC9E6,
+0xCA06, 0xC9E6, 0x8007, 0xC9E7, 0x0009, 0xD207, 0xD1E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E6, 0xC9E7, 0x8005, 0xC9E6,
+0x0004, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0x8004, 0xC9E7, 0x8003, 0xC9E6, 0x0002, 0xC9E7, 0xC9E7, 0x8005, 0xC9E6, 0x0001, 0xC9E7,
+0x8007, 0xC9E6, 0x0005, 0xC1E6, 0xC9E6, 0xC206, 0xC1E7, 0xC1E7, 0x8003, 0xC9E7, 0x0017, 0xC9E6, 0xC206, 0xB227, 0xA268, 0x7207,
+0x6269, 0x5AAA, 0x630B, 0x736D, 0x7BAE, 0x8C50, 0xAD34, 0xBDB6, 0xCE38, 0xDEBA, 0xDEBA, 0xDEFB, 0xE6FB, 0xE73C, 0xE71C, 0xE71C,
+0xE71B, 0xDEDB, 0x8003, 0xDEFB, 0x0011, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB,
+0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE71B, 0x8004, 0xDEFB, 0x0004, 0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB, 0x8005, 0xDEFB, 0x0007,
+0xE71B, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0x8004, 0xDEFB, 0x0007, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEDB, 0xE71B,
+0xE71B, 0x8004, 0xE6FB, 0x0006, 0xDEFB, 0xDEFB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0x8003, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x803C,
+0xFFFF, 0x0013, 0xF7DF, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF9E, 0xFF3B, 0xA2A9, 0xB227, 0xD269, 0xC9E7, 0xC9E7, 0xDA27,
+0xD1E6, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0x8004, 0xC9E7, 0x0004, 0xD207, 0xCA07, 0xC9E7, 0xC9E7, 0x8004, 0xC9E6, 0x8003, 0xC9E7,
+0x0001, 0xC9E6, 0x8005, 0xC9E7, 0x0002, 0xC9E6, 0xC9E6, 0x8004, 0xC9E7, 0x0004, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0x8005, 0xC9E6,
+0x0002, 0xCA07, 0xC9E7, 0x8006, 0xC9E6, 0x0017, 0xC9C6, 0xC9E6, 0xC207, 0xC207, 0xC1C7, 0xC9C7, 0xC9C7, 0xC9E7, 0xC1C6, 0xB9E6,
+0xAA68, 0x6944, 0x7ACA, 0x62AA, 0x7B8D, 0x6B2C, 0x6B4D, 0x83EF, 0x9CB2, 0xB575, 0xC5F7, 0xCE58, 0xDEFB, 0x8003, 0xE73C, 0x0007,
+0xDEFB, 0xE71B, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE73C, 0x8003, 0xDEFB, 0x000C, 0xE6FB, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE71C,
+0xE73C, 0xE73C, 0xE71B, 0xE71B, 0xE73C, 0xEF3C, 0x8004, 0xE73C, 0x0002, 0xE71C, 0xE71B, 0x8006, 0xDEFB, 0x0001, 0xE6FB, 0x8004,
+0xE71B, 0x000D, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xD6BA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0x8003,
+0xE71C, 0x0006, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xE71C, 0xE6FB, 0x8004, 0xDEDB, 0x0006, 0xDEFB, 0xFFDE, 0xFFDE, 0xF7BE, 0xFFDE,
+0xFFDE, 0x800A, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x8031, 0xFFFF, 0x0002, 0xFFFE, 0xFFFE, 0x8003, 0xFFFF, 0x000A, 0xFFDF, 0xFF9C,
+0x92A9, 0xB248, 0xC207, 0xCA28, 0xD207, 0xD1E6, 0xD1E6, 0xD1E7, 0x8007, 0xC9E7, 0x0004, 0xCA07, 0xCA07, 0xC9E7, 0xC9E7, 0x8003,
+0xC9E6, 0x0001, 0xCA07, 0x8007, 0xC9E7, 0x0005, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0x8003, 0xC9E7, 0x000E, 0xC9E6, 0xC9E6,
+0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9C6, 0xC9E6, 0xC9E6, 0x8003, 0xC9E7, 0x0029, 0xC9C6,
+0xC9E6, 0xC207, 0xC207, 0xC1C7, 0xC9C7, 0xC9C6, 0xC9E7, 0xC1E6, 0xBA48, 0x9A69, 0x69C6, 0x6A89, 0x734C, 0x6B0B, 0x736D, 0x736D,
+0x83EF, 0x9492, 0xBDD6, 0xC618, 0xDEBA, 0xE6FB, 0xE71B, 0xE6FB, 0xE73C, 0xE71B, 0xEF5D, 0xEF5D, 0xDEFB, 0xE71B, 0xDEFB, 0xE73C,
+0xE71C, 0xDEFB, 0xDEDB, 0xE6FB, 0xE6FB, 0xDEDB, 0xE71B, 0xDEFB, 0x8004, 0xE71B, 0x0004, 0xDEFB, 0xE6FB, 0xDEDA, 0xDEFB, 0x8003,
+0xDEDB, 0x0003, 0xDEFB, 0xDEFB, 0xE71B, 0x8004, 0xE71C, 0x000D, 0xE71B, 0xE71B, 0xE71C, 0xE73C, 0xEF3C, 0xE71B, 0xE6FB, 0xE71B,
+0xE71B, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0x8004, 0xDEFB, 0x0003, 0xE71B, 0xE71B, 0xE6FB, 0x8004, 0xDEFB, 0x000E, 0xE71B, 0xEF3C,
+0xEF5D, 0xEF5C, 0xE73C, 0xE73C, 0xE71C, 0xE6FB, 0xDEFB, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0x8006, 0xFFFF, 0x8003, 0xFFDF,
+0x0004, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDF, 0x8036, 0xFFFF, 0x0008, 0xFFDE, 0xFF3B, 0xB269, 0xC208, 0xCA28, 0xC1E6, 0xD1E7, 0xDA07,
+0x8003, 0xD1E7, 0x0003, 0xD207, 0xD207, 0xD1E7, 0x8006, 0xC9E7, 0x8004, 0xCA07, 0x0008, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6,
+0xC9E6, 0xC9E7, 0xCA07, 0x8003, 0xC9E6, 0x8003, 0xC9E7, 0x0002, 0xC9E6, 0xC9E6, 0x8006, 0xC9E7, 0x0003, 0xCA07, 0xC9E7, 0xC9E7,
+0x8003, 0xC9E6, 0x0001, 0xC9E7, 0x8005, 0xC9E6, 0x0016, 0xC1C6, 0xC1E7, 0xC9E7, 0xC9E7, 0xC9C6, 0xC1E6, 0xBA08, 0xA228, 0x69C6,
+0x6A68, 0x730B, 0x6B0B, 0x7BAD, 0x736D, 0x7BCF, 0x94B2, 0xA514, 0xC5F7, 0xCE79, 0xDEDA, 0xDEFB, 0xE71C, 0x8003, 0xE71B, 0x0015,
+0xE73C, 0xE71B, 0xDEDB, 0xE71B, 0xE71C, 0xDEDA, 0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE71B, 0xE73C, 0xDEFB, 0xDEFB,
+0xE71C, 0xE71C, 0xDEFB, 0xE6FB, 0xE73C, 0x8004, 0xE71C, 0x8005, 0xE73C, 0x0007, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEDB,
+0xDEDB, 0x8006, 0xE71B, 0x0018, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B,
+0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xE73C, 0xE71C, 0xE71B, 0xE6FB, 0xFFDE, 0xFFDF, 0x8008, 0xFFFF, 0x0004, 0xFFDF,
+0xFFBE, 0xFFBE, 0xFFDF, 0x803A, 0xFFFF, 0x0009, 0xFFDE, 0xFF9D, 0xAA6A, 0xC229, 0xC208, 0xCA27, 0xC9E7, 0xD1E7, 0xD1E7, 0x8006,
+0xC9E7, 0x0001, 0xC9E6, 0x8004, 0xC9E7, 0x8004, 0xC9E6, 0x0001, 0xC9E7, 0x8003, 0xC9E6, 0x8004, 0xC9E7, 0x0005, 0xC9C6, 0xC9E6,
+0xD207, 0xD207, 0xC9E7, 0x8003, 0xC9E6, 0x8007, 0xC9E7, 0x002A, 0xC9E6, 0xC9E6, 0xCA07, 0xC9E7, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6,
+0xC9E6, 0xC9E7, 0xC9E6, 0xC1C6, 0xC1E7, 0xC9E7, 0xC9E6, 0xC1E6, 0xC207, 0xAA28, 0x9249, 0x7269, 0x72EB, 0x732C, 0x736D, 0x7BAD,
+0x7BCE, 0x7BCE, 0x9CF3, 0xB5B6, 0xCE58, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEBA, 0xDEFB, 0xE71C, 0xE71B, 0xE71C, 0xDEDB, 0xDEFB, 0xE71B,
+0xE6FB, 0xE71B, 0x8003, 0xE71C, 0x0002, 0xE73C, 0xE71C, 0x8004, 0xDEFB, 0x0004, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0x8003, 0xE71C,
+0x0001, 0xE71B, 0x8003, 0xDEFB, 0x8004, 0xDEDB, 0x000A, 0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xE71B, 0xE6FB,
+0xE6FB, 0x8004, 0xDEFB, 0x0002, 0xDEDB, 0xE71C, 0x8003, 0xE73C, 0x8003, 0xE71C, 0x0001, 0xE73C, 0x8003, 0xE6FB, 0x8005, 0xE71B,
+0x8004, 0xDEFB, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8004, 0xFFDE, 0x0006, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xF7BE, 0xFFDE, 0x8005,
+0xFFFF, 0x8005, 0xFFDF, 0x8031, 0xFFFF, 0x000A, 0xFF7D, 0x9A6A, 0xB229, 0xCA29, 0xC1E7, 0xC9E7, 0xD207, 0xC9E7, 0xC9E7, 0xC9E6,
+0x8007, 0xC9E7, 0x8003, 0xCA07, 0x8003, 0xC9E7, 0x0001, 0xCA07, 0x8003, 0xC9E6, 0x000D, 0xCA07, 0xCA07, 0xC9E7, 0xC9E6, 0xC9C6,
+0xC9E7, 0xCA07, 0xC9E7, 0xC9C6, 0xC9C6, 0xC9E6, 0xC9E7, 0xC9C6, 0x8005, 0xC9E7, 0x0030, 0xC9E6, 0xC9E6, 0xC9C6, 0xC9E7, 0xC9E6,
+0xC9C6, 0xC9E6, 0xC9E7, 0xC9E6, 0xC9E6, 0xCA07, 0xC9E7, 0xC9C7, 0xC9E7, 0xC1E6, 0xC1E6, 0xC206, 0xB227, 0x9A89, 0x6185, 0x72AA,
+0x6ACB, 0x7B6D, 0x83CE, 0x738D, 0x73AE, 0x8430, 0xA534, 0xBDD6, 0xCE59, 0xDEDA, 0xDEDA, 0xE6FB, 0xE71C, 0xE6FB, 0xE73C, 0xE71C,
+0xE71C, 0xDEDA, 0xE71B, 0xE71C, 0xE71C, 0xDEDB, 0xE71C, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEBA, 0x8003, 0xE71B, 0x000D, 0xDEFB, 0xE71B,
+0xE71B, 0xE6FB, 0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xE71B, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0x8006, 0xDEFB, 0x8004, 0xDEDB, 0x0008,
+0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0x8003, 0xE73C, 0x0002, 0xE71C, 0xE71B, 0x8005, 0xDEFB, 0x0001,
+0xE6FB, 0x8003, 0xDEFB, 0x0006, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xDEFB, 0xDEDB, 0x8003, 0xFFFF, 0x0002, 0xFFDE, 0xFFBE, 0x8003,
+0xFFDE, 0x8005, 0xFFFF, 0x8005, 0xFFDF, 0x8004, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x8031, 0xFFFF, 0x0007, 0xFFBE, 0xFF1D, 0xA26A,
+0xC249, 0xCA08, 0xC9E7, 0xD228, 0x8003, 0xC9E7, 0x0002, 0xCA07, 0xCA07, 0x8005, 0xC9E7, 0x8006, 0xCA07, 0x8005, 0xC9E7, 0x0002,
+0xC9E6, 0xC9E6, 0x8003, 0xC9E7, 0x8005, 0xC9E6, 0x0002, 0xC9E7, 0xC9C6, 0x8005, 0xC9E7, 0x0003, 0xC9E6, 0xC9E6, 0xC9C6, 0x8007,
+0xC9E6, 0x001C, 0xCA07, 0xC9C6, 0xC9C7, 0xC9C7, 0xC1E6, 0xBA07, 0xB227, 0xA248, 0x79E7, 0x728A, 0x7B2C, 0x732C, 0x736D, 0x7BAE,
+0x7BEE, 0x8450, 0x8C71, 0xBDD6, 0xCE59, 0xD6BA, 0xD6BA, 0xE73C, 0xE73C, 0xE71B, 0xDEDB, 0xDEFB, 0xE6FB, 0xE73C, 0x8004, 0xDEFB,
+0x0003, 0xE73C, 0xE71C, 0xE73C, 0x8003, 0xE71C, 0x0005, 0xDEFB, 0xDEFB, 0xE73C, 0xE71B, 0xE71B, 0x8006, 0xE71C, 0x0001, 0xE6FB,
+0x8003, 0xDEDB, 0x0002, 0xDEFB, 0xE6FB, 0x8004, 0xE71B, 0x8004, 0xDEFB, 0x0001, 0xE6FB, 0x8003, 0xE73C, 0x0002, 0xE71C, 0xE71B,
+0x8003, 0xDEFB, 0x800A, 0xE71B, 0x000C, 0xE6FB, 0xDEDB, 0xDEBA, 0xD6BA, 0xDEDA, 0xDEDB, 0xE71C, 0xE6FB, 0xDEDB, 0xDEBA, 0xFFDE,
+0xFFDF, 0x8008, 0xFFFF, 0x0004, 0xFFDF, 0xF7BE, 0xF7BE, 0xFFDE, 0x8038, 0xFFFF, 0x0001, 0xFFDF, 0x8003, 0xFFFF, 0x0005, 0xFF9E,
+0xFF3C, 0xAA49, 0xCA69, 0xC1A6, 0x8003, 0xC9E7, 0x8003, 0xD207, 0x800D, 0xC9E7, 0x000E, 0xCA07, 0xCA07, 0xC9E6, 0xC9C6, 0xC9E6,
+0xC9E7, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07, 0xC9E7, 0xC9E6, 0xC9C6, 0x8006, 0xC9E7, 0x0004, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7,
+0x8004, 0xC9E6, 0x0034, 0xC9C6, 0xC9E6, 0xC1E6, 0xC1C6, 0xC9E7, 0xC9E7, 0xC206, 0xBA47, 0xAA48, 0x9248, 0x7AAA, 0x72EB, 0x730C,
+0x83AE, 0x7BAE, 0x7B8E, 0x840F, 0x8C71, 0xA4F3, 0xC618, 0xD69A, 0xE71C, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xE73C, 0xDEFB, 0xDEFB,
+0xDEDB, 0xDEDB, 0xDEDA, 0xE6FB, 0xE73C, 0xDEDA, 0xDEFB, 0xD6BA, 0xDEFB, 0xE73C, 0xE71B, 0xEF3C, 0xE71B, 0xE71B, 0xE71C, 0xE71C,
+0xE71B, 0xE6FB, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xE6FB, 0x8004, 0xE71B, 0x0003, 0xDEFB, 0xDEFB, 0xE6FB, 0x8005, 0xE71B, 0x0007,
+0xDEFB, 0xDEFB, 0xE73C, 0xEF3C, 0xE73C, 0xE73C, 0xE71B, 0x8007, 0xDEFB, 0x0001, 0xE6FB, 0x8004, 0xE71B, 0x0007, 0xE6FB, 0xE6FB,
+0xE71C, 0xE73C, 0xEF5C, 0xE73C, 0xE71C, 0x8003, 0xDEDB, 0x0005, 0xDEFB, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF, 0x8004, 0xFFFF, 0x0006,
+0xFFDE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0x8004, 0xFFDE, 0x0002, 0xFFDF, 0xFFDF, 0x8032, 0xFFFF, 0x0011, 0xFFDF, 0xFFFF,
+0xFFFF, 0xF7FF, 0xFFFF, 0xFF7D, 0x9A6A, 0xBA69, 0xC207, 0xD227, 0xC9E7, 0xC9E7, 0xCA07, 0xD207, 0xCA07, 0xC9E7, 0xC9E6, 0x8009,
+0xC9E7, 0x0001, 0xCA07, 0x8004, 0xC9E7, 0x8005, 0xC9E6, 0x0002, 0xC9E7, 0xC9E7, 0x8004, 0xC9E6, 0x8006, 0xC9E7, 0x8006, 0xC9E6,
+0x003B, 0xCA06, 0xC9E6, 0xC9E6, 0xCA06, 0xC9E7, 0xC1C6, 0xCA07, 0xC1E6, 0xBA07, 0xB248, 0x9248, 0x8268, 0x7AEB, 0x732C, 0x7B6D,
+0x734C, 0x7BCF, 0x7BCE, 0x83EF, 0x9CD3, 0xB575, 0xCE79, 0xDEDA, 0xDEBA, 0xDEDB, 0xE71B, 0xE73C, 0xE71B, 0xE71B, 0xDEFB, 0xE73C,
+0xE71B, 0xE73C, 0xE6FB, 0xE71B, 0xDEFB, 0xE73C, 0xE71C, 0xE71C, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xE73C, 0xDEFB, 0xE71B, 0xE71C,
+0xE71B, 0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0x8005, 0xDEFB, 0x0005, 0xDEDB,
+0xDEDB, 0xDEDA, 0xDEDA, 0xE6FB, 0x8004, 0xE71B, 0x0001, 0xE6FB, 0x8007, 0xE71B, 0x0002, 0xE6FB, 0xE6FB, 0x8003, 0xE71B, 0x8005,
+0xDEFB, 0x0001, 0xDEDA, 0x8003, 0xDEFB, 0x0001, 0xE6FB, 0x8003, 0xFFDE, 0x0003, 0xFFBE, 0xFFDE, 0xFFDF, 0x8006, 0xFFFF, 0x0002,
+0xFFDF, 0xFFDF, 0x8005, 0xFFDE, 0x0002, 0xFFDF, 0xFFDF, 0x8009, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x802A, 0xFFFF, 0x000C, 0xFFBF,
+0xFF9E, 0xFF5D, 0x9248, 0xB247, 0xB9E6, 0xCA06, 0xC9E6, 0xC9E6, 0xCA06, 0xCA07, 0xCA07, 0x8004, 0xC9E7, 0x0002, 0xCA07, 0xCA07,
+0x8004, 0xC9E7, 0x0003, 0xCA07, 0xC9E7, 0xC9E6, 0x8003, 0xC9E7, 0x0005, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0x8003, 0xC9C6,
+0x0001, 0xC9E6, 0x8007, 0xC9E7, 0x8004, 0xC9E6, 0x0001, 0xC9C6, 0x8004, 0xC9E6, 0x001D, 0xCA06, 0xC9E7, 0xC1E6, 0xCA06, 0xC206,
+0xBA07, 0xA248, 0x8A48, 0x7ACA, 0x7B2C, 0x7B6D, 0x736D, 0x7BCE, 0x7BEF, 0x8430, 0x9CB2, 0xB596, 0xCE38, 0xD6BA, 0xDEDA, 0xDEFB,
+0xE71C, 0xDEFB, 0xE71C, 0xE73C, 0xE6FB, 0xDEFB, 0xE73C, 0xE6FB, 0x8003, 0xE71B, 0x0012, 0xDEFB, 0xE71B, 0xE71C, 0xDEFB, 0xE71B,
+0xE73C, 0xE71C, 0xE71C, 0xDEFB, 0xE71B, 0xDEFB, 0xE6FB, 0xE71C, 0xE6FB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0x8005, 0xDEFB, 0x0002,
+0xE6FB, 0xE6FB, 0x8006, 0xDEFB, 0x0002, 0xE6FB, 0xE71B, 0x8006, 0xDEDA, 0x0003, 0xDEDB, 0xDEDB, 0xDEDA, 0x8004, 0xDEDB, 0x8004,
+0xDEFB, 0x0005, 0xE6FB, 0xE6FB, 0xDEDB, 0xDEDA, 0xDEDA, 0x8004, 0xDEFB, 0x0007, 0xDEDB, 0xDEDB, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE,
+0xFFDF, 0x8003, 0xFFFF, 0x8004, 0xFFDF, 0x0002, 0xFFFF, 0xFFDF, 0x8007, 0xFFFF, 0x0003, 0xFFDF, 0xFFDE, 0xFFDE, 0x8003, 0xFFFF,
+0x8003, 0xFFDF, 0x802B, 0xFFFF, 0x000B, 0xFFBF, 0xFFFF, 0xFFDF, 0xFF7D, 0xFF1A, 0xAAA9, 0xBA47, 0xCA27, 0xC9E7, 0xC9E6, 0xC9E6,
+0x8003, 0xCA07, 0x0002, 0xC9E6, 0xC9E6, 0x8005, 0xC9E7, 0x0001, 0xD1E7, 0x8006, 0xC9E7, 0x0004, 0xC9E6, 0xC9E7, 0xC9E7, 0xCA07,
+0x800C, 0xC9E7, 0x8003, 0xC9E6, 0x0026, 0xC9E7, 0xCA07, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9E7, 0xC9E6, 0xC9E6, 0xC9C6, 0xC1C6, 0xC206,
+0xB226, 0xAA48, 0x9A89, 0x7AA9, 0x7B2C, 0x7B4C, 0x7B6D, 0x840F, 0x738D, 0x8410, 0x94B2, 0xAD55, 0xC5F7, 0xD699, 0xE71C, 0xDEFB,
+0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xE6FB, 0xE71B, 0x8003, 0xE6FB, 0x0001, 0xE71B, 0x8003,
+0xE6FB, 0x000B, 0xDEFB, 0xE71B, 0xE73C, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEDB, 0x8004, 0xDEFB, 0x000C,
+0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0x8003, 0xDEDA, 0x0008, 0xDEFB,
+0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xDEFB, 0xDEFB, 0xE6FB, 0x8006, 0xDEFB, 0x0002, 0xE6FB, 0xE6FB, 0x8007, 0xDEFB, 0x0014, 0xE6FB,
+0xE71B, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF,
+0xFFDF, 0xFFDE, 0xFFDF, 0x8036, 0xFFFF, 0x0012, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFDE, 0xFF9D, 0x9A69, 0xB249, 0xCA08, 0xC9E7,
+0xD228, 0xC9E6, 0xCA07, 0xCA06, 0xC1C5, 0xCA06, 0xC9E6, 0xC9C6, 0x8004, 0xD1E7, 0x0003, 0xC9C7, 0xD1E7, 0xD1E6, 0x8003, 0xC9E6,
+0x8003, 0xC9E7, 0x0001, 0xCA07, 0x8006, 0xC9E7, 0x0002, 0xC9E6, 0xC9E6, 0x8004, 0xC9E7, 0x8003, 0xC9C6, 0x003F, 0xC9E6, 0xC9C6,
+0xD207, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9C6, 0xC1A6, 0xC9C7, 0xC9C6, 0xC1E7, 0xB1E7, 0xAA68, 0x9AA9, 0x82CA, 0x7B6C, 0x7B8D, 0x73AD,
+0x7BCE, 0x7BCE, 0x8C30, 0x9491, 0xA534, 0xBDF7, 0xCE38, 0xDEBA, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xE71B, 0xE71C, 0xE73C,
+0xE6FB, 0xE71B, 0xDEDB, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xDEFB, 0xE71C, 0xE73C, 0xDEFB,
+0xE71B, 0xE6FB, 0xDEDB, 0xE71B, 0xDEFB, 0xDEDB, 0xE6FB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEDB, 0x8004, 0xDEFB, 0x0002,
+0xE6FB, 0xE6FB, 0x8003, 0xDEFB, 0x0002, 0xDEDB, 0xE6FB, 0x8007, 0xDEFB, 0x0001, 0xE6FB, 0x8004, 0xDEFB, 0x0003, 0xDEDB, 0xDEDA,
+0xDEDA, 0x8006, 0xDEFB, 0x0003, 0xE6FB, 0xE71B, 0xE71B, 0x8003, 0xE6FB, 0x8005, 0xFFFF, 0x0005, 0xFFDE, 0xFFBE, 0xFFBE, 0xFFFF,
+0xFFFF, 0x8003, 0xFFDF, 0x0006, 0xFFDE, 0xF7BE, 0xF79D, 0xF79D, 0xF7BE, 0xFFBE, 0x8004, 0xFFDF, 0x0004, 0xFFFF, 0xF7BE, 0xFFBE,
+0xFFDF, 0x8007, 0xFFFF, 0x8003, 0xFFDF, 0x8024, 0xFFFF, 0x0016, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFF9D, 0xFF1C, 0x9A4A, 0xB208,
+0xC1E8, 0xC1C7, 0xCA27, 0xCA07, 0xCA06, 0xCA06, 0xC9E6, 0xC9E6, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1C7, 0xD1E7, 0xD1E7, 0x8005, 0xC9E6,
+0x0002, 0xC9E7, 0xC9E6, 0x8005, 0xC9E7, 0x0001, 0xC9E6, 0x8003, 0xC9E7, 0x0005, 0xC9E6, 0xC9E7, 0xC1E7, 0xC9E7, 0xC9E6, 0x8003,
+0xC9C6, 0x002F, 0xC9E6, 0xC9C6, 0xC9E6, 0xC9E6, 0xC1C6, 0xC9E7, 0xCA07, 0xC9E7, 0xCA07, 0xC207, 0xBA07, 0xB248, 0xA2AA, 0x930B,
+0x834C, 0x7BAD, 0x73CE, 0x7C0F, 0x7BEF, 0x840F, 0x8C50, 0xAD34, 0xBDD6, 0xCE38, 0xDEDA, 0xE6FB, 0xE73C, 0xE6FB, 0xDEFB, 0xDEFB,
+0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xE71C, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE73C, 0xE71C, 0xE6FB,
+0xDEDA, 0x8004, 0xE71C, 0x000E, 0xDEFB, 0xDEDA, 0xE71B, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xE6FB, 0xE71C, 0xE73C, 0xE71C, 0xE6FB,
+0xDEDB, 0xDEDA, 0x8008, 0xDEFB, 0x0002, 0xE71B, 0xE71B, 0x8004, 0xDEFB, 0x8005, 0xDEDB, 0x0001, 0xDEFB, 0x8004, 0xE71B, 0x8008,
+0xDEFB, 0x0006, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xFFDE, 0xFFDF, 0x8003, 0xFFFF, 0x0006, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE,
+0xFFDE, 0x8003, 0xFFFF, 0x0003, 0xFFDF, 0xF7BE, 0xF7BE, 0x8004, 0xFFDE, 0x8003, 0xF7BE, 0x800C, 0xFFFF, 0x8004, 0xFFDF, 0x8022,
+0xFFFF, 0x0016, 0xF7DE, 0xFFFE, 0xFFFE, 0xFFDE, 0xFF9D, 0xFF3C, 0xA28A, 0xB269, 0xC248, 0xC1E7, 0xC9A6, 0xD1E6, 0xD206, 0xC9E6,
+0xCA06, 0xCA07, 0xD207, 0xD1C7, 0xD1C7, 0xD207, 0xCA07, 0xC206, 0x8003, 0xC9E6, 0x0003, 0xCA06, 0xC9E7, 0xC9E6, 0x8007, 0xC9E7,
+0x0004, 0xC9E6, 0xD1E6, 0xC9E6, 0xCA06, 0x8003, 0xC9E6, 0x8003, 0xC9C6, 0x0023, 0xD1C6, 0xC9E7, 0xCA07, 0xC9E7, 0xC1E6, 0xC207,
+0xC207, 0xC1E6, 0xBA07, 0xB227, 0xA228, 0xA2A9, 0x92EB, 0x8B2C, 0x838D, 0x7BCE, 0x7BCF, 0x7BCE, 0x83EF, 0x8C50, 0x9450, 0xB555,
+0xD679, 0xDE9A, 0xDEBA, 0xE73C, 0xE71C, 0xE71B, 0xDEFB, 0xE6FB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0x8004, 0xE71C, 0x000A,
+0xDEFB, 0xDEFB, 0xE71C, 0xDEDB, 0xE71B, 0xE6FB, 0xE71B, 0xE6FB, 0xE71C, 0xDEDA, 0x8004, 0xDEFB, 0x0007, 0xE71C, 0xDEFB, 0xDEDB,
+0xDEDB, 0xDEFB, 0xDEDB, 0xDEDB, 0x8003, 0xDEFB, 0x0003, 0xE6FB, 0xE71B, 0xE6FB, 0x8004, 0xE71B, 0x0003, 0xE71C, 0xE73C, 0xE73C,
+0x8003, 0xDEFB, 0x0002, 0xE71B, 0xE71C, 0x8003, 0xE73C, 0x8004, 0xDEDB, 0x8005, 0xDEFB, 0x8003, 0xDEDB, 0x8004, 0xDEDA, 0x8004,
+0xDEFB, 0x0005, 0xF79D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDE, 0x8003, 0xF7BE, 0x0008, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE,
+0xFFBE, 0xF7BE, 0x8003, 0xFFDF, 0x8004, 0xFFFF, 0x0005, 0xFFDF, 0xFFBE, 0xFFBE, 0xFFDE, 0xFFDE, 0x8003, 0xFFDF, 0x0001, 0xFFDE,
+0x8005, 0xFFFF, 0x0003, 0xFFDF, 0xFFDE, 0xFFDE, 0x8026, 0xFFFF, 0x0012, 0xFFFE, 0xFF9D, 0xFF1B, 0x9AAA, 0xAA49, 0xC208, 0xC9E7,
+0xDA07, 0xC9C6, 0xD206, 0xCA06, 0xCA06, 0xD1E7, 0xD1C7, 0xD1C7, 0xD1E7, 0xCA07, 0xC206, 0x8003, 0xC9E6, 0x0002, 0xCA06, 0xC9E7,
+0x8003, 0xC9E6, 0x8006, 0xC9E7, 0x8004, 0xC9E6, 0x0004, 0xC9C6, 0xC9E6, 0xC9C6, 0xC9E7, 0x8003, 0xC9C7, 0x002F, 0xC9E7, 0xC1E7,
+0xC1E7, 0xC207, 0xC207, 0xB9E6, 0xB227, 0xA268, 0x9AA9, 0x9B2B, 0x936C, 0x836D, 0x83CE, 0x840F, 0x8430, 0x7BEF, 0x8C50, 0x9451,
+0xBD96, 0xCDF7, 0xDE9A, 0xE6FB, 0xE6FB, 0xE71B, 0xDEFB, 0xE71C, 0xE6FB, 0xE71B, 0xDEDB, 0xE6FB, 0xE6FB, 0xE71C, 0xE6FB, 0xE71C,
+0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xDEFB, 0xE73C, 0xE71B, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0x8003, 0xE71B, 0x000A,
+0xE6FB, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0x8003, 0xDEDB, 0x0001, 0xDEFB, 0x8003, 0xE6FB,
+0x0004, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0x800D, 0xDEFB, 0x8003, 0xDEDB, 0x0002, 0xE6FB, 0xE6FB, 0x8004, 0xDEFB, 0x0002, 0xE6FB,
+0xE71B, 0x8004, 0xDEFB, 0x0009, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFBE, 0x8003, 0xFFDE, 0x0002,
+0xFFBE, 0xFFDE, 0x8003, 0xFFFF, 0x0007, 0xFFDF, 0xF7BE, 0xF79E, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0x8004, 0xFFDF, 0x8004, 0xFFFF,
+0x0001, 0xFFDF, 0x8027, 0xFFFF, 0x001D, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xF7FE, 0xFFFF, 0xF7FE, 0xFFFE, 0xFFFE, 0xFF3B, 0xA2CA,
+0xA9E8, 0xC1E8, 0xC9E7, 0xC1C6, 0xC206, 0xC206, 0xCA06, 0xC9E6, 0xD1E6, 0xD1E6, 0xC9E6, 0xC9E6, 0xC207, 0xC9E6, 0xC9E7, 0xC9E6,
+0xC9E7, 0xC9E7, 0x8005, 0xC9E6, 0x8006, 0xC9E7, 0x0026, 0xD1C6, 0xD1C6, 0xC9C6, 0xC9E6, 0xC1E6, 0xC9E7, 0xC9C6, 0xC9C6, 0xC9C7,
+0xC9C7, 0xC1C7, 0xC1E7, 0xBA07, 0xB207, 0xB207, 0xAA68, 0xA30A, 0x934C, 0x8B8D, 0x8BCE, 0x83CF, 0x83EF, 0x8C30, 0x8C31, 0x8C71,
+0x840F, 0xB595, 0xCDF7, 0xE6BA, 0xE6BA, 0xDEDB, 0xEF3C, 0xE73C, 0xDEFB, 0xEF5C, 0xE71C, 0xEF3C, 0xE71B, 0x8003, 0xE73C, 0x0003,
+0xE6FB, 0xE71B, 0xDEDB, 0x8004, 0xE71B, 0x0002, 0xDEFB, 0xE6FB, 0x8003, 0xDEFB, 0x0009, 0xE71B, 0xDEDA, 0xDEFB, 0xE71B, 0xE71B,
+0xE71C, 0xE71B, 0xE73C, 0xE6FB, 0x8007, 0xDEFB, 0x0004, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDA, 0x8003, 0xDEDB, 0x8005, 0xDEFB, 0x0002,
+0xE6FB, 0xE6FB, 0x8005, 0xDEFB, 0x0001, 0xD6BA, 0x8005, 0xDEDA, 0x8003, 0xDEDB, 0x8005, 0xDEDA, 0x0006, 0xDEDB, 0xDEDB, 0xDEFB,
+0xDEFB, 0xDEDB, 0xDEDB, 0x8003, 0xF7BE, 0x0001, 0xFFBE, 0x8004, 0xF7BE, 0x0007, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF79D, 0xF79E,
+0xF7BE, 0x8004, 0xFFDF, 0x8003, 0xFFFF, 0x0008, 0xFFDE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0x8030, 0xFFFF,
+0x0012, 0xF7FF, 0xF7FF, 0xFFFE, 0xFFBD, 0xFF3C, 0xA2AA, 0xB249, 0xC208, 0xC1E7, 0xCA27, 0xC206, 0xCA06, 0xC9E6, 0xD1E7, 0xD1E6,
+0xC9E6, 0xCA06, 0xCA06, 0x8004, 0xC9E7, 0x8007, 0xC9E6, 0x8005, 0xC9E7, 0x002C, 0xD1C6, 0xD1E6, 0xC9C6, 0xC9E6, 0xC1E6, 0xCA06,
+0xC1E6, 0xC9E7, 0xD1E7, 0xC9E7, 0xC1C7, 0xC1E7, 0xB207, 0xAA28, 0xAA68, 0xA2EA, 0x9B8D, 0x8BCD, 0x83CE, 0x83EF, 0x840F, 0x840F,
+0x8C30, 0x8C31, 0x8C50, 0xAD75, 0xBDD6, 0xD658, 0xDE9A, 0xE6FB, 0xE6FB, 0xE71B, 0xE71C, 0xDEDB, 0xE71B, 0xDEDB, 0xE71B, 0xDEFB,
+0xE6FB, 0xE71C, 0xE71C, 0xDEFB, 0xE6FB, 0xDEDB, 0x8004, 0xE71B, 0x0018, 0xE71C, 0xE73C, 0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xDEFB,
+0xE71B, 0xDEFB, 0xDEFB, 0xE71B, 0xE6FB, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xE73C, 0xEF5C, 0xEF5C, 0xE71C, 0xE6FB,
+0xDEFB, 0x8004, 0xE6FB, 0x8003, 0xE71B, 0x0006, 0xE6FB, 0xEF5C, 0xEF5C, 0xEF3C, 0xE73C, 0xE71B, 0x8005, 0xDEFB, 0x0003, 0xE6FB,
+0xDEFB, 0xDEFB, 0x8003, 0xE6FB, 0x0003, 0xE71B, 0xE6FB, 0xE6FB, 0x8004, 0xDEFB, 0x0001, 0xE6FB, 0x8004, 0xE71B, 0x0008, 0xFFBE,
+0xFFDE, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDE, 0xFFBE, 0xFFBE, 0x8005, 0xFFDF, 0x8005, 0xFFFF, 0x0003, 0xFFDF, 0xFFDE, 0xFFDF, 0x8003,
+0xFFFF, 0x0003, 0xFFDE, 0xFFDF, 0xFFDF, 0x802E, 0xFFFF, 0x0017, 0xFFDE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF,
+0xFFDF, 0xFF7D, 0xFF1B, 0xA2AA, 0xAA28, 0xC229, 0xC1E7, 0xC9C7, 0xD1E7, 0xD1C7, 0xD1E7, 0xD1E6, 0xC9E6, 0xCA06, 0xC9E6, 0x8006,
+0xC9E7, 0x8005, 0xC9E6, 0x8006, 0xC9E7, 0x003A, 0xD1E7, 0xC9C6, 0xD1E6, 0xC9C6, 0xCA06, 0xC9E6, 0xC9E6, 0xC9E7, 0xC9C7, 0xC1E7,
+0xBA08, 0xAA29, 0xA2AA, 0xA32B, 0x9BAD, 0x93EE, 0x8C0F, 0x840F, 0x840F, 0x8C30, 0x8C31, 0x8C51, 0x9CB2, 0xA534, 0xC638, 0xCE58,
+0xDEDA, 0xEF3C, 0xE6FB, 0xE71B, 0xE73C, 0xE73C, 0xE71B, 0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0xDEFB, 0xE73C, 0xE71B, 0xE71B, 0xE6FB,
+0xE71B, 0xDEFB, 0xE71C, 0xDEFB, 0xE71B, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEFB, 0xD6BA, 0xDEDB, 0xE6FB, 0xE71C, 0xDEFB, 0xE6FB,
+0x8003, 0xDEFB, 0x0006, 0xE71B, 0xE71C, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0x8003, 0xDEDB, 0x0001, 0xDEFB, 0x8005, 0xDEDB, 0x000B,
+0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0x8005, 0xDEFB, 0x0005, 0xE71B, 0xE6FB,
+0xDEFB, 0xE71B, 0xE71B, 0x8005, 0xE71C, 0x0001, 0xE71B, 0x8003, 0xE71C, 0x000A, 0xE73C, 0xF79D, 0xF79E, 0xFFDE, 0xFFDF, 0xFFDE,
+0xF7BE, 0xF79E, 0xF79E, 0xFFFF, 0x8005, 0xFFDF, 0x0001, 0xFFBE, 0x8003, 0xF7BE, 0x0002, 0xFFBE, 0xFFBE, 0x8004, 0xFFDE, 0x8003,
+0xFFDF, 0x0003, 0xFFDE, 0xFFDE, 0xFFDF, 0x800A, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x8021, 0xFFFF, 0x8003, 0xFFDF, 0x0015, 0xFFFF,
+0xFFFF, 0xFFDF, 0xFFDF, 0xFFDE, 0xFF7D, 0xFEFB, 0x9ACA, 0xAA69, 0xB208, 0xB9E7, 0xC9E8, 0xC9C7, 0xC9C7, 0xD1C6, 0xD1E6, 0xD207,
+0xC9C6, 0xC9E6, 0xC9C6, 0xC9E7, 0x8003, 0xD1E7, 0x0002, 0xC9E7, 0xCA07, 0x8005, 0xC9E7, 0x0001, 0xC9E6, 0x8003, 0xC9E7, 0x001E,
+0xCA07, 0xC9E6, 0xCA07, 0xC1C6, 0xC9E6, 0xC1E6, 0xC1E6, 0xC207, 0xC208, 0xBA28, 0xAA49, 0x9A89, 0x9B0C, 0x93AD, 0x8BEE, 0x8C0F,
+0x840F, 0x8C50, 0x840F, 0x8C30, 0x8C71, 0x9471, 0xAD55, 0xBDF7, 0xCE78, 0xD6BA, 0xE73C, 0xEF7D, 0xE6FB, 0xE71C, 0x8003, 0xE73C,
+0x001D, 0xEF5D, 0xE71B, 0xE73C, 0xE71C, 0xDEFB, 0xE73C, 0xE71C, 0xE73C, 0xE71C, 0xEF5C, 0xDEFB, 0xEF3C, 0xDEFB, 0xE71C, 0xE71C,
+0xDEFB, 0xE6FB, 0xDEDB, 0xE71C, 0xD6BA, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xE71B, 0x8003, 0xE6FB,
+0x0003, 0xDEFB, 0xDEFB, 0xDEDB, 0x8003, 0xDEFB, 0x8004, 0xE6FB, 0x0004, 0xE71B, 0xE71C, 0xE73C, 0xE73C, 0x8004, 0xE71B, 0x0001,
+0xE6FB, 0x8003, 0xDEFB, 0x0016, 0xDEDA, 0xDEBA, 0xDEBA, 0xDEDB, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xDEDA, 0xDEDB, 0xDEFB, 0xE6FB,
+0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xDEFB, 0xF79E, 0xF7BE, 0x8003, 0xFFBE, 0x8007, 0xF7BE, 0x0002, 0xF79E,
+0xF79D, 0x8003, 0xF77D, 0x0004, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFDF, 0x8003, 0xFFDE, 0x0003, 0xF79E, 0xF7BE, 0xFFDF, 0x8009, 0xFFFF,
+0x0007, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0x8021, 0xFFFF, 0x0002, 0xFFDF, 0xFFDF, 0x8005, 0xFFFF, 0x0019,
+0xFFDE, 0xFFBD, 0xFF5C, 0xFEB9, 0x9ACA, 0xA269, 0xBA49, 0xC208, 0xC1E7, 0xCA07, 0xC9E7, 0xC9C6, 0xC9E6, 0xC1A5, 0xD227, 0xC9C6,
+0xC9C6, 0xC9E7, 0xC9E7, 0xC1A6, 0xC9E7, 0xC9E7, 0xC9C7, 0xC1C6, 0xC9E6, 0x8003, 0xC1E6, 0x0031, 0xC206, 0xC1E6, 0xC1E7, 0xC207,
+0xB9E6, 0xC207, 0xC207, 0xC227, 0xC227, 0xBA28, 0xAA28, 0x9A69, 0xAB8D, 0x9BAE, 0x9BEF, 0x940F, 0x8C0F, 0x840F, 0x8C50, 0x8C51,
+0x8C50, 0x9471, 0xA513, 0xAD75, 0xC617, 0xCE58, 0xDEFA, 0xDEFB, 0xDF1B, 0xE71C, 0xE71B, 0xE71C, 0xDEFB, 0xE71B, 0xE73C, 0xDEFB,
+0xE71B, 0xEF5C, 0xE6FB, 0xE71C, 0xDEFB, 0xE71C, 0xDEFB, 0xE6FB, 0xEF5C, 0xE71B, 0xE73C, 0xE71C, 0xDEFB, 0x8003, 0xE71B, 0x000E,
+0xDEDB, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE73C, 0xDEFB, 0xE73C, 0xE71C, 0xDEFB, 0xE71B, 0x8004, 0xDEFB,
+0x0001, 0xE6FB, 0x8004, 0xDEFB, 0x0006, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0x8004, 0xDEFB, 0x8003, 0xE6FB, 0x0008,
+0xE71B, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0x800A, 0xDEFB, 0x8003, 0xDEDB, 0x8007, 0xF79E, 0x0003, 0xF79D,
+0xFFDF, 0xFFDF, 0x8003, 0xFFDE, 0x0001, 0xFFDF, 0x8004, 0xFFFF, 0x0003, 0xFFBE, 0xF7BE, 0xFFDE, 0x8005, 0xFFFF, 0x0001, 0xFFDF,
+0x8004, 0xFFDE, 0x0004, 0xFFDF, 0xFFDE, 0xFFDE, 0xFFDF, 0x8029, 0xFFFF, 0x0006, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7DE,
+0x8003, 0xFFFF, 0x003F, 0xFFDE, 0xFF9D, 0xFF3B, 0xFEBA, 0xA2AA, 0xB269, 0xBA49, 0xB9E7, 0xC1C7, 0xD228, 0xC9E6, 0xD207, 0xC1A5,
+0xD207, 0xC9E6, 0xCA07, 0xC9E7, 0xD207, 0xC9C7, 0xC9E7, 0xC9E7, 0xC1E6, 0xC1E6, 0xC206, 0xC206, 0xC226, 0xC206, 0xC207, 0xC1E7,
+0xBA07, 0xC228, 0xBA27, 0xBA28, 0xB228, 0xAA28, 0xA269, 0xBBCE, 0xB42F, 0x9BEE, 0x942F, 0x9450, 0x9471, 0x8C50, 0x9491, 0x94B1,
+0x8C50, 0x9CB2, 0xB575, 0xBDF7, 0xC638, 0xCE78, 0xE73C, 0xE71B, 0xDF1B, 0xE73C, 0xE73C, 0xDEFB, 0xE71C, 0xEF5D, 0xE6FB, 0xE71C,
+0xE71B, 0xE73C, 0x8003, 0xE71B, 0x0001, 0xE73C, 0x8003, 0xE71C, 0x0017, 0xDEFB, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEDA, 0xE6FB,
+0xDEFB, 0xE6FB, 0xEF5C, 0xE6FB, 0xDEDA, 0xDEFB, 0xE71C, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xE73C, 0xE73C, 0xE71C, 0xE71C,
+0x8003, 0xE71B, 0x0005, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xDEFB, 0x8003, 0xDEDA, 0x0002, 0xDEDB, 0xDEFB, 0x8009, 0xDEDB, 0x0002,
+0xE71B, 0xE6FB, 0x8004, 0xDEFB, 0x0003, 0xDEDB, 0xDEDA, 0xDEFB, 0x8004, 0xDEDB, 0x000C, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xE6FB,
+0xE71C, 0xE73C, 0xFFBE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0x8003, 0xF7BE, 0x0002, 0xFFBE, 0xFFBE, 0x8007, 0xF7BE, 0x0002, 0xFFBE,
+0xFFDE, 0x8003, 0xFFDF, 0x0006, 0xFFFF, 0xFFFF, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0x8007, 0xFFDF, 0x8006, 0xFFFF, 0x8005, 0xFFDF,
+0x8025, 0xFFFF, 0x005E, 0xFFDE, 0xFFDE, 0xFFFF, 0xFF9D, 0xFF9D, 0xFF5C, 0xFEFB, 0x8A89, 0xA2AA, 0xB269, 0xBA28, 0xC1E8, 0xCA08,
+0xC1E7, 0xCA07, 0xC1E6, 0xCA07, 0xC9E6, 0xC1C5, 0xC9E6, 0xC1E6, 0xC9E6, 0xCA06, 0xCA07, 0xC1E6, 0xC1E6, 0xC207, 0xC207, 0xB9C6,
+0xC1E7, 0xC1E8, 0xB9E7, 0xBA28, 0xA9E7, 0xAA49, 0x9A48, 0x9269, 0xB3CE, 0xAC2F, 0x9C0F, 0x9C30, 0x9C71, 0x8C30, 0x8C50, 0x9471,
+0x8C70, 0x9491, 0x9CB2, 0xAD54, 0xB595, 0xC617, 0xD6BA, 0xDF1B, 0xEF5C, 0xDEFB, 0xE6FB, 0xE71B, 0xE71C, 0xE71C, 0xEF1C, 0xE6FC,
+0xE71C, 0xDEFB, 0xE71B, 0xE71C, 0xE71C, 0xEF5C, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xDEDB, 0xE71B, 0xDEFB, 0xE73C, 0xDEFB, 0xE71B,
+0xE71C, 0xE71B, 0xDEFB, 0xE6FB, 0xDEDB, 0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71B, 0xE71B,
+0xE6FB, 0x8003, 0xE71B, 0x000C, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEBA, 0xDEFB, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB,
+0x8008, 0xDEFB, 0x000A, 0xD6BA, 0xDEDA, 0xDEFB, 0xDEDB, 0xDEBA, 0xDEBA, 0xDEDB, 0xE6FB, 0xDEDB, 0xDEDB, 0x8003, 0xDEFB, 0x8003,
+0xDEDB, 0x0006, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDB, 0xFFDE, 0xF7BE, 0x8003, 0xF79E, 0x0006, 0xF7BE, 0xF7BE, 0xF79E, 0xFFBE, 0xFFDE,
+0xFFDE, 0x8003, 0xFFDF, 0x0003, 0xFFDE, 0xFFDE, 0xFFDF, 0x8003, 0xFFDE, 0x0004, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0x8006, 0xFFDF,
+0x8004, 0xFFFF, 0x8003, 0xFFDF, 0x0003, 0xFFDE, 0xFFDE, 0xFFBE, 0x802C, 0xFFFF, 0x004E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFFDE,
+0xFF7D, 0xFF5C, 0xFEDA, 0xFDD6, 0xA28A, 0xAA29, 0xBA69, 0xB228, 0xB228, 0xB227, 0xC248, 0xB9E6, 0xCA47, 0xC1E6, 0xC206, 0xC206,
+0xC1C6, 0xC1E6, 0xC207, 0xC207, 0xB9E7, 0xBA08, 0xBA28, 0xBA28, 0xBA49, 0xAA08, 0xAA69, 0xB2CB, 0xC3EF, 0xBC30, 0xB450, 0xAC71,
+0x9C50, 0x9C50, 0x9C91, 0x8C30, 0x9491, 0x9492, 0x8C71, 0xA554, 0xAD74, 0xB595, 0xC5F7, 0xD699, 0xDEFB, 0xDEFA, 0xE73B, 0xDEFB,
+0xE71B, 0xEF5D, 0xE71C, 0xDEFB, 0xE71C, 0xEF1C, 0xEEFC, 0xEF5D, 0xE6FB, 0xE73C, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE73C, 0xE71B,
+0xE6FB, 0xE73C, 0xE73C, 0xDEFB, 0xE6FB, 0xE73C, 0xE71C, 0xDEFB, 0xEF3C, 0x8003, 0xDEFB, 0x000B, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB,
+0xDEFB, 0xE71C, 0xDEDB, 0xE71C, 0xDEBA, 0xDEDA, 0xDEBA, 0x8006, 0xDEFB, 0x000A, 0xE71B, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0xE6FB,
+0xE71B, 0xE6FB, 0xDEFB, 0xDEDA, 0x8003, 0xDEDB, 0x8003, 0xDEFB, 0x0006, 0xE6FB, 0xE6FB, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0x8004,
+0xDEDB, 0x8003, 0xE6FB, 0x8003, 0xDEFB, 0x000E, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xE6FB, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D,
+0xF79D, 0xF79E, 0xF79E, 0xF79D, 0x8004, 0xF79E, 0x0009, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0xF79D, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFDF,
+0x8003, 0xF7BE, 0x0009, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0x8007, 0xFFDF, 0x0004, 0xF79D,
+0xF79D, 0xF7BE, 0xFFDE, 0x8027, 0xFFFF, 0x006D, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDE, 0xFFFF, 0xFF9D, 0xFFDE, 0xFF9D, 0xFF5C, 0xFF3B,
+0xFEFA, 0xFE99, 0xFE79, 0xFE79, 0x9269, 0xA2AA, 0xA268, 0xB248, 0xBA28, 0xB9C6, 0xCA28, 0xC207, 0xCA07, 0xC228, 0xBA08, 0xB208,
+0xB249, 0xB24A, 0xA249, 0xBBAE, 0xC470, 0xC491, 0xBC70, 0xB470, 0xB491, 0xAC91, 0xA4B2, 0x9C51, 0xA4D2, 0x9C92, 0x9C92, 0xA4F3,
+0xA4F3, 0x9CB2, 0xBDF7, 0xBDF7, 0xC637, 0xD6BA, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xDEFB, 0xEF5C, 0xE71C, 0xE6FB, 0xE6FB, 0xEF3C,
+0xEF5C, 0xE6FB, 0xE71C, 0xF77D, 0xE71B, 0xDEFB, 0xDEDB, 0xE71B, 0xE73C, 0xE73C, 0xDEFB, 0xE71C, 0xDEFB, 0xE71B, 0xE71C, 0xE6FB,
+0xE71C, 0xE71C, 0xDEDA, 0xE73C, 0xEF5C, 0xDEDB, 0xE71B, 0xE6FB, 0xE71C, 0xE71B, 0xEF5C, 0xE71C, 0xE71C, 0xD6BA, 0xDEDB, 0xDEDA,
+0xE71B, 0xD6BA, 0xD6BA, 0xD69A, 0xD6BA, 0xDEFB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xE73C, 0xE71B,
+0xDEDB, 0xDEDA, 0xDEDA, 0x8003, 0xDEFB, 0x0002, 0xDEDB, 0xDEDB, 0x8003, 0xDEDA, 0x000B, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xDEFB,
+0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xE6FB, 0x8003, 0xDEFB, 0x0006, 0xE71B, 0xE71B, 0xEF3C, 0xE73C, 0xE71C, 0xDEFB, 0x8003,
+0xF7BE, 0x0007, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xF79D, 0x8005, 0xF79E, 0x0009, 0xF79D, 0xF7BE, 0xF79E, 0xF79D,
+0xF79D, 0xF7BE, 0xFFDE, 0xFFDE, 0xF7BE, 0x8003, 0xF79E, 0x8003, 0xF7BE, 0x0002, 0xFFBE, 0xFFDE, 0x8003, 0xFFDF, 0x8006, 0xFFFF,
+0x0002, 0xFFDF, 0xFFDF, 0x8028, 0xFFFF, 0x0001, 0xFFDF, 0x8004, 0xFFFF, 0x0078, 0xFFDF, 0xFFDE, 0xF79D, 0xFF9D, 0xF77C, 0xF75C,
+0xF73B, 0xEEDA, 0xF679, 0xF658, 0xFE38, 0xED54, 0xA2CA, 0xA269, 0xB269, 0xAA28, 0xB228, 0xB249, 0xAA49, 0xA208, 0xAA8A, 0xC3AE,
+0xD431, 0xC451, 0xBCB2, 0xB4F2, 0xACD2, 0xACB1, 0xACD2, 0xA4D2, 0x9CB2, 0x9CD2, 0xA4F3, 0x9CB2, 0xA4D3, 0x9CD3, 0xA4D3, 0xAD34,
+0xAD54, 0xBDF7, 0xBDD6, 0xD679, 0xD69A, 0xE71B, 0xE73C, 0xE73C, 0xEF5C, 0xE71B, 0xE71C, 0xEF3C, 0xEF3C, 0xE71C, 0xE71C, 0xE6FB,
+0xDEFB, 0xEF5C, 0xDEFB, 0xE73C, 0xE71C, 0xEF5C, 0xE71B, 0xE6FB, 0xE6FB, 0xDEFB, 0xDEDB, 0xE73C, 0xE71C, 0xE73C, 0xDEFB, 0xE71B,
+0xDEFB, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xE71C, 0xDEDA, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xE71B, 0xE71B, 0xDEDB, 0xDEDB, 0xDEDA,
+0xDEFB, 0xE73C, 0xE73C, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xDEFB, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71C,
+0xE71C, 0xE71B, 0xDEDA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71B, 0xE71B, 0xE71C, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xDEDB, 0xDEDA,
+0xDEDB, 0xDEFB, 0x8008, 0xDEDB, 0x0006, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xF7BE, 0xF7BE, 0x8004, 0xF79E, 0x001A, 0xF7BE, 0xF79E,
+0xF79D, 0xF79D, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFBE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDE, 0xFFBE, 0xF7BE, 0xF7BE,
+0xFFDF, 0xFFDE, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE, 0xFFDE, 0xFFFF, 0x8007, 0xFFDF, 0x0001, 0xFFDE, 0x802A, 0xFFFF, 0x0004, 0xFFDF,
+0xFFFF, 0xFFFF, 0xFFDF, 0x8005, 0xFFFF, 0x0017, 0xFFDE, 0xFF9E, 0xF75D, 0xF73D, 0xFF5D, 0xEEDA, 0xEEBA, 0xF6BA, 0xEE79, 0xF679,
+0xEE18, 0xE5B6, 0xE596, 0xEDB6, 0xDD75, 0xD534, 0xD534, 0xCD33, 0xC513, 0xBD13, 0xBD13, 0xACF3, 0xA4D3, 0x8004, 0xA4F3, 0x0013,
+0xA513, 0xAD34, 0xAD34, 0xA513, 0xB595, 0xBDF6, 0xBDF7, 0xC638, 0xD69A, 0xDEBA, 0xE6FB, 0xEF3C, 0xE73C, 0xEF5D, 0xE71B, 0xE6FB,
+0xEF5D, 0xE6FB, 0xE6FB, 0x8004, 0xE73C, 0x0021, 0xE73B, 0xE73B, 0xE71B, 0xE71B, 0xE73C, 0xE71B, 0xE71C, 0xE6FB, 0xE71B, 0xE71B,
+0xE6FB, 0xE71B, 0xE71C, 0xE71B, 0xDEFB, 0xE73C, 0xE71C, 0xE71C, 0xE6FB, 0xDEFB, 0xEF5C, 0xDEFB, 0xDEDA, 0xDEFB, 0xE71C, 0xE6FB,
+0xE71C, 0xE6FB, 0xE71C, 0xE6FB, 0xE71B, 0xDEFB, 0xE71B, 0x8003, 0xDEFB, 0x0001, 0xDEDB, 0x8003, 0xDEDA, 0x0004, 0xDEDB, 0xDEDB,
+0xDEFB, 0xDEDB, 0x8003, 0xDEFB, 0x8004, 0xDEDB, 0x8003, 0xEF7D, 0x0002, 0xEF5D, 0xEF5D, 0x8003, 0xEF5C, 0x000A, 0xDEFB, 0xDEDA,
+0xD6BA, 0xDEDA, 0xE71B, 0xE73C, 0xE71B, 0xDEFB, 0xDEFB, 0xE6FB, 0x8004, 0xE71B, 0x8006, 0xDEFB, 0x8003, 0xF79E, 0x0007, 0xF79D,
+0xF79D, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDE, 0xFFDE, 0x8004, 0xFFBE, 0x8004, 0xF7BE, 0x8003, 0xFFBE, 0x0001, 0xFFDE, 0x8005, 0xFFDF,
+0x0002, 0xFFDE, 0xFFBE, 0x8004, 0xF7BE, 0x0006, 0xFFBE, 0xFFBE, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFBE, 0x8003, 0xF7BE, 0x0003, 0xFFDE,
+0xFFDF, 0xFFDF, 0x802D, 0xFFFF, 0x000E, 0xFFDE, 0xFFDE, 0xFFBE, 0xFF9E, 0xFF9E, 0xF77D, 0xFF7D, 0xF73B, 0xF71C, 0xEF1B, 0xE69A,
+0xE679, 0xE679, 0xDE38, 0x8003, 0xD617, 0x0014, 0xCDF7, 0xC5D6, 0xBDB5, 0xBDB5, 0xB595, 0xB595, 0xAD55, 0xAD75, 0xB596, 0xAD55,
+0xB595, 0xBDB6, 0xB595, 0xB596, 0xC617, 0xBE17, 0xCE58, 0xCE79, 0xDEDA, 0xE6FB, 0x8003, 0xEF3C, 0x0005, 0xE71C, 0xE73C, 0xE71C,
+0xEF5D, 0xEF5D, 0x8004, 0xE71C, 0x0015, 0xEF5C, 0xE71C, 0xDF1B, 0xE73B, 0xDEFB, 0xE71C, 0xE73C, 0xEF3C, 0xE71B, 0xE71C, 0xE6FB,
+0xE6FB, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71C, 0xDEDA, 0xE71C, 0xE71C, 0xDEFB, 0x8003, 0xDEDB, 0x000C, 0xE71B, 0xE6FB, 0xE71B,
+0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xE6FB, 0xE71B, 0x8003, 0xDEFB, 0x0001, 0xE6FB, 0x8003, 0xE71B, 0x0004,
+0xE6FB, 0xDEFB, 0xE71B, 0xE6FB, 0x8004, 0xDEFB, 0x0005, 0xDEDB, 0xDEDA, 0xDEDA, 0xDEDB, 0xDEDB, 0x8003, 0xDEFB, 0x0005, 0xE6FB,
+0xE71B, 0xDEDA, 0xDEDB, 0xDEDB, 0x8003, 0xDEFB, 0x0004, 0xDEDB, 0xDEDB, 0xDEDA, 0xDEDA, 0x8003, 0xD6BA, 0x0002, 0xDEBA, 0xDEDA,
+0x8005, 0xDEDB, 0x0008, 0xF77D, 0xF79D, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xF79D, 0xF79E, 0x8003, 0xF77D, 0x0001, 0xF79E, 0x8003,
+0xF7BE, 0x000A, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFBE, 0x8003, 0xF7BE, 0x0003, 0xFFBE,
+0xFFDE, 0xFFBE, 0x8003, 0xF7BE, 0x0004, 0xF79E, 0xF79E, 0xF7BE, 0xFFDF, 0x8007, 0xFFFF, 0x0001, 0xFFDE, 0x802B, 0xFFFF, 0x0004,
+0xFFDF, 0xFFDE, 0xFFDE, 0xFFBE, 0x8003, 0xF7BE, 0x000D, 0xF79D, 0xEF5C, 0xEF3C, 0xEF5C, 0xEF3C, 0xEF1B, 0xE6DA, 0xDEBA, 0xDE99,
+0xD679, 0xCE38, 0xC617, 0xC5F7, 0x8003, 0xC617, 0x0004, 0xC618, 0xBDD7, 0xBDB6, 0xBDD7, 0x8003, 0xC5F7, 0x0011, 0xC617, 0xCE58,
+0xD679, 0xD699, 0xDEDA, 0xDEFB, 0xDEFB, 0xE73C, 0xEF3C, 0xEF3C, 0xEF5C, 0xEF5C, 0xEF7D, 0xEF5C, 0xE73C, 0xEF5D, 0xEF5C, 0x8004,
+0xE73C, 0x002E, 0xDEFB, 0xE71C, 0xE73C, 0xE71B, 0xE73C, 0xE71B, 0xE71B, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xE71B, 0xE73C, 0xE71B,
+0xE73C, 0xDEFB, 0xDEFB, 0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0xDEDB, 0xDEFB, 0xE6FB, 0xE73C, 0xDEFB, 0xDEFB, 0xE6FB, 0xE73C, 0xDEDA,
+0xDEDB, 0xDEFB, 0xE73C, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71C, 0xE71C, 0xE71B, 0xDEFB, 0xDEDA, 0xD6BA, 0xDEDA, 0xDEDB,
+0x8004, 0xDEFB, 0x0007, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0x8003, 0xE71C, 0x0001, 0xE73C, 0x8004, 0xE71C,
+0x0003, 0xE71B, 0xE71B, 0xE6FB, 0x8004, 0xDEFB, 0x0009, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB, 0xF79D,
+0x8007, 0xF79E, 0x0001, 0xF7BE, 0x8003, 0xFFBE, 0x0008, 0xF7BE, 0xF79E, 0xF77D, 0xEF7D, 0xEF5D, 0xEF7D, 0xF79D, 0xF79E, 0x8004,
+0xF7BE, 0x0002, 0xFFBE, 0xFFDE, 0x8003, 0xFFBE, 0x0003, 0xFFDE, 0xFFDE, 0xFFBE, 0x8004, 0xFFDE, 0x8005, 0xF7BE, 0x0005, 0xFFDE,
+0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF, 0x8032, 0xFFFF, 0x0003, 0xF7BE, 0xF79E, 0xEF7D, 0x8003, 0xEF5C, 0x000A, 0xE73C, 0xE71B, 0xDEDA,
+0xDEFB, 0xDEFB, 0xDEDA, 0xD6B9, 0xD699, 0xD679, 0xD699, 0x8003, 0xCE59, 0x003C, 0xD679, 0xD679, 0xD699, 0xDEBA, 0xDEBA, 0xDEDA,
+0xE71B, 0xE6FB, 0xE6FB, 0xE71C, 0xEF3C, 0xEF3D, 0xEF5D, 0xE73C, 0xE73C, 0xE71B, 0xE71C, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xE73C,
+0xEF5D, 0xE71B, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xDEDB, 0xE71C, 0xE71C, 0xE73C, 0xDEFB, 0xE71C, 0xDEFB,
+0xDEFB, 0xE73C, 0xE71B, 0xE71B, 0xE73C, 0xDEDB, 0xDEDB, 0xE73C, 0xE71C, 0xDEDB, 0xE73C, 0xDEDB, 0xDEFB, 0xDEBA, 0xE6FB, 0xDEDB,
+0xDEFB, 0xDEDB, 0xDEFB, 0xDEDB, 0xE71C, 0xE6FB, 0x8009, 0xDEFB, 0x8005, 0xE71B, 0x8003, 0xE6FB, 0x0002, 0xE71B, 0xE71B, 0x8004,
+0xE6FB, 0x0002, 0xDEFB, 0xDEFB, 0x8003, 0xE71B, 0x0009, 0xE6FB, 0xDEFB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEFB, 0xDEFB, 0xDEDA,
+0x8003, 0xD6BA, 0x0007, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xF79D, 0xF79D, 0x8003, 0xF7BE, 0x0003, 0xF79E, 0xF79D, 0xF79D,
+0x8003, 0xF7BE, 0x0003, 0xF79E, 0xF79D, 0xF79D, 0x8005, 0xF79E, 0x8003, 0xF7BE, 0x8003, 0xFFBE, 0x000C, 0xFFDE, 0xFFDE, 0xFFBE,
+0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79D, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0x8003, 0xFFFF, 0x0004, 0xF7BE, 0xFFDE, 0xFFDE, 0xFFDF,
+0x8033, 0xFFFF, 0x0004, 0xFFFE, 0xFFDF, 0xFFDF, 0xF7BE, 0x8003, 0xF79D, 0x0006, 0xF77D, 0xEF5C, 0xEF7C, 0xE73C, 0xE6FB, 0xDEDA,
+0x8004, 0xDEFB, 0x0005, 0xDEDA, 0xDEDB, 0xE6FB, 0xE6FB, 0xDEDB, 0x8003, 0xE6FB, 0x0021, 0xE73C, 0xEF5C, 0xEF5D, 0xEF5C, 0xE73C,
+0xEF5D, 0xF77E, 0xEF3C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xE73C, 0xE71C, 0xEF5C, 0xEF5D, 0xE73C, 0xEF3C, 0xDEFB, 0xE73C, 0xE73C,
+0xE71C, 0xE6FB, 0xE73C, 0xE73C, 0xDEFB, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xE71B, 0xE71B, 0x8004, 0xDEFB, 0x8003, 0xE71B,
+0x000F, 0xEF5D, 0xE6FB, 0xE71B, 0xDEDA, 0xEF3C, 0xDEFB, 0xE71B, 0xDEFB, 0xE71B, 0xE71B, 0xDEDB, 0xE71C, 0xDEFB, 0xE71B, 0xDEDB,
+0x8003, 0xDEFB, 0x000A, 0xDEDB, 0xDEDA, 0xDEDB, 0xDEFB, 0xDEFB, 0xE6FB, 0xDEDA, 0xDEBA, 0xD6BA, 0xD6BA, 0x8003, 0xDEDA, 0x0001,
+0xDEBA, 0x8004, 0xDEFB, 0x0001, 0xE71B, 0x8003, 0xE71C, 0x0004, 0xDEFB, 0xDEFB, 0xE71B, 0xDEFB, 0x8003, 0xDEDB, 0x0004, 0xDEFB,
+0xE71C, 0xE71B, 0xDEFB, 0x8003, 0xDEDB, 0x8004, 0xDEFB, 0x0004, 0xDEDA, 0xD6BA, 0xF79E, 0xF79E, 0x8004, 0xF79D, 0x0002, 0xF7BE,
+0xF7BE, 0x8005, 0xF79D, 0x0006, 0xF79E, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFDE, 0xFFBE, 0x8005, 0xF7BE, 0x000C, 0xFFFF, 0xFFFF, 0xFFDF,
+0xF7BE, 0xF79E, 0xF7BE, 0xFFBE, 0xFFDE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0x8003, 0xF7BE, 0x0001, 0xFFDE, 0x8003, 0xFFDF, 0x0007,
+0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF7BE, 0xFFDF, 0xFFDF, 0x8026, 0xFFFF, 0x0001, 0xFFDF, 0x8007, 0xFFFF, 0x0001, 0xFFDF, 0x8004,
+0xFFDE, 0x0003, 0xF7BE, 0xF77D, 0xEF7C, 0x8003, 0xEF7D, 0x002D, 0xEF5C, 0xEF3C, 0xE73C, 0xE73C, 0xEF3C, 0xE71C, 0xE71C, 0xEF3C,
+0xEF5D, 0xEF5C, 0xEF3C, 0xEF3C, 0xEF5D, 0xEF3C, 0xF79D, 0xEF5D, 0xEF3C, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5C, 0xEF5C, 0xEF5D, 0xEF7D,
+0xEF7D, 0xE73C, 0xE71C, 0xEF3C, 0xEF5C, 0xEF5D, 0xE6FB, 0xE73C, 0xE73C, 0xE71B, 0xE73C, 0xDEFB, 0xE71C, 0xE71B, 0xE73C, 0xE73C,
+0xDEFB, 0xE73C, 0xDEFB, 0xE71B, 0xE71C, 0x8006, 0xDEFB, 0x0011, 0xE71B, 0xDEFB, 0xDEFB, 0xE71C, 0xE6FB, 0xE73C, 0xDEDB, 0xE71B,
+0xDEFB, 0xE71C, 0xDEDB, 0xDEFB, 0xE6FB, 0xDEDB, 0xDEFB, 0xE71B, 0xE71C, 0x8003, 0xE6FB, 0x8005, 0xDEFB, 0x0004, 0xDEDB, 0xE71B,
+0xDEFB, 0xDEFB, 0x8004, 0xDEDB, 0x0001, 0xDEDA, 0x8003, 0xE71C, 0x8004, 0xE71B, 0x0020, 0xE6FB, 0xDEFB, 0xDEDA, 0xD6BA, 0xDEFB,
+0xEF5C, 0xEF7D, 0xEF5C, 0xE71B, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEBA, 0xDEDA, 0xDEDB, 0xDEFB, 0xE71B, 0xE71B, 0xE6FB, 0xDEFB,
+0xEF5D, 0xF77D, 0xF7BE, 0xFFDE, 0xFFDE, 0xF7BE, 0xF79D, 0xEF7D, 0xEF7D, 0xF79D, 0xF79D, 0x8003, 0xF79E, 0x8007, 0xF7BE, 0x0015,
+0xF79E, 0xF79D, 0xEF7D, 0xF79E, 0xF7BE, 0xFFDE, 0xFFDF, 0xFFDF, 0xFFDE, 0xF7BE, 0xF79E, 0xF79D, 0xF79E, 0xF79E, 0xF79D, 0xF79E,
+0xF7BE, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0x8003, 0xFFDF, 0x0002, 0xFFDE, 0xFFFF, 0x8003, 0xFFDF, 0x802F, 0xFFFF, 0x8004, 0xFFDE,
+0x004B, 0xFFBE, 0xF7BE, 0xF7BE, 0xEF7D, 0xF79D, 0xF7BE, 0xF7BE, 0xF79E, 0xF79D, 0xEF7D, 0xEF7D, 0xF77D, 0xEF7D, 0xF77D, 0xF79D,
+0xF79D, 0xEF7D, 0xEF7D, 0xF79D, 0xF77E, 0xEF7D, 0xEF7D, 0xF77D, 0xEF5D, 0xEF7D, 0xF77D, 0xE73C, 0xEF5D, 0xEF5C, 0xE73C, 0xEF5D,
+0xEF5D, 0xEF5C, 0xEF5C, 0xE73C, 0xEF5C, 0xE6FB, 0xEF3C, 0xE73C, 0xDEFB, 0xE73C, 0xE6FB, 0xE71B, 0xE71B, 0xE71C, 0xE71C, 0xEF5C,
+0xDEDB, 0xE71B, 0xE71C, 0xE71C, 0xDEFB, 0xE71C, 0xE71B, 0xE73C, 0xE73C, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEFB, 0xE71B, 0xE73C, 0xE71B,
+0xE71B, 0xDEFB, 0xE6FB, 0xE6FB, 0xEF5C, 0xDEFB, 0xE71B, 0xE71C, 0xE73C, 0xDEBA, 0xDEDB, 0xE71B, 0x8006, 0xDEFB, 0x0002, 0xDEDA,
+0xDEBA, 0x8003, 0xDEDA, 0x0003, 0xDEDB, 0xDEFB, 0xE71B, 0x8003, 0xE71C, 0x000C, 0xE71B, 0xE71B, 0xDEFB, 0xDEDB, 0xDEDA, 0xDEBA,
+0xD6BA, 0xDEFB, 0xE6FB, 0xE71B, 0xE71B, 0xE6FB, 0x8006, 0xDEFB, 0x0009, 0xDEDB, 0xDEDA, 0xDEBA, 0xDEBA, 0xDEDA, 0xD6BA, 0xDEBA,
+0xDEDB, 0xDEFB, 0x806F, 0xFFFF, 0x0001, 0xFFDF, 0x8006, 0xFFFF, 0x8003, 0xFFDF, 0x0002, 0xFFFF, 0xFFDF, 0x8003, 0xFFFF, 0x0001,
+0xFFDE, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8005, 0xFFFF, 0x0001, 0xFFDF, 0x8011, 0xFFFF, 0x0004, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF,
+0x8009, 0xFFFF, 0x0001, 0xFFDF, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8028, 0xFFFF, 0x8008, 0x0000,
 };
+
+const Graphics_RLEImage pong = { 220, 150, 24444, pong_data };
@@ -1,12 +1,15 @@
 /* 
  * pong.h
  * 
- * An image of the DE1-SoC Board.
+ * Run-length encoded splash image of the game, drawn with Graphics_drawImageRLE().
+ * Regenerate pong.c with Tools/RLE565_Image_Converter.py.
  */
 
 #ifndef PONG_H_
 #define PONG_H_
 
-extern const unsigned short pong[76800];
+#include "Graphics_Engine/Graphics_Engine.h"
+
+extern const Graphics_RLEImage pong;
 
 #endif /* PONG_H_ */
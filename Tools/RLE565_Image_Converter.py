@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+############################################################################
+#
+#  Run-Length Encoded RGB565 Image Converter for PONG.
+#  ----------------------------------------
+#  File Name     : RLE565_Image_Converter.py
+#  Target Device : Host PC (Python 3)
+#
+#  Code Author(s): Nuo, Sanjith Chandran & Shrajan Bhandary
+#  Location      : University of Leeds
+#  Module        : ELEC5620M Embedded Microprocessor System Design
+#
+#  Description of the file:
+#      Converts an image into the run-length encoded RGB565 stream that is
+#      decoded by Graphics_drawImageRLE() straight into an LT24 window.
+#      The input can be any image that Pillow can open, or a C file that
+#      was produced by "ImageConverter 565 Online" (the format of the
+#      original pong.c splash image).
+#
+#      Stream format (all words are 16 bits):
+#          0x8000 | n, colour        -> n copies of colour       (run)
+#          n, colour_1 ... colour_n  -> n raw colours            (literal)
+#      where 1 <= n <= 0x7FFF.
+#
+#  Usage:
+#      python3 RLE565_Image_Converter.py pong.jpg pong -o pong.c
+#      python3 RLE565_Image_Converter.py old_pong.c pong --size 220x150 -o pong.c
+#
+############################################################################
+
+import argparse
+import re
+import sys
+
+MAX_COUNT = 0x7FFF          # Largest count that fits next to the run flag.
+RUN_FLAG = 0x8000           # Top bit marks a run token.
+MINIMUM_RUN = 3             # Shorter runs are cheaper to keep as literals.
+
+
+def rgb888_to_rgb565(red, green, blue):
+    """Pack an 8-bit per channel colour the same way as LT24_makeColour()."""
+    return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3)
+
+
+def load_image(path):
+    """Load an image with Pillow and return (width, height, pixels)."""
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("Pillow is required to read '%s' (pip install Pillow)." % path)
+
+    image = Image.open(path).convert("RGB")
+    width, height = image.size
+    pixels = [rgb888_to_rgb565(*pixel) for pixel in image.getdata()]
+    return width, height, pixels
+
+
+def load_c_array(path, size):
+    """Load the pixels from an ImageConverter 565 C array."""
+    text = open(path).read()
+    text = re.sub(r"//.*", "", text)                        # Drop the per-line pixel count comments.
+    body = text[text.index("{") + 1:text.rindex("}")]
+    pixels = [int(value, 16) for value in re.findall(r"0x([0-9A-Fa-f]{1,4})", body)]
+
+    if size is None:
+        match = re.search(r"\[(\d+)\]", text)
+        sys.exit("--size WIDTHxHEIGHT is required for C input (array holds %s entries)."
+                 % (match.group(1) if match else "an unknown number of"))
+
+    width, height = size
+    if len(pixels) > width * height:
+        sys.exit("'%s' holds %d pixels, more than %dx%d." % (path, len(pixels), width, height))
+
+    pixels += [0] * (width * height - len(pixels))          # Missing initialisers are zero in C.
+    return width, height, pixels
+
+
+def encode(pixels):
+    """Run-length encode a list of RGB565 pixels into a list of 16-bit words."""
+    words = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_COUNT]
+            del literal[:MAX_COUNT]
+            words.append(len(chunk))
+            words.extend(chunk)
+
+    index = 0
+    while index < len(pixels):
+        end = index
+        while end < len(pixels) and pixels[end] == pixels[index] and end - index < MAX_COUNT:
+            end += 1
+
+        if end - index >= MINIMUM_RUN:
+            flush_literal()
+            words.append(RUN_FLAG | (end - index))
+            words.append(pixels[index])
+            index = end
+        else:
+            literal.append(pixels[index])
+            index += 1
+
+    flush_literal()
+    return words
+
+
+def decode(words):
+    """Reference decoder, used to verify the encoded stream before writing it."""
+    pixels = []
+    index = 0
+    while index < len(words):
+        token = words[index]
+        count = token & MAX_COUNT
+        if token & RUN_FLAG:
+            pixels.extend([words[index + 1]] * count)
+            index += 2
+        else:
+            pixels.extend(words[index + 1:index + 1 + count])
+            index += 1 + count
+    return pixels
+
+
+def write_c_file(out, name, source, width, height, words):
+    out.write("// Generated by   : RLE565_Image_Converter.py\n")
+    out.write("// Generated from : %s\n" % source)
+    out.write("// Image Size     : %dx%d pixels\n" % (width, height))
+    out.write("// Memory usage   : %d bytes (%d bytes uncompressed)\n\n"
+              % (len(words) * 2, width * height * 2))
+    out.write("#include \"Graphics_Engine/Graphics_Engine.h\"\n\n")
+    out.write("static const unsigned short %s_data[%d] = {\n" % (name, len(words)))
+    for start in range(0, len(words), 16):
+        line = ", ".join("0x%04X" % word for word in words[start:start + 16])
+        out.write("%s,\n" % line)
+    out.write("};\n\n")
+    out.write("const Graphics_RLEImage %s = { %d, %d, %d, %s_data };\n"
+              % (name, width, height, len(words), name))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert an image into an RLE RGB565 C array.")
+    parser.add_argument("input", help="image file, or ImageConverter 565 .c file")
+    parser.add_argument("name", help="C identifier of the generated Graphics_RLEImage")
+    parser.add_argument("-o", "--output", help="output .c file (default: stdout)")
+    parser.add_argument("--size", help="WIDTHxHEIGHT, required for .c input")
+    args = parser.parse_args()
+
+    size = None
+    if args.size:
+        size = tuple(int(value) for value in args.size.lower().split("x"))
+
+    if args.input.endswith(".c"):
+        width, height, pixels = load_c_array(args.input, size)
+    else:
+        width, height, pixels = load_image(args.input)
+
+    words = encode(pixels)
+    if decode(words) != pixels:
+        sys.exit("Internal error: encoded stream does not decode to the input image.")
+
+    if args.output:
+        with open(args.output, "w") as out:
+            write_c_file(out, args.name, args.input.split("/")[-1], width, height, words)
+    else:
+        write_c_file(sys.stdout, args.name, args.input.split("/")[-1], width, height, words)
+
+    sys.stderr.write("%dx%d: %d -> %d bytes (%.1f%%)\n"
+                     % (width, height, width * height * 2, len(words) * 2,
+                        100.0 * len(words) / (width * height)))
+
+
+if __name__ == "__main__":
+    main()